@@ -70,6 +70,13 @@ namespace solv
 template <int DIM, class TYPE>
 class SAMRAIVectorReal;
 } // namespace solv
+namespace xfer
+{
+template <int DIM>
+class RefineAlgorithm;
+template <int DIM>
+class RefineSchedule;
+} // namespace xfer
 } // namespace SAMRAI
 
 /////////////////////////////// CLASS DEFINITION /////////////////////////////
@@ -99,6 +106,19 @@ namespace IBTK
  * By default, the class is configured to solve the Poisson problem \f$
  * -\nabla^2 u = f \f$, subject to homogeneous Dirichlet boundary conditions.
  *
+ * The \c "CHEBYSHEV" smoother performs Jacobi-preconditioned Chebyshev
+ * iteration targeting the eigenvalues of \f$ \mbox{diag}(L)^{-1} L \f$ that
+ * lie in [chebyshev_eig_lower_bound, chebyshev_eig_upper_bound].  Each sweep is
+ * a pointwise update that is threaded across the patches of a level.  When
+ * chebyshev_sweeps_per_ghost_fill = \f$ k > 1 \f$, the smoother keeps \f$ k
+ * \f$ layers of ghost cells and performs \f$ k \f$ sweeps per ghost cell
+ * exchange by redundantly updating the ghost cells that are covered by
+ * neighboring patches.  Values at physical and coarse-fine boundaries are reset
+ * locally after each sweep, so the smoother remains a fixed linear operator; it
+ * reduces to an overlapping block Chebyshev smoother only where the level
+ * boundary passes within \f$ k \f$ cells of a patch corner.  With a variable
+ * diffusion coefficient, ghost cell values are exchanged after every sweep.
+ *
  * Sample parameters for initialization from database (and their default
  * values): \verbatim
 
@@ -109,6 +129,9 @@ namespace IBTK
  coarse_solver_rel_residual_tol = 1.0e-5      // see setCoarseSolverRelativeTolerance()
  coarse_solver_abs_residual_tol = 1.0e-50     // see setCoarseSolverAbsoluteTolerance()
  coarse_solver_max_iterations = 1             // see setCoarseSolverMaxIterations()
+ chebyshev_eig_lower_bound = 1/NDIM           // lower end of the damped spectrum
+ chebyshev_eig_upper_bound = 2.0              // upper end of the damped spectrum
+ chebyshev_sweeps_per_ghost_fill = 1          // Chebyshev sweeps per ghost cell exchange
  coarse_solver_db {                           // SAMRAI::tbox::Database for initializing coarse
  level solver
     solver_type = "PFMG"
@@ -157,6 +180,7 @@ public:
      * - \c "PATCH_GAUSS_SEIDEL"
      * - \c "PROCESSOR_GAUSS_SEIDEL"
      * - \c "RED_BLACK_GAUSS_SEIDEL"
+     * - \c "CHEBYSHEV"
      */
     void setSmootherType(const std::string& smoother_type);
 
@@ -264,6 +288,14 @@ private:
      */
     CCPoissonPointRelaxationFACOperator& operator=(const CCPoissonPointRelaxationFACOperator& that);
 
+    /*!
+     * \brief Perform a given number of Chebyshev sweeps on the error.
+     */
+    void smoothErrorChebyshev(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& error,
+                              const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& residual,
+                              int level_num,
+                              int num_sweeps);
+
     /*
      * Coarse level solvers and solver parameters.
      */
@@ -275,6 +307,18 @@ private:
      */
     std::vector<std::vector<SAMRAI::hier::BoxList<NDIM> > > d_patch_bc_box_overlap;
     std::vector<std::vector<std::map<int, SAMRAI::hier::Box<NDIM> > > > d_patch_neighbor_overlap;
+
+    /*
+     * Chebyshev smoother parameters and data.
+     */
+    double d_chebyshev_eig_lower_bound, d_chebyshev_eig_upper_bound;
+    int d_chebyshev_sweeps_per_ghost_fill;
+    int d_chebyshev_sol_idx, d_chebyshev_rhs_idx, d_chebyshev_dir_idx;
+    std::vector<std::vector<SAMRAI::hier::BoxList<NDIM> > > d_patch_chebyshev_update_boxes;
+    SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineAlgorithm<NDIM> > d_chebyshev_init_refine_algorithm,
+        d_chebyshev_update_refine_algorithm;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > > d_chebyshev_init_refine_schedules,
+        d_chebyshev_update_refine_schedules;
 };
 } // namespace IBTK
 
@@ -202,6 +202,20 @@ public:
     void initializeSolverState(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
                                const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b);
 
+    /*!
+     * \brief Refresh the coefficient-dependent data required by the solver.
+     *
+     * The FAC strategy object refreshes its state via
+     * FACPreconditionerStrategy::reinitializeOperatorState().  Temporary
+     * vectors are reused.
+     *
+     * \note If the solver state is not initialized, or if the hierarchy
+     * configuration has changed, the solver state is fully reinitialized via
+     * initializeSolverState().
+     */
+    void reinitializeSolverState(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                                 const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b);
+
     /*!
      * \brief Remove all hierarchy dependent data allocated by
      * initializeSolverState().
@@ -214,6 +214,15 @@ public:
     virtual void initializeOperatorState(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& solution,
                                          const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& rhs);
 
+    /*!
+     * \brief Refresh any coefficient-dependent data while reusing the
+     * hierarchy-dependent data set up by initializeOperatorState().
+     *
+     * The default implementation simply calls initializeOperatorState().
+     */
+    virtual void reinitializeOperatorState(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& solution,
+                                           const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& rhs);
+
     /*!
      * \brief Deallocate any hierarchy-dependent data initialized by
      * initializeOperatorState().
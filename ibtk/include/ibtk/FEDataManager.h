@@ -57,8 +57,10 @@
 #include "ibtk/ibtk_utilities.h"
 #include "libmesh/dof_map.h"
 #include "libmesh/elem.h"
+#include "libmesh/enum_elem_type.h"
 #include "libmesh/enum_order.h"
 #include "libmesh/enum_quadrature_type.h"
+#include "libmesh/fe_type.h"
 #include "libmesh/system.h"
 #include "tbox/Pointer.h"
 #include "tbox/Serializable.h"
@@ -84,6 +86,9 @@ namespace libMesh
 {
 class Elem;
 class EquationSystems;
+template <typename OutputType>
+class FEGenericBase;
+typedef FEGenericBase<Real> FEBase;
 class QBase;
 template <typename T>
 class LinearSolver;
@@ -139,6 +144,106 @@ public:
         boost::unordered_map<libMesh::dof_id_type, std::vector<std::vector<unsigned int> > > d_dof_cache;
     };
 
+    /*!
+     * \brief Class QuadratureCache stores the data required to evaluate
+     * element quadrature rules for a single finite element type so that it may
+     * be reused across elements and across time steps.
+     *
+     * For Lagrange finite element families, shape function values depend only
+     * on the element type and on the quadrature rule, and so they are computed
+     * once for each combination of element type, p-refinement level,
+     * quadrature type, and quadrature order.  For other families, the shape
+     * functions may also depend on the element (e.g., on the orientation of its
+     * edges), and so they are recomputed for each element.  Values of JxW depend on the geometry of the
+     * element in the reference configuration and are cached element by
+     * element, for at most a few quadrature rules per element.  The caches
+     * are reset by reinitElementMappings(), so that only elements that are
+     * active on this processor since the last regrid are retained.
+     *
+     * \note Cached JxW values are not recomputed if the nodes of the libMesh
+     * mesh are moved.  FEDataManager::clearQuadratureCache() must be called if
+     * the reference configuration of the mesh is modified.
+     */
+    class QuadratureCache
+    {
+    public:
+        /*!
+         * \brief Struct QuadratureData stores the quadrature rule, the shape
+         * function values, and the number of quadrature points associated
+         * with a particular reference element.
+         */
+        struct QuadratureData
+        {
+            libMesh::UniquePtr<libMesh::QBase> qrule;
+            libMesh::UniquePtr<libMesh::FEBase> fe;
+            std::vector<std::vector<double> > phi;
+            unsigned int n_qp;
+        };
+
+        /*!
+         * \brief Constructor.
+         */
+        QuadratureCache(unsigned int dim, const libMesh::FEType& fe_type);
+
+        /*!
+         * \brief Destructor.
+         */
+        ~QuadratureCache();
+
+        /*!
+         * \return The quadrature data associated with the specified element
+         * and quadrature rule, which is computed if it is not already cached.
+         */
+        const QuadratureData&
+        getQuadratureData(const libMesh::Elem* elem, libMesh::QuadratureType type, libMesh::Order order);
+
+        /*!
+         * \return The values of the shape functions for the specified element
+         * at the quadrature points of the specified quadrature rule.
+         *
+         * \note For finite element families other than Lagrange, the returned
+         * reference remains valid only until the next call to getPhi() or
+         * getJxW() for the same quadrature data.
+         */
+        const std::vector<std::vector<double> >& getPhi(const libMesh::Elem* elem, const QuadratureData& quad_data);
+
+        /*!
+         * \return The values of JxW for the specified element at the
+         * quadrature points of the specified quadrature rule.
+         *
+         * \note The returned reference remains valid until the next call to
+         * getJxW() for the same element.
+         */
+        const std::vector<double>& getJxW(const libMesh::Elem* elem, const QuadratureData& quad_data);
+
+        /*!
+         * \brief Clear all cached data.
+         */
+        void clear();
+
+    private:
+        struct Key
+        {
+            libMesh::ElemType elem_type;
+            unsigned int p_level;
+            libMesh::QuadratureType quad_type;
+            libMesh::Order quad_order;
+
+            bool operator<(const Key& that) const;
+        };
+
+        QuadratureCache(const QuadratureCache& from);
+        QuadratureCache& operator=(const QuadratureCache& that);
+
+        typedef std::vector<std::pair<const QuadratureData*, std::vector<double> > > ElemJxWCache;
+
+        const unsigned int d_dim;
+        const libMesh::FEType d_fe_type;
+        const bool d_share_phi;
+        std::map<Key, QuadratureData*> d_quad_data;
+        boost::unordered_map<libMesh::dof_id_type, ElemJxWCache> d_JxW_cache;
+    };
+
     /*!
      * \brief Struct InterpSpec encapsulates data needed to specify the manner
      * in which Eulerian-to-Lagrangian interpolation is performed when using an
@@ -320,6 +425,19 @@ public:
      */
     SystemDofMapCache* getDofMapCache(unsigned int system_num);
 
+    /*!
+     * \return The QuadratureCache for a specified finite element type.
+     */
+    QuadratureCache* getQuadratureCache(const libMesh::FEType& fe_type);
+
+    /*!
+     * \brief Clear all cached quadrature data.
+     *
+     * \note This must be called if the nodes of the libMesh mesh (i.e., the
+     * reference configuration of the structure) are moved.
+     */
+    void clearQuadratureCache();
+
     /*!
      * \return The level number to which the equations system object managed by
      * the FEDataManager is assigned.
@@ -522,6 +640,20 @@ public:
                              double tol = 1.0e-6,
                              unsigned int max_its = 100);
 
+    /*!
+     * \return The order of the quadrature rule to use for the current element.
+     * If adaptive quadrature is enabled, the order is determined from the size
+     * of the element in the current configuration relative to the grid
+     * spacing; otherwise, quad_order is returned.
+     */
+    static libMesh::Order getQuadratureOrder(libMesh::QuadratureType quad_type,
+                                             libMesh::Order quad_order,
+                                             bool use_adaptive_quadrature,
+                                             double point_density,
+                                             const libMesh::Elem* elem,
+                                             const boost::multi_array<double, 2>& X_node,
+                                             double dx_min);
+
     /*!
      * Update the quarature rule for the current element.  If the provided
      * qrule is already configured appropriately, it is not modified.
@@ -830,6 +962,7 @@ private:
     libMesh::EquationSystems* d_es;
     int d_level_number;
     std::map<unsigned int, SAMRAI::tbox::Pointer<SystemDofMapCache> > d_system_dof_map_cache;
+    std::map<libMesh::FEType, SAMRAI::tbox::Pointer<QuadratureCache> > d_quadrature_cache;
 
     /*
      * Data to manage mappings between mesh elements and grid patches.
@@ -223,6 +223,29 @@ public:
     virtual void initializeSolverState(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
                                        const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b);
 
+    /*!
+     * \brief Refresh the numerical data required for solving \f$F[x]=b\f$
+     * following a change in the problem coefficients (e.g., the time step
+     * size) but not in the hierarchy configuration.
+     *
+     * Subclasses may override this method to update coefficient-dependent data
+     * (e.g., matrix entries and preconditioner factorizations) in place, while
+     * reusing structural data such as DOF index maps, sparsity patterns,
+     * subdomain decompositions, and communication schedules that were set up by
+     * a previous call to initializeSolverState().
+     *
+     * \note Subclasses are required to be implemented so that it is safe to
+     * call reinitializeSolverState() when the solver state is not initialized
+     * or when the hierarchy configuration has changed.  In this case, the
+     * solver state should be fully reinitialized.
+     *
+     * \note The default implementation simply calls initializeSolverState().
+     *
+     * \see initializeSolverState
+     */
+    virtual void reinitializeSolverState(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                                         const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b);
+
     /*!
      * \brief Remove all hierarchy dependent data allocated by
      * initializeSolverState().
@@ -284,6 +284,12 @@ public:
 
     /*!
      * \brief Begin updating ghost values.
+     *
+     * Work that does not depend on the ghost values may be done before the
+     * matching call to endGhostUpdate().  In the meantime, the local values
+     * may be read through the global vector (e.g., via VecGetArrayRead()),
+     * but they must not be modified, and the ghosted local form must not be
+     * accessed.
      */
     void beginGhostUpdate();
 
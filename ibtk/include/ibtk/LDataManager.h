@@ -205,6 +205,26 @@ public:
      */
     const std::string& getDefaultSpreadKernelFunction() const;
 
+    /*!
+     * \brief Set whether the local nodes of each patch are stored in the
+     * Morton (Z-order) ordering of the grid cells that contain them.
+     *
+     * With this ordering, the Lagrangian data owned by each patch is contiguous
+     * in memory and is traversed in a spatially coherent order by the
+     * interpolation and spreading operators.  Nodes that remain in the same
+     * grid cell between redistributions retain their relative ordering.
+     *
+     * \note The new ordering takes effect at the next redistribution of the
+     * Lagrangian data.
+     */
+    void setUseMortonNodeOrdering(bool use_morton_node_ordering);
+
+    /*!
+     * \brief Return whether the local nodes of each patch are stored in the
+     * Morton ordering of the grid cells that contain them.
+     */
+    bool getUseMortonNodeOrdering() const;
+
     /*!
      * \brief Spread a quantity from the Lagrangian mesh to the Eulerian grid
      * using the default spreading kernel function.
@@ -399,6 +419,11 @@ public:
      *
      * Unlike the standard regularized delta function spreading operation, the
      * implemented operation spreads values, \em NOT densities.
+     *
+     * \note When ghost node updates are requested, the nodes in the patch
+     * interiors are spread while the ghost node values are communicated, and
+     * the nodes in the patch ghost cell regions are spread once the updates
+     * complete.
      */
     void spread(int f_data_idx,
                 std::vector<SAMRAI::tbox::Pointer<LData> >& F_data,
@@ -445,6 +470,10 @@ public:
     /*!
      * \brief Interpolate a quantity from the Eulerian grid to the Lagrangian
      * mesh using the default interpolation kernel function.
+     *
+     * \note Only the local values of X_data are read, so a ghost update of
+     * X_data may be in progress when this function is called.  Only the local
+     * values of F_data are set.
      */
     void interp(int f_data_idx,
                 std::vector<SAMRAI::tbox::Pointer<LData> >& F_data,
@@ -1108,6 +1137,12 @@ private:
      */
     bool d_error_if_points_leave_domain;
 
+    /*
+     * Whether to order the local nodes of each patch by the Morton index of
+     * the grid cells that contain them.
+     */
+    bool d_use_morton_node_ordering;
+
     /*
      * SAMRAI::hier::IntVector object that determines the ghost cell width of
      * the LNodeData SAMRAI::hier::PatchData objects.
@@ -104,6 +104,37 @@ public:
 
     /*!
      * \brief Set configuration options from a user-supplied database.
+     *
+     * The following options are recognized:
+     *  - \p use_kernel_engine: use the vectorized C++ kernel engine (see class
+     *    LEKernelEngine) in place of the Fortran kernels for those kernel
+     *    functions supported by the engine (default FALSE)
+     *  - \p cache_kernel_weights: reuse stencil weights between interpolation
+     *    and spreading operations at the same marker configuration (default
+     *    FALSE)
+     *  - \p max_kernel_weight_cache_size: maximum number of cached weight
+     *    configurations (default 256)
+     *  - \p deterministic_mode: only use kernel engine implementations that
+     *    are bitwise identical to the Fortran kernels (default FALSE)
+     *  - \p use_threaded_spreading: when IBTK is compiled with OpenMP, spread
+     *    the markers of each patch using multiple threads (default FALSE)
+     *  - \p use_threaded_interpolation: when IBTK is compiled with OpenMP,
+     *    interpolate to the markers of each patch using multiple threads
+     *    (default FALSE)
+     *  - \p min_threaded_markers: minimum number of markers in a patch for
+     *    which threading is used (default 1024)
+     *
+     * Threaded spreading bins the markers into tiles that are wider than the
+     * kernel stencil and processes the tiles in \f$2^{\mathrm{NDIM}}\f$
+     * colored sweeps, so that no two threads update the same grid value at
+     * the same time.  The order in which values are accumulated is
+     * independent of the number of threads, although it generally differs
+     * from the serial ordering.
+     *
+     * \note Threads are only used for kernel functions that are handled by the
+     * C++ kernel engine, i.e., when \p use_kernel_engine is enabled.  All
+     * other kernel functions are evaluated serially by the Fortran kernels,
+     * which are not guaranteed to be reentrant.
      */
     static void setFromDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
 
@@ -1288,6 +1319,47 @@ private:
                        const std::string& spread_fcn,
                        int axis = 0);
 
+    /*!
+     * Threaded implementation of the IB interpolation operation.
+     */
+    static void threadedInterpolate(double* Q_data,
+                                    int Q_depth,
+                                    const double* X_data,
+                                    const double* q_data,
+                                    const SAMRAI::hier::Box<NDIM>& q_data_box,
+                                    const SAMRAI::hier::IntVector<NDIM>& q_gcw,
+                                    int q_depth,
+                                    const double* x_lower,
+                                    const double* x_upper,
+                                    const double* dx,
+                                    const boost::array<int, NDIM>& patch_touches_lower_physical_bdry,
+                                    const boost::array<int, NDIM>& patch_touches_upper_physical_bdry,
+                                    const std::vector<int>& local_indices,
+                                    const std::vector<double>& periodic_shifts,
+                                    const std::string& interp_fcn,
+                                    int axis);
+
+    /*!
+     * Threaded implementation of the IB spreading operation using a colored
+     * tiling of the patch.
+     */
+    static void threadedSpread(double* q_data,
+                               const SAMRAI::hier::Box<NDIM>& q_data_box,
+                               const SAMRAI::hier::IntVector<NDIM>& q_gcw,
+                               int q_depth,
+                               const double* Q_data,
+                               int Q_depth,
+                               const double* X_data,
+                               const double* x_lower,
+                               const double* x_upper,
+                               const double* dx,
+                               const boost::array<int, NDIM>& patch_touches_lower_physical_bdry,
+                               const boost::array<int, NDIM>& patch_touches_upper_physical_bdry,
+                               const std::vector<int>& local_indices,
+                               const std::vector<double>& periodic_shifts,
+                               const std::string& spread_fcn,
+                               int axis);
+
     /*!
      * \brief Compute the local PETSc indices located within the provided box
      * based on the LNodeIndexSetData values.
@@ -1345,6 +1417,20 @@ private:
                                   const int* local_indices,
                                   const double* X_shift,
                                   int num_local_indices);
+
+    /*!
+     * \brief Whether to use the C++ kernel engine when it supports the
+     * requested kernel function.
+     */
+    static bool s_use_kernel_engine;
+
+    /*!
+     * \brief Whether to use threaded spreading and interpolation, and the
+     * minimum number of markers in a patch for which threads are used.
+     */
+    static bool s_use_threaded_spreading;
+    static bool s_use_threaded_interpolation;
+    static int s_min_threaded_markers;
 };
 } // namespace IBTK
 
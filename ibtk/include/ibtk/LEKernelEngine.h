@@ -0,0 +1,205 @@
+// Filename: LEKernelEngine.h
+// Created on 17 Oct 2026
+//
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_LEKernelEngine
+#define included_IBTK_LEKernelEngine
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <string>
+
+#include "Box.h"
+#include "IntVector.h"
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class LEKernelEngine provides C++ implementations of the IB
+ * interpolation and spreading operations for a subset of the kernel functions
+ * supported by class LEInteractor.
+ *
+ * Unlike the Fortran kernels, which evaluate the one-dimensional kernel weights
+ * marker by marker, this engine first computes the stencil origins and the
+ * one-dimensional weights for all markers in structure-of-arrays form using
+ * compile-time stencil widths, so that the weight evaluation vectorizes.  The
+ * tensor-product weights are then applied to the Cartesian grid data in a
+ * second pass.
+ *
+ * The stencil origins and weights optionally may be cached, so that a spreading
+ * operation that immediately follows an interpolation operation (or vice versa)
+ * at the same marker configuration reuses the previously computed weights.
+ * Cached weights are only reused when the patch data box, grid spacing, marker
+ * indices, and marker positions are all unchanged.  The cache is not used
+ * when the engine is called from within an OpenMP parallel region.
+ *
+ * In deterministic mode, the engine performs exactly the same sequence of
+ * floating point operations as the reference Fortran kernels, and so yields
+ * results that are bitwise identical to those kernels.  Kernel functions for
+ * which this cannot be guaranteed are not supported in deterministic mode.
+ * Otherwise, the engine is free to reorder operations (e.g., by folding the
+ * grid-cell volume scaling into the spread values).
+ *
+ * \note Class LEKernelEngine is used by class LEInteractor, and it usually
+ * should not be used directly.
+ */
+class LEKernelEngine
+{
+public:
+    /*!
+     * \brief Enable or disable caching of the stencil origins and weights.
+     */
+    static void setWeightCachingEnabled(bool enabled);
+
+    /*!
+     * \brief Indicate whether caching of the stencil origins and weights is
+     * enabled.
+     */
+    static bool getWeightCachingEnabled();
+
+    /*!
+     * \brief Set the maximum number of cached weight configurations.
+     */
+    static void setMaxWeightCacheSize(int max_cache_size);
+
+    /*!
+     * \brief Enable or disable deterministic mode.
+     */
+    static void setDeterministicMode(bool deterministic);
+
+    /*!
+     * \brief Indicate whether deterministic mode is enabled.
+     */
+    static bool getDeterministicMode();
+
+    /*!
+     * \brief Deallocate all cached stencil origins and weights.
+     */
+    static void clearWeightCache();
+
+    /*!
+     * \return A boolean indicating whether the engine provides an
+     * implementation of the specified kernel function in the current mode.
+     */
+    static bool isSupported(const std::string& kernel_fcn);
+
+    /*!
+     * \brief Interpolate data from an Eulerian grid patch to the specified
+     * Lagrangian markers.
+     *
+     * The arguments are interpreted in the same manner as those of the Fortran
+     * interpolation kernels used by class LEInteractor.
+     */
+    static void interpolate(double* Q_data,
+                            int Q_depth,
+                            const double* X_data,
+                            const double* q_data,
+                            const SAMRAI::hier::Box<NDIM>& q_data_box,
+                            const SAMRAI::hier::IntVector<NDIM>& q_gcw,
+                            int q_depth,
+                            const double* x_lower,
+                            const double* dx,
+                            const int* local_indices,
+                            const double* periodic_shifts,
+                            int num_local_indices,
+                            const std::string& interp_fcn);
+
+    /*!
+     * \brief Spread values from the specified Lagrangian markers to an
+     * Eulerian grid patch.
+     *
+     * The arguments are interpreted in the same manner as those of the Fortran
+     * spreading kernels used by class LEInteractor.
+     */
+    static void spread(double* q_data,
+                       const SAMRAI::hier::Box<NDIM>& q_data_box,
+                       const SAMRAI::hier::IntVector<NDIM>& q_gcw,
+                       int q_depth,
+                       const double* Q_data,
+                       int Q_depth,
+                       const double* X_data,
+                       const double* x_lower,
+                       const double* dx,
+                       const int* local_indices,
+                       const double* periodic_shifts,
+                       int num_local_indices,
+                       const std::string& spread_fcn);
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    LEKernelEngine();
+
+    /*!
+     * \brief Default destructor constructor.
+     *
+     * \note This destructor is not implemented and should not be used.
+     */
+    ~LEKernelEngine();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    LEKernelEngine(const LEKernelEngine& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    LEKernelEngine& operator=(const LEKernelEngine& that);
+
+    /*!
+     * Configuration options.
+     */
+    static bool s_cache_weights;
+    static int s_max_cache_size;
+    static bool s_deterministic;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_LEKernelEngine
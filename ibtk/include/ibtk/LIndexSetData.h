@@ -81,9 +81,16 @@ public:
 
     /*!
      * \brief Update the cached indexing data.
+     *
+     * If \a sort_by_local_petsc_index is true, the cached indices are stored
+     * in order of increasing local PETSc index, so that operations that loop
+     * over the cached indices access the corresponding Lagrangian data in
+     * memory order.  Otherwise, the indices are stored in the order in which
+     * the index sets are stored in the patch data.
      */
     void cacheLocalIndices(SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
-                           const SAMRAI::hier::IntVector<NDIM>& periodic_shift);
+                           const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                           bool sort_by_local_petsc_index = false);
 
     /*!
      * \return A constant reference to the set of Lagrangian data indices that
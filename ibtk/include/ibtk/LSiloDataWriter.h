@@ -35,6 +35,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <pthread.h>
 #include <map>
 #include <set>
 #include <string>
@@ -204,6 +205,47 @@ public:
      */
     void writePlotData(int time_step_number, double simulation_time);
 
+    /*!
+     * \brief Enable or disable asynchronous output.
+     *
+     * When asynchronous output is enabled, writePlotData() takes a snapshot of
+     * the plot data and returns once the data required by the root process has
+     * been communicated; the Silo files are written by a background thread.
+     * Pending output is completed by the next call to writePlotData(), by
+     * waitForPendingOutput(), or by the destructor.
+     *
+     * Errors encountered by the background thread are reported by the call
+     * that completes the pending output.  The destructor logs such errors
+     * instead of aborting.
+     *
+     * AppInitializer sets this option from the \p silo_asynchronous_output key
+     * of the \p Main input database.
+     *
+     * \note Silo is not thread-safe.  Applications that access Silo databases
+     * elsewhere (e.g., via VisItDataWriter) should call waitForPendingOutput()
+     * before doing so.
+     */
+    void setAsynchronousOutput(bool async_output);
+
+    /*!
+     * \brief Set the number of data files written per plot dump.
+     *
+     * When the number of files is positive and smaller than the number of MPI
+     * processes, the plot data of consecutive MPI processes are aggregated and
+     * written to a shared file by the first process of each group.  A value of
+     * zero (the default) writes one data file per MPI process.
+     *
+     * AppInitializer sets this option from the \p silo_number_of_output_files
+     * key of the \p Main input database.
+     */
+    void setNumberOfOutputFiles(int num_files);
+
+    /*!
+     * \brief Block until any pending asynchronous output has been written, and
+     * report any error that was encountered while writing it.
+     */
+    void waitForPendingOutput();
+
     /*!
      * Write out object state to the given database.
      *
@@ -246,6 +288,12 @@ private:
      */
     void buildVecScatters(AO& ao, int level_number);
 
+    /*!
+     * \brief Block until any pending asynchronous output has been written,
+     * without reporting errors.
+     */
+    void joinPendingOutput();
+
     /*!
      * Read object state from the restart file and initialize class data
      * members.  The database from which the restart data is read is determined
@@ -337,6 +385,15 @@ private:
     std::vector<bool> d_build_vec_scatters;
     std::vector<std::map<int, Vec> > d_src_vec, d_dst_vec;
     std::vector<std::map<int, VecScatter> > d_vec_scatter;
+
+    /*
+     * Output options and the state of the background writer thread.
+     */
+    bool d_async_output;
+    int d_num_output_files;
+    bool d_async_output_pending;
+    pthread_t d_async_output_thread;
+    std::string d_output_error_message;
 };
 } // namespace IBTK
 
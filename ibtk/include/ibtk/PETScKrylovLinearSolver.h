@@ -82,6 +82,15 @@ namespace IBTK
  * for a complete list of the Krylov solvers provided by this class.  Note that
  * solver configuration is typically done at runtime via command line options.
  *
+ * Communication-reducing pipelined Krylov methods (e.g., \p pipecg, \p pipecr,
+ * \p pgmres, \p pipebcgs, \p pipefgmres, and \p pipefcg) may also be selected
+ * via the \p ksp_type input database key or the command line.  These methods
+ * combine the global reductions performed by each iteration into a single
+ * non-blocking reduction that is overlapped with the application of the
+ * operator and preconditioner, which can substantially reduce solver latency
+ * at large processor counts.  Flexible variants (\p pipefgmres or \p pipefcg)
+ * should be used with variable preconditioners such as FAC preconditioners.
+ *
  * \note
  * - Preconditioners and direct solvers provided by PETSc \em cannot be used
  *   within the present IBTK solver framework.  However, this <em>does not
@@ -294,6 +303,22 @@ public:
     void initializeSolverState(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
                                const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b);
 
+    /*!
+     * \brief Refresh the coefficient-dependent data required by the solver
+     * without rebuilding the KSP object or the hierarchy-dependent data.
+     *
+     * When a preconditioner object has been registered with this class via
+     * setPreconditioner(), its state is refreshed via
+     * GeneralSolver::reinitializeSolverState().  The linear operator is
+     * expected to use the current problem coefficients when it is applied.
+     *
+     * \note If the solver state is not initialized, or if the hierarchy
+     * configuration has changed, the solver state is fully reinitialized via
+     * initializeSolverState().
+     */
+    void reinitializeSolverState(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                                 const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b);
+
     /*!
      * \brief Remove all hierarchy dependent data allocated by
      * initializeSolverState().
@@ -80,8 +80,21 @@ namespace IBTK
  abs_residual_tol = 1.0e-50    // see setAbsoluteTolerance()
  max_iterations = 10000        // see setMaxIterations()
  enable_logging = FALSE        // see setLoggingEnabled()
+ agglomeration_factor = 1      // see below
  \endverbatim
  *
+ * When \p agglomeration_factor is larger than one, the level is agglomerated
+ * onto a subset of processors (reduced by the specified factor) using the
+ * PETSc PCTELESCOPE preconditioner, and the preconditioner given by \p pc_type
+ * (e.g., \p lu or \p gamg) is applied on the reduced communicator.  The
+ * factorization or algebraic multigrid hierarchy constructed on the reduced
+ * communicator is kept between solves.  This is typically useful when the
+ * solver is used as the coarse level solver of a FAC preconditioner at large
+ * processor counts.  Agglomeration is not used with the \p asm, \p fieldsplit,
+ * or \p shell preconditioners.  The solver on the reduced communicator may be
+ * further configured at runtime via the options prefix \p
+ * <options_prefix>telescope_.
+ *
  * PETSc is developed at the Argonne National Laboratory Mathematics and
  * Computer Science Division.  For more information about \em PETSc, see <A
  * HREF="http://www.mcs.anl.gov/petsc">http://www.mcs.anl.gov/petsc</A>.
@@ -215,6 +228,18 @@ public:
     void initializeSolverState(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
                                const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b);
 
+    /*!
+     * \brief Refresh the matrix coefficients and the preconditioner while
+     * reusing the DOF index maps, the matrix nonzero structure, the subdomain
+     * index sets, and the scatters set up by initializeSolverState().
+     *
+     * \note If the solver state is not initialized, if the patch level has
+     * changed, or if reinitializeSolverStateSpecialized() returns \p false, the
+     * solver state is fully reinitialized via initializeSolverState().
+     */
+    void reinitializeSolverState(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                                 const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b);
+
     /*!
      * \brief Remove all hierarchy dependent data allocated by
      * initializeSolverState().
@@ -262,6 +287,18 @@ protected:
      */
     virtual void deallocateSolverStateSpecialized() = 0;
 
+    /*!
+     * \brief Recompute the entries of the matrix in place, keeping its nonzero
+     * structure unchanged.
+     *
+     * \return \p true if the matrix was refreshed in place, \p false if the
+     * solver state must be fully reinitialized.
+     *
+     * The default implementation returns \p false.
+     */
+    virtual bool reinitializeSolverStateSpecialized(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                                                    const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b);
+
     /*!
      * \brief Copy a generic vector to the PETSc representation.
      */
@@ -305,6 +342,7 @@ protected:
     //\{
     std::string d_ksp_type, d_pc_type, d_shell_pc_type;
     std::string d_options_prefix;
+    int d_agglomeration_factor;
     KSP d_petsc_ksp;
     Mat d_petsc_mat, d_petsc_pc;
     MatNullSpace d_petsc_nullsp;
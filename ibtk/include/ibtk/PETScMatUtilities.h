@@ -152,6 +152,34 @@ public:
                                               const std::vector<int>& num_dofs_per_proc,
                                               int dof_index_idx,
                                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
+
+    /*!
+     * \brief Update the coefficients of an IB interpolation operator
+     * previously constructed by constructPatchLevelSCInterpOp() without
+     * reallocating the matrix.
+     *
+     * Only the rows associated with IB points whose positions differ from
+     * those stored in \a X_prev are reset, and \a X_prev is updated
+     * accordingly.  The update is performed only if no IB point on any process
+     * requires a different stencil box than the one used to assemble the
+     * existing matrix.
+     *
+     * \return true if the matrix was updated in place, or false if the nonzero
+     * structure has changed and the matrix must be reconstructed.  In the
+     * latter case, the matrix is left unmodified.
+     *
+     * \note This is a collective operation.  The caller is responsible for
+     * ensuring that the DOF indices have not been renumbered since the matrix
+     * was constructed.
+     */
+    static bool updatePatchLevelSCInterpOp(Mat& mat,
+                                           void (*interp_fcn)(double r_lower, double* w),
+                                           int interp_stencil,
+                                           Vec& X_vec,
+                                           std::vector<double>& X_prev,
+                                           int dof_index_idx,
+                                           SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
+
     /*!
      * \brief Standard one-dimensional Peskin 4-pt delta function.
      *
@@ -66,6 +66,16 @@ namespace IBTK
  * through the static member functions that create and destroy PETSc vector
  * objects.
  *
+ * Local (i.e., processor-only) versions of the inner product and norm
+ * operations are also provided, so that the split-phase reductions of PETSc
+ * (e.g., VecDotBegin()/VecDotEnd(), VecMDotBegin()/VecMDotEnd(), and
+ * VecNormBegin()/VecNormEnd()) may be used with these vectors.  This allows
+ * several reductions to be combined into a single non-blocking global
+ * reduction that may be overlapped with operator and preconditioner
+ * applications, as is done by the pipelined Krylov methods provided by PETSc.
+ * Fused operations that require more than one global reduction (e.g.,
+ * VecDotNorm2()) also perform only a single reduction.
+ *
  * Finally, we remark that PETSc allows vectors with complex-valued entries.
  * This class and the class SAMRAI::solv::SAMRAIVectorReal assume real-values
  * vectors, i.e., data of type \p double or \p float.  The (currently
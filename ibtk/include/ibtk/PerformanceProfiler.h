@@ -0,0 +1,352 @@
+// Filename: PerformanceProfiler.h
+// Created on 17 Oct 2026
+//
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_PerformanceProfiler
+#define included_IBTK_PerformanceProfiler
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class PerformanceProfiler is a singleton class that records a tree of
+ * nested, named timing scopes and reports per-time step breakdowns of the
+ * elapsed wall-clock time along with statistics over all MPI processes.
+ *
+ * Unlike the flat SAMRAI timers, a scope is identified by its path in the
+ * scope tree, so that the same operation (e.g., force spreading) is reported
+ * separately for each phase of the time step in which it occurs.  Time steps
+ * are delimited by calls to beginStep(), which is called by
+ * HierarchyIntegrator::advanceHierarchy().  A time step lasts until the next
+ * call to beginStep() (or to finalize()), so that work done by the application
+ * in between time steps (e.g., visualization or restart I/O) is attributed to
+ * the step that it follows.
+ *
+ * When a time step is completed, the elapsed times for that step are reduced
+ * over all processes, and a one-line summary of the step is printed.  The
+ * summary reports the total wall-clock time of the step along with the scopes
+ * that consumed the most time, aggregated by scope name.  Each time is the
+ * maximum over all processes, and the load imbalance is reported as the ratio
+ * of the maximum to the mean time.  A full profile of the scope tree and of
+ * the per-step history may be written in JSON or CSV format.
+ *
+ * \note Completing a time step and writing the profile are collective
+ * operations, and all processes must enter the same scopes.  Scopes must not
+ * be entered from within OpenMP parallel regions.
+ *
+ * \note Profiling is disabled by default, in which case entering and exiting
+ * scopes is essentially free.
+ */
+class PerformanceProfiler
+{
+public:
+    /*!
+     * Return a pointer to the instance of the profiler.  Access to
+     * PerformanceProfiler objects is mediated by the getProfiler() function.
+     *
+     * \return A pointer to the profiler instance.
+     */
+    static PerformanceProfiler* getProfiler();
+
+    /*!
+     * Deallocate the PerformanceProfiler instance.  Any time step that is in
+     * progress is completed and the profile is written, if requested.
+     *
+     * It is not necessary to call this function at program termination, since
+     * it is automatically called by the ShutdownRegistry class.
+     */
+    static void freeProfiler();
+
+    /*!
+     * \brief Enable or disable profiling.
+     */
+    void setEnabled(bool enabled);
+
+    /*!
+     * \brief Indicate whether profiling is enabled.
+     */
+    static bool isEnabled()
+    {
+        return s_enabled;
+    } // isEnabled
+
+    /*!
+     * \brief Set the interval (in time steps) at which per-step summaries are
+     * printed.  A value of zero disables the per-step summaries.
+     */
+    void setLogInterval(int log_interval);
+
+    /*!
+     * \brief Set the maximum number of scopes reported in the per-step
+     * summaries.
+     */
+    void setMaxLogEntries(int max_log_entries);
+
+    /*!
+     * \brief Set the name of the file to which the profile is written by
+     * finalize().  The profile is written in CSV format if the file name ends
+     * in ".csv" and in JSON format otherwise.  An empty file name disables
+     * writing the profile.
+     *
+     * \note The per-step history is only recorded when a file name is set, and
+     * the step times are only reduced over all processes when they are either
+     * recorded or printed.
+     */
+    void setProfileFileName(const std::string& file_name);
+
+    /*!
+     * \brief Begin a new time step, completing the previous step, if any.
+     */
+    void beginStep(int step_num, double step_time);
+
+    /*!
+     * \brief Complete the current time step, if any, and write the profile to
+     * the file specified by setProfileFileName().
+     */
+    void finalize();
+
+    /*!
+     * \brief Enter a scope nested within the currently active scope.
+     */
+    void beginScope(const std::string& scope_name);
+
+    /*!
+     * \brief Exit the currently active scope.
+     */
+    void endScope();
+
+    /*!
+     * \brief Return the total time spent by the local process in all scopes
+     * with the specified name since profiling was enabled.
+     *
+     * \note A scope that is nested within a scope with the same name is not
+     * counted twice.
+     */
+    double getLocalTotalTime(const std::string& scope_name) const;
+
+    /*!
+     * \brief Write the profile in JSON format.
+     *
+     * \note This is a collective operation, but only the root process writes
+     * to the output stream.
+     */
+    void printJSON(std::ostream& os);
+
+    /*!
+     * \brief Write the profile in CSV format.
+     *
+     * \note This is a collective operation, but only the root process writes
+     * to the output stream.
+     */
+    void printCSV(std::ostream& os);
+
+protected:
+    /*!
+     * \brief Default constructor.
+     */
+    PerformanceProfiler();
+
+    /*!
+     * \brief Destructor.
+     */
+    ~PerformanceProfiler();
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    PerformanceProfiler(const PerformanceProfiler& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    PerformanceProfiler& operator=(const PerformanceProfiler& that);
+
+    /*!
+     * \brief Complete the current time step: reduce the step times over all
+     * processes, record them, and print the per-step summary.
+     */
+    void endStep();
+
+    /*!
+     * \brief Reduce the accumulated times of all scopes over all processes.
+     *
+     * \return A boolean indicating whether all processes have the same scope
+     * tree.  If not, only the local times are reported.
+     */
+    bool reduceTotals(std::vector<double>& min_vals, std::vector<double>& max_vals, std::vector<double>& avg_vals);
+
+    /*!
+     * \brief Determine whether all processes have the same scope tree by
+     * comparing hashes of the scope paths.
+     */
+    bool haveConsistentScopeTrees() const;
+
+    /*!
+     * \brief Return the full path of the specified scope.
+     */
+    std::string getScopePath(int node_idx) const;
+
+    /*!
+     * Static data members used to control access to and destruction of
+     * singleton profiler instance.
+     */
+    static PerformanceProfiler* s_profiler_instance;
+    static bool s_registered_callback;
+    static unsigned char s_shutdown_priority;
+    static bool s_enabled;
+
+    /*!
+     * \brief A node in the scope tree.
+     *
+     * Node 0 is the root of the tree and corresponds to the time step.
+     */
+    struct ScopeNode
+    {
+        std::string name;
+        int parent, depth;
+        std::map<std::string, int> children;
+        int num_calls;
+        double start_time, step_time, total_time;
+    };
+    std::vector<ScopeNode> d_nodes;
+    std::vector<int> d_active_nodes;
+
+    /*!
+     * \brief The reduced times of the scopes that were active during one time
+     * step.  These records are only kept on the root process.
+     */
+    struct StepRecord
+    {
+        int step_num;
+        double step_time;
+        bool consistent;
+        std::vector<int> node_idxs;
+        std::vector<double> max_vals, avg_vals;
+    };
+    std::vector<StepRecord> d_step_records;
+
+    bool d_step_in_progress;
+    int d_step_num;
+    double d_step_time;
+    int d_log_interval, d_max_log_entries;
+    std::string d_profile_file_name;
+    bool d_profile_written;
+};
+
+/*!
+ * \brief Class ProfilingScope enters a PerformanceProfiler scope on
+ * construction and exits it on destruction.
+ *
+ * For example:
+ *
+ * \code
+ * {
+ *     ProfilingScope scope("spread");
+ *     ib_method_ops->spreadForce(...);
+ * }
+ * \endcode
+ */
+class ProfilingScope
+{
+public:
+    /*!
+     * \brief Enter the named scope, if profiling is enabled.
+     */
+    explicit ProfilingScope(const char* scope_name) : d_active(PerformanceProfiler::isEnabled())
+    {
+        if (d_active) PerformanceProfiler::getProfiler()->beginScope(scope_name);
+        return;
+    } // ProfilingScope
+
+    /*!
+     * \brief Exit the scope.
+     */
+    ~ProfilingScope()
+    {
+        if (d_active) PerformanceProfiler::getProfiler()->endScope();
+        return;
+    } // ~ProfilingScope
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    ProfilingScope();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    ProfilingScope(const ProfilingScope& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    ProfilingScope& operator=(const ProfilingScope& that);
+
+    const bool d_active;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_PerformanceProfiler
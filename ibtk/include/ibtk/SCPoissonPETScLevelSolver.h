@@ -177,6 +177,12 @@ protected:
     std::vector<int> d_num_dofs_per_proc;
     int d_dof_index_idx;
     SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, int> > d_dof_index_var;
+
+    /*!
+     * \brief Scratch data used to modify the right-hand side vector.
+     */
+    int d_b_adj_idx;
+
     SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > d_data_synch_sched, d_ghost_fill_sched;
     //\}
 
@@ -62,6 +62,19 @@ LDataManager::getDefaultSpreadKernelFunction() const
     return d_default_spread_kernel_fcn;
 } // getDefaultSpreadKernelFunction
 
+inline void
+LDataManager::setUseMortonNodeOrdering(const bool use_morton_node_ordering)
+{
+    d_use_morton_node_ordering = use_morton_node_ordering;
+    return;
+} // setUseMortonNodeOrdering
+
+inline bool
+LDataManager::getUseMortonNodeOrdering() const
+{
+    return d_use_morton_node_ordering;
+} // getUseMortonNodeOrdering
+
 inline bool
 LDataManager::levelContainsLagrangianData(const int level_number) const
 {
@@ -98,6 +98,7 @@
 #include "libmesh/enum_parallel_type.h"
 #include "libmesh/enum_quadrature_type.h"
 #include "libmesh/equation_systems.h"
+#include "libmesh/fe.h"
 #include "libmesh/fe_interface.h"
 #include "libmesh/fe_type.h"
 #include "libmesh/fem_context.h"
@@ -257,6 +258,88 @@ get_elem_hmax(const Elem* const elem, const boost::multi_array<double, 2>& X_nod
     }
     return sqrt(hmax_squared);
 } // get_elem_hmax
+
+// Collect the nodal positions of a batch of elements into a single contiguous
+// array and look up the cached quadrature data for each element.
+inline void
+get_element_quadrature_data(std::vector<const FEDataManager::QuadratureCache::QuadratureData*>& F_quad_data,
+                            std::vector<const FEDataManager::QuadratureCache::QuadratureData*>& X_quad_data,
+                            std::vector<double>& X_node_patch,
+                            std::vector<size_t>& X_node_offset,
+                            boost::multi_array<double, 2>& X_node,
+                            const std::vector<Elem*>& elems,
+                            FEDataManager::QuadratureCache& F_quad_cache,
+                            FEDataManager::QuadratureCache& X_quad_cache,
+                            FEDataManager::SystemDofMapCache& X_dof_map_cache,
+                            const PetscVector<double>& X_petsc_vec,
+                            const double* const X_local_soln,
+                            const QuadratureType quad_type,
+                            const Order quad_order,
+                            const bool use_adaptive_quadrature,
+                            const double point_density,
+                            const double dx_min)
+{
+    const size_t num_elems = elems.size();
+    F_quad_data.resize(num_elems);
+    X_quad_data.resize(num_elems);
+    X_node_offset.resize(num_elems + 1);
+    X_node_patch.clear();
+    X_node_offset[0] = 0;
+    std::vector<std::vector<unsigned int> > X_dof_indices(NDIM);
+    for (unsigned int e_idx = 0; e_idx < num_elems; ++e_idx)
+    {
+        const Elem* const elem = elems[e_idx];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            X_dof_map_cache.dof_indices(elem, X_dof_indices[d], d);
+        }
+        get_values_for_interpolation(X_node, X_petsc_vec, X_local_soln, X_dof_indices);
+        const Order order = FEDataManager::getQuadratureOrder(
+            quad_type, quad_order, use_adaptive_quadrature, point_density, elem, X_node, dx_min);
+        F_quad_data[e_idx] = &F_quad_cache.getQuadratureData(elem, quad_type, order);
+        X_quad_data[e_idx] = &X_quad_cache.getQuadratureData(elem, quad_type, order);
+        X_node_patch.insert(X_node_patch.end(), X_node.data(), X_node.data() + X_node.num_elements());
+        X_node_offset[e_idx + 1] = X_node_patch.size();
+    }
+    return;
+} // get_element_quadrature_data
+
+// Evaluate the positions of the quadrature points of a batch of elements.
+inline void
+interpolate_element_positions(std::vector<double>& X_qp,
+                              const std::vector<const FEDataManager::QuadratureCache::QuadratureData*>& X_quad_data,
+                              const std::vector<double>& X_node_patch,
+                              const std::vector<size_t>& X_node_offset,
+                              const std::vector<Elem*>& elems,
+                              FEDataManager::QuadratureCache& X_quad_cache)
+{
+    std::fill(X_qp.begin(), X_qp.end(), 0.0);
+    unsigned int qp_offset = 0;
+    for (unsigned int e_idx = 0; e_idx < X_quad_data.size(); ++e_idx)
+    {
+        const std::vector<std::vector<double> >& phi_X = X_quad_cache.getPhi(elems[e_idx], *X_quad_data[e_idx]);
+        const unsigned int n_qp = X_quad_data[e_idx]->n_qp;
+        const size_t n_basis = (X_node_offset[e_idx + 1] - X_node_offset[e_idx]) / NDIM;
+#if !defined(NDEBUG)
+        TBOX_ASSERT(n_basis == phi_X.size());
+#endif
+        const double* const X_node = &X_node_patch[X_node_offset[e_idx]];
+        double* const X_begin = &X_qp[NDIM * qp_offset];
+        for (unsigned int k = 0; k < n_basis; ++k)
+        {
+            for (unsigned int qp = 0; qp < n_qp; ++qp)
+            {
+                const double& p_X = phi_X[k][qp];
+                for (unsigned int i = 0; i < NDIM; ++i)
+                {
+                    X_begin[NDIM * qp + i] += X_node[NDIM * k + i] * p_X;
+                }
+            }
+        }
+        qp_offset += n_qp;
+    }
+    return;
+} // interpolate_element_positions
 }
 
 const short int FEDataManager::ZERO_DISPLACEMENT_X_BDRY_ID = 0x100;
@@ -358,6 +441,7 @@ FEDataManager::setEquationSystems(EquationSystems* const equation_systems, const
 {
     d_es = equation_systems;
     d_level_number = level_number;
+    clearQuadratureCache();
     return;
 } // setEquationSystems
 
@@ -386,6 +470,118 @@ FEDataManager::getDofMapCache(unsigned int system_num)
     return dof_map_cache.getPointer();
 } // getDofMapCache
 
+FEDataManager::QuadratureCache*
+FEDataManager::getQuadratureCache(const FEType& fe_type)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_es);
+#endif
+    Pointer<QuadratureCache> quad_cache = d_quadrature_cache[fe_type];
+    if (!quad_cache)
+    {
+        d_quadrature_cache[fe_type] = new QuadratureCache(d_es->get_mesh().mesh_dimension(), fe_type);
+        quad_cache = d_quadrature_cache[fe_type];
+    }
+    return quad_cache.getPointer();
+} // getQuadratureCache
+
+void
+FEDataManager::clearQuadratureCache()
+{
+    d_quadrature_cache.clear();
+    return;
+} // clearQuadratureCache
+
+FEDataManager::QuadratureCache::QuadratureCache(const unsigned int dim, const FEType& fe_type)
+    : d_dim(dim), d_fe_type(fe_type), d_share_phi(fe_type.family == LAGRANGE), d_quad_data(), d_JxW_cache()
+{
+    return;
+} // QuadratureCache
+
+FEDataManager::QuadratureCache::~QuadratureCache()
+{
+    clear();
+    return;
+} // ~QuadratureCache
+
+const FEDataManager::QuadratureCache::QuadratureData&
+FEDataManager::QuadratureCache::getQuadratureData(const Elem* const elem, const QuadratureType type, const Order order)
+{
+    Key key;
+    key.elem_type = elem->type();
+    key.p_level = elem->p_level();
+    key.quad_type = type;
+    key.quad_order = order;
+    QuadratureData*& quad_data = d_quad_data[key];
+    if (!quad_data)
+    {
+        // NOTE: Lagrange shape function values depend only on the element type
+        // and quadrature rule, not on the element geometry, so that it is safe
+        // to share them among all elements of the same type.  Other families
+        // are reinitialized for each element by getPhi().
+        const unsigned int elem_dim = elem->dim();
+        quad_data = new QuadratureData();
+        quad_data->qrule =
+            (type == QGRID ? UniquePtr<QBase>(new QGrid(elem_dim, order)) : QBase::build(type, elem_dim, order));
+        quad_data->qrule->init(key.elem_type, key.p_level);
+        quad_data->fe = UniquePtr<FEBase>(FEBase::build(d_dim, d_fe_type));
+        quad_data->fe->attach_quadrature_rule(quad_data->qrule.get());
+        const std::vector<std::vector<double> >& phi = quad_data->fe->get_phi();
+        quad_data->fe->get_JxW();
+        quad_data->fe->reinit(elem);
+        quad_data->phi = phi;
+        quad_data->n_qp = quad_data->qrule->n_points();
+    }
+    return *quad_data;
+} // getQuadratureData
+
+const std::vector<std::vector<double> >&
+FEDataManager::QuadratureCache::getPhi(const Elem* const elem, const QuadratureData& quad_data)
+{
+    if (d_share_phi) return quad_data.phi;
+    quad_data.fe->reinit(elem);
+    return quad_data.fe->get_phi();
+} // getPhi
+
+const std::vector<double>&
+FEDataManager::QuadratureCache::getJxW(const Elem* const elem, const QuadratureData& quad_data)
+{
+    ElemJxWCache& elem_JxW = d_JxW_cache[elem->id()];
+    for (ElemJxWCache::const_iterator cit = elem_JxW.begin(); cit != elem_JxW.end(); ++cit)
+    {
+        if (cit->first == &quad_data) return cit->second;
+    }
+    // Only keep the values for a few quadrature rules per element, so that the
+    // cache does not grow without bound when adaptive quadrature selects
+    // different rules over time.
+    static const size_t MAX_RULES_PER_ELEM = 4;
+    if (elem_JxW.size() >= MAX_RULES_PER_ELEM) elem_JxW.erase(elem_JxW.begin());
+    quad_data.fe->reinit(elem);
+    elem_JxW.push_back(std::make_pair(&quad_data, quad_data.fe->get_JxW()));
+    return elem_JxW.back().second;
+} // getJxW
+
+void
+FEDataManager::QuadratureCache::clear()
+{
+    for (std::map<Key, QuadratureData*>::iterator it = d_quad_data.begin(); it != d_quad_data.end(); ++it)
+    {
+        delete it->second;
+    }
+    d_quad_data.clear();
+    d_JxW_cache.clear();
+    return;
+} // clear
+
+bool
+FEDataManager::QuadratureCache::Key::operator<(const Key& that) const
+{
+    if (elem_type != that.elem_type) return elem_type < that.elem_type;
+    if (p_level != that.p_level) return p_level < that.p_level;
+    if (quad_type != that.quad_type) return quad_type < that.quad_type;
+    return quad_order < that.quad_order;
+} // operator<
+
 int
 FEDataManager::getLevelNumber() const
 {
@@ -439,6 +635,11 @@ FEDataManager::reinitElementMappings()
     }
     d_system_ghost_vec.clear();
 
+    // The set of elements that are active on this processor generally changes
+    // when the patch hierarchy is regridded, so the cached per-element
+    // quadrature data are reset along with the element mappings.
+    clearQuadratureCache();
+
     // Reset the mappings between grid patches and active mesh elements.
     collectActivePatchElements(d_active_patch_elem_map, d_level_number, d_ghost_width);
     collectActivePatchNodes(d_active_patch_node_map, d_active_patch_elem_map);
@@ -551,12 +752,7 @@ FEDataManager::spread(const int f_data_idx,
     // We spread directly to the finest level of the patch hierarchy.
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(d_level_number);
 
-    // Extract the mesh.
-    const MeshBase& mesh = d_es->get_mesh();
-    const unsigned int dim = mesh.mesh_dimension();
-    UniquePtr<QBase> qrule;
-
-    // Extract the FE systems and DOF maps, and setup the FE object.
+    // Extract the FE systems and DOF maps.
     System& F_system = d_es->get_system(system_name);
     const unsigned int n_vars = F_system.n_vars();
     const DofMap& F_dof_map = F_system.get_dof_map();
@@ -565,7 +761,6 @@ FEDataManager::spread(const int f_data_idx,
     const DofMap& X_dof_map = X_system.get_dof_map();
     SystemDofMapCache& X_dof_map_cache = *getDofMapCache(COORDINATES_SYSTEM_NAME);
     std::vector<std::vector<unsigned int> > F_dof_indices(n_vars);
-    std::vector<std::vector<unsigned int> > X_dof_indices(NDIM);
     FEType F_fe_type = F_dof_map.variable_type(0);
     Order F_order = F_dof_map.variable_order(0);
     for (unsigned i = 0; i < n_vars; ++i)
@@ -580,16 +775,6 @@ FEDataManager::spread(const int f_data_idx,
         TBOX_ASSERT(X_dof_map.variable_type(d) == X_fe_type);
         TBOX_ASSERT(F_dof_map.variable_order(d) == X_order);
     }
-    UniquePtr<FEBase> F_fe_autoptr(FEBase::build(dim, F_fe_type)), X_fe_autoptr;
-    if (F_fe_type != X_fe_type)
-    {
-        X_fe_autoptr = UniquePtr<FEBase>(FEBase::build(dim, X_fe_type));
-    }
-    FEBase* F_fe = F_fe_autoptr.get();
-    FEBase* X_fe = X_fe_autoptr.get() ? X_fe_autoptr.get() : F_fe_autoptr.get();
-    const std::vector<double>& JxW_F = F_fe->get_JxW();
-    const std::vector<std::vector<double> >& phi_F = F_fe->get_phi();
-    const std::vector<std::vector<double> >& phi_X = X_fe->get_phi();
 
     // Check to see if we are using nodal quadrature.
     const bool use_nodal_quadrature =
@@ -719,6 +904,16 @@ FEDataManager::spread(const int f_data_idx,
         // Loop over the patches to interpolate nodal values on the FE mesh to
         // the element quadrature points, then spread those values onto the
         // Eulerian grid.
+        //
+        // NOTE: Shape function values and values of JxW are obtained from the
+        // quadrature caches, so that libMesh FE objects need only to be
+        // reinitialized the first time that a particular element or
+        // quadrature rule is encountered.
+        QuadratureCache& F_quad_cache = *getQuadratureCache(F_fe_type);
+        QuadratureCache& X_quad_cache = *getQuadratureCache(X_fe_type);
+        std::vector<const QuadratureCache::QuadratureData*> F_quad_data, X_quad_data;
+        std::vector<double> X_node_patch;
+        std::vector<size_t> X_node_offset;
         boost::multi_array<double, 2> F_node, X_node;
         std::vector<double> F_JxW_qp, X_qp;
         int local_patch_num = 0;
@@ -734,27 +929,39 @@ FEDataManager::spread(const int f_data_idx,
             const double* const patch_dx = patch_geom->getDx();
             const double patch_dx_min = *std::min_element(patch_dx, patch_dx + NDIM);
 
-            // Setup vectors to store the values of F_JxW and X at the
-            // quadrature points.
+            // Collect the nodal positions of the elements and determine the
+            // quadrature rule to use on each element.
+            get_element_quadrature_data(F_quad_data,
+                                        X_quad_data,
+                                        X_node_patch,
+                                        X_node_offset,
+                                        X_node,
+                                        patch_elems,
+                                        F_quad_cache,
+                                        X_quad_cache,
+                                        X_dof_map_cache,
+                                        *X_petsc_vec,
+                                        X_local_soln,
+                                        spread_spec.quad_type,
+                                        spread_spec.quad_order,
+                                        spread_spec.use_adaptive_quadrature,
+                                        spread_spec.point_density,
+                                        patch_dx_min);
             unsigned int n_qp_patch = 0;
             for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
             {
-                Elem* const elem = patch_elems[e_idx];
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    X_dof_map_cache.dof_indices(elem, X_dof_indices[d], d);
-                }
-                get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, X_dof_indices);
-                updateSpreadQuadratureRule(qrule, spread_spec, elem, X_node, patch_dx_min);
-                n_qp_patch += qrule->n_points();
+                n_qp_patch += F_quad_data[e_idx]->n_qp;
             }
             if (!n_qp_patch) continue;
             F_JxW_qp.resize(n_vars * n_qp_patch);
             X_qp.resize(NDIM * n_qp_patch);
+            std::fill(F_JxW_qp.begin(), F_JxW_qp.end(), 0.0);
+
+            // Compute the positions of the quadrature points for all of the
+            // elements in the patch.
+            interpolate_element_positions(X_qp, X_quad_data, X_node_patch, X_node_offset, patch_elems, X_quad_cache);
 
-            // Loop over the elements and compute the values to be spread and
-            // the positions of the quadrature points.
-            qrule.reset();
+            // Loop over the elements and compute the values to be spread.
             unsigned int qp_offset = 0;
             for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
             {
@@ -764,47 +971,18 @@ FEDataManager::spread(const int f_data_idx,
                     F_dof_map_cache.dof_indices(elem, F_dof_indices[i], i);
                 }
                 get_values_for_interpolation(F_node, *F_petsc_vec, F_local_soln, F_dof_indices);
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    X_dof_map_cache.dof_indices(elem, X_dof_indices[d], d);
-                }
-                get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, X_dof_indices);
-                const bool qrule_changed = updateSpreadQuadratureRule(qrule, spread_spec, elem, X_node, patch_dx_min);
-                if (qrule_changed)
-                {
-                    // NOTE: Because we are only using the shape function values
-                    // for the FE object associated with X, we only need to
-                    // reinitialize X_fe whenever the quadrature rule changes.
-                    // In particular, notice that the shape function values
-                    // depend only on the element type and quadrature rule, not
-                    // on the element geometry.
-                    F_fe->attach_quadrature_rule(qrule.get());
-                    X_fe->attach_quadrature_rule(qrule.get());
-                    if (X_fe != F_fe) X_fe->reinit(elem);
-                }
-                F_fe->reinit(elem);
-                const unsigned int n_qp = qrule->n_points();
-                double* F_begin = &F_JxW_qp[n_vars * qp_offset];
-                double* X_begin = &X_qp[NDIM * qp_offset];
-                std::fill(F_begin, F_begin + n_vars * n_qp, 0.0);
-                std::fill(X_begin, X_begin + NDIM * n_qp, 0.0);
+                const QuadratureCache::QuadratureData& F_elem_quad_data = *F_quad_data[e_idx];
+                const std::vector<std::vector<double> >& phi_F = F_quad_cache.getPhi(elem, F_elem_quad_data);
+                const std::vector<double>& JxW_F = F_quad_cache.getJxW(elem, F_elem_quad_data);
+                const unsigned int n_qp = F_elem_quad_data.n_qp;
+                double* const F_begin = &F_JxW_qp[n_vars * qp_offset];
                 for (unsigned int k = 0; k < F_dof_indices[0].size(); ++k)
                 {
                     for (unsigned int qp = 0; qp < n_qp; ++qp)
                     {
                         for (unsigned int i = 0; i < n_vars; ++i)
                         {
-                            F_JxW_qp[n_vars * (qp_offset + qp) + i] += F_node[k][i] * phi_F[k][qp] * JxW_F[qp];
-                        }
-                    }
-                }
-                for (unsigned int k = 0; k < X_dof_indices[0].size(); ++k)
-                {
-                    for (unsigned int qp = 0; qp < n_qp; ++qp)
-                    {
-                        for (unsigned int i = 0; i < NDIM; ++i)
-                        {
-                            X_qp[NDIM * (qp_offset + qp) + i] += X_node[k][i] * phi_X[k][qp];
+                            F_begin[n_vars * qp + i] += F_node[k][i] * phi_F[k][qp] * JxW_F[qp];
                         }
                     }
                 }
@@ -1122,12 +1300,7 @@ FEDataManager::interpWeighted(const int f_data_idx,
     // We interpolate directly from the finest level of the patch hierarchy.
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(d_level_number);
 
-    // Extract the mesh.
-    const MeshBase& mesh = d_es->get_mesh();
-    const unsigned int dim = mesh.mesh_dimension();
-    UniquePtr<QBase> qrule;
-
-    // Extract the FE systems and DOF maps, and setup the FE object.
+    // Extract the FE systems and DOF maps.
     System& F_system = d_es->get_system(system_name);
     const unsigned int n_vars = F_system.n_vars();
     const DofMap& F_dof_map = F_system.get_dof_map();
@@ -1136,7 +1309,6 @@ FEDataManager::interpWeighted(const int f_data_idx,
     const DofMap& X_dof_map = X_system.get_dof_map();
     SystemDofMapCache& X_dof_map_cache = *getDofMapCache(COORDINATES_SYSTEM_NAME);
     std::vector<std::vector<unsigned int> > F_dof_indices(n_vars);
-    std::vector<std::vector<unsigned int> > X_dof_indices(NDIM);
     FEType F_fe_type = F_dof_map.variable_type(0);
     Order F_order = F_dof_map.variable_order(0);
     for (unsigned i = 0; i < n_vars; ++i)
@@ -1151,16 +1323,6 @@ FEDataManager::interpWeighted(const int f_data_idx,
         TBOX_ASSERT(X_dof_map.variable_type(d) == X_fe_type);
         TBOX_ASSERT(X_dof_map.variable_order(d) == X_order);
     }
-    UniquePtr<FEBase> F_fe_autoptr(FEBase::build(dim, F_fe_type)), X_fe_autoptr;
-    if (F_fe_type != X_fe_type)
-    {
-        X_fe_autoptr = UniquePtr<FEBase>(FEBase::build(dim, X_fe_type));
-    }
-    FEBase* F_fe = F_fe_autoptr.get();
-    FEBase* X_fe = X_fe_autoptr.get() ? X_fe_autoptr.get() : F_fe_autoptr.get();
-    const std::vector<double>& JxW_F = F_fe->get_JxW();
-    const std::vector<std::vector<double> >& phi_F = F_fe->get_phi();
-    const std::vector<std::vector<double> >& phi_X = X_fe->get_phi();
 
     // Communicate any unsynchronized ghost data.
     for (unsigned int k = 0; k < f_refine_scheds.size(); ++k)
@@ -1286,7 +1448,17 @@ FEDataManager::interpWeighted(const int f_data_idx,
         // Loop over the patches to interpolate values to the element quadrature
         // points from the grid, then use these values to compute the projection
         // of the interpolated velocity field onto the FE basis functions.
+        //
+        // NOTE: Shape function values and values of JxW are obtained from the
+        // quadrature caches, so that libMesh FE objects need only to be
+        // reinitialized the first time that a particular element or
+        // quadrature rule is encountered.
         F_vec.zero();
+        QuadratureCache& F_quad_cache = *getQuadratureCache(F_fe_type);
+        QuadratureCache& X_quad_cache = *getQuadratureCache(X_fe_type);
+        std::vector<const QuadratureCache::QuadratureData*> F_quad_data, X_quad_data;
+        std::vector<double> X_node_patch;
+        std::vector<size_t> X_node_offset;
         std::vector<DenseVector<double> > F_rhs_e(n_vars);
         boost::multi_array<double, 2> X_node;
         std::vector<double> F_qp, X_qp;
@@ -1303,66 +1475,37 @@ FEDataManager::interpWeighted(const int f_data_idx,
             const double* const patch_dx = patch_geom->getDx();
             const double patch_dx_min = *std::min_element(patch_dx, patch_dx + NDIM);
 
-            // Setup vectors to store the values of F and X at the quadrature
-            // points.
+            // Collect the nodal positions of the elements and determine the
+            // quadrature rule to use on each element.
+            get_element_quadrature_data(F_quad_data,
+                                        X_quad_data,
+                                        X_node_patch,
+                                        X_node_offset,
+                                        X_node,
+                                        patch_elems,
+                                        F_quad_cache,
+                                        X_quad_cache,
+                                        X_dof_map_cache,
+                                        *X_petsc_vec,
+                                        X_local_soln,
+                                        interp_spec.quad_type,
+                                        interp_spec.quad_order,
+                                        interp_spec.use_adaptive_quadrature,
+                                        interp_spec.point_density,
+                                        patch_dx_min);
             unsigned int n_qp_patch = 0;
             for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
             {
-                Elem* const elem = patch_elems[e_idx];
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    X_dof_map_cache.dof_indices(elem, X_dof_indices[d], d);
-                }
-                get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, X_dof_indices);
-                updateInterpQuadratureRule(qrule, interp_spec, elem, X_node, patch_dx_min);
-                n_qp_patch += qrule->n_points();
+                n_qp_patch += X_quad_data[e_idx]->n_qp;
             }
             if (!n_qp_patch) continue;
             F_qp.resize(n_vars * n_qp_patch);
             X_qp.resize(NDIM * n_qp_patch);
             std::fill(F_qp.begin(), F_qp.end(), 0.0);
 
-            // Loop over the elements and compute the positions of the
-            // quadrature points.
-            qrule.reset();
-            unsigned int qp_offset = 0;
-            for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
-            {
-                Elem* const elem = patch_elems[e_idx];
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    X_dof_map_cache.dof_indices(elem, X_dof_indices[d], d);
-                }
-                get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, X_dof_indices);
-                const bool qrule_changed = updateInterpQuadratureRule(qrule, interp_spec, elem, X_node, patch_dx_min);
-                if (qrule_changed)
-                {
-                    // NOTE: Because we are only using the shape function values
-                    // for the FE object associated with X, we only need to
-                    // reinitialize X_fe whenever the quadrature rule changes.
-                    // In particular, notice that the shape function values
-                    // depend only on the element type and quadrature rule, not
-                    // on the element geometry.
-                    X_fe->attach_quadrature_rule(qrule.get());
-                    X_fe->reinit(elem);
-                }
-                const unsigned int n_node = elem->n_nodes();
-                const unsigned int n_qp = qrule->n_points();
-                double* X_begin = &X_qp[NDIM * qp_offset];
-                std::fill(X_begin, X_begin + NDIM * n_qp, 0.0);
-                for (unsigned int k = 0; k < n_node; ++k)
-                {
-                    for (unsigned int qp = 0; qp < n_qp; ++qp)
-                    {
-                        const double& p_X = phi_X[k][qp];
-                        for (unsigned int i = 0; i < NDIM; ++i)
-                        {
-                            X_qp[NDIM * (qp_offset + qp) + i] += X_node[k][i] * p_X;
-                        }
-                    }
-                }
-                qp_offset += n_qp;
-            }
+            // Compute the positions of the quadrature points for all of the
+            // elements in the patch.
+            interpolate_element_positions(X_qp, X_quad_data, X_node_patch, X_node_offset, patch_elems, X_quad_cache);
 
             // Interpolate values from the Cartesian grid patch to the
             // quadrature points.
@@ -1385,8 +1528,7 @@ FEDataManager::interpWeighted(const int f_data_idx,
             }
 
             // Loop over the elements and accumulate the right-hand-side values.
-            qrule.reset();
-            qp_offset = 0;
+            unsigned int qp_offset = 0;
             for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
             {
                 Elem* const elem = patch_elems[e_idx];
@@ -1395,26 +1537,10 @@ FEDataManager::interpWeighted(const int f_data_idx,
                     F_dof_map_cache.dof_indices(elem, F_dof_indices[i], i);
                     F_rhs_e[i].resize(static_cast<int>(F_dof_indices[i].size()));
                 }
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    X_dof_map_cache.dof_indices(elem, X_dof_indices[d], d);
-                }
-                get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, X_dof_indices);
-                const bool qrule_changed = updateInterpQuadratureRule(qrule, interp_spec, elem, X_node, patch_dx_min);
-                if (qrule_changed)
-                {
-                    // NOTE: Because we are only using the shape function values
-                    // for the FE object associated with X, we only need to
-                    // reinitialize X_fe whenever the quadrature rule changes.
-                    // In particular, notice that the shape function values
-                    // depend only on the element type and quadrature rule, not
-                    // on the element geometry.
-                    F_fe->attach_quadrature_rule(qrule.get());
-                    X_fe->attach_quadrature_rule(qrule.get());
-                    if (X_fe != F_fe) X_fe->reinit(elem);
-                }
-                F_fe->reinit(elem);
-                const unsigned int n_qp = qrule->n_points();
+                const QuadratureCache::QuadratureData& F_elem_quad_data = *F_quad_data[e_idx];
+                const std::vector<std::vector<double> >& phi_F = F_quad_cache.getPhi(elem, F_elem_quad_data);
+                const std::vector<double>& JxW_F = F_quad_cache.getJxW(elem, F_elem_quad_data);
+                const unsigned int n_qp = F_elem_quad_data.n_qp;
                 const size_t n_basis = F_dof_indices[0].size();
                 for (unsigned int qp = 0; qp < n_qp; ++qp)
                 {
@@ -2016,19 +2142,15 @@ FEDataManager::computeL2Projection(NumericVector<double>& U_vec,
     return converged;
 } // computeL2Projection
 
-bool
-FEDataManager::updateQuadratureRule(UniquePtr<QBase>& qrule,
-                                    QuadratureType type,
-                                    Order order,
-                                    bool use_adaptive_quadrature,
-                                    double point_density,
-                                    const Elem* const elem,
-                                    const boost::multi_array<double, 2>& X_node,
-                                    const double dx_min)
+Order
+FEDataManager::getQuadratureOrder(QuadratureType type,
+                                  Order order,
+                                  bool use_adaptive_quadrature,
+                                  double point_density,
+                                  const Elem* const elem,
+                                  const boost::multi_array<double, 2>& X_node,
+                                  const double dx_min)
 {
-    unsigned int elem_dim = elem->dim();
-    const ElemType elem_type = elem->type();
-    const unsigned int elem_p_level = elem->p_level();
     if (use_adaptive_quadrature)
     {
         const double hmax = get_elem_hmax(elem, X_node);
@@ -2043,11 +2165,28 @@ FEDataManager::updateQuadratureRule(UniquePtr<QBase>& qrule,
             order = static_cast<Order>(npts);
             break;
         default:
-            TBOX_ERROR("FEDataManager::updateQuadratureRule():\n"
+            TBOX_ERROR("FEDataManager::getQuadratureOrder():\n"
                        << "  adaptive quadrature rules are available only for quad_type = QGAUSS "
                           "or QGRID\n");
         }
     }
+    return order;
+} // getQuadratureOrder
+
+bool
+FEDataManager::updateQuadratureRule(UniquePtr<QBase>& qrule,
+                                    QuadratureType type,
+                                    Order order,
+                                    bool use_adaptive_quadrature,
+                                    double point_density,
+                                    const Elem* const elem,
+                                    const boost::multi_array<double, 2>& X_node,
+                                    const double dx_min)
+{
+    unsigned int elem_dim = elem->dim();
+    const ElemType elem_type = elem->type();
+    const unsigned int elem_p_level = elem->p_level();
+    order = getQuadratureOrder(type, order, use_adaptive_quadrature, point_density, elem, X_node, dx_min);
     bool qrule_updated = false;
     if (!qrule || qrule->type() != type || qrule->get_dim() != elem_dim || qrule->get_order() != order ||
         qrule->get_elem_type() != elem_type || qrule->get_p_level() != elem_p_level)
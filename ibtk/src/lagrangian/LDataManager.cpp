@@ -93,6 +93,7 @@
 #include "ibtk/LData.h"
 #include "ibtk/LDataManager.h"
 #include "ibtk/LEInteractor.h"
+#include "ibtk/LEKernelEngine.h"
 #include "ibtk/LIndexSetData.h"
 #include "ibtk/LInitStrategy.h"
 #include "ibtk/LMesh.h"
@@ -172,6 +173,145 @@ static const double TOL = sqrt(std::numeric_limits<double>::epsilon());
 
 // Version of LDataManager restart file data.
 static const int LDATA_MANAGER_VERSION = 1;
+
+// A node along with the (nonnegative) offset of its cell index relative to the
+// lower corner of the ghost box of the patch that contains it.
+struct CellOffsetNode
+{
+    unsigned int cell_offset[NDIM];
+    LNode* node;
+};
+
+// Compare two nodes according to the Morton (Z-order) ordering of their cells.
+// The comparison determines the dimension with the most significant differing
+// bit, and so does not require explicitly interleaving the bits of the cell
+// indices.  As with the Cartesian grid data, the last dimension is the slowest
+// varying one.
+struct CellOffsetNodeMortonComp
+{
+    inline bool operator()(const CellOffsetNode& lhs, const CellOffsetNode& rhs) const
+    {
+        int d_msb = NDIM - 1;
+        unsigned int x_msb = 0;
+        for (int d = NDIM - 1; d >= 0; --d)
+        {
+            const unsigned int x = lhs.cell_offset[d] ^ rhs.cell_offset[d];
+            if (x_msb < x && x_msb < (x_msb ^ x))
+            {
+                d_msb = d;
+                x_msb = x;
+            }
+        }
+        return lhs.cell_offset[d_msb] < rhs.cell_offset[d_msb];
+    }
+};
+
+// Compare two nodes according to the local PETSc indices that they were
+// assigned by the previous node distribution.
+struct CellOffsetNodeLocalIndexComp
+{
+    inline bool operator()(const CellOffsetNode& lhs, const CellOffsetNode& rhs) const
+    {
+        return lhs.node->getLocalPETScIndex() < rhs.node->getLocalPETScIndex();
+    }
+};
+
+// Sort a range of nodes with a stable sort, skipping the sort if the range is
+// already sorted.
+template <class Comp>
+inline void
+stable_sort_if_unsorted(std::vector<CellOffsetNode>& nodes, const Comp& comp)
+{
+    for (size_t k = 1; k < nodes.size(); ++k)
+    {
+        if (comp(nodes[k], nodes[k - 1]))
+        {
+            std::stable_sort(nodes.begin(), nodes.end(), comp);
+            return;
+        }
+    }
+    return;
+}
+
+// Spread the values of the nodes that lie in the specified box onto the
+// Eulerian data, whatever its centering.
+inline void
+spread_patch_data(Pointer<PatchData<NDIM> > f_data,
+                  const double* const F_data,
+                  const int F_depth,
+                  const double* const X_data,
+                  const Pointer<LNodeSetData> idx_data,
+                  const Pointer<Patch<NDIM> > patch,
+                  const Box<NDIM>& box,
+                  const IntVector<NDIM>& periodic_shift,
+                  const std::string& spread_kernel_fcn)
+{
+    Pointer<CellData<NDIM, double> > f_cc_data = f_data;
+    Pointer<EdgeData<NDIM, double> > f_ec_data = f_data;
+    Pointer<NodeData<NDIM, double> > f_nc_data = f_data;
+    Pointer<SideData<NDIM, double> > f_sc_data = f_data;
+    if (f_cc_data)
+    {
+        LEInteractor::spread(
+            f_cc_data, F_data, F_depth, X_data, NDIM, idx_data, patch, box, periodic_shift, spread_kernel_fcn);
+    }
+    if (f_ec_data)
+    {
+        LEInteractor::spread(
+            f_ec_data, F_data, F_depth, X_data, NDIM, idx_data, patch, box, periodic_shift, spread_kernel_fcn);
+    }
+    if (f_nc_data)
+    {
+        LEInteractor::spread(
+            f_nc_data, F_data, F_depth, X_data, NDIM, idx_data, patch, box, periodic_shift, spread_kernel_fcn);
+    }
+    if (f_sc_data)
+    {
+        LEInteractor::spread(
+            f_sc_data, F_data, F_depth, X_data, NDIM, idx_data, patch, box, periodic_shift, spread_kernel_fcn);
+    }
+    return;
+} // spread_patch_data
+
+// Interpolate the Eulerian data onto the nodes that lie in the specified box,
+// whatever its centering.
+inline void
+interp_patch_data(Pointer<PatchData<NDIM> > f_data,
+                  double* const F_data,
+                  const int F_depth,
+                  const double* const X_data,
+                  const Pointer<LNodeSetData> idx_data,
+                  const Pointer<Patch<NDIM> > patch,
+                  const Box<NDIM>& box,
+                  const IntVector<NDIM>& periodic_shift,
+                  const std::string& interp_kernel_fcn)
+{
+    Pointer<CellData<NDIM, double> > f_cc_data = f_data;
+    Pointer<EdgeData<NDIM, double> > f_ec_data = f_data;
+    Pointer<NodeData<NDIM, double> > f_nc_data = f_data;
+    Pointer<SideData<NDIM, double> > f_sc_data = f_data;
+    if (f_cc_data)
+    {
+        LEInteractor::interpolate(
+            F_data, F_depth, X_data, NDIM, idx_data, f_cc_data, patch, box, periodic_shift, interp_kernel_fcn);
+    }
+    if (f_ec_data)
+    {
+        LEInteractor::interpolate(
+            F_data, F_depth, X_data, NDIM, idx_data, f_ec_data, patch, box, periodic_shift, interp_kernel_fcn);
+    }
+    if (f_nc_data)
+    {
+        LEInteractor::interpolate(
+            F_data, F_depth, X_data, NDIM, idx_data, f_nc_data, patch, box, periodic_shift, interp_kernel_fcn);
+    }
+    if (f_sc_data)
+    {
+        LEInteractor::interpolate(
+            F_data, F_depth, X_data, NDIM, idx_data, f_sc_data, patch, box, periodic_shift, interp_kernel_fcn);
+    }
+    return;
+} // interp_patch_data
 }
 
 const std::string LDataManager::POSN_DATA_NAME = "X";
@@ -434,28 +574,23 @@ LDataManager::spread(const int f_data_idx,
         zeroInactivatedComponents(F_data[ln], ln);
     }
 
-    // Compute F*ds.
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
-    {
-        if (!levelContainsLagrangianData(ln)) continue;
-
-        if (F_data_ghost_node_update) F_data[ln]->beginGhostUpdate();
-        if (ds_data_ghost_node_update) ds_data[ln]->beginGhostUpdate();
-    }
+    // Compute F*ds.  When ghost node values are required, only the local
+    // values of F*ds are computed here and the product is communicated in a
+    // single ghost update that overlaps with spreading.
+    const bool F_ds_data_ghost_node_update = F_data_ghost_node_update || ds_data_ghost_node_update;
     std::vector<Pointer<LData> > F_ds_data(F_data.size());
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         if (!levelContainsLagrangianData(ln)) continue;
 
-        if (F_data_ghost_node_update) F_data[ln]->endGhostUpdate();
-        if (ds_data_ghost_node_update) ds_data[ln]->endGhostUpdate();
-
         const int depth = F_data[ln]->getDepth();
         F_ds_data[ln] = new LData("", getNumberOfLocalNodes(ln), depth, d_nonlocal_petsc_indices[ln]);
         boost::multi_array_ref<double, 2>& F_ds_arr = *F_ds_data[ln]->getGhostedLocalFormVecArray();
         const boost::multi_array_ref<double, 2>& F_arr = *F_data[ln]->getGhostedLocalFormVecArray();
         const boost::multi_array_ref<double, 1>& ds_arr = *ds_data[ln]->getGhostedLocalFormArray();
-        for (int k = 0; k < static_cast<int>(F_data[ln]->getLocalNodeCount() + F_data[ln]->getGhostNodeCount()); ++k)
+        const int n_nodes = static_cast<int>(F_data[ln]->getLocalNodeCount() +
+                                             (F_ds_data_ghost_node_update ? 0 : F_data[ln]->getGhostNodeCount()));
+        for (int k = 0; k < n_nodes; ++k)
         {
             for (int d = 0; d < depth; ++d)
             {
@@ -477,7 +612,7 @@ LDataManager::spread(const int f_data_idx,
            f_phys_bdry_op,
            f_prolongation_scheds,
            fill_data_time,
-           /*F_data_ghost_node_update*/ false,
+           F_ds_data_ghost_node_update,
            X_data_ghost_node_update,
            coarsest_ln,
            finest_ln);
@@ -635,40 +770,59 @@ LDataManager::spread(const int f_data_idx,
 
         if (!levelContainsLagrangianData(ln)) continue;
 
-        // Spread data onto the grid.
-        if (F_data_ghost_node_update) F_data[ln]->endGhostUpdate();
-        if (X_data_ghost_node_update) X_data[ln]->endGhostUpdate();
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
         const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(level->getRatio());
+        const int F_depth = F_data[ln]->getDepth();
+        const bool ghost_node_update = F_data_ghost_node_update || X_data_ghost_node_update;
+        if (ghost_node_update)
+        {
+            // Nodes in the patch interiors are local nodes, so they can be
+            // spread using only the local parts of F and X while the ghost node
+            // values are still in flight.  The local parts are accessed
+            // read-only because they are the sources of the ghost updates.
+            const double *F_local_arr, *X_local_arr;
+            int ierr = VecGetArrayRead(F_data[ln]->getVec(), &F_local_arr);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecGetArrayRead(X_data[ln]->getVec(), &X_local_arr);
+            IBTK_CHKERRQ(ierr);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+                spread_patch_data(patch->getPatchData(f_data_idx),
+                                  F_local_arr,
+                                  F_depth,
+                                  X_local_arr,
+                                  idx_data,
+                                  patch,
+                                  patch->getBox(),
+                                  periodic_shift,
+                                  spread_kernel_fcn);
+            }
+            ierr = VecRestoreArrayRead(F_data[ln]->getVec(), &F_local_arr);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecRestoreArrayRead(X_data[ln]->getVec(), &X_local_arr);
+            IBTK_CHKERRQ(ierr);
+            if (F_data_ghost_node_update) F_data[ln]->endGhostUpdate();
+            if (X_data_ghost_node_update) X_data[ln]->endGhostUpdate();
+        }
+
+        // Spread the remaining nodes onto the grid.  If the patch interiors
+        // have already been treated, these are the nodes in the patch ghost
+        // cell regions, some of which may be owned by other processes.
+        const double* const F_arr = F_data[ln]->getGhostedLocalFormVecArray()->data();
+        const double* const X_arr = X_data[ln]->getGhostedLocalFormVecArray()->data();
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<PatchData<NDIM> > f_data = patch->getPatchData(f_data_idx);
             Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
-            const Box<NDIM>& box = idx_data->getGhostBox();
-            if (cc_data)
-            {
-                Pointer<CellData<NDIM, double> > f_cc_data = f_data;
-                LEInteractor::spread(
-                    f_cc_data, F_data[ln], X_data[ln], idx_data, patch, box, periodic_shift, spread_kernel_fcn);
-            }
-            if (ec_data)
-            {
-                Pointer<EdgeData<NDIM, double> > f_ec_data = f_data;
-                LEInteractor::spread(
-                    f_ec_data, F_data[ln], X_data[ln], idx_data, patch, box, periodic_shift, spread_kernel_fcn);
-            }
-            if (nc_data)
-            {
-                Pointer<NodeData<NDIM, double> > f_nc_data = f_data;
-                LEInteractor::spread(
-                    f_nc_data, F_data[ln], X_data[ln], idx_data, patch, box, periodic_shift, spread_kernel_fcn);
-            }
-            if (sc_data)
+            BoxList<NDIM> spread_boxes(idx_data->getGhostBox());
+            if (ghost_node_update) spread_boxes.removeIntersections(patch->getBox());
+            for (BoxList<NDIM>::Iterator bl(spread_boxes); bl; bl++)
             {
-                Pointer<SideData<NDIM, double> > f_sc_data = f_data;
-                LEInteractor::spread(
-                    f_sc_data, F_data[ln], X_data[ln], idx_data, patch, box, periodic_shift, spread_kernel_fcn);
+                spread_patch_data(
+                    f_data, F_arr, F_depth, X_arr, idx_data, patch, bl(), periodic_shift, spread_kernel_fcn);
             }
             if (f_phys_bdry_op)
             {
@@ -676,6 +830,8 @@ LDataManager::spread(const int f_data_idx,
                 f_phys_bdry_op->accumulateFromPhysicalBoundaryData(*patch, fill_data_time, f_data->getGhostCellWidth());
             }
         }
+        F_data[ln]->restoreArrays();
+        X_data[ln]->restoreArrays();
     }
 
     // Accumulate data.
@@ -769,63 +925,34 @@ LDataManager::interp(const int f_data_idx,
         {
             f_ghost_fill_scheds[ln]->fillData(fill_data_time);
         }
+
+        // Only nodes in the patch interiors are updated, and these are all
+        // local nodes.  The positions are therefore read from the local part
+        // of X, which allows a ghost update of X to be in progress.
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
         const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(level->getRatio());
+        const int F_depth = F_data[ln]->getDepth();
+        double* const F_arr = F_data[ln]->getGhostedLocalFormVecArray()->data();
+        const double* X_local_arr;
+        int ierr = VecGetArrayRead(X_data[ln]->getVec(), &X_local_arr);
+        IBTK_CHKERRQ(ierr);
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            Pointer<PatchData<NDIM> > f_data = patch->getPatchData(f_data_idx);
             Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
-            const Box<NDIM>& box = idx_data->getBox();
-            if (cc_data)
-            {
-                Pointer<CellData<NDIM, double> > f_cc_data = f_data;
-                LEInteractor::interpolate(F_data[ln],
-                                          X_data[ln],
-                                          idx_data,
-                                          f_cc_data,
-                                          patch,
-                                          box,
-                                          periodic_shift,
-                                          d_default_interp_kernel_fcn);
-            }
-            if (ec_data)
-            {
-                Pointer<EdgeData<NDIM, double> > f_ec_data = f_data;
-                LEInteractor::interpolate(F_data[ln],
-                                          X_data[ln],
-                                          idx_data,
-                                          f_ec_data,
-                                          patch,
-                                          box,
-                                          periodic_shift,
-                                          d_default_interp_kernel_fcn);
-            }
-            if (nc_data)
-            {
-                Pointer<NodeData<NDIM, double> > f_nc_data = f_data;
-                LEInteractor::interpolate(F_data[ln],
-                                          X_data[ln],
-                                          idx_data,
-                                          f_nc_data,
-                                          patch,
-                                          box,
-                                          periodic_shift,
-                                          d_default_interp_kernel_fcn);
-            }
-            if (sc_data)
-            {
-                Pointer<SideData<NDIM, double> > f_sc_data = f_data;
-                LEInteractor::interpolate(F_data[ln],
-                                          X_data[ln],
-                                          idx_data,
-                                          f_sc_data,
-                                          patch,
-                                          box,
-                                          periodic_shift,
-                                          d_default_interp_kernel_fcn);
-            }
-        }
+            interp_patch_data(patch->getPatchData(f_data_idx),
+                              F_arr,
+                              F_depth,
+                              X_local_arr,
+                              idx_data,
+                              patch,
+                              idx_data->getBox(),
+                              periodic_shift,
+                              d_default_interp_kernel_fcn);
+        }
+        ierr = VecRestoreArrayRead(X_data[ln]->getVec(), &X_local_arr);
+        IBTK_CHKERRQ(ierr);
+        F_data[ln]->restoreArrays();
     }
 
     // Zero inactivated components.
@@ -1895,7 +2022,7 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
-            idx_data->cacheLocalIndices(patch, periodic_shift);
+            idx_data->cacheLocalIndices(patch, periodic_shift, d_use_morton_node_ordering);
             const Box<NDIM>& ghost_box = idx_data->getGhostBox();
             for (LNodeSetData::DataIterator it = idx_data->data_begin(ghost_box); it != idx_data->data_end(); ++it)
             {
@@ -1988,6 +2115,9 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         d_silo_writer->registerLagrangianAO(d_ao, coarsest_ln, finest_ln);
     }
 
+    // Cached interpolation/spreading weights refer to the old patch layout.
+    LEKernelEngine::clearWeightCache();
+
     IBTK_TIMER_STOP(t_end_data_redistribution);
     return;
 } // endDataRedistribution
@@ -2298,7 +2428,7 @@ LDataManager::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> > hiera
 
             node_count_data->fillAll(0.0);
 
-            idx_data->cacheLocalIndices(patch, periodic_shift);
+            idx_data->cacheLocalIndices(patch, periodic_shift, d_use_morton_node_ordering);
             for (LNodeSetData::SetIterator it(*idx_data); it; it++)
             {
                 const CellIndex<NDIM>& i = it.getIndex();
@@ -2697,6 +2827,7 @@ LDataManager::LDataManager(const std::string& object_name,
       d_default_interp_kernel_fcn(default_interp_kernel_fcn),
       d_default_spread_kernel_fcn(default_spread_kernel_fcn),
       d_error_if_points_leave_domain(error_if_points_leave_domain),
+      d_use_morton_node_ordering(false),
       d_ghost_width(ghost_width),
       d_lag_node_index_bdry_fill_alg(NULL),
       d_lag_node_index_bdry_fill_scheds(),
@@ -2986,11 +3117,56 @@ LDataManager::computeNodeDistribution(AO& ao,
     unsigned int local_offset = 0;
     std::map<int, int> lag_idx_to_petsc_idx;
 #if 1
+    std::vector<CellOffsetNode> patch_nodes;
     for (PatchLevel<NDIM>::Iterator p(level); p; p++)
     {
         const Pointer<Patch<NDIM> > patch = level->getPatch(p());
         const Box<NDIM>& patch_box = patch->getBox();
         const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+        if (d_use_morton_node_ordering)
+        {
+            // Order the nodes of the patch by the Morton index of their cells.
+            //
+            // The nodes are first put into the order given by their previous
+            // local indices, so that the subsequent stable sort keeps nodes
+            // that share a cell in their previous relative order.  If the
+            // patch contains the same nodes as it did when the ordering was
+            // last computed, and none of them has changed cells, then both
+            // sorts are skipped and the nodes keep their previous order.  Nodes
+            // that were received from other processors carry local indices
+            // assigned by those processors, which only affects their order
+            // relative to other nodes in the same cell.
+            const Index<NDIM>& ig_lower = idx_data->getGhostBox().lower();
+            patch_nodes.clear();
+            for (LNodeSetData::SetIterator it(*idx_data); it; it++)
+            {
+                const CellIndex<NDIM>& i = it.getIndex();
+                if (!patch_box.contains(i)) continue;
+                CellOffsetNode cell_node;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    cell_node.cell_offset[d] = static_cast<unsigned int>(i(d) - ig_lower(d));
+                }
+                const LNodeSet& node_set = *it;
+                for (LNodeSet::const_iterator n = node_set.begin(); n != node_set.end(); ++n)
+                {
+                    cell_node.node = *n;
+                    patch_nodes.push_back(cell_node);
+                }
+            }
+            stable_sort_if_unsorted(patch_nodes, CellOffsetNodeLocalIndexComp());
+            stable_sort_if_unsorted(patch_nodes, CellOffsetNodeMortonComp());
+            for (std::vector<CellOffsetNode>::const_iterator it = patch_nodes.begin(); it != patch_nodes.end(); ++it)
+            {
+                LNode* const node_idx = it->node;
+                const int lag_idx = node_idx->getLagrangianIndex();
+                local_lag_indices.push_back(lag_idx);
+                const int petsc_idx = local_offset++;
+                node_idx->setLocalPETScIndex(petsc_idx);
+                lag_idx_to_petsc_idx[lag_idx] = petsc_idx;
+            }
+            continue;
+        }
         for (LNodeSetData::DataIterator it = idx_data->data_begin(patch_box); it != idx_data->data_end(); ++it)
         {
             LNode* const node_idx = *it;
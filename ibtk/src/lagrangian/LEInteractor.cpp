@@ -58,6 +58,7 @@
 #include "ibtk/IndexUtilities.h"
 #include "ibtk/LData.h"
 #include "ibtk/LEInteractor.h"
+#include "ibtk/LEKernelEngine.h"
 #include "ibtk/LIndexSetData.h"
 #include "ibtk/LSet.h"
 #include "ibtk/ibtk_utilities.h"
@@ -66,6 +67,10 @@
 #include "tbox/Pointer.h"
 #include "tbox/Utilities.h"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 // FORTRAN ROUTINES
 #if (NDIM == 2)
 #define LAGRANGIAN_PIECEWISE_CONSTANT_INTERP_FC                                                                        \
@@ -1324,14 +1329,71 @@ spread_data(const int stencil_sz,
     }
 #endif
 } // spread_data
+
+// Whether to hand the markers of a patch off to multiple threads.  Only the
+// C++ kernel engine is used from multiple threads: the Fortran kernels are not
+// guaranteed to be reentrant, since the build system does not compile them
+// with -frecursive or -fopenmp.  Nested calls (including those made by the
+// threaded implementations themselves) are always serial.
+inline bool
+use_threads(const bool threading_enabled,
+            const bool kernel_engine_enabled,
+            const std::string& kernel_fcn,
+            const int num_markers,
+            const int min_markers)
+{
+#ifdef _OPENMP
+    return threading_enabled && kernel_engine_enabled && LEKernelEngine::isSupported(kernel_fcn) &&
+           num_markers >= min_markers && omp_get_level() == 0 && omp_get_max_threads() > 1;
+#else
+    NULL_USE(threading_enabled);
+    NULL_USE(kernel_engine_enabled);
+    NULL_USE(kernel_fcn);
+    NULL_USE(num_markers);
+    NULL_USE(min_markers);
+    return false;
+#endif
+}
 }
 
 double (*LEInteractor::s_kernel_fcn)(double r) = &ib4_kernel_fcn;
 int LEInteractor::s_kernel_fcn_stencil_size = 4;
 
-void LEInteractor::setFromDatabase(Pointer<Database> /*db*/)
+bool LEInteractor::s_use_kernel_engine = false;
+bool LEInteractor::s_use_threaded_spreading = false;
+bool LEInteractor::s_use_threaded_interpolation = false;
+int LEInteractor::s_min_threaded_markers = 1024;
+
+void
+LEInteractor::setFromDatabase(Pointer<Database> db)
 {
-    // intentionally blank
+    if (!db) return;
+    if (db->keyExists("use_kernel_engine")) s_use_kernel_engine = db->getBool("use_kernel_engine");
+    if (db->keyExists("cache_kernel_weights"))
+        LEKernelEngine::setWeightCachingEnabled(db->getBool("cache_kernel_weights"));
+    if (db->keyExists("max_kernel_weight_cache_size"))
+        LEKernelEngine::setMaxWeightCacheSize(db->getInteger("max_kernel_weight_cache_size"));
+    if (db->keyExists("deterministic_mode")) LEKernelEngine::setDeterministicMode(db->getBool("deterministic_mode"));
+    if (db->keyExists("use_threaded_spreading")) s_use_threaded_spreading = db->getBool("use_threaded_spreading");
+    if (db->keyExists("use_threaded_interpolation"))
+        s_use_threaded_interpolation = db->getBool("use_threaded_interpolation");
+    if (db->keyExists("min_threaded_markers")) s_min_threaded_markers = db->getInteger("min_threaded_markers");
+#ifndef _OPENMP
+    if (s_use_threaded_spreading || s_use_threaded_interpolation)
+    {
+        TBOX_WARNING("LEInteractor::setFromDatabase():\n"
+                     << "  threaded spreading/interpolation requested, but IBTK was not compiled with OpenMP.\n"
+                     << "  markers will be processed serially."
+                     << std::endl);
+    }
+#endif
+    if ((s_use_threaded_spreading || s_use_threaded_interpolation) && !s_use_kernel_engine)
+    {
+        TBOX_WARNING("LEInteractor::setFromDatabase():\n"
+                     << "  threaded spreading/interpolation requires use_kernel_engine = TRUE.\n"
+                     << "  markers will be processed serially."
+                     << std::endl);
+    }
     return;
 }
 
@@ -1339,6 +1401,12 @@ void
 LEInteractor::printClassData(std::ostream& os)
 {
     os << "LEInteractor::printClassData():\n";
+    os << "  s_use_kernel_engine = " << s_use_kernel_engine << "\n";
+    os << "  kernel engine weight caching = " << LEKernelEngine::getWeightCachingEnabled() << "\n";
+    os << "  kernel engine deterministic mode = " << LEKernelEngine::getDeterministicMode() << "\n";
+    os << "  s_use_threaded_spreading = " << s_use_threaded_spreading << "\n";
+    os << "  s_use_threaded_interpolation = " << s_use_threaded_interpolation << "\n";
+    os << "  s_min_threaded_markers = " << s_min_threaded_markers << "\n";
     return;
 }
 
@@ -3770,8 +3838,8 @@ LEInteractor::interpolate(double* const Q_data,
                           const double* const x_lower,
                           const double* const x_upper,
                           const double* const dx,
-                          const boost::array<int, NDIM>& /*patch_touches_lower_physical_bdry*/,
-                          const boost::array<int, NDIM>& /*patch_touches_upper_physical_bdry*/,
+                          const boost::array<int, NDIM>& patch_touches_lower_physical_bdry,
+                          const boost::array<int, NDIM>& patch_touches_upper_physical_bdry,
                           const std::vector<int>& local_indices,
                           const std::vector<double>& periodic_shifts,
                           const std::string& interp_fcn,
@@ -3798,6 +3866,47 @@ LEInteractor::interpolate(double* const Q_data,
     }
     if (local_indices.empty()) return;
     const int local_indices_size = static_cast<int>(local_indices.size());
+    if (use_threads(s_use_threaded_interpolation,
+                    s_use_kernel_engine,
+                    interp_fcn,
+                    local_indices_size,
+                    s_min_threaded_markers))
+    {
+        threadedInterpolate(Q_data,
+                            Q_depth,
+                            X_data,
+                            q_data,
+                            q_data_box,
+                            q_gcw,
+                            q_depth,
+                            x_lower,
+                            x_upper,
+                            dx,
+                            patch_touches_lower_physical_bdry,
+                            patch_touches_upper_physical_bdry,
+                            local_indices,
+                            periodic_shifts,
+                            interp_fcn,
+                            axis);
+        return;
+    }
+    if (s_use_kernel_engine && LEKernelEngine::isSupported(interp_fcn))
+    {
+        LEKernelEngine::interpolate(Q_data,
+                                    Q_depth,
+                                    X_data,
+                                    q_data,
+                                    q_data_box,
+                                    q_gcw,
+                                    q_depth,
+                                    x_lower,
+                                    dx,
+                                    &local_indices[0],
+                                    &periodic_shifts[0],
+                                    local_indices_size,
+                                    interp_fcn);
+        return;
+    }
     const IntVector<NDIM>& ilower = q_data_box.lower();
     const IntVector<NDIM>& iupper = q_data_box.upper();
     if (interp_fcn == "PIECEWISE_CONSTANT")
@@ -4288,6 +4397,47 @@ LEInteractor::spread(double* const q_data,
     }
     if (local_indices.empty()) return;
     const int local_indices_size = static_cast<int>(local_indices.size());
+    if (use_threads(s_use_threaded_spreading,
+                    s_use_kernel_engine,
+                    spread_fcn,
+                    local_indices_size,
+                    s_min_threaded_markers))
+    {
+        threadedSpread(q_data,
+                       q_data_box,
+                       q_gcw,
+                       q_depth,
+                       Q_data,
+                       Q_depth,
+                       X_data,
+                       x_lower,
+                       x_upper,
+                       dx,
+                       patch_touches_lower_physical_bdry,
+                       patch_touches_upper_physical_bdry,
+                       local_indices,
+                       periodic_shifts,
+                       spread_fcn,
+                       axis);
+        return;
+    }
+    if (s_use_kernel_engine && LEKernelEngine::isSupported(spread_fcn))
+    {
+        LEKernelEngine::spread(q_data,
+                               q_data_box,
+                               q_gcw,
+                               q_depth,
+                               Q_data,
+                               Q_depth,
+                               X_data,
+                               x_lower,
+                               dx,
+                               &local_indices[0],
+                               &periodic_shifts[0],
+                               local_indices_size,
+                               spread_fcn);
+        return;
+    }
     const IntVector<NDIM>& ilower = q_data_box.lower();
     const IntVector<NDIM>& iupper = q_data_box.upper();
     if (spread_fcn == "PIECEWISE_CONSTANT")
@@ -4733,6 +4883,204 @@ LEInteractor::spread(double* const q_data,
     return;
 }
 
+void
+LEInteractor::threadedInterpolate(double* const Q_data,
+                                  const int Q_depth,
+                                  const double* const X_data,
+                                  const double* const q_data,
+                                  const Box<NDIM>& q_data_box,
+                                  const IntVector<NDIM>& q_gcw,
+                                  const int q_depth,
+                                  const double* const x_lower,
+                                  const double* const x_upper,
+                                  const double* const dx,
+                                  const boost::array<int, NDIM>& patch_touches_lower_physical_bdry,
+                                  const boost::array<int, NDIM>& patch_touches_upper_physical_bdry,
+                                  const std::vector<int>& local_indices,
+                                  const std::vector<double>& periodic_shifts,
+                                  const std::string& interp_fcn,
+                                  const int axis)
+{
+    const int num_markers = static_cast<int>(local_indices.size());
+
+    // Periodic images of the same marker write to the same output values, in
+    // which case the markers must be processed serially to retain the serial
+    // (last image wins) semantics.
+    const int max_index = *std::max_element(local_indices.begin(), local_indices.end());
+    std::vector<char> marker_seen(max_index + 1, 0);
+    bool has_duplicates = false;
+    for (int l = 0; l < num_markers && !has_duplicates; ++l)
+    {
+        char& seen = marker_seen[local_indices[l]];
+        has_duplicates = seen;
+        seen = 1;
+    }
+
+    // Split the markers into contiguous chunks that are interpolated
+    // independently.
+    int num_chunks = 1;
+#ifdef _OPENMP
+    if (!has_duplicates) num_chunks = std::min(4 * omp_get_max_threads(), num_markers);
+#endif
+    const int chunk_size = (num_markers + num_chunks - 1) / num_chunks;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int k = 0; k < num_chunks; ++k)
+    {
+        const int l_begin = std::min(k * chunk_size, num_markers);
+        const int l_end = std::min(l_begin + chunk_size, num_markers);
+        if (l_begin == l_end) continue;
+        const std::vector<int> chunk_indices(local_indices.begin() + l_begin, local_indices.begin() + l_end);
+        const std::vector<double> chunk_shifts(periodic_shifts.begin() + NDIM * l_begin,
+                                               periodic_shifts.begin() + NDIM * l_end);
+        interpolate(Q_data,
+                    Q_depth,
+                    X_data,
+                    q_data,
+                    q_data_box,
+                    q_gcw,
+                    q_depth,
+                    x_lower,
+                    x_upper,
+                    dx,
+                    patch_touches_lower_physical_bdry,
+                    patch_touches_upper_physical_bdry,
+                    chunk_indices,
+                    chunk_shifts,
+                    interp_fcn,
+                    axis);
+    }
+    return;
+}
+
+void
+LEInteractor::threadedSpread(double* const q_data,
+                             const Box<NDIM>& q_data_box,
+                             const IntVector<NDIM>& q_gcw,
+                             const int q_depth,
+                             const double* const Q_data,
+                             const int Q_depth,
+                             const double* const X_data,
+                             const double* const x_lower,
+                             const double* const x_upper,
+                             const double* const dx,
+                             const boost::array<int, NDIM>& patch_touches_lower_physical_bdry,
+                             const boost::array<int, NDIM>& patch_touches_upper_physical_bdry,
+                             const std::vector<int>& local_indices,
+                             const std::vector<double>& periodic_shifts,
+                             const std::string& spread_fcn,
+                             const int axis)
+{
+    const int num_markers = static_cast<int>(local_indices.size());
+
+    // Tile the ghost box of the patch data.  The tiles are two cells wider
+    // than the kernel stencil, so that the stencils of markers in tiles that
+    // are separated by at least one other tile in each direction never
+    // overlap, even allowing for round-off in the stencil location.
+    const int tile_width = getStencilSize(spread_fcn) + 2;
+    const Box<NDIM> ghost_box = Box<NDIM>::grow(q_data_box, q_gcw);
+    const IntVector<NDIM>& ig_lower = ghost_box.lower();
+    const IntVector<NDIM>& ilower = q_data_box.lower();
+    IntVector<NDIM> num_tiles;
+    int total_num_tiles = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        num_tiles(d) = (ghost_box.numberCells(d) + tile_width - 1) / tile_width;
+        total_num_tiles *= num_tiles(d);
+    }
+
+    // Bin the markers by tile.  Markers that lie outside of the ghost box are
+    // assigned to the nearest tile, which contains all of the grid values that
+    // they can update.
+    std::vector<int> marker_tile(num_markers);
+    std::vector<int> tile_offset(total_num_tiles + 1, 0);
+    for (int l = 0; l < num_markers; ++l)
+    {
+        const int s = local_indices[l];
+        int tile = 0;
+        for (int d = NDIM - 1; d >= 0; --d)
+        {
+            const double X_o_dx = (X_data[NDIM * s + d] + periodic_shifts[NDIM * l + d] - x_lower[d]) / dx[d];
+            const int ic = static_cast<int>(std::floor(X_o_dx)) + ilower(d);
+            const int t = std::max(0, std::min(num_tiles(d) - 1, (ic - ig_lower(d)) / tile_width));
+            tile = tile * num_tiles(d) + t;
+        }
+        marker_tile[l] = tile;
+        ++tile_offset[tile + 1];
+    }
+    for (int tile = 0; tile < total_num_tiles; ++tile)
+    {
+        tile_offset[tile + 1] += tile_offset[tile];
+    }
+
+    // Sort the markers by tile.  The sort is stable, so that the markers
+    // within each tile are spread in their original order.
+    std::vector<int> sorted_indices(num_markers);
+    std::vector<double> sorted_shifts(NDIM * num_markers);
+    std::vector<int> tile_fill(tile_offset.begin(), tile_offset.end() - 1);
+    for (int l = 0; l < num_markers; ++l)
+    {
+        const int k = tile_fill[marker_tile[l]]++;
+        sorted_indices[k] = local_indices[l];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            sorted_shifts[NDIM * k + d] = periodic_shifts[NDIM * l + d];
+        }
+    }
+
+    // Spread the markers one color at a time.  Tiles of the same color do not
+    // share any grid values, and so they may be processed concurrently.
+    static const int num_colors = 1 << NDIM;
+    std::vector<int> color_tiles;
+    color_tiles.reserve(total_num_tiles);
+    for (int color = 0; color < num_colors; ++color)
+    {
+        color_tiles.clear();
+        for (int tile = 0; tile < total_num_tiles; ++tile)
+        {
+            if (tile_offset[tile] == tile_offset[tile + 1]) continue;
+            int tile_color = 0, t = tile;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                tile_color |= ((t % num_tiles(d)) % 2) << d;
+                t /= num_tiles(d);
+            }
+            if (tile_color == color) color_tiles.push_back(tile);
+        }
+        const int num_color_tiles = static_cast<int>(color_tiles.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for (int k = 0; k < num_color_tiles; ++k)
+        {
+            const int tile = color_tiles[k];
+            const int l_begin = tile_offset[tile];
+            const int l_end = tile_offset[tile + 1];
+            const std::vector<int> tile_indices(sorted_indices.begin() + l_begin, sorted_indices.begin() + l_end);
+            const std::vector<double> tile_shifts(sorted_shifts.begin() + NDIM * l_begin,
+                                                  sorted_shifts.begin() + NDIM * l_end);
+            spread(q_data,
+                   q_data_box,
+                   q_gcw,
+                   q_depth,
+                   Q_data,
+                   Q_depth,
+                   X_data,
+                   x_lower,
+                   x_upper,
+                   dx,
+                   patch_touches_lower_physical_bdry,
+                   patch_touches_upper_physical_bdry,
+                   tile_indices,
+                   tile_shifts,
+                   spread_fcn,
+                   axis);
+        }
+    }
+    return;
+}
+
 template <class T>
 void
 LEInteractor::buildLocalIndices(std::vector<int>& local_indices,
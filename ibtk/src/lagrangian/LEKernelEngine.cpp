@@ -0,0 +1,894 @@
+// Filename: LEKernelEngine.cpp
+// Created on 17 Oct 2026
+//
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "Box.h"
+#include "IBTK_config.h"
+#include "IntVector.h"
+#include "ibtk/LEKernelEngine.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Utilities.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// The weight cache is shared state, so it is bypassed when the engine is
+// invoked from within a threaded region.
+inline bool
+in_parallel_region()
+{
+#ifdef _OPENMP
+    return omp_in_parallel();
+#else
+    return false;
+#endif
+}
+
+inline int
+NINT(double a)
+{
+    return (a >= 0.0 ? static_cast<int>(a + 0.5) : static_cast<int>(a - 0.5));
+}
+
+// The kernel weight functions.  Each function evaluates the one-dimensional
+// weights for n markers in structure-of-arrays form: w[k*n+l] is the weight of
+// stencil entry k for marker l, and r[l] is the offset of marker l relative to
+// the center of stencil entry (width/2-1).
+struct PiecewiseLinearKernel
+{
+    static const int width = 2;
+
+    static inline void computeWeights(const double* const r, double* const w, const int n)
+    {
+        double* const w0 = w;
+        double* const w1 = w + n;
+        for (int l = 0; l < n; ++l)
+        {
+            w0[l] = 1.0 - r[l];
+            w1[l] = r[l];
+        }
+        return;
+    }
+};
+
+struct IB4Kernel
+{
+    static const int width = 4;
+
+    static inline void computeWeights(const double* const r, double* const w, const int n)
+    {
+        double* const w0 = w;
+        double* const w1 = w + n;
+        double* const w2 = w + 2 * n;
+        double* const w3 = w + 3 * n;
+        for (int l = 0; l < n; ++l)
+        {
+            // NOTE: These expressions are written to match those used by the
+            // Fortran IB_4 kernels operation-for-operation.
+            const double q = sqrt(1.0 + 4.0 * r[l] * (1.0 - r[l]));
+            w0[l] = 0.125 * (3.0 - 2.0 * r[l] - q);
+            w1[l] = 0.125 * (3.0 - 2.0 * r[l] + q);
+            w2[l] = 0.125 * (1.0 + 2.0 * r[l] + q);
+            w3[l] = 0.125 * (1.0 + 2.0 * r[l] - q);
+        }
+        return;
+    }
+};
+
+struct BSpline4Kernel
+{
+    static const int width = 4;
+
+    static inline void computeWeights(const double* const r, double* const w, const int n)
+    {
+        static const double one_sixth = 1.0 / 6.0;
+        double* const w0 = w;
+        double* const w1 = w + n;
+        double* const w2 = w + 2 * n;
+        double* const w3 = w + 3 * n;
+        for (int l = 0; l < n; ++l)
+        {
+            const double s = 1.0 - r[l];
+            const double r2 = r[l] * r[l];
+            const double r3 = r2 * r[l];
+            const double s2 = s * s;
+            const double s3 = s2 * s;
+            w0[l] = one_sixth * s3;
+            w1[l] = one_sixth * (4.0 - 6.0 * r2 + 3.0 * r3);
+            w2[l] = one_sixth * (4.0 - 6.0 * s2 + 3.0 * s3);
+            w3[l] = one_sixth * r3;
+        }
+        return;
+    }
+};
+
+// Stencil origins and one-dimensional weights for a collection of markers.
+struct StencilWeights
+{
+    int width;
+    int num_markers;
+    std::vector<int> ic_lower;  // ic_lower[d*n+l]
+    std::vector<double> w;      // w[(d*width+k)*n+l]
+};
+
+template <class Kernel>
+void
+compute_stencil_weights(StencilWeights& sw, const std::vector<double>& X_o_dx, const int* const ilower, const int n)
+{
+    const int W = Kernel::width;
+    sw.width = W;
+    sw.num_markers = n;
+    sw.ic_lower.resize(NDIM * n);
+    sw.w.resize(NDIM * W * n);
+    std::vector<double> r(n);
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        const double* const X = &X_o_dx[d * n];
+        int* const ic = &sw.ic_lower[d * n];
+        for (int l = 0; l < n; ++l)
+        {
+            ic[l] = NINT(X[l]) + ilower[d] - W / 2;
+            r[l] = X[l] - (static_cast<double>(ic[l] + W / 2 - 1 - ilower[d]) + 0.5);
+        }
+        Kernel::computeWeights(&r[0], &sw.w[d * W * n], n);
+    }
+    return;
+}
+
+// A cached set of stencil weights, along with the data required to determine
+// whether the cached weights may be reused.
+struct WeightCacheEntry
+{
+    std::string kernel_fcn;
+    int ilower[NDIM], iupper[NDIM];
+    std::vector<double> X_o_dx;
+    StencilWeights weights;
+};
+
+std::vector<WeightCacheEntry> s_weight_cache;
+int s_weight_cache_next_slot = 0;
+
+// Compute the (shifted) marker positions in units of the grid spacing relative
+// to the lower corner of the patch data box, in structure-of-arrays form.
+void
+compute_scaled_positions(std::vector<double>& X_o_dx,
+                         const double* const X,
+                         const double* const x_lower,
+                         const double* const dx,
+                         const int* const local_indices,
+                         const double* const X_shift,
+                         const int n)
+{
+    X_o_dx.resize(NDIM * n);
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        double* const X_d = &X_o_dx[d * n];
+        for (int l = 0; l < n; ++l)
+        {
+            const int s = local_indices[l];
+            X_d[l] = (X[d + s * NDIM] + X_shift[d + l * NDIM] - x_lower[d]) / dx[d];
+        }
+    }
+    return;
+}
+
+template <class Kernel>
+const StencilWeights&
+get_cached_stencil_weights(const std::string& kernel_fcn,
+                           const std::vector<double>& X_o_dx,
+                           const int* const ilower,
+                           const int* const iupper,
+                           const int n,
+                           const int max_cache_size)
+{
+    // Look for the cache entry that corresponds to the same kernel function
+    // and patch data box.  If the marker positions are unchanged, the cached
+    // weights are reused; otherwise, the entry is recomputed in place.
+    WeightCacheEntry* entry = NULL;
+    for (std::vector<WeightCacheEntry>::iterator it = s_weight_cache.begin(); it != s_weight_cache.end(); ++it)
+    {
+        if (it->kernel_fcn != kernel_fcn) continue;
+        bool same_box = true;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            same_box = same_box && (it->ilower[d] == ilower[d]) && (it->iupper[d] == iupper[d]);
+        }
+        if (!same_box) continue;
+        if (it->weights.num_markers == n &&
+            std::memcmp(&it->X_o_dx[0], &X_o_dx[0], NDIM * n * sizeof(double)) == 0)
+        {
+            return it->weights;
+        }
+        entry = &(*it);
+        break;
+    }
+
+    // Otherwise, compute the weights and store them in the cache, replacing
+    // old entries in round-robin order once the cache is full.
+    if (!entry)
+    {
+        if (static_cast<int>(s_weight_cache.size()) < max_cache_size)
+        {
+            s_weight_cache.push_back(WeightCacheEntry());
+            entry = &s_weight_cache.back();
+        }
+        else
+        {
+            s_weight_cache_next_slot = s_weight_cache_next_slot % static_cast<int>(s_weight_cache.size());
+            entry = &s_weight_cache[s_weight_cache_next_slot++];
+        }
+        entry->kernel_fcn = kernel_fcn;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            entry->ilower[d] = ilower[d];
+            entry->iupper[d] = iupper[d];
+        }
+    }
+    entry->X_o_dx = X_o_dx;
+    compute_stencil_weights<Kernel>(entry->weights, X_o_dx, ilower, n);
+    return entry->weights;
+}
+
+// Compute the tensor-product weights for marker l along with the portion of
+// the stencil that lies within the ghost box of the patch data.  The return
+// value indicates whether the entire stencil lies within the ghost box.
+template <int W, bool deterministic>
+inline bool
+compute_tensor_weights(double* const wt,
+                       int* const ic_lower,
+                       int* const istart,
+                       int* const istop,
+                       const StencilWeights& sw,
+                       const int l,
+                       const int* const ig_lower,
+                       const int* const ig_upper,
+                       const double scale)
+{
+    const int n = sw.num_markers;
+    bool interior = true;
+    double w[NDIM][W];
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        ic_lower[d] = sw.ic_lower[d * n + l];
+        istart[d] = std::max(ig_lower[d] - ic_lower[d], 0);
+        istop[d] = (W - 1) - std::max(ic_lower[d] + (W - 1) - ig_upper[d], 0);
+        interior = interior && (istart[d] == 0) && (istop[d] == W - 1);
+        for (int k = 0; k < W; ++k) w[d][k] = sw.w[(d * W + k) * n + l];
+    }
+
+    // NOTE: In deterministic mode, the tensor-product weights are formed in the
+    // same order as in the Fortran kernels, and the scale factor (if any) is
+    // applied to the slowest-varying weight.
+#if (NDIM == 2)
+    for (int i1 = 0; i1 < W; ++i1)
+    {
+        const double wy = (deterministic && scale != 1.0) ? w[1][i1] / scale : w[1][i1];
+        for (int i0 = 0; i0 < W; ++i0) wt[i0 + W * i1] = w[0][i0] * wy;
+    }
+#endif
+#if (NDIM == 3)
+    for (int i2 = 0; i2 < W; ++i2)
+    {
+        const double wz = (deterministic && scale != 1.0) ? w[2][i2] / scale : w[2][i2];
+        for (int i1 = 0; i1 < W; ++i1)
+        {
+            const double wyz = w[1][i1] * wz;
+            for (int i0 = 0; i0 < W; ++i0) wt[i0 + W * (i1 + W * i2)] = w[0][i0] * wyz;
+        }
+    }
+#endif
+    return interior;
+}
+
+template <int W, bool deterministic>
+void
+interpolate_data(double* const Q,
+                 const int Q_depth,
+                 const double* const q,
+                 const int* const ig_lower,
+                 const int* const ig_upper,
+                 const int q_depth,
+                 const int* const local_indices,
+                 const StencilWeights& sw)
+{
+    const int n = sw.num_markers;
+    const int ng0 = ig_upper[0] - ig_lower[0] + 1;
+    const int ng1 = ig_upper[1] - ig_lower[1] + 1;
+#if (NDIM == 2)
+    const int depth_stride = ng0 * ng1;
+#endif
+#if (NDIM == 3)
+    const int ng2 = ig_upper[2] - ig_lower[2] + 1;
+    const int depth_stride = ng0 * ng1 * ng2;
+#endif
+    int ic_lower[NDIM], istart[NDIM], istop[NDIM];
+#if (NDIM == 2)
+    double wt[W * W];
+#endif
+#if (NDIM == 3)
+    double wt[W * W * W];
+#endif
+    for (int l = 0; l < n; ++l)
+    {
+        const int s = local_indices[l];
+        const bool interior =
+            compute_tensor_weights<W, deterministic>(wt, ic_lower, istart, istop, sw, l, ig_lower, ig_upper, 1.0);
+#if (NDIM == 2)
+        const int offset = (ic_lower[1] - ig_lower[1]) * ng0 + (ic_lower[0] - ig_lower[0]);
+        for (int d = 0; d < q_depth; ++d)
+        {
+            const double* const q_d = q + d * depth_stride + offset;
+            double V = 0.0;
+            if (interior)
+            {
+                for (int i1 = 0; i1 < W; ++i1)
+                {
+                    for (int i0 = 0; i0 < W; ++i0) V += wt[i0 + W * i1] * q_d[i0 + ng0 * i1];
+                }
+            }
+            else
+            {
+                for (int i1 = istart[1]; i1 <= istop[1]; ++i1)
+                {
+                    for (int i0 = istart[0]; i0 <= istop[0]; ++i0) V += wt[i0 + W * i1] * q_d[i0 + ng0 * i1];
+                }
+            }
+            Q[d + s * Q_depth] = V;
+        }
+#endif
+#if (NDIM == 3)
+        const int offset =
+            ((ic_lower[2] - ig_lower[2]) * ng1 + (ic_lower[1] - ig_lower[1])) * ng0 + (ic_lower[0] - ig_lower[0]);
+        for (int d = 0; d < q_depth; ++d)
+        {
+            const double* const q_d = q + d * depth_stride + offset;
+            double V = 0.0;
+            if (interior)
+            {
+                for (int i2 = 0; i2 < W; ++i2)
+                {
+                    for (int i1 = 0; i1 < W; ++i1)
+                    {
+                        const double* const q_row = q_d + ng0 * (i1 + ng1 * i2);
+                        const double* const wt_row = wt + W * (i1 + W * i2);
+                        for (int i0 = 0; i0 < W; ++i0) V += wt_row[i0] * q_row[i0];
+                    }
+                }
+            }
+            else
+            {
+                for (int i2 = istart[2]; i2 <= istop[2]; ++i2)
+                {
+                    for (int i1 = istart[1]; i1 <= istop[1]; ++i1)
+                    {
+                        const double* const q_row = q_d + ng0 * (i1 + ng1 * i2);
+                        const double* const wt_row = wt + W * (i1 + W * i2);
+                        for (int i0 = istart[0]; i0 <= istop[0]; ++i0) V += wt_row[i0] * q_row[i0];
+                    }
+                }
+            }
+            Q[d + s * Q_depth] = V;
+        }
+#endif
+    }
+    return;
+}
+
+template <int W, bool deterministic>
+void
+spread_data(double* const q,
+            const int* const ig_lower,
+            const int* const ig_upper,
+            const int q_depth,
+            const double* const Q,
+            const int Q_depth,
+            const double* const dx,
+            const int* const local_indices,
+            const StencilWeights& sw)
+{
+    const int n = sw.num_markers;
+    const int ng0 = ig_upper[0] - ig_lower[0] + 1;
+    const int ng1 = ig_upper[1] - ig_lower[1] + 1;
+#if (NDIM == 2)
+    const int depth_stride = ng0 * ng1;
+    const double dV = dx[0] * dx[1];
+#endif
+#if (NDIM == 3)
+    const int ng2 = ig_upper[2] - ig_lower[2] + 1;
+    const int depth_stride = ng0 * ng1 * ng2;
+    const double dV = dx[0] * dx[1] * dx[2];
+#endif
+    // In deterministic mode, the weights are scaled by 1/dV.  Otherwise, the
+    // spread values are scaled once per marker.
+    const double fac = deterministic ? 1.0 : 1.0 / dV;
+    int ic_lower[NDIM], istart[NDIM], istop[NDIM];
+#if (NDIM == 2)
+    double wt[W * W];
+#endif
+#if (NDIM == 3)
+    double wt[W * W * W];
+#endif
+    for (int l = 0; l < n; ++l)
+    {
+        const int s = local_indices[l];
+        const bool interior =
+            compute_tensor_weights<W, deterministic>(wt, ic_lower, istart, istop, sw, l, ig_lower, ig_upper, dV);
+#if (NDIM == 2)
+        const int offset = (ic_lower[1] - ig_lower[1]) * ng0 + (ic_lower[0] - ig_lower[0]);
+        for (int d = 0; d < q_depth; ++d)
+        {
+            double* const q_d = q + d * depth_stride + offset;
+            const double V = deterministic ? Q[d + s * Q_depth] : Q[d + s * Q_depth] * fac;
+            if (interior)
+            {
+                for (int i1 = 0; i1 < W; ++i1)
+                {
+                    for (int i0 = 0; i0 < W; ++i0) q_d[i0 + ng0 * i1] += wt[i0 + W * i1] * V;
+                }
+            }
+            else
+            {
+                for (int i1 = istart[1]; i1 <= istop[1]; ++i1)
+                {
+                    for (int i0 = istart[0]; i0 <= istop[0]; ++i0) q_d[i0 + ng0 * i1] += wt[i0 + W * i1] * V;
+                }
+            }
+        }
+#endif
+#if (NDIM == 3)
+        const int offset =
+            ((ic_lower[2] - ig_lower[2]) * ng1 + (ic_lower[1] - ig_lower[1])) * ng0 + (ic_lower[0] - ig_lower[0]);
+        for (int d = 0; d < q_depth; ++d)
+        {
+            double* const q_d = q + d * depth_stride + offset;
+            const double V = deterministic ? Q[d + s * Q_depth] : Q[d + s * Q_depth] * fac;
+            if (interior)
+            {
+                for (int i2 = 0; i2 < W; ++i2)
+                {
+                    for (int i1 = 0; i1 < W; ++i1)
+                    {
+                        double* const q_row = q_d + ng0 * (i1 + ng1 * i2);
+                        const double* const wt_row = wt + W * (i1 + W * i2);
+                        for (int i0 = 0; i0 < W; ++i0) q_row[i0] += wt_row[i0] * V;
+                    }
+                }
+            }
+            else
+            {
+                for (int i2 = istart[2]; i2 <= istop[2]; ++i2)
+                {
+                    for (int i1 = istart[1]; i1 <= istop[1]; ++i1)
+                    {
+                        double* const q_row = q_d + ng0 * (i1 + ng1 * i2);
+                        const double* const wt_row = wt + W * (i1 + W * i2);
+                        for (int i0 = istart[0]; i0 <= istop[0]; ++i0) q_row[i0] += wt_row[i0] * V;
+                    }
+                }
+            }
+        }
+#endif
+    }
+    return;
+}
+
+// Markers are processed in batches of this size when the weights are not
+// cached, so that the stencil data for each batch remains in cache.
+static const int BATCH_SIZE = 128;
+
+// Dispatch to the implementations for the selected kernel function.
+template <class Kernel>
+void
+interpolate_kernel(double* const Q_data,
+                   const int Q_depth,
+                   const double* const X_data,
+                   const double* const q_data,
+                   const int* const ilower,
+                   const int* const iupper,
+                   const int* const ig_lower,
+                   const int* const ig_upper,
+                   const int q_depth,
+                   const double* const x_lower,
+                   const double* const dx,
+                   const int* const local_indices,
+                   const double* const periodic_shifts,
+                   const int num_local_indices,
+                   const std::string& kernel_fcn,
+                   const bool use_cache,
+                   const int max_cache_size,
+                   const bool deterministic)
+{
+    static const int W = Kernel::width;
+    std::vector<double> X_o_dx;
+    if (use_cache)
+    {
+        compute_scaled_positions(X_o_dx, X_data, x_lower, dx, local_indices, periodic_shifts, num_local_indices);
+        const StencilWeights& sw =
+            get_cached_stencil_weights<Kernel>(kernel_fcn, X_o_dx, ilower, iupper, num_local_indices, max_cache_size);
+        if (deterministic)
+            interpolate_data<W, true>(Q_data, Q_depth, q_data, ig_lower, ig_upper, q_depth, local_indices, sw);
+        else
+            interpolate_data<W, false>(Q_data, Q_depth, q_data, ig_lower, ig_upper, q_depth, local_indices, sw);
+        return;
+    }
+
+    StencilWeights sw;
+    for (int l_begin = 0; l_begin < num_local_indices; l_begin += BATCH_SIZE)
+    {
+        const int n = std::min(BATCH_SIZE, num_local_indices - l_begin);
+        const int* const batch_indices = local_indices + l_begin;
+        compute_scaled_positions(X_o_dx, X_data, x_lower, dx, batch_indices, periodic_shifts + NDIM * l_begin, n);
+        compute_stencil_weights<Kernel>(sw, X_o_dx, ilower, n);
+        if (deterministic)
+            interpolate_data<W, true>(Q_data, Q_depth, q_data, ig_lower, ig_upper, q_depth, batch_indices, sw);
+        else
+            interpolate_data<W, false>(Q_data, Q_depth, q_data, ig_lower, ig_upper, q_depth, batch_indices, sw);
+    }
+    return;
+}
+
+template <class Kernel>
+void
+spread_kernel(double* const q_data,
+              const int* const ilower,
+              const int* const iupper,
+              const int* const ig_lower,
+              const int* const ig_upper,
+              const int q_depth,
+              const double* const Q_data,
+              const int Q_depth,
+              const double* const X_data,
+              const double* const x_lower,
+              const double* const dx,
+              const int* const local_indices,
+              const double* const periodic_shifts,
+              const int num_local_indices,
+              const std::string& kernel_fcn,
+              const bool use_cache,
+              const int max_cache_size,
+              const bool deterministic)
+{
+    static const int W = Kernel::width;
+    std::vector<double> X_o_dx;
+    if (use_cache)
+    {
+        compute_scaled_positions(X_o_dx, X_data, x_lower, dx, local_indices, periodic_shifts, num_local_indices);
+        const StencilWeights& sw =
+            get_cached_stencil_weights<Kernel>(kernel_fcn, X_o_dx, ilower, iupper, num_local_indices, max_cache_size);
+        if (deterministic)
+            spread_data<W, true>(q_data, ig_lower, ig_upper, q_depth, Q_data, Q_depth, dx, local_indices, sw);
+        else
+            spread_data<W, false>(q_data, ig_lower, ig_upper, q_depth, Q_data, Q_depth, dx, local_indices, sw);
+        return;
+    }
+
+    StencilWeights sw;
+    for (int l_begin = 0; l_begin < num_local_indices; l_begin += BATCH_SIZE)
+    {
+        const int n = std::min(BATCH_SIZE, num_local_indices - l_begin);
+        const int* const batch_indices = local_indices + l_begin;
+        compute_scaled_positions(X_o_dx, X_data, x_lower, dx, batch_indices, periodic_shifts + NDIM * l_begin, n);
+        compute_stencil_weights<Kernel>(sw, X_o_dx, ilower, n);
+        if (deterministic)
+            spread_data<W, true>(q_data, ig_lower, ig_upper, q_depth, Q_data, Q_depth, dx, batch_indices, sw);
+        else
+            spread_data<W, false>(q_data, ig_lower, ig_upper, q_depth, Q_data, Q_depth, dx, batch_indices, sw);
+    }
+    return;
+}
+}
+
+bool LEKernelEngine::s_cache_weights = false;
+int LEKernelEngine::s_max_cache_size = 256;
+bool LEKernelEngine::s_deterministic = false;
+
+void
+LEKernelEngine::setWeightCachingEnabled(const bool enabled)
+{
+    s_cache_weights = enabled;
+    if (!s_cache_weights) clearWeightCache();
+    return;
+}
+
+bool
+LEKernelEngine::getWeightCachingEnabled()
+{
+    return s_cache_weights;
+}
+
+void
+LEKernelEngine::setMaxWeightCacheSize(const int max_cache_size)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(max_cache_size > 0);
+#endif
+    s_max_cache_size = max_cache_size;
+    clearWeightCache();
+    return;
+}
+
+void
+LEKernelEngine::setDeterministicMode(const bool deterministic)
+{
+    s_deterministic = deterministic;
+    return;
+}
+
+bool
+LEKernelEngine::getDeterministicMode()
+{
+    return s_deterministic;
+}
+
+void
+LEKernelEngine::clearWeightCache()
+{
+    std::vector<WeightCacheEntry>().swap(s_weight_cache);
+    s_weight_cache_next_slot = 0;
+    return;
+}
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+bool
+LEKernelEngine::isSupported(const std::string& kernel_fcn)
+{
+    if (kernel_fcn == "IB_4") return true;
+    if (s_deterministic) return false;
+    if (kernel_fcn == "PIECEWISE_LINEAR") return true;
+    if (kernel_fcn == "BSPLINE_4") return true;
+    return false;
+}
+
+void
+LEKernelEngine::interpolate(double* const Q_data,
+                            const int Q_depth,
+                            const double* const X_data,
+                            const double* const q_data,
+                            const Box<NDIM>& q_data_box,
+                            const IntVector<NDIM>& q_gcw,
+                            const int q_depth,
+                            const double* const x_lower,
+                            const double* const dx,
+                            const int* const local_indices,
+                            const double* const periodic_shifts,
+                            const int num_local_indices,
+                            const std::string& interp_fcn)
+{
+    if (num_local_indices == 0) return;
+    const bool use_cache = s_cache_weights && !in_parallel_region();
+    int ilower[NDIM], iupper[NDIM], ig_lower[NDIM], ig_upper[NDIM];
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        ilower[d] = q_data_box.lower()(d);
+        iupper[d] = q_data_box.upper()(d);
+        ig_lower[d] = q_data_box.lower()(d) - q_gcw(d);
+        ig_upper[d] = q_data_box.upper()(d) + q_gcw(d);
+    }
+    if (interp_fcn == "IB_4")
+    {
+        interpolate_kernel<IB4Kernel>(Q_data,
+                                      Q_depth,
+                                      X_data,
+                                      q_data,
+                                      ilower,
+                                      iupper,
+                                      ig_lower,
+                                      ig_upper,
+                                      q_depth,
+                                      x_lower,
+                                      dx,
+                                      local_indices,
+                                      periodic_shifts,
+                                      num_local_indices,
+                                      interp_fcn,
+                                      use_cache,
+                                      s_max_cache_size,
+                                      s_deterministic);
+    }
+    else if (interp_fcn == "PIECEWISE_LINEAR")
+    {
+        interpolate_kernel<PiecewiseLinearKernel>(Q_data,
+                                                  Q_depth,
+                                                  X_data,
+                                                  q_data,
+                                                  ilower,
+                                                  iupper,
+                                                  ig_lower,
+                                                  ig_upper,
+                                                  q_depth,
+                                                  x_lower,
+                                                  dx,
+                                                  local_indices,
+                                                  periodic_shifts,
+                                                  num_local_indices,
+                                                  interp_fcn,
+                                                  use_cache,
+                                                  s_max_cache_size,
+                                                  s_deterministic);
+    }
+    else if (interp_fcn == "BSPLINE_4")
+    {
+        interpolate_kernel<BSpline4Kernel>(Q_data,
+                                           Q_depth,
+                                           X_data,
+                                           q_data,
+                                           ilower,
+                                           iupper,
+                                           ig_lower,
+                                           ig_upper,
+                                           q_depth,
+                                           x_lower,
+                                           dx,
+                                           local_indices,
+                                           periodic_shifts,
+                                           num_local_indices,
+                                           interp_fcn,
+                                           use_cache,
+                                           s_max_cache_size,
+                                           s_deterministic);
+    }
+    else
+    {
+        TBOX_ERROR("LEKernelEngine::interpolate()\n"
+                   << "  Unsupported interpolation kernel function "
+                   << interp_fcn
+                   << std::endl);
+    }
+    return;
+}
+
+void
+LEKernelEngine::spread(double* const q_data,
+                       const Box<NDIM>& q_data_box,
+                       const IntVector<NDIM>& q_gcw,
+                       const int q_depth,
+                       const double* const Q_data,
+                       const int Q_depth,
+                       const double* const X_data,
+                       const double* const x_lower,
+                       const double* const dx,
+                       const int* const local_indices,
+                       const double* const periodic_shifts,
+                       const int num_local_indices,
+                       const std::string& spread_fcn)
+{
+    if (num_local_indices == 0) return;
+    const bool use_cache = s_cache_weights && !in_parallel_region();
+    int ilower[NDIM], iupper[NDIM], ig_lower[NDIM], ig_upper[NDIM];
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        ilower[d] = q_data_box.lower()(d);
+        iupper[d] = q_data_box.upper()(d);
+        ig_lower[d] = q_data_box.lower()(d) - q_gcw(d);
+        ig_upper[d] = q_data_box.upper()(d) + q_gcw(d);
+    }
+    if (spread_fcn == "IB_4")
+    {
+        spread_kernel<IB4Kernel>(q_data,
+                                 ilower,
+                                 iupper,
+                                 ig_lower,
+                                 ig_upper,
+                                 q_depth,
+                                 Q_data,
+                                 Q_depth,
+                                 X_data,
+                                 x_lower,
+                                 dx,
+                                 local_indices,
+                                 periodic_shifts,
+                                 num_local_indices,
+                                 spread_fcn,
+                                 use_cache,
+                                 s_max_cache_size,
+                                 s_deterministic);
+    }
+    else if (spread_fcn == "PIECEWISE_LINEAR")
+    {
+        spread_kernel<PiecewiseLinearKernel>(q_data,
+                                             ilower,
+                                             iupper,
+                                             ig_lower,
+                                             ig_upper,
+                                             q_depth,
+                                             Q_data,
+                                             Q_depth,
+                                             X_data,
+                                             x_lower,
+                                             dx,
+                                             local_indices,
+                                             periodic_shifts,
+                                             num_local_indices,
+                                             spread_fcn,
+                                             use_cache,
+                                             s_max_cache_size,
+                                             s_deterministic);
+    }
+    else if (spread_fcn == "BSPLINE_4")
+    {
+        spread_kernel<BSpline4Kernel>(q_data,
+                                      ilower,
+                                      iupper,
+                                      ig_lower,
+                                      ig_upper,
+                                      q_depth,
+                                      Q_data,
+                                      Q_depth,
+                                      X_data,
+                                      x_lower,
+                                      dx,
+                                      local_indices,
+                                      periodic_shifts,
+                                      num_local_indices,
+                                      spread_fcn,
+                                      use_cache,
+                                      s_max_cache_size,
+                                      s_deterministic);
+    }
+    else
+    {
+        TBOX_ERROR("LEKernelEngine::spread()\n"
+                   << "  Unsupported spreading kernel function "
+                   << spread_fcn
+                   << std::endl);
+    }
+    return;
+}
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -32,6 +32,8 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
+#include <utility>
 #include <vector>
 
 #include "Box.h"
@@ -59,6 +61,44 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Reorder the cached indices (and the associated periodic shifts) so that they
+// are in order of increasing local PETSc index.
+void
+sort_cached_indices(std::vector<int>& lag_indices,
+                    std::vector<int>& global_petsc_indices,
+                    std::vector<int>& local_petsc_indices,
+                    std::vector<double>& periodic_shifts)
+{
+    const size_t num_indices = local_petsc_indices.size();
+    std::vector<std::pair<int, int> > order(num_indices);
+    for (size_t k = 0; k < num_indices; ++k)
+    {
+        order[k] = std::make_pair(local_petsc_indices[k], static_cast<int>(k));
+    }
+    std::sort(order.begin(), order.end());
+
+    std::vector<int> sorted_lag_indices(num_indices), sorted_global_petsc_indices(num_indices);
+    std::vector<double> sorted_periodic_shifts(NDIM * num_indices);
+    for (size_t k = 0; k < num_indices; ++k)
+    {
+        const int j = order[k].second;
+        sorted_lag_indices[k] = lag_indices[j];
+        sorted_global_petsc_indices[k] = global_petsc_indices[j];
+        local_petsc_indices[k] = order[k].first;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            sorted_periodic_shifts[NDIM * k + d] = periodic_shifts[NDIM * j + d];
+        }
+    }
+    lag_indices.swap(sorted_lag_indices);
+    global_petsc_indices.swap(sorted_global_petsc_indices);
+    periodic_shifts.swap(sorted_periodic_shifts);
+    return;
+} // sort_cached_indices
+}
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 template <class T>
@@ -90,7 +130,9 @@ LIndexSetData<T>::~LIndexSetData()
 
 template <class T>
 void
-LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch, const IntVector<NDIM>& periodic_shift)
+LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch,
+                                    const IntVector<NDIM>& periodic_shift,
+                                    const bool sort_by_local_petsc_index)
 {
     d_lag_indices.clear();
     d_interior_lag_indices.clear();
@@ -175,6 +217,16 @@ LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch, const IntVector
             }
         }
     }
+    if (sort_by_local_petsc_index)
+    {
+        sort_cached_indices(d_lag_indices, d_global_petsc_indices, d_local_petsc_indices, d_periodic_shifts);
+        sort_cached_indices(d_interior_lag_indices,
+                            d_interior_global_petsc_indices,
+                            d_interior_local_petsc_indices,
+                            d_interior_periodic_shifts);
+        sort_cached_indices(
+            d_ghost_lag_indices, d_ghost_global_petsc_indices, d_ghost_local_petsc_indices, d_ghost_periodic_shifts);
+    }
     return;
 } // cacheLocalIndices
 
@@ -41,6 +41,7 @@
 #include <map>
 #include <set>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
@@ -89,11 +90,26 @@ static const std::string SILO_SUMMARY_FILE_PREFIX = "lag_data.cycle_";
 static const std::string SILO_SUMMARY_FILE_POSTFIX = ".summary.silo";
 static const std::string SILO_PROCESSOR_FILE_PREFIX = "lag_data.proc_";
 static const std::string SILO_PROCESSOR_FILE_POSTFIX = ".silo";
+static const std::string SILO_GROUP_FILE_PREFIX = "lag_data.group_";
+static const std::string SILO_PROCESSOR_DIR_PREFIX = "proc_";
 
 // Version of LSiloDataWriter restart file data.
 static const int LAG_SILO_DATA_WRITER_VERSION = 1;
 
 #if defined(IBTK_HAVE_SILO)
+// Errors that occur while the Silo files are written are reported by throwing
+// an exception rather than by TBOX_ERROR, because the files may be written on
+// a background thread.  The exception is caught by write_plot_data_job(), and
+// the error is reported on the main thread by
+// LSiloDataWriter::waitForPendingOutput().
+#define PLOT_DATA_ERROR(X)                                                                                             \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        std::ostringstream plot_data_error_stream;                                                                     \
+        plot_data_error_stream << X;                                                                                   \
+        throw std::runtime_error(plot_data_error_stream.str());                                                        \
+    } while (0)
+
 /*!
  * \brief Build a local mesh database entry corresponding to a cloud of marker
  * points.
@@ -144,10 +160,10 @@ build_local_marker_cloud(DBfile* dbfile,
     // Set the working directory in the Silo database.
     if (DBSetDir(dbfile, dirname.c_str()) == -1)
     {
-        TBOX_ERROR("LSiloDataWriter::build_local_marker_cloud()\n"
-                   << "  Could not set directory "
-                   << dirname
-                   << std::endl);
+        PLOT_DATA_ERROR("LSiloDataWriter::build_local_marker_cloud()\n"
+                        << "  Could not set directory "
+                        << dirname
+                        << std::endl);
     }
 
     // Write out the variables.
@@ -198,10 +214,10 @@ build_local_marker_cloud(DBfile* dbfile,
     // Reset the working directory in the Silo database.
     if (DBSetDir(dbfile, "..") == -1)
     {
-        TBOX_ERROR("LSiloDataWriter::build_local_marker_cloud()\n"
-                   << "  Could not return to the base directory from subdirectory "
-                   << dirname
-                   << std::endl);
+        PLOT_DATA_ERROR("LSiloDataWriter::build_local_marker_cloud()\n"
+                        << "  Could not return to the base directory from subdirectory "
+                        << dirname
+                        << std::endl);
     }
     return;
 } // build_local_marker_cloud
@@ -310,10 +326,10 @@ build_local_curv_block(DBfile* dbfile,
     // Set the working directory in the Silo database.
     if (DBSetDir(dbfile, dirname.c_str()) == -1)
     {
-        TBOX_ERROR("LSiloDataWriter::build_local_curv_block()\n"
-                   << "  Could not set directory "
-                   << dirname
-                   << std::endl);
+        PLOT_DATA_ERROR("LSiloDataWriter::build_local_curv_block()\n"
+                        << "  Could not set directory "
+                        << dirname
+                        << std::endl);
     }
 
     // Write out the variables.
@@ -403,10 +419,10 @@ build_local_curv_block(DBfile* dbfile,
     // Reset the working directory in the Silo database.
     if (DBSetDir(dbfile, "..") == -1)
     {
-        TBOX_ERROR("LSiloDataWriter::build_local_curv_block()\n"
-                   << "  Could not return to the base directory from subdirectory "
-                   << dirname
-                   << std::endl);
+        PLOT_DATA_ERROR("LSiloDataWriter::build_local_curv_block()\n"
+                        << "  Could not return to the base directory from subdirectory "
+                        << dirname
+                        << std::endl);
     }
     return;
 } // build_local_curv_block
@@ -498,10 +514,10 @@ build_local_ucd_mesh(DBfile* dbfile,
     // Set the working directory in the Silo database.
     if (DBSetDir(dbfile, dirname.c_str()) == -1)
     {
-        TBOX_ERROR("LSiloDataWriter::build_local_ucd_mesh()\n"
-                   << "  Could not set directory "
-                   << dirname
-                   << std::endl);
+        PLOT_DATA_ERROR("LSiloDataWriter::build_local_ucd_mesh()\n"
+                        << "  Could not set directory "
+                        << dirname
+                        << std::endl);
     }
 
     // Node coordinates.
@@ -627,202 +643,1074 @@ build_local_ucd_mesh(DBfile* dbfile,
     // Reset the working directory in the Silo database.
     if (DBSetDir(dbfile, "..") == -1)
     {
-        TBOX_ERROR("LSiloDataWriter::build_local_ucd_mesh()\n"
-                   << "  Could not return to the base directory from subdirectory "
-                   << dirname
-                   << std::endl);
+        PLOT_DATA_ERROR("LSiloDataWriter::build_local_ucd_mesh()\n"
+                        << "  Could not return to the base directory from subdirectory "
+                        << dirname
+                        << std::endl);
     }
     return;
 } // build_local_ucd_mesh
-#endif // if defined(IBTK_HAVE_SILO)
-}
 
-/////////////////////////////// PUBLIC ///////////////////////////////////////
+/*!
+ * \brief Snapshot of the local Lagrangian data of a single MPI process along
+ * with the layout information required to write it to a Silo database.
+ */
+struct LocalPlotData
+{
+    int rank;
+    std::vector<char> has_coords;
+    std::vector<int> nclouds, nblocks, nmbs, nucd_meshes, nvars;
+    std::vector<std::vector<int> > cloud_nmarks, mb_nblocks;
+    std::vector<std::vector<IntVector<NDIM> > > block_nelems, block_periodic;
+    std::vector<std::vector<std::vector<IntVector<NDIM> > > > mb_nelems, mb_periodic;
+    std::vector<std::vector<std::set<int> > > ucd_mesh_vertices;
+    std::vector<std::vector<std::multimap<int, std::pair<int, int> > > > ucd_mesh_edge_maps;
+    std::vector<std::vector<std::string> > var_names;
+    std::vector<std::vector<int> > var_start_depths, var_plot_depths, var_depths;
+    std::vector<std::vector<double> > X;
+    std::vector<std::vector<std::vector<double> > > var_vals;
+};
 
-LSiloDataWriter::LSiloDataWriter(const std::string& object_name,
-                                 const std::string& dump_directory_name,
-                                 bool register_for_restart)
-    : d_object_name(object_name),
-      d_registered_for_restart(register_for_restart),
-      d_dump_directory_name(dump_directory_name),
-      d_time_step_number(-1),
-      d_hierarchy(),
-      d_coarsest_ln(0),
-      d_finest_ln(0),
-      d_nclouds(d_finest_ln + 1, 0),
-      d_cloud_names(d_finest_ln + 1),
-      d_cloud_nmarks(d_finest_ln + 1),
-      d_cloud_first_lag_idx(d_finest_ln + 1),
-      d_nblocks(d_finest_ln + 1, 0),
-      d_block_names(d_finest_ln + 1),
-      d_block_nelems(d_finest_ln + 1),
-      d_block_periodic(d_finest_ln + 1),
-      d_block_first_lag_idx(d_finest_ln + 1),
-      d_nmbs(d_finest_ln + 1, 0),
-      d_mb_names(d_finest_ln + 1),
-      d_mb_nblocks(d_finest_ln + 1),
-      d_mb_nelems(d_finest_ln + 1),
-      d_mb_periodic(d_finest_ln + 1),
-      d_mb_first_lag_idx(d_finest_ln + 1),
-      d_nucd_meshes(d_finest_ln + 1, 0),
-      d_ucd_mesh_names(d_finest_ln + 1),
-      d_ucd_mesh_vertices(d_finest_ln + 1),
-      d_ucd_mesh_edge_maps(d_finest_ln + 1),
-      d_coords_data(d_finest_ln + 1, Pointer<LData>(NULL)),
-      d_nvars(d_finest_ln + 1, 0),
-      d_var_names(d_finest_ln + 1),
-      d_var_start_depths(d_finest_ln + 1),
-      d_var_plot_depths(d_finest_ln + 1),
-      d_var_depths(d_finest_ln + 1),
-      d_var_data(d_finest_ln + 1),
-      d_ao(d_finest_ln + 1),
-      d_build_vec_scatters(d_finest_ln + 1),
-      d_src_vec(d_finest_ln + 1),
-      d_dst_vec(d_finest_ln + 1),
-      d_vec_scatter(d_finest_ln + 1)
+/*!
+ * \brief All data required to write a single plot dump on one MPI process.
+ */
+struct PlotDataJob
 {
-#if defined(IBTK_HAVE_SILO)
-// intentionally blank
-#else
-    TBOX_WARNING("LSiloDataWriter::LSiloDataWriter(): SILO is not installed; cannot write data." << std::endl);
-#endif
-    if (d_registered_for_restart)
+    std::string object_name;
+    int coarsest_ln, finest_ln;
+    int time_step_number;
+    double simulation_time;
+    std::string dump_directory_name, current_dump_directory_name, dump_dirname;
+    int mpi_nodes, num_files;
+
+    // The local data file and the data of the processes written to it.
+    std::string file_name;
+    std::vector<LocalPlotData> local_data;
+
+    // Data required to write the summary file on the root MPI process.
+    bool write_summary;
+    std::vector<int> nvars;
+    std::vector<std::vector<std::string> > var_names;
+    std::vector<std::vector<int> > nclouds_per_proc, nblocks_per_proc, nmbs_per_proc, nucd_meshes_per_proc;
+    std::vector<std::vector<std::vector<int> > > meshtypes_per_proc, vartypes_per_proc, mb_nblocks_per_proc;
+    std::vector<std::vector<std::vector<std::vector<int> > > > multimeshtypes_per_proc, multivartypes_per_proc;
+    std::vector<std::vector<std::vector<std::string> > > cloud_names_per_proc, block_names_per_proc, mb_names_per_proc,
+        ucd_mesh_names_per_proc;
+
+    // Where to record an error encountered while writing the data.
+    std::string* error_message;
+};
+
+/*!
+ * \brief Copy the values of a sequential Vec into a std::vector.
+ */
+void
+copy_local_vec(Vec v, std::vector<double>& vals)
+{
+    int ierr;
+    int n;
+    ierr = VecGetLocalSize(v, &n);
+    IBTK_CHKERRQ(ierr);
+    const double* v_arr;
+    ierr = VecGetArrayRead(v, &v_arr);
+    IBTK_CHKERRQ(ierr);
+    vals.assign(v_arr, v_arr + n);
+    ierr = VecRestoreArrayRead(v, &v_arr);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // copy_local_vec
+
+/*!
+ * \brief Index of the file that holds the data of a particular MPI process.
+ */
+int
+get_file_index(const int proc, const int mpi_nodes, const int num_files)
+{
+    if (num_files == 0) return proc;
+    return static_cast<int>((static_cast<long>(proc) * num_files) / mpi_nodes);
+} // get_file_index
+
+/*!
+ * \brief Name of the file that holds the data of a particular MPI process.
+ */
+std::string
+get_file_name(const int proc, const int mpi_nodes, const int num_files)
+{
+    char temp_buf[SILO_NAME_BUFSIZE];
+    sprintf(temp_buf, "%04d", get_file_index(proc, mpi_nodes, num_files));
+    const std::string& prefix = (num_files == 0 ? SILO_PROCESSOR_FILE_PREFIX : SILO_GROUP_FILE_PREFIX);
+    return prefix + temp_buf + SILO_PROCESSOR_FILE_POSTFIX;
+} // get_file_name
+
+/*!
+ * \brief Prefix of the Silo paths to the data of a particular MPI process, as
+ * used in the summary file.
+ */
+std::string
+get_data_prefix(const int proc, const int mpi_nodes, const int num_files)
+{
+    std::string prefix = get_file_name(proc, mpi_nodes, num_files) + ":";
+    if (num_files > 0)
     {
-        RestartManager::getManager()->registerRestartItem(d_object_name, this);
+        char temp_buf[SILO_NAME_BUFSIZE];
+        sprintf(temp_buf, "%04d", proc);
+        prefix += SILO_PROCESSOR_DIR_PREFIX + temp_buf + "/";
     }
+    return prefix;
+} // get_data_prefix
 
-    // Initialize object with data read from the restart database.
-    const bool from_restart = RestartManager::getManager()->isFromRestart();
-    if (from_restart)
+template <class T>
+void
+pack_value(const T& val, std::vector<char>& buffer)
+{
+    const char* const p = reinterpret_cast<const char*>(&val);
+    buffer.insert(buffer.end(), p, p + sizeof(T));
+    return;
+} // pack_value
+
+template <class T>
+void
+unpack_value(const std::vector<char>& buffer, size_t& pos, T& val)
+{
+    memcpy(&val, &buffer[pos], sizeof(T));
+    pos += sizeof(T);
+    return;
+} // unpack_value
+
+template <class T>
+void
+pack_vector(const std::vector<T>& vals, std::vector<char>& buffer)
+{
+    pack_value(static_cast<int>(vals.size()), buffer);
+    if (vals.empty()) return;
+    const char* const p = reinterpret_cast<const char*>(&vals[0]);
+    buffer.insert(buffer.end(), p, p + vals.size() * sizeof(T));
+    return;
+} // pack_vector
+
+template <class T>
+void
+unpack_vector(const std::vector<char>& buffer, size_t& pos, std::vector<T>& vals)
+{
+    int n;
+    unpack_value(buffer, pos, n);
+    vals.resize(n);
+    if (n == 0) return;
+    memcpy(&vals[0], &buffer[pos], n * sizeof(T));
+    pos += n * sizeof(T);
+    return;
+} // unpack_vector
+
+void
+pack_int_vectors(const std::vector<IntVector<NDIM> >& vals, std::vector<char>& buffer)
+{
+    std::vector<int> ivals(NDIM * vals.size());
+    for (unsigned int k = 0; k < vals.size(); ++k)
     {
-        getFromRestart();
+        for (unsigned int d = 0; d < NDIM; ++d) ivals[NDIM * k + d] = vals[k](d);
     }
+    pack_vector(ivals, buffer);
     return;
-} // LSiloDataWriter
+} // pack_int_vectors
 
-LSiloDataWriter::~LSiloDataWriter()
+void
+unpack_int_vectors(const std::vector<char>& buffer, size_t& pos, std::vector<IntVector<NDIM> >& vals)
 {
-    if (d_registered_for_restart)
+    std::vector<int> ivals;
+    unpack_vector(buffer, pos, ivals);
+    vals.resize(ivals.size() / NDIM);
+    for (unsigned int k = 0; k < vals.size(); ++k)
     {
-        RestartManager::getManager()->unregisterRestartItem(d_object_name);
+        for (unsigned int d = 0; d < NDIM; ++d) vals[k](d) = ivals[NDIM * k + d];
     }
+    return;
+} // unpack_int_vectors
 
-    // Destroy any remaining PETSc objects.
-    int ierr;
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+/*!
+ * \brief Serialize the local plot data of the specified levels.
+ */
+void
+pack_local_plot_data(const LocalPlotData& data, const int coarsest_ln, const int finest_ln, std::vector<char>& buffer)
+{
+    pack_value(data.rank, buffer);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
-        for (std::map<int, Vec>::iterator it = d_dst_vec[ln].begin(); it != d_dst_vec[ln].end(); ++it)
+        pack_value(data.has_coords[ln], buffer);
+        if (!data.has_coords[ln]) continue;
+
+        pack_vector(data.cloud_nmarks[ln], buffer);
+        pack_int_vectors(data.block_nelems[ln], buffer);
+        pack_int_vectors(data.block_periodic[ln], buffer);
+        pack_vector(data.mb_nblocks[ln], buffer);
+        for (int mb = 0; mb < data.nmbs[ln]; ++mb)
         {
-            Vec& v = it->second;
-            if (v)
-            {
-                ierr = VecDestroy(&v);
-                IBTK_CHKERRQ(ierr);
-            }
+            pack_int_vectors(data.mb_nelems[ln][mb], buffer);
+            pack_int_vectors(data.mb_periodic[ln][mb], buffer);
         }
-        for (std::map<int, VecScatter>::iterator it = d_vec_scatter[ln].begin(); it != d_vec_scatter[ln].end(); ++it)
+        pack_value(data.nucd_meshes[ln], buffer);
+        for (int mesh = 0; mesh < data.nucd_meshes[ln]; ++mesh)
         {
-            VecScatter& vs = it->second;
-            if (vs)
+            const std::set<int>& vertices = data.ucd_mesh_vertices[ln][mesh];
+            pack_vector(std::vector<int>(vertices.begin(), vertices.end()), buffer);
+            const std::multimap<int, std::pair<int, int> >& edge_map = data.ucd_mesh_edge_maps[ln][mesh];
+            std::vector<int> edges;
+            edges.reserve(3 * edge_map.size());
+            for (std::multimap<int, std::pair<int, int> >::const_iterator it = edge_map.begin(); it != edge_map.end();
+                 ++it)
             {
-                ierr = VecScatterDestroy(&vs);
-                IBTK_CHKERRQ(ierr);
+                edges.push_back(it->first);
+                edges.push_back(it->second.first);
+                edges.push_back(it->second.second);
             }
+            pack_vector(edges, buffer);
+        }
+        pack_value(data.nvars[ln], buffer);
+        for (int v = 0; v < data.nvars[ln]; ++v)
+        {
+            const std::string& var_name = data.var_names[ln][v];
+            pack_vector(std::vector<char>(var_name.begin(), var_name.end()), buffer);
+        }
+        pack_vector(data.var_start_depths[ln], buffer);
+        pack_vector(data.var_plot_depths[ln], buffer);
+        pack_vector(data.var_depths[ln], buffer);
+        pack_vector(data.X[ln], buffer);
+        for (int v = 0; v < data.nvars[ln]; ++v)
+        {
+            pack_vector(data.var_vals[ln][v], buffer);
         }
     }
     return;
-} // ~LSiloDataWriter
-
-void
-LSiloDataWriter::setPatchHierarchy(Pointer<PatchHierarchy<NDIM> > hierarchy)
-{
-#if !defined(NDEBUG)
-    TBOX_ASSERT(hierarchy);
-    TBOX_ASSERT(hierarchy->getFinestLevelNumber() >= d_finest_ln);
-#endif
-    // Reset the hierarchy.
-    d_hierarchy = hierarchy;
-    return;
-} // setPatchHierarchy
+} // pack_local_plot_data
 
+/*!
+ * \brief Deserialize local plot data packed by pack_local_plot_data().
+ */
 void
-LSiloDataWriter::resetLevels(const int coarsest_ln, const int finest_ln)
+unpack_local_plot_data(const std::vector<char>& buffer, const int coarsest_ln, const int finest_ln, LocalPlotData& data)
 {
-#if !defined(NDEBUG)
-    TBOX_ASSERT((coarsest_ln >= 0) && (finest_ln >= coarsest_ln));
-    if (d_hierarchy)
-    {
-        TBOX_ASSERT(finest_ln <= d_hierarchy->getFinestLevelNumber());
-    }
-#endif
-    // Destroy any unneeded PETSc objects.
-    int ierr;
-    for (int ln = std::max(d_coarsest_ln, 0); (ln <= d_finest_ln) && (ln < coarsest_ln); ++ln)
+    size_t pos = 0;
+    unpack_value(buffer, pos, data.rank);
+    data.has_coords.resize(finest_ln + 1, 0);
+    data.nclouds.resize(finest_ln + 1, 0);
+    data.nblocks.resize(finest_ln + 1, 0);
+    data.nmbs.resize(finest_ln + 1, 0);
+    data.nucd_meshes.resize(finest_ln + 1, 0);
+    data.nvars.resize(finest_ln + 1, 0);
+    data.cloud_nmarks.resize(finest_ln + 1);
+    data.mb_nblocks.resize(finest_ln + 1);
+    data.block_nelems.resize(finest_ln + 1);
+    data.block_periodic.resize(finest_ln + 1);
+    data.mb_nelems.resize(finest_ln + 1);
+    data.mb_periodic.resize(finest_ln + 1);
+    data.ucd_mesh_vertices.resize(finest_ln + 1);
+    data.ucd_mesh_edge_maps.resize(finest_ln + 1);
+    data.var_names.resize(finest_ln + 1);
+    data.var_start_depths.resize(finest_ln + 1);
+    data.var_plot_depths.resize(finest_ln + 1);
+    data.var_depths.resize(finest_ln + 1);
+    data.X.resize(finest_ln + 1);
+    data.var_vals.resize(finest_ln + 1);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
-        for (std::map<int, Vec>::iterator it = d_dst_vec[ln].begin(); it != d_dst_vec[ln].end(); ++it)
+        unpack_value(buffer, pos, data.has_coords[ln]);
+        if (!data.has_coords[ln]) continue;
+
+        unpack_vector(buffer, pos, data.cloud_nmarks[ln]);
+        data.nclouds[ln] = static_cast<int>(data.cloud_nmarks[ln].size());
+        unpack_int_vectors(buffer, pos, data.block_nelems[ln]);
+        unpack_int_vectors(buffer, pos, data.block_periodic[ln]);
+        data.nblocks[ln] = static_cast<int>(data.block_nelems[ln].size());
+        unpack_vector(buffer, pos, data.mb_nblocks[ln]);
+        data.nmbs[ln] = static_cast<int>(data.mb_nblocks[ln].size());
+        data.mb_nelems[ln].resize(data.nmbs[ln]);
+        data.mb_periodic[ln].resize(data.nmbs[ln]);
+        for (int mb = 0; mb < data.nmbs[ln]; ++mb)
         {
-            Vec& v = it->second;
-            if (v)
-            {
-                ierr = VecDestroy(&v);
-                IBTK_CHKERRQ(ierr);
-            }
+            unpack_int_vectors(buffer, pos, data.mb_nelems[ln][mb]);
+            unpack_int_vectors(buffer, pos, data.mb_periodic[ln][mb]);
         }
-        for (std::map<int, VecScatter>::iterator it = d_vec_scatter[ln].begin(); it != d_vec_scatter[ln].end(); ++it)
+        unpack_value(buffer, pos, data.nucd_meshes[ln]);
+        data.ucd_mesh_vertices[ln].resize(data.nucd_meshes[ln]);
+        data.ucd_mesh_edge_maps[ln].resize(data.nucd_meshes[ln]);
+        for (int mesh = 0; mesh < data.nucd_meshes[ln]; ++mesh)
         {
-            VecScatter& vs = it->second;
-            if (vs)
+            std::vector<int> vertices;
+            unpack_vector(buffer, pos, vertices);
+            data.ucd_mesh_vertices[ln][mesh].insert(vertices.begin(), vertices.end());
+            std::vector<int> edges;
+            unpack_vector(buffer, pos, edges);
+            std::multimap<int, std::pair<int, int> >& edge_map = data.ucd_mesh_edge_maps[ln][mesh];
+            for (unsigned int k = 0; k + 2 < edges.size(); k += 3)
             {
-                ierr = VecScatterDestroy(&vs);
-                IBTK_CHKERRQ(ierr);
+                edge_map.insert(std::make_pair(edges[k], std::make_pair(edges[k + 1], edges[k + 2])));
             }
         }
+        unpack_value(buffer, pos, data.nvars[ln]);
+        data.var_names[ln].resize(data.nvars[ln]);
+        for (int v = 0; v < data.nvars[ln]; ++v)
+        {
+            std::vector<char> var_name;
+            unpack_vector(buffer, pos, var_name);
+            data.var_names[ln][v].assign(var_name.begin(), var_name.end());
+        }
+        unpack_vector(buffer, pos, data.var_start_depths[ln]);
+        unpack_vector(buffer, pos, data.var_plot_depths[ln]);
+        unpack_vector(buffer, pos, data.var_depths[ln]);
+        unpack_vector(buffer, pos, data.X[ln]);
+        data.var_vals[ln].resize(data.nvars[ln]);
+        for (int v = 0; v < data.nvars[ln]; ++v)
+        {
+            unpack_vector(buffer, pos, data.var_vals[ln][v]);
+        }
     }
+    return;
+} // unpack_local_plot_data
 
-    for (int ln = finest_ln + 1; ln <= d_finest_ln; ++ln)
+/*!
+ * \brief Write the local plot data of a single MPI process to the current
+ * directory of a Silo database.
+ */
+void
+write_local_plot_data(DBfile* dbfile,
+                      const LocalPlotData& data,
+                      const std::string& object_name,
+                      const int coarsest_ln,
+                      const int finest_ln,
+                      const int time_step_number,
+                      const double simulation_time)
+{
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
-        for (std::map<int, Vec>::iterator it = d_dst_vec[ln].begin(); it != d_dst_vec[ln].end(); ++it)
+        if (!data.has_coords[ln]) continue;
+
+        const double* const local_X_arr = data.X[ln].empty() ? NULL : &data.X[ln][0];
+        std::vector<const double*> local_v_arrs(data.nvars[ln]);
+        for (int v = 0; v < data.nvars[ln]; ++v)
         {
-            Vec& v = it->second;
-            if (v)
+            local_v_arrs[v] = data.var_vals[ln][v].empty() ? NULL : &data.var_vals[ln][v][0];
+        }
+
+        // Keep track of the current offset in the local Vec data.
+        int offset = 0;
+
+        // Add the local clouds to the local DBfile.
+        for (int cloud = 0; cloud < data.nclouds[ln]; ++cloud)
+        {
+            const int nmarks = data.cloud_nmarks[ln][cloud];
+
+            std::ostringstream stream;
+            stream << "level_" << ln << "_cloud_" << cloud;
+            std::string dirname = stream.str();
+
+            if (DBMkDir(dbfile, dirname.c_str()) == -1)
             {
-                ierr = VecDestroy(&v);
-                IBTK_CHKERRQ(ierr);
+                PLOT_DATA_ERROR(object_name << "::writePlotData()\n"
+                                            << "  Could not create directory named "
+                                            << dirname
+                                            << std::endl);
+            }
+
+            const double* const X = local_X_arr + NDIM * offset;
+            std::vector<const double*> var_vals(data.nvars[ln]);
+            for (int v = 0; v < data.nvars[ln]; ++v)
+            {
+                var_vals[v] = local_v_arrs[v] + data.var_depths[ln][v] * offset;
             }
+
+            build_local_marker_cloud(dbfile,
+                                     dirname,
+                                     nmarks,
+                                     X,
+                                     data.nvars[ln],
+                                     data.var_names[ln],
+                                     data.var_start_depths[ln],
+                                     data.var_plot_depths[ln],
+                                     data.var_depths[ln],
+                                     var_vals,
+                                     time_step_number,
+                                     simulation_time);
+
+            offset += nmarks;
         }
-        for (std::map<int, VecScatter>::iterator it = d_vec_scatter[ln].begin(); it != d_vec_scatter[ln].end(); ++it)
+
+        // Add the local blocks to the local DBfile.
+        for (int block = 0; block < data.nblocks[ln]; ++block)
         {
-            VecScatter& vs = it->second;
-            if (vs)
+            const IntVector<NDIM>& nelem = data.block_nelems[ln][block];
+            const IntVector<NDIM>& periodic = data.block_periodic[ln][block];
+            const int ntot = nelem.getProduct();
+
+            std::ostringstream stream;
+            stream << "level_" << ln << "_block_" << block;
+            std::string dirname = stream.str();
+
+            if (DBMkDir(dbfile, dirname.c_str()) == -1)
             {
-                ierr = VecScatterDestroy(&vs);
-                IBTK_CHKERRQ(ierr);
+                PLOT_DATA_ERROR(object_name << "::writePlotData()\n"
+                                            << "  Could not create directory named "
+                                            << dirname
+                                            << std::endl);
+            }
+
+            const double* const X = local_X_arr + NDIM * offset;
+            std::vector<const double*> var_vals(data.nvars[ln]);
+            for (int v = 0; v < data.nvars[ln]; ++v)
+            {
+                var_vals[v] = local_v_arrs[v] + data.var_depths[ln][v] * offset;
             }
+
+            build_local_curv_block(dbfile,
+                                   dirname,
+                                   nelem,
+                                   periodic,
+                                   X,
+                                   data.nvars[ln],
+                                   data.var_names[ln],
+                                   data.var_start_depths[ln],
+                                   data.var_plot_depths[ln],
+                                   data.var_depths[ln],
+                                   var_vals,
+                                   time_step_number,
+                                   simulation_time);
+
+            offset += ntot;
         }
-    }
 
-    // Reset the level numbers.
-    d_coarsest_ln = coarsest_ln;
-    d_finest_ln = finest_ln;
+        // Add the local multiblocks to the local DBfile.
+        for (int mb = 0; mb < data.nmbs[ln]; ++mb)
+        {
+            for (int block = 0; block < data.mb_nblocks[ln][mb]; ++block)
+            {
+                const IntVector<NDIM>& nelem = data.mb_nelems[ln][mb][block];
+                const IntVector<NDIM>& periodic = data.mb_periodic[ln][mb][block];
+                const int ntot = nelem.getProduct();
 
-    // Resize some arrays.
-    d_nclouds.resize(d_finest_ln + 1, 0);
-    d_cloud_names.resize(d_finest_ln + 1);
-    d_cloud_nmarks.resize(d_finest_ln + 1);
-    d_cloud_first_lag_idx.resize(d_finest_ln + 1);
+                std::ostringstream stream;
+                stream << "level_" << ln << "_mb_" << mb << "_block_" << block;
+                std::string dirname = stream.str();
 
-    d_nblocks.resize(d_finest_ln + 1, 0);
-    d_block_names.resize(d_finest_ln + 1);
-    d_block_nelems.resize(d_finest_ln + 1);
-    d_block_periodic.resize(d_finest_ln + 1);
-    d_block_first_lag_idx.resize(d_finest_ln + 1);
+                if (DBMkDir(dbfile, dirname.c_str()) == -1)
+                {
+                    PLOT_DATA_ERROR(object_name << "::writePlotData()\n"
+                                                << "  Could not create directory named "
+                                                << dirname
+                                                << std::endl);
+                }
 
-    d_nmbs.resize(d_finest_ln + 1, 0);
-    d_mb_nblocks.resize(d_finest_ln + 1);
-    d_mb_names.resize(d_finest_ln + 1);
-    d_mb_nelems.resize(d_finest_ln + 1);
-    d_mb_periodic.resize(d_finest_ln + 1);
-    d_mb_first_lag_idx.resize(d_finest_ln + 1);
+                const double* const X = local_X_arr + NDIM * offset;
+                std::vector<const double*> var_vals(data.nvars[ln]);
+                for (int v = 0; v < data.nvars[ln]; ++v)
+                {
+                    var_vals[v] = local_v_arrs[v] + data.var_depths[ln][v] * offset;
+                }
+
+                build_local_curv_block(dbfile,
+                                       dirname,
+                                       nelem,
+                                       periodic,
+                                       X,
+                                       data.nvars[ln],
+                                       data.var_names[ln],
+                                       data.var_start_depths[ln],
+                                       data.var_plot_depths[ln],
+                                       data.var_depths[ln],
+                                       var_vals,
+                                       time_step_number,
+                                       simulation_time);
+
+                offset += ntot;
+            }
+        }
+
+        // Add the local UCD meshes to the local DBfile.
+        for (int mesh = 0; mesh < data.nucd_meshes[ln]; ++mesh)
+        {
+            const std::set<int>& vertices = data.ucd_mesh_vertices[ln][mesh];
+            const std::multimap<int, std::pair<int, int> >& edge_map = data.ucd_mesh_edge_maps[ln][mesh];
+            const size_t ntot = vertices.size();
+
+            std::ostringstream stream;
+            stream << "level_" << ln << "_mesh_" << mesh;
+            std::string dirname = stream.str();
+
+            if (DBMkDir(dbfile, dirname.c_str()) == -1)
+            {
+                PLOT_DATA_ERROR(object_name << "::writePlotData()\n"
+                                            << "  Could not create directory named "
+                                            << dirname
+                                            << std::endl);
+            }
+
+            const double* const X = local_X_arr + NDIM * offset;
+            std::vector<const double*> var_vals(data.nvars[ln]);
+            for (int v = 0; v < data.nvars[ln]; ++v)
+            {
+                var_vals[v] = local_v_arrs[v] + data.var_depths[ln][v] * offset;
+            }
+
+            build_local_ucd_mesh(dbfile,
+                                 dirname,
+                                 vertices,
+                                 edge_map,
+                                 X,
+                                 data.nvars[ln],
+                                 data.var_names[ln],
+                                 data.var_start_depths[ln],
+                                 data.var_plot_depths[ln],
+                                 data.var_depths[ln],
+                                 var_vals,
+                                 time_step_number,
+                                 simulation_time);
+
+            offset += ntot;
+        }
+    }
+    return;
+} // write_local_plot_data
+
+/*!
+ * \brief Write the data files of a plot dump.
+ */
+void
+write_plot_data(PlotDataJob& job)
+{
+    char temp_buf[SILO_NAME_BUFSIZE];
+    DBfile* dbfile;
+
+    // Write the local data of the processes that share the local file.
+    if (!job.local_data.empty())
+    {
+        if (!(dbfile = DBCreate(job.file_name.c_str(), DB_CLOBBER, DB_LOCAL, NULL, DB_PDB)))
+        {
+            PLOT_DATA_ERROR(job.object_name << "::writePlotData()\n"
+                                            << "  Could not create DBfile named "
+                                            << job.file_name
+                                            << std::endl);
+        }
+        for (unsigned int k = 0; k < job.local_data.size(); ++k)
+        {
+            const LocalPlotData& data = job.local_data[k];
+            std::string proc_dirname;
+            if (job.num_files > 0)
+            {
+                sprintf(temp_buf, "%04d", data.rank);
+                proc_dirname = SILO_PROCESSOR_DIR_PREFIX + temp_buf;
+                if (DBMkDir(dbfile, proc_dirname.c_str()) == -1 || DBSetDir(dbfile, proc_dirname.c_str()) == -1)
+                {
+                    PLOT_DATA_ERROR(job.object_name << "::writePlotData()\n"
+                                                    << "  Could not create directory named "
+                                                    << proc_dirname
+                                                    << std::endl);
+                }
+            }
+            write_local_plot_data(dbfile,
+                                  data,
+                                  job.object_name,
+                                  job.coarsest_ln,
+                                  job.finest_ln,
+                                  job.time_step_number,
+                                  job.simulation_time);
+            if (job.num_files > 0 && DBSetDir(dbfile, "..") == -1)
+            {
+                PLOT_DATA_ERROR(job.object_name << "::writePlotData()\n"
+                                                << "  Could not return to the base directory from subdirectory "
+                                                << proc_dirname
+                                                << std::endl);
+            }
+        }
+        DBClose(dbfile);
+    }
+
+    if (job.write_summary)
+    {
+        std::vector<std::vector<int> >& nclouds_per_proc = job.nclouds_per_proc;
+        std::vector<std::vector<int> >& nblocks_per_proc = job.nblocks_per_proc;
+        std::vector<std::vector<int> >& nmbs_per_proc = job.nmbs_per_proc;
+        std::vector<std::vector<int> >& nucd_meshes_per_proc = job.nucd_meshes_per_proc;
+        std::vector<std::vector<std::vector<int> > >& meshtypes_per_proc = job.meshtypes_per_proc;
+        std::vector<std::vector<std::vector<int> > >& vartypes_per_proc = job.vartypes_per_proc;
+        std::vector<std::vector<std::vector<int> > >& mb_nblocks_per_proc = job.mb_nblocks_per_proc;
+        std::vector<std::vector<std::vector<std::vector<int> > > >& multimeshtypes_per_proc =
+            job.multimeshtypes_per_proc;
+        std::vector<std::vector<std::vector<std::vector<int> > > >& multivartypes_per_proc =
+            job.multivartypes_per_proc;
+        std::vector<std::vector<std::vector<std::string> > >& cloud_names_per_proc = job.cloud_names_per_proc;
+        std::vector<std::vector<std::vector<std::string> > >& block_names_per_proc = job.block_names_per_proc;
+        std::vector<std::vector<std::vector<std::string> > >& mb_names_per_proc = job.mb_names_per_proc;
+        std::vector<std::vector<std::vector<std::string> > >& ucd_mesh_names_per_proc = job.ucd_mesh_names_per_proc;
+
+        // Create and initialize the multimesh Silo database on the root MPI
+        // process.
+        sprintf(temp_buf, "%06d", job.time_step_number);
+        std::string summary_file_name =
+            job.dump_dirname + "/" + SILO_SUMMARY_FILE_PREFIX + temp_buf + SILO_SUMMARY_FILE_POSTFIX;
+        if (!(dbfile = DBCreate(summary_file_name.c_str(), DB_CLOBBER, DB_LOCAL, NULL, DB_PDB)))
+        {
+            PLOT_DATA_ERROR(job.object_name << "::writePlotData()\n"
+                                            << "  Could not create DBfile named "
+                                            << summary_file_name
+                                            << std::endl);
+        }
+
+        int cycle = job.time_step_number;
+        float time = float(job.simulation_time);
+        double dtime = job.simulation_time;
+
+        static const int MAX_OPTS = 3;
+        DBoptlist* optlist = DBMakeOptlist(MAX_OPTS);
+        DBAddOption(optlist, DBOPT_CYCLE, &cycle);
+        DBAddOption(optlist, DBOPT_TIME, &time);
+        DBAddOption(optlist, DBOPT_DTIME, &dtime);
+
+        for (int proc = 0; proc < job.mpi_nodes; ++proc)
+        {
+            const std::string data_prefix = get_data_prefix(proc, job.mpi_nodes, job.num_files);
+            for (int ln = job.coarsest_ln; ln <= job.finest_ln; ++ln)
+            {
+                for (int cloud = 0; cloud < nclouds_per_proc[ln][proc]; ++cloud)
+                {
+                    std::ostringstream stream;
+                    stream << data_prefix << "level_" << ln << "_cloud_" << cloud << "/mesh";
+                    std::string meshname = stream.str();
+                    char* meshname_ptr = const_cast<char*>(meshname.c_str());
+                    int meshtype = DB_POINTMESH;
+
+                    std::string& cloud_name = cloud_names_per_proc[ln][proc][cloud];
+
+                    DBPutMultimesh(dbfile, cloud_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
+
+                    if (DBMkDir(dbfile, cloud_name.c_str()) == -1)
+                    {
+                        PLOT_DATA_ERROR(job.object_name << "::writePlotData()\n"
+                                                        << "  Could not create directory named "
+                                                        << cloud_name
+                                                        << std::endl);
+                    }
+                }
+
+                for (int block = 0; block < nblocks_per_proc[ln][proc]; ++block)
+                {
+                    std::ostringstream stream;
+                    stream << data_prefix << "level_" << ln << "_block_" << block << "/mesh";
+                    std::string meshname = stream.str();
+                    char* meshname_ptr = const_cast<char*>(meshname.c_str());
+                    int meshtype = meshtypes_per_proc[ln][proc][block];
+
+                    std::string& block_name = block_names_per_proc[ln][proc][block];
+
+                    DBPutMultimesh(dbfile, block_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
+
+                    if (DBMkDir(dbfile, block_name.c_str()) == -1)
+                    {
+                        PLOT_DATA_ERROR(job.object_name << "::writePlotData()\n"
+                                                        << "  Could not create directory named "
+                                                        << block_name
+                                                        << std::endl);
+                    }
+                }
+
+                for (int mb = 0; mb < nmbs_per_proc[ln][proc]; ++mb)
+                {
+                    const int nblocks = mb_nblocks_per_proc[ln][proc][mb];
+                    char** meshnames = new char*[nblocks];
+
+                    for (int block = 0; block < nblocks; ++block)
+                    {
+                        std::ostringstream stream;
+                        stream << data_prefix << "level_" << ln << "_mb_" << mb << "_block_" << block << "/mesh";
+                        meshnames[block] = strdup(stream.str().c_str());
+                    }
+
+                    std::string& mb_name = mb_names_per_proc[ln][proc][mb];
+
+                    DBPutMultimesh(dbfile,
+                                   mb_name.c_str(),
+                                   nblocks,
+                                   meshnames,
+                                   &multimeshtypes_per_proc[ln][proc][mb][0],
+                                   optlist);
+
+                    if (DBMkDir(dbfile, mb_name.c_str()) == -1)
+                    {
+                        PLOT_DATA_ERROR(job.object_name << "::writePlotData()\n"
+                                                        << "  Could not create directory named "
+                                                        << mb_name
+                                                        << std::endl);
+                    }
+
+                    for (int block = 0; block < nblocks; ++block)
+                    {
+                        free(meshnames[block]);
+                    }
+                    delete[] meshnames;
+                }
+
+                for (int mesh = 0; mesh < nucd_meshes_per_proc[ln][proc]; ++mesh)
+                {
+                    std::ostringstream stream;
+                    stream << data_prefix << "level_" << ln << "_mesh_" << mesh << "/mesh";
+                    std::string meshname = stream.str();
+                    char* meshname_ptr = const_cast<char*>(meshname.c_str());
+                    int meshtype = DB_UCDMESH;
+
+                    std::string& mesh_name = ucd_mesh_names_per_proc[ln][proc][mesh];
+
+                    DBPutMultimesh(dbfile, mesh_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
+
+                    if (DBMkDir(dbfile, mesh_name.c_str()) == -1)
+                    {
+                        PLOT_DATA_ERROR(job.object_name << "::writePlotData()\n"
+                                                        << "  Could not create directory named "
+                                                        << mesh_name
+                                                        << std::endl);
+                    }
+                }
+
+                for (int v = 0; v < job.nvars[ln]; ++v)
+                {
+                    for (int cloud = 0; cloud < nclouds_per_proc[ln][proc]; ++cloud)
+                    {
+                        std::ostringstream varname_stream;
+                        varname_stream << data_prefix << "level_" << ln << "_cloud_" << cloud << "/"
+                                       << job.var_names[ln][v];
+                        std::string varname = varname_stream.str();
+                        char* varname_ptr = const_cast<char*>(varname.c_str());
+                        int vartype = DB_POINTVAR;
+
+                        std::string& cloud_name = cloud_names_per_proc[ln][proc][cloud];
+
+                        std::ostringstream stream;
+                        stream << cloud_name << "/" << job.var_names[ln][v];
+                        std::string var_name = stream.str();
+
+                        DBPutMultivar(dbfile, var_name.c_str(), 1, &varname_ptr, &vartype, optlist);
+                    }
+
+                    for (int block = 0; block < nblocks_per_proc[ln][proc]; ++block)
+                    {
+                        std::ostringstream varname_stream;
+                        varname_stream << data_prefix << "level_" << ln << "_block_" << block << "/"
+                                       << job.var_names[ln][v];
+                        std::string varname = varname_stream.str();
+                        char* varname_ptr = const_cast<char*>(varname.c_str());
+                        int vartype = vartypes_per_proc[ln][proc][block];
+
+                        std::string& block_name = block_names_per_proc[ln][proc][block];
+
+                        std::ostringstream stream;
+                        stream << block_name << "/" << job.var_names[ln][v];
+                        std::string var_name = stream.str();
+
+                        DBPutMultivar(dbfile, var_name.c_str(), 1, &varname_ptr, &vartype, optlist);
+                    }
+
+                    for (int mb = 0; mb < nmbs_per_proc[ln][proc]; ++mb)
+                    {
+                        const int nblocks = mb_nblocks_per_proc[ln][proc][mb];
+                        char** varnames = new char*[nblocks];
+
+                        for (int block = 0; block < nblocks; ++block)
+                        {
+                            std::ostringstream varname_stream;
+                            varname_stream << data_prefix << "level_" << ln << "_mb_" << mb << "_block_" << block
+                                           << job.var_names[ln][v];
+                            varnames[block] = strdup(varname_stream.str().c_str());
+                        }
+
+                        std::string& mb_name = mb_names_per_proc[ln][proc][mb];
+
+                        std::ostringstream stream;
+                        stream << mb_name << "/" << job.var_names[ln][v];
+                        std::string var_name = stream.str();
+
+                        DBPutMultivar(dbfile,
+                                      var_name.c_str(),
+                                      nblocks,
+                                      varnames,
+                                      &multivartypes_per_proc[ln][proc][mb][0],
+                                      optlist);
+
+                        for (int block = 0; block < nblocks; ++block)
+                        {
+                            free(varnames[block]);
+                        }
+                        delete[] varnames;
+                    }
+
+                    for (int mesh = 0; mesh < nucd_meshes_per_proc[ln][proc]; ++mesh)
+                    {
+                        std::ostringstream varname_stream;
+                        varname_stream << data_prefix << "level_" << ln << "_mesh_" << mesh << "/"
+                                       << job.var_names[ln][v];
+                        std::string varname = varname_stream.str();
+                        char* varname_ptr = const_cast<char*>(varname.c_str());
+                        int vartype = DB_UCDVAR;
+
+                        std::string& mesh_name = ucd_mesh_names_per_proc[ln][proc][mesh];
+
+                        std::ostringstream stream;
+                        stream << mesh_name << "/" << job.var_names[ln][v];
+                        std::string var_name = stream.str();
+
+                        DBPutMultivar(dbfile, var_name.c_str(), 1, &varname_ptr, &vartype, optlist);
+                    }
+                }
+            }
+        }
+
+        DBFreeOptlist(optlist);
+        DBClose(dbfile);
+
+        // Create or update the dumps file on the root MPI process.
+        static bool summary_file_opened = false;
+        std::string path = job.dump_directory_name + "/" + VISIT_DUMPS_FILENAME;
+        sprintf(temp_buf, "%06d", job.time_step_number);
+        std::string file =
+            job.current_dump_directory_name + "/" + SILO_SUMMARY_FILE_PREFIX + temp_buf + SILO_SUMMARY_FILE_POSTFIX;
+        if (!summary_file_opened)
+        {
+            summary_file_opened = true;
+            std::ofstream sfile(path.c_str(), std::ios::out);
+            sfile << file << std::endl;
+            sfile.close();
+        }
+        else
+        {
+            std::ofstream sfile(path.c_str(), std::ios::app);
+            sfile << file << std::endl;
+            sfile.close();
+        }
+    }
+
+    return;
+} // write_plot_data
+
+/*!
+ * \brief Write the data files of a plot dump.  The job is deleted once the data
+ * has been written.  Errors are recorded in the error message of the job.
+ *
+ * \note This function does not communicate and may be executed on a background
+ * thread.
+ */
+void*
+write_plot_data_job(void* ctx)
+{
+    PlotDataJob* const job = static_cast<PlotDataJob*>(ctx);
+    try
+    {
+        write_plot_data(*job);
+    }
+    catch (const std::exception& e)
+    {
+        *job->error_message = e.what();
+    }
+    delete job;
+    return NULL;
+} // write_plot_data_job
+#endif // if defined(IBTK_HAVE_SILO)
+}
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+LSiloDataWriter::LSiloDataWriter(const std::string& object_name,
+                                 const std::string& dump_directory_name,
+                                 bool register_for_restart)
+    : d_object_name(object_name),
+      d_registered_for_restart(register_for_restart),
+      d_dump_directory_name(dump_directory_name),
+      d_time_step_number(-1),
+      d_hierarchy(),
+      d_coarsest_ln(0),
+      d_finest_ln(0),
+      d_nclouds(d_finest_ln + 1, 0),
+      d_cloud_names(d_finest_ln + 1),
+      d_cloud_nmarks(d_finest_ln + 1),
+      d_cloud_first_lag_idx(d_finest_ln + 1),
+      d_nblocks(d_finest_ln + 1, 0),
+      d_block_names(d_finest_ln + 1),
+      d_block_nelems(d_finest_ln + 1),
+      d_block_periodic(d_finest_ln + 1),
+      d_block_first_lag_idx(d_finest_ln + 1),
+      d_nmbs(d_finest_ln + 1, 0),
+      d_mb_names(d_finest_ln + 1),
+      d_mb_nblocks(d_finest_ln + 1),
+      d_mb_nelems(d_finest_ln + 1),
+      d_mb_periodic(d_finest_ln + 1),
+      d_mb_first_lag_idx(d_finest_ln + 1),
+      d_nucd_meshes(d_finest_ln + 1, 0),
+      d_ucd_mesh_names(d_finest_ln + 1),
+      d_ucd_mesh_vertices(d_finest_ln + 1),
+      d_ucd_mesh_edge_maps(d_finest_ln + 1),
+      d_coords_data(d_finest_ln + 1, Pointer<LData>(NULL)),
+      d_nvars(d_finest_ln + 1, 0),
+      d_var_names(d_finest_ln + 1),
+      d_var_start_depths(d_finest_ln + 1),
+      d_var_plot_depths(d_finest_ln + 1),
+      d_var_depths(d_finest_ln + 1),
+      d_var_data(d_finest_ln + 1),
+      d_ao(d_finest_ln + 1),
+      d_build_vec_scatters(d_finest_ln + 1),
+      d_src_vec(d_finest_ln + 1),
+      d_dst_vec(d_finest_ln + 1),
+      d_vec_scatter(d_finest_ln + 1),
+      d_async_output(false),
+      d_num_output_files(0),
+      d_async_output_pending(false),
+      d_output_error_message()
+{
+#if defined(IBTK_HAVE_SILO)
+// intentionally blank
+#else
+    TBOX_WARNING("LSiloDataWriter::LSiloDataWriter(): SILO is not installed; cannot write data." << std::endl);
+#endif
+    if (d_registered_for_restart)
+    {
+        RestartManager::getManager()->registerRestartItem(d_object_name, this);
+    }
+
+    // Initialize object with data read from the restart database.
+    const bool from_restart = RestartManager::getManager()->isFromRestart();
+    if (from_restart)
+    {
+        getFromRestart();
+    }
+    return;
+} // LSiloDataWriter
+
+LSiloDataWriter::~LSiloDataWriter()
+{
+    // NOTE: Errors encountered while writing pending output are logged rather
+    // than reported via TBOX_ERROR, which aborts the program.
+    joinPendingOutput();
+    if (!d_output_error_message.empty())
+    {
+        pout << d_object_name << "::~LSiloDataWriter()\n"
+             << "  error encountered while writing plot data:\n"
+             << d_output_error_message << std::endl;
+        d_output_error_message.clear();
+    }
+
+    if (d_registered_for_restart)
+    {
+        RestartManager::getManager()->unregisterRestartItem(d_object_name);
+    }
+
+    // Destroy any remaining PETSc objects.
+    int ierr;
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        for (std::map<int, Vec>::iterator it = d_dst_vec[ln].begin(); it != d_dst_vec[ln].end(); ++it)
+        {
+            Vec& v = it->second;
+            if (v)
+            {
+                ierr = VecDestroy(&v);
+                IBTK_CHKERRQ(ierr);
+            }
+        }
+        for (std::map<int, VecScatter>::iterator it = d_vec_scatter[ln].begin(); it != d_vec_scatter[ln].end(); ++it)
+        {
+            VecScatter& vs = it->second;
+            if (vs)
+            {
+                ierr = VecScatterDestroy(&vs);
+                IBTK_CHKERRQ(ierr);
+            }
+        }
+    }
+    return;
+} // ~LSiloDataWriter
+
+void
+LSiloDataWriter::setPatchHierarchy(Pointer<PatchHierarchy<NDIM> > hierarchy)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(hierarchy);
+    TBOX_ASSERT(hierarchy->getFinestLevelNumber() >= d_finest_ln);
+#endif
+    // Reset the hierarchy.
+    d_hierarchy = hierarchy;
+    return;
+} // setPatchHierarchy
+
+void
+LSiloDataWriter::resetLevels(const int coarsest_ln, const int finest_ln)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT((coarsest_ln >= 0) && (finest_ln >= coarsest_ln));
+    if (d_hierarchy)
+    {
+        TBOX_ASSERT(finest_ln <= d_hierarchy->getFinestLevelNumber());
+    }
+#endif
+    // Destroy any unneeded PETSc objects.
+    int ierr;
+    for (int ln = std::max(d_coarsest_ln, 0); (ln <= d_finest_ln) && (ln < coarsest_ln); ++ln)
+    {
+        for (std::map<int, Vec>::iterator it = d_dst_vec[ln].begin(); it != d_dst_vec[ln].end(); ++it)
+        {
+            Vec& v = it->second;
+            if (v)
+            {
+                ierr = VecDestroy(&v);
+                IBTK_CHKERRQ(ierr);
+            }
+        }
+        for (std::map<int, VecScatter>::iterator it = d_vec_scatter[ln].begin(); it != d_vec_scatter[ln].end(); ++it)
+        {
+            VecScatter& vs = it->second;
+            if (vs)
+            {
+                ierr = VecScatterDestroy(&vs);
+                IBTK_CHKERRQ(ierr);
+            }
+        }
+    }
+
+    for (int ln = finest_ln + 1; ln <= d_finest_ln; ++ln)
+    {
+        for (std::map<int, Vec>::iterator it = d_dst_vec[ln].begin(); it != d_dst_vec[ln].end(); ++it)
+        {
+            Vec& v = it->second;
+            if (v)
+            {
+                ierr = VecDestroy(&v);
+                IBTK_CHKERRQ(ierr);
+            }
+        }
+        for (std::map<int, VecScatter>::iterator it = d_vec_scatter[ln].begin(); it != d_vec_scatter[ln].end(); ++it)
+        {
+            VecScatter& vs = it->second;
+            if (vs)
+            {
+                ierr = VecScatterDestroy(&vs);
+                IBTK_CHKERRQ(ierr);
+            }
+        }
+    }
+
+    // Reset the level numbers.
+    d_coarsest_ln = coarsest_ln;
+    d_finest_ln = finest_ln;
+
+    // Resize some arrays.
+    d_nclouds.resize(d_finest_ln + 1, 0);
+    d_cloud_names.resize(d_finest_ln + 1);
+    d_cloud_nmarks.resize(d_finest_ln + 1);
+    d_cloud_first_lag_idx.resize(d_finest_ln + 1);
+
+    d_nblocks.resize(d_finest_ln + 1, 0);
+    d_block_names.resize(d_finest_ln + 1);
+    d_block_nelems.resize(d_finest_ln + 1);
+    d_block_periodic.resize(d_finest_ln + 1);
+    d_block_first_lag_idx.resize(d_finest_ln + 1);
+
+    d_nmbs.resize(d_finest_ln + 1, 0);
+    d_mb_nblocks.resize(d_finest_ln + 1);
+    d_mb_names.resize(d_finest_ln + 1);
+    d_mb_nelems.resize(d_finest_ln + 1);
+    d_mb_periodic.resize(d_finest_ln + 1);
+    d_mb_first_lag_idx.resize(d_finest_ln + 1);
 
     d_nucd_meshes.resize(d_finest_ln + 1, 0);
     d_ucd_mesh_names.resize(d_finest_ln + 1);
@@ -1270,12 +2158,14 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
                                  << std::endl);
     }
 
+    // Make sure that the previous plot dump has been written.
+    waitForPendingOutput();
+
     int ierr;
     char temp_buf[SILO_NAME_BUFSIZE];
-    std::string current_file_name;
-    DBfile* dbfile;
     const int mpi_rank = SAMRAI_MPI::getRank();
     const int mpi_nodes = SAMRAI_MPI::getNodes();
+    const int num_files = (d_num_output_files > 0 && d_num_output_files < mpi_nodes) ? d_num_output_files : 0;
 
     // Construct the VecScatter objects required to write the plot data.
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
@@ -1294,266 +2184,99 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
     Utilities::recursiveMkdir(dump_dirname);
 
-    // Create one local DBfile per MPI process.
-    sprintf(temp_buf, "%04d", mpi_rank);
-    current_file_name = dump_dirname + "/" + SILO_PROCESSOR_FILE_PREFIX;
-    current_file_name += temp_buf;
-    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-    if (!(dbfile = DBCreate(current_file_name.c_str(), DB_CLOBBER, DB_LOCAL, NULL, DB_PDB)))
-    {
-        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                 << "  Could not create DBfile named "
-                                 << current_file_name
-                                 << std::endl);
-    }
+    // Setup the output job.
+    PlotDataJob* job = new PlotDataJob();
+    job->object_name = d_object_name;
+    job->coarsest_ln = d_coarsest_ln;
+    job->finest_ln = d_finest_ln;
+    job->time_step_number = time_step_number;
+    job->simulation_time = simulation_time;
+    job->dump_directory_name = d_dump_directory_name;
+    job->current_dump_directory_name = current_dump_directory_name;
+    job->dump_dirname = dump_dirname;
+    job->mpi_nodes = mpi_nodes;
+    job->num_files = num_files;
+    job->write_summary = false;
+    job->error_message = &d_output_error_message;
 
     std::vector<std::vector<int> > meshtype(d_finest_ln + 1), vartype(d_finest_ln + 1);
     std::vector<std::vector<std::vector<int> > > multimeshtype(d_finest_ln + 1), multivartype(d_finest_ln + 1);
 
-    // Set the local data.
+    // Take a snapshot of the local data, so that the Lagrangian data may be
+    // modified while the plot data is being written.
+    job->local_data.resize(1);
+    LocalPlotData& local_data = job->local_data[0];
+    local_data.rank = mpi_rank;
+    local_data.has_coords.resize(d_finest_ln + 1, 0);
+    local_data.nclouds = d_nclouds;
+    local_data.cloud_nmarks = d_cloud_nmarks;
+    local_data.nblocks = d_nblocks;
+    local_data.block_nelems = d_block_nelems;
+    local_data.block_periodic = d_block_periodic;
+    local_data.nmbs = d_nmbs;
+    local_data.mb_nblocks = d_mb_nblocks;
+    local_data.mb_nelems = d_mb_nelems;
+    local_data.mb_periodic = d_mb_periodic;
+    local_data.nucd_meshes = d_nucd_meshes;
+    local_data.ucd_mesh_vertices = d_ucd_mesh_vertices;
+    local_data.ucd_mesh_edge_maps = d_ucd_mesh_edge_maps;
+    local_data.nvars = d_nvars;
+    local_data.var_names = d_var_names;
+    local_data.var_start_depths = d_var_start_depths;
+    local_data.var_plot_depths = d_var_plot_depths;
+    local_data.var_depths = d_var_depths;
+    local_data.X.resize(d_finest_ln + 1);
+    local_data.var_vals.resize(d_finest_ln + 1);
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        if (d_coords_data[ln])
-        {
-            // Scatter the data from "global" to "local" form.
-            Vec local_X_vec;
-            ierr = VecDuplicate(d_dst_vec[ln][NDIM], &local_X_vec);
-            IBTK_CHKERRQ(ierr);
-
-            Vec global_X_vec = d_coords_data[ln]->getVec();
-            ierr = VecScatterBegin(d_vec_scatter[ln][NDIM], global_X_vec, local_X_vec, INSERT_VALUES, SCATTER_FORWARD);
-            IBTK_CHKERRQ(ierr);
-            ierr = VecScatterEnd(d_vec_scatter[ln][NDIM], global_X_vec, local_X_vec, INSERT_VALUES, SCATTER_FORWARD);
-            IBTK_CHKERRQ(ierr);
-
-            double* local_X_arr;
-            ierr = VecGetArray(local_X_vec, &local_X_arr);
-            IBTK_CHKERRQ(ierr);
-
-            std::vector<Vec> local_v_vecs;
-            std::vector<double*> local_v_arrs;
-
-            for (int v = 0; v < d_nvars[ln]; ++v)
-            {
-                const int var_depth = d_var_depths[ln][v];
-                Vec local_v_vec;
-                ierr = VecDuplicate(d_dst_vec[ln][var_depth], &local_v_vec);
-                IBTK_CHKERRQ(ierr);
-
-                Vec global_v_vec = d_var_data[ln][v]->getVec();
-                ierr = VecScatterBegin(
-                    d_vec_scatter[ln][var_depth], global_v_vec, local_v_vec, INSERT_VALUES, SCATTER_FORWARD);
-                IBTK_CHKERRQ(ierr);
-                ierr = VecScatterEnd(
-                    d_vec_scatter[ln][var_depth], global_v_vec, local_v_vec, INSERT_VALUES, SCATTER_FORWARD);
-                IBTK_CHKERRQ(ierr);
-
-                double* local_v_arr;
-                ierr = VecGetArray(local_v_vec, &local_v_arr);
-                IBTK_CHKERRQ(ierr);
-
-                local_v_vecs.push_back(local_v_vec);
-                local_v_arrs.push_back(local_v_arr);
-            }
-
-            // Keep track of the current offset in the local Vec data.
-            int offset = 0;
-
-            // Add the local clouds to the local DBfile.
-            for (int cloud = 0; cloud < d_nclouds[ln]; ++cloud)
-            {
-                const int nmarks = d_cloud_nmarks[ln][cloud];
-
-                std::ostringstream stream;
-                stream << "level_" << ln << "_cloud_" << cloud;
-                std::string dirname = stream.str();
-
-                if (DBMkDir(dbfile, dirname.c_str()) == -1)
-                {
-                    TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                             << "  Could not create directory named "
-                                             << dirname
-                                             << std::endl);
-                }
-
-                const double* const X = local_X_arr + NDIM * offset;
-                std::vector<const double*> var_vals(d_nvars[ln]);
-                for (int v = 0; v < d_nvars[ln]; ++v)
-                {
-                    var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
-                }
-
-                build_local_marker_cloud(dbfile,
-                                         dirname,
-                                         nmarks,
-                                         X,
-                                         d_nvars[ln],
-                                         d_var_names[ln],
-                                         d_var_start_depths[ln],
-                                         d_var_plot_depths[ln],
-                                         d_var_depths[ln],
-                                         var_vals,
-                                         time_step_number,
-                                         simulation_time);
-
-                offset += nmarks;
-            }
-
-            // Add the local blocks to the local DBfile.
-            for (int block = 0; block < d_nblocks[ln]; ++block)
-            {
-                const IntVector<NDIM>& nelem = d_block_nelems[ln][block];
-                const IntVector<NDIM>& periodic = d_block_periodic[ln][block];
-                const int ntot = nelem.getProduct();
-
-                std::ostringstream stream;
-                stream << "level_" << ln << "_block_" << block;
-                std::string dirname = stream.str();
-
-                if (DBMkDir(dbfile, dirname.c_str()) == -1)
-                {
-                    TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                             << "  Could not create directory named "
-                                             << dirname
-                                             << std::endl);
-                }
-
-                const double* const X = local_X_arr + NDIM * offset;
-                std::vector<const double*> var_vals(d_nvars[ln]);
-                for (int v = 0; v < d_nvars[ln]; ++v)
-                {
-                    var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
-                }
-
-                build_local_curv_block(dbfile,
-                                       dirname,
-                                       nelem,
-                                       periodic,
-                                       X,
-                                       d_nvars[ln],
-                                       d_var_names[ln],
-                                       d_var_start_depths[ln],
-                                       d_var_plot_depths[ln],
-                                       d_var_depths[ln],
-                                       var_vals,
-                                       time_step_number,
-                                       simulation_time);
-                meshtype[ln].push_back(DB_QUAD_CURV);
-                vartype[ln].push_back(DB_QUADVAR);
-
-                offset += ntot;
-            }
-
-            // Add the local multiblocks to the local DBfile.
-            multimeshtype[ln].resize(d_nmbs[ln]);
-            multivartype[ln].resize(d_nmbs[ln]);
-            for (int mb = 0; mb < d_nmbs[ln]; ++mb)
-            {
-                for (int block = 0; block < d_mb_nblocks[ln][mb]; ++block)
-                {
-                    const IntVector<NDIM>& nelem = d_mb_nelems[ln][mb][block];
-                    const IntVector<NDIM>& periodic = d_mb_periodic[ln][mb][block];
-                    const int ntot = nelem.getProduct();
-
-                    std::ostringstream stream;
-                    stream << "level_" << ln << "_mb_" << mb << "_block_" << block;
-                    std::string dirname = stream.str();
-
-                    if (DBMkDir(dbfile, dirname.c_str()) == -1)
-                    {
-                        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                                 << "  Could not create directory named "
-                                                 << dirname
-                                                 << std::endl);
-                    }
-
-                    const double* const X = local_X_arr + NDIM * offset;
-                    std::vector<const double*> var_vals(d_nvars[ln]);
-                    for (int v = 0; v < d_nvars[ln]; ++v)
-                    {
-                        var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
-                    }
-
-                    build_local_curv_block(dbfile,
-                                           dirname,
-                                           nelem,
-                                           periodic,
-                                           X,
-                                           d_nvars[ln],
-                                           d_var_names[ln],
-                                           d_var_start_depths[ln],
-                                           d_var_plot_depths[ln],
-                                           d_var_depths[ln],
-                                           var_vals,
-                                           time_step_number,
-                                           simulation_time);
-                    multimeshtype[ln][mb].push_back(DB_QUAD_CURV);
-                    multivartype[ln][mb].push_back(DB_QUADVAR);
-
-                    offset += ntot;
-                }
-            }
-
-            // Add the local UCD meshes to the local DBfile.
-            for (int mesh = 0; mesh < d_nucd_meshes[ln]; ++mesh)
-            {
-                const std::set<int>& vertices = d_ucd_mesh_vertices[ln][mesh];
-                const std::multimap<int, std::pair<int, int> >& edge_map = d_ucd_mesh_edge_maps[ln][mesh];
-                const size_t ntot = vertices.size();
-
-                std::ostringstream stream;
-                stream << "level_" << ln << "_mesh_" << mesh;
-                std::string dirname = stream.str();
-
-                if (DBMkDir(dbfile, dirname.c_str()) == -1)
-                {
-                    TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                             << "  Could not create directory named "
-                                             << dirname
-                                             << std::endl);
-                }
+    {
+        if (!d_coords_data[ln]) continue;
+        local_data.has_coords[ln] = 1;
 
-                const double* const X = local_X_arr + NDIM * offset;
-                std::vector<const double*> var_vals(d_nvars[ln]);
-                for (int v = 0; v < d_nvars[ln]; ++v)
-                {
-                    var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
-                }
+        // Scatter the data from "global" to "local" form.
+        Vec local_X_vec;
+        ierr = VecDuplicate(d_dst_vec[ln][NDIM], &local_X_vec);
+        IBTK_CHKERRQ(ierr);
 
-                build_local_ucd_mesh(dbfile,
-                                     dirname,
-                                     vertices,
-                                     edge_map,
-                                     X,
-                                     d_nvars[ln],
-                                     d_var_names[ln],
-                                     d_var_start_depths[ln],
-                                     d_var_plot_depths[ln],
-                                     d_var_depths[ln],
-                                     var_vals,
-                                     time_step_number,
-                                     simulation_time);
+        Vec global_X_vec = d_coords_data[ln]->getVec();
+        ierr = VecScatterBegin(d_vec_scatter[ln][NDIM], global_X_vec, local_X_vec, INSERT_VALUES, SCATTER_FORWARD);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecScatterEnd(d_vec_scatter[ln][NDIM], global_X_vec, local_X_vec, INSERT_VALUES, SCATTER_FORWARD);
+        IBTK_CHKERRQ(ierr);
+        copy_local_vec(local_X_vec, local_data.X[ln]);
+        ierr = VecDestroy(&local_X_vec);
+        IBTK_CHKERRQ(ierr);
 
-                offset += ntot;
-            }
+        local_data.var_vals[ln].resize(d_nvars[ln]);
+        for (int v = 0; v < d_nvars[ln]; ++v)
+        {
+            const int var_depth = d_var_depths[ln][v];
+            Vec local_v_vec;
+            ierr = VecDuplicate(d_dst_vec[ln][var_depth], &local_v_vec);
+            IBTK_CHKERRQ(ierr);
 
-            // Clean up allocated data.
-            ierr = VecRestoreArray(local_X_vec, &local_X_arr);
+            Vec global_v_vec = d_var_data[ln][v]->getVec();
+            ierr = VecScatterBegin(
+                d_vec_scatter[ln][var_depth], global_v_vec, local_v_vec, INSERT_VALUES, SCATTER_FORWARD);
             IBTK_CHKERRQ(ierr);
-            ierr = VecDestroy(&local_X_vec);
+            ierr =
+                VecScatterEnd(d_vec_scatter[ln][var_depth], global_v_vec, local_v_vec, INSERT_VALUES, SCATTER_FORWARD);
+            IBTK_CHKERRQ(ierr);
+            copy_local_vec(local_v_vec, local_data.var_vals[ln][v]);
+            ierr = VecDestroy(&local_v_vec);
             IBTK_CHKERRQ(ierr);
-            for (int v = 0; v < d_nvars[ln]; ++v)
-            {
-                ierr = VecRestoreArray(local_v_vecs[v], &local_v_arrs[v]);
-                IBTK_CHKERRQ(ierr);
-                ierr = VecDestroy(&local_v_vecs[v]);
-                IBTK_CHKERRQ(ierr);
-            }
         }
-    }
 
-    DBClose(dbfile);
+        // Record the types of the local blocks and multiblocks.
+        meshtype[ln].assign(d_nblocks[ln], DB_QUAD_CURV);
+        vartype[ln].assign(d_nblocks[ln], DB_QUADVAR);
+        multimeshtype[ln].resize(d_nmbs[ln]);
+        multivartype[ln].resize(d_nmbs[ln]);
+        for (int mb = 0; mb < d_nmbs[ln]; ++mb)
+        {
+            multimeshtype[ln][mb].assign(d_mb_nblocks[ln][mb], DB_QUAD_CURV);
+            multivartype[ln][mb].assign(d_mb_nblocks[ln][mb], DB_QUADVAR);
+        }
+    }
 
     // Send data to the root MPI process required to create the multimesh and
     // multivar objects.
@@ -1814,296 +2537,133 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
         }
     }
 
-    if (mpi_rank == SILO_MPI_ROOT)
+    // When the data are aggregated into fewer files than processes, send the
+    // local data to the first process that writes the corresponding file.
+    if (num_files > 0)
     {
-        // Create and initialize the multimesh Silo database on the root MPI
-        // process.
-        sprintf(temp_buf, "%06d", d_time_step_number);
-        std::string summary_file_name =
-            dump_dirname + "/" + SILO_SUMMARY_FILE_PREFIX + temp_buf + SILO_SUMMARY_FILE_POSTFIX;
-        if (!(dbfile = DBCreate(summary_file_name.c_str(), DB_CLOBBER, DB_LOCAL, NULL, DB_PDB)))
-        {
-            TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                     << "  Could not create DBfile named "
-                                     << summary_file_name
-                                     << std::endl);
-        }
-
-        int cycle = time_step_number;
-        float time = float(simulation_time);
-        double dtime = simulation_time;
-
-        static const int MAX_OPTS = 3;
-        DBoptlist* optlist = DBMakeOptlist(MAX_OPTS);
-        DBAddOption(optlist, DBOPT_CYCLE, &cycle);
-        DBAddOption(optlist, DBOPT_TIME, &time);
-        DBAddOption(optlist, DBOPT_DTIME, &dtime);
-
+        const int file_idx = get_file_index(mpi_rank, mpi_nodes, num_files);
+        std::vector<int> file_procs;
         for (int proc = 0; proc < mpi_nodes; ++proc)
         {
-            for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-            {
-                for (int cloud = 0; cloud < nclouds_per_proc[ln][proc]; ++cloud)
-                {
-                    sprintf(temp_buf, "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                    std::ostringstream stream;
-                    stream << current_file_name << ":level_" << ln << "_cloud_" << cloud << "/mesh";
-                    std::string meshname = stream.str();
-                    char* meshname_ptr = const_cast<char*>(meshname.c_str());
-                    int meshtype = DB_POINTMESH;
-
-                    std::string& cloud_name = cloud_names_per_proc[ln][proc][cloud];
-
-                    DBPutMultimesh(dbfile, cloud_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
-
-                    if (DBMkDir(dbfile, cloud_name.c_str()) == -1)
-                    {
-                        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                                 << "  Could not create directory named "
-                                                 << cloud_name
-                                                 << std::endl);
-                    }
-                }
-
-                for (int block = 0; block < nblocks_per_proc[ln][proc]; ++block)
-                {
-                    sprintf(temp_buf, "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                    std::ostringstream stream;
-                    stream << current_file_name << ":level_" << ln << "_block_" << block << "/mesh";
-                    std::string meshname = stream.str();
-                    char* meshname_ptr = const_cast<char*>(meshname.c_str());
-                    int meshtype = meshtypes_per_proc[ln][proc][block];
-
-                    std::string& block_name = block_names_per_proc[ln][proc][block];
-
-                    DBPutMultimesh(dbfile, block_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
-
-                    if (DBMkDir(dbfile, block_name.c_str()) == -1)
-                    {
-                        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                                 << "  Could not create directory named "
-                                                 << block_name
-                                                 << std::endl);
-                    }
-                }
-
-                for (int mb = 0; mb < nmbs_per_proc[ln][proc]; ++mb)
-                {
-                    sprintf(temp_buf, "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                    const int nblocks = mb_nblocks_per_proc[ln][proc][mb];
-                    char** meshnames = new char*[nblocks];
-
-                    for (int block = 0; block < nblocks; ++block)
-                    {
-                        std::ostringstream stream;
-                        stream << current_file_name << ":level_" << ln << "_mb_" << mb << "_block_" << block << "/mesh";
-                        meshnames[block] = strdup(stream.str().c_str());
-                    }
-
-                    std::string& mb_name = mb_names_per_proc[ln][proc][mb];
-
-                    DBPutMultimesh(dbfile,
-                                   mb_name.c_str(),
-                                   nblocks,
-                                   meshnames,
-                                   &multimeshtypes_per_proc[ln][proc][mb][0],
-                                   optlist);
-
-                    if (DBMkDir(dbfile, mb_name.c_str()) == -1)
-                    {
-                        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                                 << "  Could not create directory named "
-                                                 << mb_name
-                                                 << std::endl);
-                    }
-
-                    for (int block = 0; block < nblocks; ++block)
-                    {
-                        free(meshnames[block]);
-                    }
-                    delete[] meshnames;
-                }
-
-                for (int mesh = 0; mesh < nucd_meshes_per_proc[ln][proc]; ++mesh)
-                {
-                    sprintf(temp_buf, "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                    std::ostringstream stream;
-                    stream << current_file_name << ":level_" << ln << "_mesh_" << mesh << "/mesh";
-                    std::string meshname = stream.str();
-                    char* meshname_ptr = const_cast<char*>(meshname.c_str());
-                    int meshtype = DB_UCDMESH;
-
-                    std::string& mesh_name = ucd_mesh_names_per_proc[ln][proc][mesh];
-
-                    DBPutMultimesh(dbfile, mesh_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
-
-                    if (DBMkDir(dbfile, mesh_name.c_str()) == -1)
-                    {
-                        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                                 << "  Could not create directory named "
-                                                 << mesh_name
-                                                 << std::endl);
-                    }
-                }
-
-                for (int v = 0; v < d_nvars[ln]; ++v)
-                {
-                    for (int cloud = 0; cloud < nclouds_per_proc[ln][proc]; ++cloud)
-                    {
-                        sprintf(temp_buf, "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                        std::ostringstream varname_stream;
-                        varname_stream << current_file_name << ":level_" << ln << "_cloud_" << cloud << "/"
-                                       << d_var_names[ln][v];
-                        std::string varname = varname_stream.str();
-                        char* varname_ptr = const_cast<char*>(varname.c_str());
-                        int vartype = DB_POINTVAR;
-
-                        std::string& cloud_name = cloud_names_per_proc[ln][proc][cloud];
-
-                        std::ostringstream stream;
-                        stream << cloud_name << "/" << d_var_names[ln][v];
-                        std::string var_name = stream.str();
-
-                        DBPutMultivar(dbfile, var_name.c_str(), 1, &varname_ptr, &vartype, optlist);
-                    }
-
-                    for (int block = 0; block < nblocks_per_proc[ln][proc]; ++block)
-                    {
-                        sprintf(temp_buf, "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                        std::ostringstream varname_stream;
-                        varname_stream << current_file_name << ":level_" << ln << "_block_" << block << "/"
-                                       << d_var_names[ln][v];
-                        std::string varname = varname_stream.str();
-                        char* varname_ptr = const_cast<char*>(varname.c_str());
-                        int vartype = vartypes_per_proc[ln][proc][block];
-
-                        std::string& block_name = block_names_per_proc[ln][proc][block];
-
-                        std::ostringstream stream;
-                        stream << block_name << "/" << d_var_names[ln][v];
-                        std::string var_name = stream.str();
-
-                        DBPutMultivar(dbfile, var_name.c_str(), 1, &varname_ptr, &vartype, optlist);
-                    }
-
-                    for (int mb = 0; mb < nmbs_per_proc[ln][proc]; ++mb)
-                    {
-                        sprintf(temp_buf, "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                        const int nblocks = mb_nblocks_per_proc[ln][proc][mb];
-                        char** varnames = new char*[nblocks];
-
-                        for (int block = 0; block < nblocks; ++block)
-                        {
-                            std::ostringstream varname_stream;
-                            varname_stream << current_file_name << ":level_" << ln << "_mb_" << mb << "_block_" << block
-                                           << d_var_names[ln][v];
-                            varnames[block] = strdup(varname_stream.str().c_str());
-                        }
-
-                        std::string& mb_name = mb_names_per_proc[ln][proc][mb];
-
-                        std::ostringstream stream;
-                        stream << mb_name << "/" << d_var_names[ln][v];
-                        std::string var_name = stream.str();
-
-                        DBPutMultivar(dbfile,
-                                      var_name.c_str(),
-                                      nblocks,
-                                      varnames,
-                                      &multivartypes_per_proc[ln][proc][mb][0],
-                                      optlist);
-
-                        for (int block = 0; block < nblocks; ++block)
-                        {
-                            free(varnames[block]);
-                        }
-                        delete[] varnames;
-                    }
-
-                    for (int mesh = 0; mesh < nucd_meshes_per_proc[ln][proc]; ++mesh)
-                    {
-                        sprintf(temp_buf, "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                        std::ostringstream varname_stream;
-                        varname_stream << current_file_name << ":level_" << ln << "_mesh_" << mesh << "/"
-                                       << d_var_names[ln][v];
-                        std::string varname = varname_stream.str();
-                        char* varname_ptr = const_cast<char*>(varname.c_str());
-                        int vartype = DB_UCDVAR;
-
-                        std::string& mesh_name = ucd_mesh_names_per_proc[ln][proc][mesh];
-
-                        std::ostringstream stream;
-                        stream << mesh_name << "/" << d_var_names[ln][v];
-                        std::string var_name = stream.str();
-
-                        DBPutMultivar(dbfile, var_name.c_str(), 1, &varname_ptr, &vartype, optlist);
-                    }
-                }
-            }
+            if (get_file_index(proc, mpi_nodes, num_files) == file_idx) file_procs.push_back(proc);
         }
-
-        DBFreeOptlist(optlist);
-        DBClose(dbfile);
-
-        // Create or update the dumps file on the root MPI process.
-        static bool summary_file_opened = false;
-        std::string path = d_dump_directory_name + "/" + VISIT_DUMPS_FILENAME;
-        sprintf(temp_buf, "%06d", d_time_step_number);
-        std::string file =
-            current_dump_directory_name + "/" + SILO_SUMMARY_FILE_PREFIX + temp_buf + SILO_SUMMARY_FILE_POSTFIX;
-        if (!summary_file_opened)
+        const int file_root = file_procs.front();
+        int one = 1;
+        if (mpi_rank != file_root)
         {
-            summary_file_opened = true;
-            std::ofstream sfile(path.c_str(), std::ios::out);
-            sfile << file << std::endl;
-            sfile.close();
+            std::vector<char> buffer;
+            pack_local_plot_data(job->local_data[0], d_coarsest_ln, d_finest_ln, buffer);
+            int num_bytes = static_cast<int>(buffer.size());
+            SAMRAI_MPI::send(&num_bytes, one, file_root, false);
+            MPI_Send(&buffer[0], num_bytes, MPI_CHAR, file_root, SILO_MPI_TAG, SAMRAI_MPI::commWorld);
+            job->local_data.clear();
         }
         else
         {
-            std::ofstream sfile(path.c_str(), std::ios::app);
-            sfile << file << std::endl;
-            sfile.close();
+            job->local_data.resize(file_procs.size());
+            for (unsigned int k = 1; k < file_procs.size(); ++k)
+            {
+                const int proc = file_procs[k];
+                int num_bytes;
+                SAMRAI_MPI::recv(&num_bytes, one, proc, false);
+                std::vector<char> buffer(num_bytes);
+                MPI_Status status;
+                MPI_Recv(&buffer[0], num_bytes, MPI_CHAR, proc, SILO_MPI_TAG, SAMRAI_MPI::commWorld, &status);
+                unpack_local_plot_data(buffer, d_coarsest_ln, d_finest_ln, job->local_data[k]);
+            }
         }
     }
-    SAMRAI_MPI::barrier();
+    if (!job->local_data.empty())
+    {
+        job->file_name = dump_dirname + "/" + get_file_name(mpi_rank, mpi_nodes, num_files);
+    }
+
+    // The root MPI process additionally writes the summary file.
+    if (mpi_rank == SILO_MPI_ROOT)
+    {
+        job->write_summary = true;
+        job->nvars = d_nvars;
+        job->var_names = d_var_names;
+        job->nclouds_per_proc.swap(nclouds_per_proc);
+        job->nblocks_per_proc.swap(nblocks_per_proc);
+        job->nmbs_per_proc.swap(nmbs_per_proc);
+        job->nucd_meshes_per_proc.swap(nucd_meshes_per_proc);
+        job->meshtypes_per_proc.swap(meshtypes_per_proc);
+        job->vartypes_per_proc.swap(vartypes_per_proc);
+        job->mb_nblocks_per_proc.swap(mb_nblocks_per_proc);
+        job->multimeshtypes_per_proc.swap(multimeshtypes_per_proc);
+        job->multivartypes_per_proc.swap(multivartypes_per_proc);
+        job->cloud_names_per_proc.swap(cloud_names_per_proc);
+        job->block_names_per_proc.swap(block_names_per_proc);
+        job->mb_names_per_proc.swap(mb_names_per_proc);
+        job->ucd_mesh_names_per_proc.swap(ucd_mesh_names_per_proc);
+    }
+
+    // Write the data, either in the background or right away.
+    if (d_async_output && pthread_create(&d_async_output_thread, NULL, write_plot_data_job, job) == 0)
+    {
+        d_async_output_pending = true;
+    }
+    else
+    {
+        write_plot_data_job(job);
+        waitForPendingOutput();
+        SAMRAI_MPI::barrier();
+    }
 #else
     TBOX_WARNING("LSiloDataWriter::writePlotData(): SILO is not installed; cannot write data." << std::endl);
 #endif // if defined(IBTK_HAVE_SILO)
     return;
 } // writePlotData
 
+void
+LSiloDataWriter::setAsynchronousOutput(const bool async_output)
+{
+    d_async_output = async_output;
+    return;
+} // setAsynchronousOutput
+
+void
+LSiloDataWriter::setNumberOfOutputFiles(const int num_files)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(num_files >= 0);
+#endif
+    d_num_output_files = num_files;
+    return;
+} // setNumberOfOutputFiles
+
+void
+LSiloDataWriter::waitForPendingOutput()
+{
+    joinPendingOutput();
+
+    // Report any error encountered while writing the data.  Errors cannot be
+    // reported from the background thread itself, and so they are recorded
+    // and reported here.
+    if (!d_output_error_message.empty())
+    {
+        const std::string error_message = d_output_error_message;
+        d_output_error_message.clear();
+        TBOX_ERROR(d_object_name << "::waitForPendingOutput()\n"
+                                 << "  error encountered while writing plot data:\n"
+                                 << error_message
+                                 << std::endl);
+    }
+    return;
+} // waitForPendingOutput
+
+void
+LSiloDataWriter::joinPendingOutput()
+{
+    if (d_async_output_pending)
+    {
+        pthread_join(d_async_output_thread, NULL);
+        d_async_output_pending = false;
+    }
+    return;
+} // joinPendingOutput
+
 void
 LSiloDataWriter::putToDatabase(Pointer<Database> db)
 {
@@ -117,6 +117,140 @@ static const std::string RT0 = "RT0";
 static const std::string LINEAR = "LINEAR";
 
 #define SCD(a) static_cast<double>(a)
+
+// Determine the index of the Cartesian grid cell containing an IB point and
+// the side-centered stencil boxes (one per axis) used to interpolate to it.
+inline void
+compute_sc_interp_stencil_boxes(Index<NDIM>& X_idx,
+                                Box<NDIM>* const stencil_box,
+                                const double* const X,
+                                const int interp_stencil,
+                                Pointer<CartesianGridGeometry<NDIM> > grid_geom,
+                                const IntVector<NDIM>& ratio,
+                                const double* const dx,
+                                const Index<NDIM>& domain_lower)
+{
+    if (interp_stencil % 2 != 0)
+    {
+        TBOX_ERROR(
+            "PETScMatUtilities::constructPatchLevelSCInterpOp(): support for odd "
+            "stencil "
+            "sizes not currently implemented\n");
+    }
+    const double* const x_lower = grid_geom->getXLower();
+    X_idx = IndexUtilities::getCellIndex(X, grid_geom, ratio);
+
+    // Determine the position of the center of the Cartesian grid cell
+    // containing the IB point.
+    double X_cell[NDIM];
+    for (int d = 0; d < NDIM; ++d)
+    {
+        X_cell[d] = (static_cast<double>(X_idx(d) - domain_lower(d)) + 0.5) * dx[d] + x_lower[d];
+    }
+    for (int axis = 0; axis < NDIM; ++axis)
+    {
+        Index<NDIM>& stencil_box_lower = stencil_box[axis].lower();
+        Index<NDIM>& stencil_box_upper = stencil_box[axis].upper();
+        for (int d = 0; d < NDIM; ++d)
+        {
+            if (d == axis)
+            {
+                stencil_box_lower(d) = X_idx(d) - interp_stencil / 2 + 1;
+                stencil_box_upper(d) = X_idx(d) + interp_stencil / 2;
+            }
+            else if (X[d] <= X_cell[d])
+            {
+                stencil_box_lower(d) = X_idx(d) - interp_stencil / 2;
+                stencil_box_upper(d) = X_idx(d) + interp_stencil / 2 - 1;
+            }
+            else
+            {
+                stencil_box_lower(d) = X_idx(d) - interp_stencil / 2 + 1;
+                stencil_box_upper(d) = X_idx(d) + interp_stencil / 2;
+            }
+        }
+    }
+    return;
+} // compute_sc_interp_stencil_boxes
+
+// Find a local patch that contains the specified cell index in either its
+// patch interior or ghost cell region.
+inline int
+find_local_patch_num(const Index<NDIM>& X_idx, Pointer<PatchLevel<NDIM> > patch_level)
+{
+    const ProcessorMapping& proc_mapping = patch_level->getProcessorMapping();
+    for (int growth_size = 0; growth_size <= 1; ++growth_size)
+    {
+        Box<NDIM> box(X_idx, X_idx);
+        box.grow(IntVector<NDIM>(growth_size));
+        Array<int> patch_num_arr;
+        patch_level->getBoxTree()->findOverlapIndices(patch_num_arr, box);
+        for (int j = 0; j < patch_num_arr.size(); ++j)
+        {
+            const int n = patch_num_arr[j];
+            if (proc_mapping.isMappingLocal(n)) return n;
+        }
+    }
+    return -1;
+} // find_local_patch_num
+
+// Set the NDIM rows of the interpolation operator associated with a single IB
+// point.
+inline void
+set_sc_interp_op_values(Mat& mat,
+                        const int row_lower,
+                        const double* const X,
+                        const Box<NDIM>* const stencil_box,
+                        void (*interp_fcn)(double r_lower, double* w),
+                        const int interp_stencil,
+                        const SideData<NDIM, int>& dof_index_data,
+                        const double* const x_lower,
+                        const double* const dx,
+                        const Index<NDIM>& domain_lower)
+{
+    std::vector<double> w[NDIM];
+    for (int d = 0; d < NDIM; ++d) w[d].resize(interp_stencil);
+    int stencil_box_nvals = 1;
+    for (unsigned int d = 0; d < NDIM; ++d) stencil_box_nvals *= interp_stencil;
+    std::vector<double> stencil_box_vals(stencil_box_nvals);
+    std::vector<int> stencil_box_cols(stencil_box_nvals);
+    for (int axis = 0; axis < NDIM; ++axis)
+    {
+        // Look-up the stencil box.
+        const Box<NDIM>& stencil_box_axis = stencil_box[axis];
+        const Index<NDIM>& stencil_box_lower = stencil_box_axis.lower();
+
+        // Compute the weights of the 1-dimensional delta functions.
+        for (int d = 0; d < NDIM; ++d)
+        {
+            const int i = stencil_box_lower(d);
+            const double X_stencil_lower =
+                (static_cast<double>(i - domain_lower(d)) + (d == axis ? 0.0 : 0.5)) * dx[d] + x_lower[d];
+            interp_fcn((X[d] - X_stencil_lower) / dx[d], &w[d][0]);
+        }
+
+        // Compute the weights of the d-dimensional delta function as the
+        // tensor products of the 1-dimensional delta functions.
+        int stencil_box_row = row_lower + axis;
+        int stencil_idx = 0;
+        std::fill(stencil_box_vals.begin(), stencil_box_vals.end(), 1.0);
+        for (Box<NDIM>::Iterator b(stencil_box_axis); b; b++, ++stencil_idx)
+        {
+            const SideIndex<NDIM> i(b(), axis, SideIndex<NDIM>::Lower);
+            for (int d = 0; d < NDIM; ++d)
+            {
+                stencil_box_vals[stencil_idx] *= w[d][i(d) - stencil_box_lower(d)];
+            }
+            stencil_box_cols[stencil_idx] = dof_index_data(i);
+        }
+
+        // Set the values for this IB point.
+        int ierr = MatSetValues(
+            mat, 1, &stencil_box_row, stencil_box_nvals, &stencil_box_cols[0], &stencil_box_vals[0], INSERT_VALUES);
+        IBTK_CHKERRQ(ierr);
+    }
+    return;
+} // set_sc_interp_op_values
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -820,9 +954,6 @@ PETScMatUtilities::constructPatchLevelSCInterpOp(Mat& mat,
 #endif
     const Index<NDIM>& domain_lower = domain_boxes[0].lower();
 
-    // The processor mapping determines which patches are assigned to which processors.
-    const ProcessorMapping& proc_mapping = patch_level->getProcessorMapping();
-
     // Determine the matrix dimensions and index ranges.
     int m_local;
     ierr = VecGetLocalSize(X_vec, &m_local);
@@ -851,40 +982,12 @@ PETScMatUtilities::constructPatchLevelSCInterpOp(Mat& mat,
     for (int k = 0; k < n_local_points; ++k)
     {
         const double* const X = &X_arr[NDIM * k];
-        const Index<NDIM> X_idx = IndexUtilities::getCellIndex(X, grid_geom, ratio);
-
-// Determine the position of the center of the Cartesian grid cell
-// containing the IB point.
-#if (NDIM == 2)
-        const double X_cell[NDIM] = { (static_cast<double>(X_idx(0) - domain_lower(0)) + 0.5) * dx[0] + x_lower[0],
-                                      (static_cast<double>(X_idx(1) - domain_lower(1)) + 0.5) * dx[1] + x_lower[1] };
-#endif
-#if (NDIM == 3)
-        const double X_cell[NDIM] = { (static_cast<double>(X_idx(0) - domain_lower(0)) + 0.5) * dx[0] + x_lower[0],
-                                      (static_cast<double>(X_idx(1) - domain_lower(1)) + 0.5) * dx[1] + x_lower[1],
-                                      (static_cast<double>(X_idx(2) - domain_lower(2)) + 0.5) * dx[2] + x_lower[2] };
-#endif
-        // Find a local patch that contains the IB point in either its patch
-        // interior or ghost cell region.
-        bool found_local_patch = false;
-        for (int growth_size = 0; growth_size <= 1; ++growth_size)
-        {
-            Box<NDIM> box(X_idx, X_idx);
-            box.grow(IntVector<NDIM>(growth_size));
-            Array<int> patch_num_arr;
-            patch_level->getBoxTree()->findOverlapIndices(patch_num_arr, box);
-            for (int j = 0; j < patch_num_arr.size() && !found_local_patch; ++j)
-            {
-                const int n = patch_num_arr[j];
-                if (proc_mapping.isMappingLocal(n))
-                {
-                    patch_num[k] = n;
-                    found_local_patch = true;
-                }
-            }
-        }
+        Index<NDIM> X_idx;
+        compute_sc_interp_stencil_boxes(
+            X_idx, &stencil_box[k][0], X, interp_stencil, grid_geom, ratio, dx, domain_lower);
+        patch_num[k] = find_local_patch_num(X_idx, patch_level);
 #if !defined(NDEBUG)
-        TBOX_ASSERT(found_local_patch);
+        TBOX_ASSERT(patch_num[k] >= 0);
 #endif
         Pointer<Patch<NDIM> > patch = patch_level->getPatch(patch_num[k]);
         Pointer<SideData<NDIM, int> > dof_index_data = patch->getPatchData(dof_index_idx);
@@ -892,38 +995,10 @@ PETScMatUtilities::constructPatchLevelSCInterpOp(Mat& mat,
         TBOX_ASSERT(dof_index_data->getDepth() == 1);
 #endif
 
-        // Compute the stencil box and setup the nonzero structure.
+        // Setup the nonzero structure.
         for (int axis = 0; axis < NDIM; ++axis)
         {
-            // Determine the stencil box.
-            if (interp_stencil % 2 != 0)
-            {
-                TBOX_ERROR(
-                    "PETScMatUtilities::constructPatchLevelSCInterpOp(): support for odd "
-                    "stencil "
-                    "sizes not currently implemented\n");
-            }
-            Box<NDIM>& stencil_box_axis = stencil_box[k][axis];
-            Index<NDIM>& stencil_box_lower = stencil_box_axis.lower();
-            Index<NDIM>& stencil_box_upper = stencil_box_axis.upper();
-            for (int d = 0; d < NDIM; ++d)
-            {
-                if (d == axis)
-                {
-                    stencil_box_lower(d) = X_idx(d) - interp_stencil / 2 + 1;
-                    stencil_box_upper(d) = X_idx(d) + interp_stencil / 2;
-                }
-                else if (X[d] <= X_cell[d])
-                {
-                    stencil_box_lower(d) = X_idx(d) - interp_stencil / 2;
-                    stencil_box_upper(d) = X_idx(d) + interp_stencil / 2 - 1;
-                }
-                else
-                {
-                    stencil_box_lower(d) = X_idx(d) - interp_stencil / 2 + 1;
-                    stencil_box_upper(d) = X_idx(d) + interp_stencil / 2;
-                }
-            }
+            const Box<NDIM>& stencil_box_axis = stencil_box[k][axis];
             const int local_idx = NDIM * k + axis;
 #if !defined(NDEBUG)
             TBOX_ASSERT(SideGeometry<NDIM>::toSideBox(dof_index_data->getGhostBox(), axis).contains(stencil_box_axis));
@@ -959,59 +1034,143 @@ PETScMatUtilities::constructPatchLevelSCInterpOp(Mat& mat,
     IBTK_CHKERRQ(ierr);
 
     // Set the matrix coefficients.
-    for (int k = 0; k < m_local / NDIM; ++k)
+    for (int k = 0; k < n_local_points; ++k)
     {
-        const double* const X = &X_arr[NDIM * k];
-
         // Look-up the local patch that we have associated with this IB point.
         Pointer<Patch<NDIM> > patch = patch_level->getPatch(patch_num[k]);
         Pointer<SideData<NDIM, int> > dof_index_data = patch->getPatchData(dof_index_idx);
+
+        // Construct the interpolation weights for this IB point.
+        set_sc_interp_op_values(mat,
+                                i_lower + NDIM * k,
+                                &X_arr[NDIM * k],
+                                &stencil_box[k][0],
+                                interp_fcn,
+                                interp_stencil,
+                                *dof_index_data,
+                                x_lower,
+                                dx,
+                                domain_lower);
+    }
+    ierr = VecRestoreArray(X_vec, &X_arr);
+    IBTK_CHKERRQ(ierr);
+
+    // Assemble the matrix.
+    ierr = MatAssemblyBegin(mat, MAT_FINAL_ASSEMBLY);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatAssemblyEnd(mat, MAT_FINAL_ASSEMBLY);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // constructPatchLevelSCInterpOp
+
+bool
+PETScMatUtilities::updatePatchLevelSCInterpOp(Mat& mat,
+                                              void (*interp_fcn)(double r_lower, double* w),
+                                              int interp_stencil,
+                                              Vec& X_vec,
+                                              std::vector<double>& X_prev,
+                                              const int dof_index_idx,
+                                              Pointer<PatchLevel<NDIM> > patch_level)
+{
+    // \todo Properly support odd stencil sizes.
+    if (interp_stencil % 2 != 0) interp_stencil += 1;
+
+    // Determine the grid extents.
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = patch_level->getGridGeometry();
+    const double* const x_lower = grid_geom->getXLower();
+    const double* const dx0 = grid_geom->getDx();
+    const IntVector<NDIM>& ratio = patch_level->getRatio();
+    double dx[NDIM];
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        dx[d] = dx0[d] / static_cast<double>(ratio(d));
+    }
+    const BoxArray<NDIM>& domain_boxes = patch_level->getPhysicalDomain();
 #if !defined(NDEBUG)
-        TBOX_ASSERT(dof_index_data->getDepth() == 1);
+    TBOX_ASSERT(domain_boxes.size() == 1);
 #endif
+    const Index<NDIM>& domain_lower = domain_boxes[0].lower();
 
-        // Construct the interpolation weights for this IB point.
-        std::vector<double> w[NDIM];
-        for (int d = 0; d < NDIM; ++d) w[d].resize(interp_stencil);
-        int stencil_box_nvals = 1;
-        for (unsigned int d = 0; d < NDIM; ++d) stencil_box_nvals *= interp_stencil;
-        std::vector<double> stencil_box_vals(stencil_box_nvals);
-        std::vector<int> stencil_box_cols(stencil_box_nvals);
+    // The existing row layout must match the current distribution of the IB
+    // points.
+    int ierr;
+    int m_local;
+    ierr = VecGetLocalSize(X_vec, &m_local);
+    IBTK_CHKERRQ(ierr);
+    int i_lower, i_upper;
+    ierr = VecGetOwnershipRange(X_vec, &i_lower, &i_upper);
+    IBTK_CHKERRQ(ierr);
+    bool needs_rebuild = !mat || static_cast<int>(X_prev.size()) != m_local;
+    if (mat)
+    {
+        int row_lower, row_upper;
+        ierr = MatGetOwnershipRange(mat, &row_lower, &row_upper);
+        IBTK_CHKERRQ(ierr);
+        needs_rebuild = needs_rebuild || row_lower != i_lower || row_upper != i_upper;
+    }
+
+    // Determine which IB points have moved since the matrix was last
+    // assembled, and check whether any of those points now require a
+    // different stencil.  The nonzero structure is unchanged so long as every
+    // stencil box is unchanged.
+    const int n_local_points = m_local / NDIM;
+    double* X_arr;
+    ierr = VecGetArray(X_vec, &X_arr);
+    IBTK_CHKERRQ(ierr);
+    std::vector<int> moved_points;
+    std::vector<Index<NDIM> > moved_X_idx;
+    std::vector<Box<NDIM> > moved_stencil_box;
+    for (int k = 0; k < n_local_points && !needs_rebuild; ++k)
+    {
+        const double* const X = &X_arr[NDIM * k];
+        const double* const X_old = &X_prev[NDIM * k];
+        if (std::equal(X, X + NDIM, X_old)) continue;
+        Index<NDIM> X_idx, X_old_idx;
+        Box<NDIM> stencil_box[NDIM], stencil_box_old[NDIM];
+        compute_sc_interp_stencil_boxes(X_idx, stencil_box, X, interp_stencil, grid_geom, ratio, dx, domain_lower);
+        compute_sc_interp_stencil_boxes(
+            X_old_idx, stencil_box_old, X_old, interp_stencil, grid_geom, ratio, dx, domain_lower);
         for (int axis = 0; axis < NDIM; ++axis)
         {
-            // Look-up the stencil box.
-            const Box<NDIM>& stencil_box_axis = stencil_box[k][axis];
-            const Index<NDIM>& stencil_box_lower = stencil_box_axis.lower();
-
-            // Compute the weights of the 1-dimensional delta functions.
-            for (int d = 0; d < NDIM; ++d)
-            {
-                const int i = stencil_box_lower(d);
-                const double X_stencil_lower =
-                    (static_cast<double>(i - domain_lower(d)) + (d == axis ? 0.0 : 0.5)) * dx[d] + x_lower[d];
-                interp_fcn((X[d] - X_stencil_lower) / dx[d], &w[d][0]);
-            }
+            needs_rebuild = needs_rebuild || stencil_box[axis] != stencil_box_old[axis];
+        }
+        moved_points.push_back(k);
+        moved_X_idx.push_back(X_idx);
+        moved_stencil_box.insert(moved_stencil_box.end(), stencil_box, stencil_box + NDIM);
+    }
 
-            // Compute the weights of the d-dimensional delta function as the
-            // tensor products of the 1-dimensional delta functions.
-            int stencil_box_row = i_lower + NDIM * k + axis;
-            int stencil_idx = 0;
-            std::fill(stencil_box_vals.begin(), stencil_box_vals.end(), 1.0);
-            for (Box<NDIM>::Iterator b(stencil_box_axis); b; b++, ++stencil_idx)
-            {
-                const SideIndex<NDIM> i(b(), axis, SideIndex<NDIM>::Lower);
-                for (int d = 0; d < NDIM; ++d)
-                {
-                    stencil_box_vals[stencil_idx] *= w[d][i(d) - stencil_box_lower(d)];
-                }
-                stencil_box_cols[stencil_idx] = (*dof_index_data)(i);
-            }
+    // The matrix must be rebuilt (collectively) if the nonzero structure has
+    // changed on any process.
+    if (SAMRAI_MPI::maxReduction(needs_rebuild ? 1 : 0) == 1)
+    {
+        ierr = VecRestoreArray(X_vec, &X_arr);
+        IBTK_CHKERRQ(ierr);
+        return false;
+    }
 
-            // Set the values for this IB point.
-            ierr = MatSetValues(
-                mat, 1, &stencil_box_row, stencil_box_nvals, &stencil_box_cols[0], &stencil_box_vals[0], INSERT_VALUES);
-            IBTK_CHKERRQ(ierr);
-        }
+    // Reset the matrix coefficients for the IB points that have moved.
+    ierr = MatSetOption(mat, MAT_NEW_NONZERO_LOCATION_ERR, PETSC_TRUE);
+    IBTK_CHKERRQ(ierr);
+    for (unsigned int j = 0; j < moved_points.size(); ++j)
+    {
+        const int k = moved_points[j];
+        const int patch_num = find_local_patch_num(moved_X_idx[j], patch_level);
+#if !defined(NDEBUG)
+        TBOX_ASSERT(patch_num >= 0);
+#endif
+        Pointer<Patch<NDIM> > patch = patch_level->getPatch(patch_num);
+        Pointer<SideData<NDIM, int> > dof_index_data = patch->getPatchData(dof_index_idx);
+        set_sc_interp_op_values(mat,
+                                i_lower + NDIM * k,
+                                &X_arr[NDIM * k],
+                                &moved_stencil_box[NDIM * j],
+                                interp_fcn,
+                                interp_stencil,
+                                *dof_index_data,
+                                x_lower,
+                                dx,
+                                domain_lower);
+        std::copy(&X_arr[NDIM * k], &X_arr[NDIM * k] + NDIM, &X_prev[NDIM * k]);
     }
     ierr = VecRestoreArray(X_vec, &X_arr);
     IBTK_CHKERRQ(ierr);
@@ -1021,8 +1180,8 @@ PETScMatUtilities::constructPatchLevelSCInterpOp(Mat& mat,
     IBTK_CHKERRQ(ierr);
     ierr = MatAssemblyEnd(mat, MAT_FINAL_ASSEMBLY);
     IBTK_CHKERRQ(ierr);
-    return;
-} // constructPatchLevelSCInterpOp
+    return true;
+} // updatePatchLevelSCInterpOp
 
 void
 PETScMatUtilities::constructProlongationOp(Mat& mat,
@@ -83,7 +83,12 @@ static const int CELLG = 1;
 CCPoissonPETScLevelSolver::CCPoissonPETScLevelSolver(const std::string& object_name,
                                                      Pointer<Database> input_db,
                                                      const std::string& default_options_prefix)
-    : d_context(NULL), d_dof_index_idx(-1), d_dof_index_var(NULL), d_data_synch_sched(NULL), d_ghost_fill_sched(NULL)
+    : d_context(NULL),
+      d_dof_index_idx(-1),
+      d_dof_index_var(NULL),
+      d_b_adj_idx(-1),
+      d_data_synch_sched(NULL),
+      d_ghost_fill_sched(NULL)
 {
     // Configure solver.
     GeneralSolver::init(object_name, /*homogeneous_bc*/ false);
@@ -130,7 +135,7 @@ CCPoissonPETScLevelSolver::generateASMSubdomains(std::vector<std::set<int> >& /*
 
 void
 CCPoissonPETScLevelSolver::initializeSolverStateSpecialized(const SAMRAIVectorReal<NDIM, double>& x,
-                                                            const SAMRAIVectorReal<NDIM, double>& /*b*/)
+                                                            const SAMRAIVectorReal<NDIM, double>& b)
 {
     // Allocate DOF index data.
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
@@ -154,6 +159,15 @@ CCPoissonPETScLevelSolver::initializeSolverStateSpecialized(const SAMRAIVectorRe
         d_petsc_mat, d_poisson_spec, d_bc_coefs, d_solution_time, d_num_dofs_per_proc, d_dof_index_idx, d_level);
     d_petsc_pc = d_petsc_mat;
 
+    // Allocate scratch data used to modify the right-hand side at physical and
+    // coarse-fine interface boundaries.  This data is kept for the lifetime of
+    // the solver state so that repeated solves (e.g., when the solver is used
+    // as a coarse level solver in a FAC preconditioner) do not need to
+    // reallocate it.
+    const int b_idx = b.getComponentDescriptorIndex(0);
+    d_b_adj_idx = var_db->registerClonedPatchDataIndex(b.getComponentVariable(0), b_idx);
+    d_level->allocatePatchData(d_b_adj_idx);
+
     // Setup SAMRAI communication objects.
     d_data_synch_sched = PETScVecUtilities::constructDataSynchSchedule(x_idx, d_level);
     d_ghost_fill_sched = PETScVecUtilities::constructGhostFillSchedule(x_idx, d_level);
@@ -165,6 +179,14 @@ CCPoissonPETScLevelSolver::deallocateSolverStateSpecialized()
 {
     // Deallocate DOF index data.
     if (d_level->checkAllocated(d_dof_index_idx)) d_level->deallocatePatchData(d_dof_index_idx);
+
+    // Deallocate scratch data.
+    if (d_b_adj_idx != -1)
+    {
+        if (d_level->checkAllocated(d_b_adj_idx)) d_level->deallocatePatchData(d_b_adj_idx);
+        VariableDatabase<NDIM>::getDatabase()->removePatchDataIndex(d_b_adj_idx);
+        d_b_adj_idx = -1;
+    }
     return;
 } // deallocateSolverStateSpecialized
 
@@ -195,10 +217,7 @@ CCPoissonPETScLevelSolver::setupKSPVecs(Vec& petsc_x,
     const bool level_zero = (d_level_num == 0);
     const int x_idx = x.getComponentDescriptorIndex(0);
     const int b_idx = b.getComponentDescriptorIndex(0);
-    Pointer<CellVariable<NDIM, double> > b_var = b.getComponentVariable(0);
-    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
-    int b_adj_idx = var_db->registerClonedPatchDataIndex(b_var, b_idx);
-    d_level->allocatePatchData(b_adj_idx);
+    const int b_adj_idx = d_b_adj_idx;
     for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
     {
         Pointer<Patch<NDIM> > patch = d_level->getPatch(p());
@@ -224,8 +243,6 @@ CCPoissonPETScLevelSolver::setupKSPVecs(Vec& petsc_x,
         }
     }
     PETScVecUtilities::copyToPatchLevelVec(petsc_b, b_adj_idx, d_dof_index_idx, d_level);
-    d_level->deallocatePatchData(b_adj_idx);
-    var_db->removePatchDataIndex(b_adj_idx);
     return;
 } // setupKSPVecs
 
@@ -43,6 +43,7 @@
 
 #include "ArrayData.h"
 #include "Box.h"
+#include "BoxArray.h"
 #include "BoxList.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
@@ -57,16 +58,21 @@
 #include "IntVector.h"
 #include "MultiblockDataTranslator.h"
 #include "Patch.h"
+#include "PatchDataFactory.h"
 #include "PatchDescriptor.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
 #include "PoissonSpecifications.h"
 #include "ProcessorMapping.h"
+#include "RefineAlgorithm.h"
+#include "RefineOperator.h"
+#include "RefineSchedule.h"
 #include "SAMRAIVectorReal.h"
 #include "SideData.h"
 #include "SideIndex.h"
 #include "Variable.h"
 #include "VariableDatabase.h"
+#include "VariableContext.h"
 #include "VariableFillPattern.h"
 #include "boost/array.hpp"
 #include "ibtk/CCPoissonPointRelaxationFACOperator.h"
@@ -103,12 +109,18 @@
 #define RB_GS_SMOOTH_FC IBTK_FC_FUNC(rbgssmooth2d, RBGSSMOOTH2D)
 #define VC_CELL_GS_SMOOTH_FC IBTK_FC_FUNC(vccellgssmooth2d, VCCELLGSSMOOTH2D)
 #define VC_CELL_RB_GS_SMOOTH_FC IBTK_FC_FUNC(vccellrbgssmooth2d, VCCELLRBGSSMOOTH2D)
+#define CHEBY_SMOOTH_FC IBTK_FC_FUNC(chebysmooth2d, CHEBYSMOOTH2D)
+#define VC_CELL_CHEBY_SMOOTH_FC IBTK_FC_FUNC(vccellchebysmooth2d, VCCELLCHEBYSMOOTH2D)
+#define CHEBY_UPDATE_FC IBTK_FC_FUNC(chebyupdate2d, CHEBYUPDATE2D)
 #endif
 #if (NDIM == 3)
 #define GS_SMOOTH_FC IBTK_FC_FUNC(gssmooth3d, GSSMOOTH3D)
 #define RB_GS_SMOOTH_FC IBTK_FC_FUNC(rbgssmooth3d, RBGSSMOOTH3D)
 #define VC_CELL_GS_SMOOTH_FC IBTK_FC_FUNC(vccellgssmooth3d, VCCELLGSSMOOTH3D)
 #define VC_CELL_RB_GS_SMOOTH_FC IBTK_FC_FUNC(vccellrbgssmooth3d, VCCELLRBGSSMOOTH3D)
+#define CHEBY_SMOOTH_FC IBTK_FC_FUNC(chebysmooth3d, CHEBYSMOOTH3D)
+#define VC_CELL_CHEBY_SMOOTH_FC IBTK_FC_FUNC(vccellchebysmooth3d, VCCELLCHEBYSMOOTH3D)
+#define CHEBY_UPDATE_FC IBTK_FC_FUNC(chebyupdate3d, CHEBYUPDATE3D)
 #endif
 
 // Function interfaces
@@ -188,6 +200,90 @@ void VC_CELL_RB_GS_SMOOTH_FC(double* U,
 #endif
                              const double* dx,
                              const int& red_or_black);
+
+void CHEBY_SMOOTH_FC(const double* U,
+                     const int& U_gcw,
+                     double* D,
+                     const int& D_gcw,
+                     const double& alpha,
+                     const double& beta,
+                     const double* F,
+                     const int& F_gcw,
+                     const int& ilower0,
+                     const int& iupper0,
+                     const int& ilower1,
+                     const int& iupper1,
+#if (NDIM == 3)
+                     const int& ilower2,
+                     const int& iupper2,
+#endif
+                     const int& blower0,
+                     const int& bupper0,
+                     const int& blower1,
+                     const int& bupper1,
+#if (NDIM == 3)
+                     const int& blower2,
+                     const int& bupper2,
+#endif
+                     const double* dx,
+                     const double& omega_d,
+                     const double& omega_r);
+
+void VC_CELL_CHEBY_SMOOTH_FC(const double* U,
+                             const int& U_gcw,
+                             double* D,
+                             const int& D_gcw,
+                             const double* alpha0,
+                             const double* alpha1,
+#if (NDIM == 3)
+                             const double* alpha2,
+#endif
+                             const int& alpha_gcw,
+                             const double& beta,
+                             const double* F,
+                             const int& F_gcw,
+                             const int& ilower0,
+                             const int& iupper0,
+                             const int& ilower1,
+                             const int& iupper1,
+#if (NDIM == 3)
+                             const int& ilower2,
+                             const int& iupper2,
+#endif
+                             const int& blower0,
+                             const int& bupper0,
+                             const int& blower1,
+                             const int& bupper1,
+#if (NDIM == 3)
+                             const int& blower2,
+                             const int& bupper2,
+#endif
+                             const double* dx,
+                             const double& omega_d,
+                             const double& omega_r);
+
+void CHEBY_UPDATE_FC(double* U,
+                     const int& U_gcw,
+                     const double* D,
+                     const int& D_gcw,
+                     const int& ilower0,
+                     const int& iupper0,
+                     const int& ilower1,
+                     const int& iupper1,
+#if (NDIM == 3)
+                     const int& ilower2,
+                     const int& iupper2,
+#endif
+                     const int& blower0,
+                     const int& bupper0,
+                     const int& blower1,
+                     const int& bupper1
+#if (NDIM == 3)
+                     ,
+                     const int& blower2,
+                     const int& bupper2
+#endif
+                     );
 }
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -245,6 +341,7 @@ enum SmootherType
     PATCH_GAUSS_SEIDEL,
     PROCESSOR_GAUSS_SEIDEL,
     RED_BLACK_GAUSS_SEIDEL,
+    CHEBYSHEV,
     UNKNOWN = -1
 };
 
@@ -253,8 +350,9 @@ get_smoother_type(const std::string& smoother_type_string)
 {
     if (smoother_type_string == "PATCH_GAUSS_SEIDEL") return PATCH_GAUSS_SEIDEL;
     if (smoother_type_string == "PROCESSOR_GAUSS_SEIDEL") return PROCESSOR_GAUSS_SEIDEL;
-    if (smoother_type_string == "RED_BLACK_GAUSS_SEIDEL")
-        return RED_BLACK_GAUSS_SEIDEL;
+    if (smoother_type_string == "RED_BLACK_GAUSS_SEIDEL") return RED_BLACK_GAUSS_SEIDEL;
+    if (smoother_type_string == "CHEBYSHEV")
+        return CHEBYSHEV;
     else
         return UNKNOWN;
 } // get_smoother_type
@@ -284,6 +382,41 @@ do_local_data_update(SmootherType smoother_type)
         return false;
     }
 } // do_local_data_update
+
+// Data required to perform a Chebyshev sweep on a single box of a single patch.
+struct ChebyshevBoxData
+{
+    double* U;
+    int U_ghosts;
+    double* D;
+    int D_ghosts;
+    const double* F;
+    int F_ghosts;
+    const double* alpha[NDIM];
+    int alpha_ghosts;
+    Box<NDIM> patch_box, update_box;
+    const double* dx;
+};
+
+inline int
+register_chebyshev_variable(const std::string& var_name,
+                            const Pointer<VariableContext>& context,
+                            const IntVector<NDIM>& ghosts)
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<Variable<NDIM> > var;
+    if (var_db->checkVariableExists(var_name))
+    {
+        var = var_db->getVariable(var_name);
+        const int idx = var_db->mapVariableAndContextToIndex(var, context);
+        if (idx >= 0) var_db->removePatchDataIndex(idx);
+    }
+    else
+    {
+        var = new CellVariable<NDIM, double>(var_name, DEFAULT_DATA_DEPTH);
+    }
+    return var_db->registerVariableAndContext(var, context, ghosts);
+} // register_chebyshev_variable
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -300,7 +433,18 @@ CCPoissonPointRelaxationFACOperator::CCPoissonPointRelaxationFACOperator(const s
       d_coarse_solver(NULL),
       d_coarse_solver_db(),
       d_patch_bc_box_overlap(),
-      d_patch_neighbor_overlap()
+      d_patch_neighbor_overlap(),
+      d_chebyshev_eig_lower_bound(1.0 / static_cast<double>(NDIM)),
+      d_chebyshev_eig_upper_bound(2.0),
+      d_chebyshev_sweeps_per_ghost_fill(1),
+      d_chebyshev_sol_idx(-1),
+      d_chebyshev_rhs_idx(-1),
+      d_chebyshev_dir_idx(-1),
+      d_patch_chebyshev_update_boxes(),
+      d_chebyshev_init_refine_algorithm(),
+      d_chebyshev_update_refine_algorithm(),
+      d_chebyshev_init_refine_schedules(),
+      d_chebyshev_update_refine_schedules()
 {
     // Set some default values.
     d_smoother_type = "PATCH_GAUSS_SEIDEL";
@@ -335,6 +479,12 @@ CCPoissonPointRelaxationFACOperator::CCPoissonPointRelaxationFACOperator(const s
         {
             d_coarse_solver_db = input_db->getDatabase("coarse_solver_db");
         }
+        if (input_db->keyExists("chebyshev_eig_lower_bound"))
+            d_chebyshev_eig_lower_bound = input_db->getDouble("chebyshev_eig_lower_bound");
+        if (input_db->keyExists("chebyshev_eig_upper_bound"))
+            d_chebyshev_eig_upper_bound = input_db->getDouble("chebyshev_eig_upper_bound");
+        if (input_db->keyExists("chebyshev_sweeps_per_ghost_fill"))
+            d_chebyshev_sweeps_per_ghost_fill = input_db->getInteger("chebyshev_sweeps_per_ghost_fill");
         if (input_db->isDatabase("bottom_solver"))
         {
             tbox::pout << "WARNING: ``bottom_solver'' input entry is no longer used by class "
@@ -355,6 +505,31 @@ CCPoissonPointRelaxationFACOperator::CCPoissonPointRelaxationFACOperator(const s
         }
     }
 
+    if (d_chebyshev_eig_lower_bound <= 0.0 || d_chebyshev_eig_upper_bound <= d_chebyshev_eig_lower_bound)
+    {
+        TBOX_ERROR(d_object_name << "::CCPoissonPointRelaxationFACOperator():\n"
+                                 << "  invalid Chebyshev eigenvalue bounds: ["
+                                 << d_chebyshev_eig_lower_bound
+                                 << ", "
+                                 << d_chebyshev_eig_upper_bound
+                                 << "]"
+                                 << std::endl);
+    }
+    if (d_chebyshev_sweeps_per_ghost_fill < 1)
+    {
+        TBOX_ERROR(d_object_name << "::CCPoissonPointRelaxationFACOperator():\n"
+                                 << "  chebyshev_sweeps_per_ghost_fill must be positive"
+                                 << std::endl);
+    }
+
+    // Setup scratch variables for the Chebyshev smoother.  These variables
+    // hold one layer of ghost cells for each sweep performed between ghost
+    // cell exchanges.
+    const IntVector<NDIM> chebyshev_ghosts = d_chebyshev_sweeps_per_ghost_fill;
+    d_chebyshev_sol_idx = register_chebyshev_variable(d_object_name + "::chebyshev_sol", d_context, chebyshev_ghosts);
+    d_chebyshev_rhs_idx = register_chebyshev_variable(d_object_name + "::chebyshev_rhs", d_context, chebyshev_ghosts);
+    d_chebyshev_dir_idx = register_chebyshev_variable(d_object_name + "::chebyshev_dir", d_context, chebyshev_ghosts);
+
     // Configure the coarse level solver.
     setCoarseSolverType(d_coarse_solver_type);
 
@@ -380,6 +555,13 @@ CCPoissonPointRelaxationFACOperator::setSmootherType(const std::string& smoother
 #if !defined(NDEBUG)
     TBOX_ASSERT(get_smoother_type(smoother_type) != UNKNOWN);
 #endif
+    if (d_is_initialized && get_smoother_type(smoother_type) == CHEBYSHEV &&
+        get_smoother_type(d_smoother_type) != CHEBYSHEV && get_smoother_type(d_coarse_solver_type) != CHEBYSHEV)
+    {
+        TBOX_ERROR(d_object_name << "::setSmootherType():\n"
+                                 << "  cannot switch to the CHEBYSHEV smoother while operator state is initialized"
+                                 << std::endl);
+    }
     d_smoother_type = smoother_type;
     return;
 } // setSmootherType
@@ -427,6 +609,12 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
 #if !defined(NDEBUG)
     TBOX_ASSERT(smoother_type != UNKNOWN);
 #endif
+    if (smoother_type == CHEBYSHEV)
+    {
+        smoothErrorChebyshev(error, residual, level_num, num_sweeps);
+        IBTK_TIMER_STOP(t_smooth_error);
+        return;
+    }
     const bool red_black_ordering = use_red_black_ordering(smoother_type);
     const bool update_local_data = do_local_data_update(smoother_type);
 
@@ -879,19 +1067,122 @@ CCPoissonPointRelaxationFACOperator::initializeOperatorStateSpecialized(const SA
             }
         }
     }
+
+    // Setup data for the Chebyshev smoother.
+    if (get_smoother_type(d_smoother_type) == CHEBYSHEV || get_smoother_type(d_coarse_solver_type) == CHEBYSHEV)
+    {
+        const int chebyshev_idxs[3] = { d_chebyshev_sol_idx, d_chebyshev_rhs_idx, d_chebyshev_dir_idx };
+        for (int k = 0; k < 3; ++k)
+        {
+            Pointer<CellDataFactory<NDIM, double> > chebyshev_pdat_fac =
+                var_db->getPatchDescriptor()->getPatchDataFactory(chebyshev_idxs[k]);
+            chebyshev_pdat_fac->setDefaultDepth(solution_pdat_fac->getDefaultDepth());
+        }
+
+        // The error and right-hand side are exchanged before the first sweep;
+        // the error and search direction are exchanged between subsequent
+        // batches of sweeps.
+        d_chebyshev_init_refine_algorithm = new RefineAlgorithm<NDIM>();
+        d_chebyshev_init_refine_algorithm->registerRefine(
+            d_chebyshev_sol_idx, d_chebyshev_sol_idx, d_chebyshev_sol_idx, Pointer<RefineOperator<NDIM> >());
+        d_chebyshev_init_refine_algorithm->registerRefine(
+            d_chebyshev_rhs_idx, d_chebyshev_rhs_idx, d_chebyshev_rhs_idx, Pointer<RefineOperator<NDIM> >());
+        d_chebyshev_update_refine_algorithm = new RefineAlgorithm<NDIM>();
+        d_chebyshev_update_refine_algorithm->registerRefine(
+            d_chebyshev_sol_idx, d_chebyshev_sol_idx, d_chebyshev_sol_idx, Pointer<RefineOperator<NDIM> >());
+        d_chebyshev_update_refine_algorithm->registerRefine(
+            d_chebyshev_dir_idx, d_chebyshev_dir_idx, d_chebyshev_dir_idx, Pointer<RefineOperator<NDIM> >());
+
+        d_chebyshev_init_refine_schedules.resize(d_finest_ln + 1);
+        d_chebyshev_update_refine_schedules.resize(d_finest_ln + 1);
+        d_patch_chebyshev_update_boxes.resize(d_finest_ln + 1);
+        const int s = d_chebyshev_sweeps_per_ghost_fill;
+        for (int ln = coarsest_reset_ln; ln <= finest_reset_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            if (!level->checkAllocated(d_chebyshev_sol_idx)) level->allocatePatchData(d_chebyshev_sol_idx);
+            if (!level->checkAllocated(d_chebyshev_rhs_idx)) level->allocatePatchData(d_chebyshev_rhs_idx);
+            if (!level->checkAllocated(d_chebyshev_dir_idx)) level->allocatePatchData(d_chebyshev_dir_idx);
+            d_chebyshev_init_refine_schedules[ln] = d_chebyshev_init_refine_algorithm->createSchedule(level);
+            d_chebyshev_update_refine_schedules[ln] = d_chebyshev_update_refine_algorithm->createSchedule(level);
+
+            // Determine the cells within s-1 cells of each patch that are
+            // covered by the level, including periodic images.  These cells
+            // are updated redundantly between ghost cell exchanges.
+            BoxList<NDIM> level_boxes;
+            if (s > 1)
+            {
+                const BoxArray<NDIM>& boxes = level->getBoxes();
+                const IntVector<NDIM> periodic_shift = geometry->getPeriodicShift(level->getRatio());
+                IntVector<NDIM> lower_shift, upper_shift;
+                for (int d = 0; d < NDIM; ++d)
+                {
+                    lower_shift(d) = periodic_shift(d) != 0 ? -1 : 0;
+                    upper_shift(d) = periodic_shift(d) != 0 ? +1 : 0;
+                }
+                const Box<NDIM> shift_box(lower_shift, upper_shift);
+                for (Box<NDIM>::Iterator b(shift_box); b; b++)
+                {
+                    IntVector<NDIM> offset;
+                    for (int d = 0; d < NDIM; ++d) offset(d) = b()(d) * periodic_shift(d);
+                    for (int i = 0; i < boxes.getNumberOfBoxes(); ++i)
+                    {
+                        Box<NDIM> shifted_box = boxes[i];
+                        shifted_box.shift(offset);
+                        level_boxes.appendItem(shifted_box);
+                    }
+                }
+            }
+            const int num_local_patches = level->getProcessorMapping().getLocalIndices().getSize();
+            d_patch_chebyshev_update_boxes[ln].resize(num_local_patches);
+            int patch_counter = 0;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Box<NDIM>& patch_box = patch->getBox();
+                BoxList<NDIM>& update_boxes = d_patch_chebyshev_update_boxes[ln][patch_counter];
+                update_boxes.clearItems();
+                if (s == 1)
+                {
+                    update_boxes.appendItem(patch_box);
+                    continue;
+                }
+                const Box<NDIM> grown_box = Box<NDIM>::grow(patch_box, IntVector<NDIM>(s - 1));
+                for (BoxList<NDIM>::Iterator b(level_boxes); b; b++)
+                {
+                    const Box<NDIM> overlap = grown_box * b();
+                    if (!overlap.empty()) update_boxes.appendItem(overlap);
+                }
+            }
+        }
+    }
     return;
 } // initializeOperatorStateSpecialized
 
 void
-CCPoissonPointRelaxationFACOperator::deallocateOperatorStateSpecialized(const int /*coarsest_reset_ln*/,
-                                                                        const int /*finest_reset_ln*/)
+CCPoissonPointRelaxationFACOperator::deallocateOperatorStateSpecialized(const int coarsest_reset_ln,
+                                                                        const int finest_reset_ln)
 {
     if (!d_is_initialized) return;
 
+    // Deallocate Chebyshev smoother data.
+    for (int ln = coarsest_reset_ln; ln <= std::min(d_finest_ln, finest_reset_ln); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (level->checkAllocated(d_chebyshev_sol_idx)) level->deallocatePatchData(d_chebyshev_sol_idx);
+        if (level->checkAllocated(d_chebyshev_rhs_idx)) level->deallocatePatchData(d_chebyshev_rhs_idx);
+        if (level->checkAllocated(d_chebyshev_dir_idx)) level->deallocatePatchData(d_chebyshev_dir_idx);
+    }
+
     if (!d_in_initialize_operator_state)
     {
         d_patch_bc_box_overlap.clear();
         d_patch_neighbor_overlap.clear();
+        d_patch_chebyshev_update_boxes.clear();
+        d_chebyshev_init_refine_algorithm.setNull();
+        d_chebyshev_update_refine_algorithm.setNull();
+        d_chebyshev_init_refine_schedules.clear();
+        d_chebyshev_update_refine_schedules.clear();
         if (d_coarse_solver) d_coarse_solver->deallocateSolverState();
     }
     return;
@@ -899,6 +1190,287 @@ CCPoissonPointRelaxationFACOperator::deallocateOperatorStateSpecialized(const in
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+CCPoissonPointRelaxationFACOperator::smoothErrorChebyshev(SAMRAIVectorReal<NDIM, double>& error,
+                                                          const SAMRAIVectorReal<NDIM, double>& residual,
+                                                          const int level_num,
+                                                          const int num_sweeps)
+{
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
+    const int scratch_idx = d_scratch_idx;
+    const int sol_idx = d_chebyshev_sol_idx;
+    const int rhs_idx = d_chebyshev_rhs_idx;
+    const int dir_idx = d_chebyshev_dir_idx;
+
+    // Redundant updates within the ghost cell region require the variable
+    // diffusion coefficient in that region, but the ghost values of the
+    // coefficient are not filled by the solver.  With a variable coefficient,
+    // only the patch interiors are updated, and ghost cell values are exchanged
+    // after every sweep.
+    const bool D_is_constant = d_poisson_spec.dIsConstant();
+    const double& alpha = D_is_constant ? d_poisson_spec.getDConstant() : 0.0;
+    const double& beta = d_poisson_spec.cIsZero() ? 0.0 : d_poisson_spec.getCConstant();
+    const int sweeps_per_ghost_fill = D_is_constant ? d_chebyshev_sweeps_per_ghost_fill : 1;
+
+    // Copy the error and residual into the Chebyshev scratch data, and cache
+    // coarse-fine interface ghost cell values in the "scratch" data.
+    int patch_counter = 0;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+        Pointer<CellData<NDIM, double> > residual_data = residual.getComponentPatchData(0, *patch);
+        Pointer<CellData<NDIM, double> > sol_data = patch->getPatchData(sol_idx);
+        Pointer<CellData<NDIM, double> > rhs_data = patch->getPatchData(rhs_idx);
+        Pointer<CellData<NDIM, double> > dir_data = patch->getPatchData(dir_idx);
+#if !defined(NDEBUG)
+        TBOX_ASSERT(error_data->getDepth() == sol_data->getDepth());
+        TBOX_ASSERT(residual_data->getDepth() == rhs_data->getDepth());
+#endif
+        sol_data->copy(*error_data);
+        rhs_data->copy(*residual_data);
+        dir_data->fillAll(0.0);
+        if (level_num > d_coarsest_ln)
+        {
+            Pointer<CellData<NDIM, double> > scratch_data = patch->getPatchData(scratch_idx);
+            scratch_data->getArrayData().copy(
+                error_data->getArrayData(), d_patch_bc_box_overlap[level_num][patch_counter], IntVector<NDIM>(0));
+        }
+    }
+    d_chebyshev_init_refine_schedules[level_num]->fillData(d_solution_time);
+
+    // Setup the Chebyshev recurrence.
+    const double theta = 0.5 * (d_chebyshev_eig_upper_bound + d_chebyshev_eig_lower_bound);
+    const double delta = 0.5 * (d_chebyshev_eig_upper_bound - d_chebyshev_eig_lower_bound);
+    const double sigma = theta / delta;
+    double rho = 1.0 / sigma;
+
+    std::vector<ChebyshevBoxData> box_data;
+    for (int isweep = 0; isweep < num_sweeps; ++isweep)
+    {
+        // Exchange ghost cell values once per batch of sweeps.
+        const int batch_sweep = isweep % sweeps_per_ghost_fill;
+        if (isweep > 0 && batch_sweep == 0)
+        {
+            d_chebyshev_update_refine_schedules[level_num]->fillData(d_solution_time);
+        }
+
+        // Reset the physical boundary and coarse-fine interface ghost cell
+        // values.  These operations only use data local to each patch.
+        d_bc_op->setPatchDataIndex(sol_idx);
+        d_bc_op->setPhysicalBcCoefs(d_bc_coefs);
+        d_bc_op->setHomogeneousBc(true);
+        d_cf_bdry_op->setPatchDataIndex(sol_idx);
+        patch_counter = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > sol_data = patch->getPatchData(sol_idx);
+            if (level_num > d_coarsest_ln)
+            {
+                Pointer<CellData<NDIM, double> > scratch_data = patch->getPatchData(scratch_idx);
+                sol_data->getArrayData().copy(scratch_data->getArrayData(),
+                                              d_patch_bc_box_overlap[level_num][patch_counter],
+                                              IntVector<NDIM>(0));
+            }
+            d_bc_op->setPhysicalBoundaryConditions(*patch, d_solution_time, sol_data->getGhostCellWidth());
+            if (level_num > d_coarsest_ln)
+            {
+                const IntVector<NDIM>& ratio = level->getRatioToCoarserLevel();
+                d_cf_bdry_op->computeNormalExtension(*patch, ratio, d_gcw);
+            }
+        }
+
+        // Compute the Chebyshev coefficients for this sweep.
+        double omega_d, omega_r;
+        if (isweep == 0)
+        {
+            omega_d = 0.0;
+            omega_r = 1.0 / theta;
+        }
+        else
+        {
+            const double rho_new = 1.0 / (2.0 * sigma - rho);
+            omega_d = rho_new * rho;
+            omega_r = 2.0 * rho_new / delta;
+            rho = rho_new;
+        }
+
+        // Only update the ghost cells whose values are needed by the remaining
+        // sweeps in the current batch.
+        const int update_width = std::min(sweeps_per_ghost_fill - 1 - batch_sweep, num_sweeps - 1 - isweep);
+
+        // Collect the data required to update each box.  Smart pointers are not
+        // thread safe, so this is done before the threaded update.
+        box_data.clear();
+        patch_counter = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > sol_data = patch->getPatchData(sol_idx);
+            Pointer<CellData<NDIM, double> > rhs_data = patch->getPatchData(rhs_idx);
+            Pointer<CellData<NDIM, double> > dir_data = patch->getPatchData(dir_idx);
+            Pointer<SideData<NDIM, double> > alpha_data = NULL;
+            if (!D_is_constant) alpha_data = patch->getPatchData(d_poisson_spec.getDPatchDataId());
+#if !defined(NDEBUG)
+            if (!D_is_constant) TBOX_ASSERT(alpha_data);
+#endif
+            const Box<NDIM>& patch_box = patch->getBox();
+            const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const Box<NDIM> grown_box = Box<NDIM>::grow(patch_box, IntVector<NDIM>(update_width));
+            const BoxList<NDIM>& update_boxes = d_patch_chebyshev_update_boxes[level_num][patch_counter];
+            for (int depth = 0; depth < sol_data->getDepth(); ++depth)
+            {
+                for (BoxList<NDIM>::Iterator b(update_boxes); b; b++)
+                {
+                    const Box<NDIM> update_box = grown_box * b();
+                    if (update_box.empty()) continue;
+                    ChebyshevBoxData data;
+                    data.U = sol_data->getPointer(depth);
+                    data.U_ghosts = (sol_data->getGhostCellWidth()).max();
+                    data.D = dir_data->getPointer(depth);
+                    data.D_ghosts = (dir_data->getGhostCellWidth()).max();
+                    data.F = rhs_data->getPointer(depth);
+                    data.F_ghosts = (rhs_data->getGhostCellWidth()).max();
+                    for (int d = 0; d < NDIM; ++d)
+                    {
+                        data.alpha[d] = D_is_constant ? NULL : alpha_data->getPointer(d, depth);
+                    }
+                    data.alpha_ghosts = D_is_constant ? 0 : (alpha_data->getGhostCellWidth()).max();
+                    data.patch_box = patch_box;
+                    data.update_box = update_box;
+                    data.dx = pgeom->getDx();
+                    box_data.push_back(data);
+                }
+            }
+        }
+
+        // Update the search direction on each box.  This pass only reads U, and
+        // the update boxes of a patch are disjoint, so the boxes of a patch may
+        // be processed concurrently without racing on the stencil values of U.
+        const int num_boxes = static_cast<int>(box_data.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for (int k = 0; k < num_boxes; ++k)
+        {
+            const ChebyshevBoxData& data = box_data[k];
+            const Box<NDIM>& patch_box = data.patch_box;
+            const Box<NDIM>& update_box = data.update_box;
+            if (D_is_constant)
+            {
+                CHEBY_SMOOTH_FC(data.U,
+                                data.U_ghosts,
+                                data.D,
+                                data.D_ghosts,
+                                alpha,
+                                beta,
+                                data.F,
+                                data.F_ghosts,
+                                patch_box.lower(0),
+                                patch_box.upper(0),
+                                patch_box.lower(1),
+                                patch_box.upper(1),
+#if (NDIM == 3)
+                                patch_box.lower(2),
+                                patch_box.upper(2),
+#endif
+                                update_box.lower(0),
+                                update_box.upper(0),
+                                update_box.lower(1),
+                                update_box.upper(1),
+#if (NDIM == 3)
+                                update_box.lower(2),
+                                update_box.upper(2),
+#endif
+                                data.dx,
+                                omega_d,
+                                omega_r);
+            }
+            else
+            {
+                VC_CELL_CHEBY_SMOOTH_FC(data.U,
+                                        data.U_ghosts,
+                                        data.D,
+                                        data.D_ghosts,
+                                        data.alpha[0],
+                                        data.alpha[1],
+#if (NDIM == 3)
+                                        data.alpha[2],
+#endif
+                                        data.alpha_ghosts,
+                                        beta,
+                                        data.F,
+                                        data.F_ghosts,
+                                        patch_box.lower(0),
+                                        patch_box.upper(0),
+                                        patch_box.lower(1),
+                                        patch_box.upper(1),
+#if (NDIM == 3)
+                                        patch_box.lower(2),
+                                        patch_box.upper(2),
+#endif
+                                        update_box.lower(0),
+                                        update_box.upper(0),
+                                        update_box.lower(1),
+                                        update_box.upper(1),
+#if (NDIM == 3)
+                                        update_box.lower(2),
+                                        update_box.upper(2),
+#endif
+                                        data.dx,
+                                        omega_d,
+                                        omega_r);
+            }
+        }
+
+        // Update the error on each box once all of the search directions have
+        // been computed.  Each box only reads and writes its own values, so the
+        // result does not depend on the number of threads or the box ordering.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for (int k = 0; k < num_boxes; ++k)
+        {
+            const ChebyshevBoxData& data = box_data[k];
+            const Box<NDIM>& patch_box = data.patch_box;
+            const Box<NDIM>& update_box = data.update_box;
+            CHEBY_UPDATE_FC(data.U,
+                            data.U_ghosts,
+                            data.D,
+                            data.D_ghosts,
+                            patch_box.lower(0),
+                            patch_box.upper(0),
+                            patch_box.lower(1),
+                            patch_box.upper(1),
+#if (NDIM == 3)
+                            patch_box.lower(2),
+                            patch_box.upper(2),
+#endif
+                            update_box.lower(0),
+                            update_box.upper(0),
+                            update_box.lower(1),
+                            update_box.upper(1)
+#if (NDIM == 3)
+                                ,
+                            update_box.lower(2),
+                            update_box.upper(2)
+#endif
+                                );
+        }
+    }
+
+    // Copy the smoothed error back into the error vector.
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+        Pointer<CellData<NDIM, double> > sol_data = patch->getPatchData(sol_idx);
+        error_data->getArrayData().copy(sol_data->getArrayData(), patch->getBox());
+    }
+    return;
+} // smoothErrorChebyshev
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
@@ -222,6 +222,25 @@ FACPreconditioner::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& s
     return;
 } // initializeSolverState
 
+void
+FACPreconditioner::reinitializeSolverState(const SAMRAIVectorReal<NDIM, double>& solution,
+                                           const SAMRAIVectorReal<NDIM, double>& rhs)
+{
+    if (!d_is_initialized || d_hierarchy != solution.getPatchHierarchy() ||
+        d_coarsest_ln != solution.getCoarsestLevelNumber() || d_finest_ln != solution.getFinestLevelNumber())
+    {
+        initializeSolverState(solution, rhs);
+        return;
+    }
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_hierarchy == rhs.getPatchHierarchy());
+    TBOX_ASSERT(d_coarsest_ln == rhs.getCoarsestLevelNumber());
+    TBOX_ASSERT(d_finest_ln == rhs.getFinestLevelNumber());
+#endif
+    d_fac_strategy->reinitializeOperatorState(solution, rhs);
+    return;
+} // reinitializeSolverState
+
 void
 FACPreconditioner::deallocateSolverState()
 {
@@ -81,6 +81,7 @@ namespace
 // Timers.
 static Timer* t_solve_system;
 static Timer* t_initialize_solver_state;
+static Timer* t_reinitialize_solver_state;
 static Timer* t_deallocate_solver_state;
 }
 
@@ -420,6 +421,33 @@ PETScKrylovLinearSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, doub
     return;
 } // initializeSolverState
 
+void
+PETScKrylovLinearSolver::reinitializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
+                                                 const SAMRAIVectorReal<NDIM, double>& b)
+{
+    // Fall back on a full initialization when the hierarchy configuration has
+    // changed since the solver state was last initialized.
+    if (!d_is_initialized || x.getPatchHierarchy() != d_x->getPatchHierarchy() ||
+        x.getCoarsestLevelNumber() != d_x->getCoarsestLevelNumber() ||
+        x.getFinestLevelNumber() != d_x->getFinestLevelNumber() ||
+        x.getNumberOfComponents() != d_x->getNumberOfComponents() ||
+        b.getNumberOfComponents() != d_b->getNumberOfComponents())
+    {
+        initializeSolverState(x, b);
+        return;
+    }
+
+    IBTK_TIMER_START(t_reinitialize_solver_state);
+
+    // The KSP object, the cloned solution and rhs vectors, and the linear
+    // operator only depend on the hierarchy configuration and are kept as-is.
+    // Only the preconditioner needs to refresh its coefficient-dependent data.
+    if (d_pc_solver) d_pc_solver->reinitializeSolverState(*d_x, *d_b);
+
+    IBTK_TIMER_STOP(t_reinitialize_solver_state);
+    return;
+} // reinitializeSolverState
+
 void
 PETScKrylovLinearSolver::deallocateSolverState()
 {
@@ -476,6 +504,8 @@ PETScKrylovLinearSolver::common_ctor()
     IBTK_DO_ONCE(t_solve_system = TimerManager::getManager()->getTimer("IBTK::PETScKrylovLinearSolver::solveSystem()");
                  t_initialize_solver_state =
                      TimerManager::getManager()->getTimer("IBTK::PETScKrylovLinearSolver::initializeSolverState()");
+                 t_reinitialize_solver_state =
+                     TimerManager::getManager()->getTimer("IBTK::PETScKrylovLinearSolver::reinitializeSolverState()");
                  t_deallocate_solver_state =
                      TimerManager::getManager()->getTimer("IBTK::PETScKrylovLinearSolver::deallocateSolverState()"););
     return;
@@ -32,6 +32,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
 #include <math.h>
 #include <stddef.h>
 #include <ostream>
@@ -71,6 +72,7 @@ namespace
 // Timers.
 static Timer* t_solve_system;
 static Timer* t_initialize_solver_state;
+static Timer* t_reinitialize_solver_state;
 static Timer* t_deallocate_solver_state;
 
 void
@@ -133,6 +135,7 @@ PETScLevelSolver::PETScLevelSolver()
       d_ksp_type(KSPGMRES),
       d_shell_pc_type(""),
       d_options_prefix(""),
+      d_agglomeration_factor(1),
       d_petsc_ksp(NULL),
       d_petsc_mat(NULL),
       d_petsc_pc(NULL),
@@ -154,6 +157,8 @@ PETScLevelSolver::PETScLevelSolver()
     IBTK_DO_ONCE(t_solve_system = TimerManager::getManager()->getTimer("IBTK::PETScLevelSolver::solveSystem()");
                  t_initialize_solver_state =
                      TimerManager::getManager()->getTimer("IBTK::PETScLevelSolver::initializeSolverState()");
+                 t_reinitialize_solver_state =
+                     TimerManager::getManager()->getTimer("IBTK::PETScLevelSolver::reinitializeSolverState()");
                  t_deallocate_solver_state =
                      TimerManager::getManager()->getTimer("IBTK::PETScLevelSolver::deallocateSolverState()"););
     return;
@@ -376,6 +381,21 @@ PETScLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
     PCType pc_type = d_pc_type.c_str();
     ierr = PCSetType(ksp_pc, pc_type);
     IBTK_CHKERRQ(ierr);
+
+    // Agglomerate the level onto a subset of the processors when requested.
+    // In this case, the requested preconditioner is used by a direct solve on
+    // the reduced communicator.  Because the outer KSP reuses its
+    // preconditioner, the factorization on the reduced communicator persists
+    // between solves.
+    const bool use_agglomeration = d_agglomeration_factor > 1 && d_pc_type != "shell" && d_pc_type != "asm" &&
+                                   d_pc_type != "fieldsplit" && SAMRAI_MPI::getNodes() > 1;
+    if (use_agglomeration)
+    {
+        ierr = PCSetType(ksp_pc, PCTELESCOPE);
+        IBTK_CHKERRQ(ierr);
+        ierr = PCTelescopeSetReductionFactor(ksp_pc, std::min(d_agglomeration_factor, SAMRAI_MPI::getNodes()));
+        IBTK_CHKERRQ(ierr);
+    }
     if (d_options_prefix != "")
     {
         ierr = KSPSetOptionsPrefix(d_petsc_ksp, d_options_prefix.c_str());
@@ -387,9 +407,12 @@ PETScLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
     // Reset class data structure to correspond to command-line options.
     ierr = KSPGetTolerances(d_petsc_ksp, &d_rel_residual_tol, &d_abs_residual_tol, NULL, &d_max_iterations);
     IBTK_CHKERRQ(ierr);
-    ierr = PCGetType(ksp_pc, &pc_type);
-    IBTK_CHKERRQ(ierr);
-    d_pc_type = pc_type;
+    if (!use_agglomeration)
+    {
+        ierr = PCGetType(ksp_pc, &pc_type);
+        IBTK_CHKERRQ(ierr);
+        d_pc_type = pc_type;
+    }
 
     // Set the nullspace.
     if (d_nullspace_contains_constant_vec || !d_nullspace_basis_vecs.empty()) setupNullspace();
@@ -666,6 +689,31 @@ PETScLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
         }
     }
 
+    // Configure the solver used on the reduced communicator.  The inner KSP
+    // object is only created when the agglomerating preconditioner is set up,
+    // and it only exists on the processors that participate in the reduced
+    // solve.
+    if (use_agglomeration)
+    {
+        ierr = KSPSetUp(d_petsc_ksp);
+        IBTK_CHKERRQ(ierr);
+        KSP reduced_ksp = NULL;
+        ierr = PCTelescopeGetKSP(ksp_pc, &reduced_ksp);
+        IBTK_CHKERRQ(ierr);
+        if (reduced_ksp)
+        {
+            ierr = KSPSetType(reduced_ksp, KSPPREONLY);
+            IBTK_CHKERRQ(ierr);
+            PC reduced_pc;
+            ierr = KSPGetPC(reduced_ksp, &reduced_pc);
+            IBTK_CHKERRQ(ierr);
+            ierr = PCSetType(reduced_pc, d_pc_type.c_str());
+            IBTK_CHKERRQ(ierr);
+            ierr = KSPSetFromOptions(reduced_ksp);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+
     // Indicate that the solver is initialized.
     d_is_initialized = true;
 
@@ -673,6 +721,110 @@ PETScLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
     return;
 } // initializeSolverState
 
+void
+PETScLevelSolver::reinitializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
+                                          const SAMRAIVectorReal<NDIM, double>& b)
+{
+    // Fall back on a full initialization when the patch level has changed or
+    // when the subclass is unable to refresh the matrix coefficients in place.
+    if (!d_is_initialized || x.getPatchHierarchy() != d_hierarchy || x.getCoarsestLevelNumber() != d_level_num ||
+        x.getFinestLevelNumber() != d_level_num || d_hierarchy->getPatchLevel(d_level_num) != d_level ||
+        !reinitializeSolverStateSpecialized(x, b))
+    {
+        initializeSolverState(x, b);
+        return;
+    }
+
+    IBTK_TIMER_START(t_reinitialize_solver_state);
+
+    // The matrix has been refreshed in place with an unchanged nonzero
+    // structure, so the DOF index maps, subdomain index sets, and scatters are
+    // all still valid.  Only the subdomain matrices and the factorizations need
+    // to be recomputed.
+    int ierr;
+    if (d_pc_type == "shell")
+    {
+#if PETSC_VERSION_GE(3,8,0)
+        ierr = MatCreateSubMatrices(d_petsc_mat,
+                                    d_n_local_subdomains,
+                                    d_n_local_subdomains ? &d_overlap_is[0] : NULL,
+                                    d_n_local_subdomains ? &d_overlap_is[0] : NULL,
+                                    MAT_REUSE_MATRIX,
+                                    &d_sub_mat);
+#else
+        ierr = MatGetSubMatrices(d_petsc_mat,
+                                 d_n_local_subdomains,
+                                 d_n_local_subdomains ? &d_overlap_is[0] : NULL,
+                                 d_n_local_subdomains ? &d_overlap_is[0] : NULL,
+                                 MAT_REUSE_MATRIX,
+                                 &d_sub_mat);
+#endif
+        IBTK_CHKERRQ(ierr);
+        if (d_shell_pc_type == "multiplicative")
+        {
+            PetscInt n_lo, n_hi;
+            ierr = VecGetOwnershipRange(d_petsc_x, &n_lo, &n_hi);
+            IBTK_CHKERRQ(ierr);
+            IS local_idx;
+            ierr = ISCreateStride(PETSC_COMM_WORLD, n_hi - n_lo, n_lo, 1, &local_idx);
+            IBTK_CHKERRQ(ierr);
+            std::vector<IS> local_idxs(d_n_local_subdomains, local_idx);
+#if PETSC_VERSION_GE(3,8,0)
+            ierr = MatCreateSubMatrices(d_petsc_mat,
+                                        d_n_local_subdomains,
+                                        d_n_local_subdomains ? &d_overlap_is[0] : NULL,
+                                        d_n_local_subdomains ? &local_idxs[0] : NULL,
+                                        MAT_REUSE_MATRIX,
+                                        &d_sub_bc_mat);
+#else
+            ierr = MatGetSubMatrices(d_petsc_mat,
+                                     d_n_local_subdomains,
+                                     d_n_local_subdomains ? &d_overlap_is[0] : NULL,
+                                     d_n_local_subdomains ? &local_idxs[0] : NULL,
+                                     MAT_REUSE_MATRIX,
+                                     &d_sub_bc_mat);
+#endif
+            IBTK_CHKERRQ(ierr);
+            for (int i = 0; i < d_n_local_subdomains; ++i)
+            {
+                ierr = MatScale(d_sub_bc_mat[i], -1.0);
+                IBTK_CHKERRQ(ierr);
+            }
+            ierr = ISDestroy(&local_idx);
+            IBTK_CHKERRQ(ierr);
+        }
+
+        // Refactor the subdomain matrices.  The symbolic factorizations are
+        // reused because the nonzero structure is unchanged.
+        for (int i = 0; i < d_n_local_subdomains; ++i)
+        {
+            KSP& sub_ksp = d_sub_ksp[i];
+            ierr = KSPSetOperators(sub_ksp, d_sub_mat[i], d_sub_mat[i]);
+            IBTK_CHKERRQ(ierr);
+            ierr = KSPSetReusePreconditioner(sub_ksp, PETSC_FALSE);
+            IBTK_CHKERRQ(ierr);
+            ierr = KSPSetUp(sub_ksp);
+            IBTK_CHKERRQ(ierr);
+            ierr = KSPSetReusePreconditioner(sub_ksp, PETSC_TRUE);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+
+    // Update the preconditioner of the level solver using the new matrix
+    // values.
+    ierr = KSPSetOperators(d_petsc_ksp, d_petsc_mat, d_petsc_pc);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetReusePreconditioner(d_petsc_ksp, PETSC_FALSE);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetUp(d_petsc_ksp);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetReusePreconditioner(d_petsc_ksp, PETSC_TRUE);
+    IBTK_CHKERRQ(ierr);
+
+    IBTK_TIMER_STOP(t_reinitialize_solver_state);
+    return;
+} // reinitializeSolverState
+
 void
 PETScLevelSolver::deallocateSolverState()
 {
@@ -777,6 +929,8 @@ PETScLevelSolver::init(Pointer<Database> input_db, const std::string& default_op
         if (input_db->keyExists("ksp_type")) d_ksp_type = input_db->getString("ksp_type");
         if (input_db->keyExists("pc_type")) d_pc_type = input_db->getString("pc_type");
         if (input_db->keyExists("shell_pc_type")) d_shell_pc_type = input_db->getString("shell_pc_type");
+        if (input_db->keyExists("agglomeration_factor"))
+            d_agglomeration_factor = input_db->getInteger("agglomeration_factor");
         if (input_db->keyExists("initial_guess_nonzero"))
             d_initial_guess_nonzero = input_db->getBool("initial_guess_nonzero");
         if (input_db->keyExists("subdomain_box_size"))
@@ -806,6 +960,13 @@ PETScLevelSolver::generateFieldSplitSubdomains(std::vector<std::string>& /*field
     return;
 } // generateFieldSplitSubdomains
 
+bool
+PETScLevelSolver::reinitializeSolverStateSpecialized(const SAMRAIVectorReal<NDIM, double>& /*x*/,
+                                                     const SAMRAIVectorReal<NDIM, double>& /*b*/)
+{
+    return false;
+} // reinitializeSolverStateSpecialized
+
 void
 PETScLevelSolver::setupNullspace()
 {
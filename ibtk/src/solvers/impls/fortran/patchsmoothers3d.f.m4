@@ -1652,4 +1652,255 @@ c
       end
 c
 
-c
\ No newline at end of file
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+
+c              Chebyshev patch smoothers
+
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Perform a single step of Jacobi-preconditioned Chebyshev iteration
+c     for F = alpha div grad U + beta U on the box [blower,bupper].
+c
+c     The search direction is updated via
+c
+c        D := omega_d*D + omega_r*diag(A)^{-1}*(F - A U)
+c
+c     The solution itself is left unchanged; see chebyupdate3d.  Only D
+c     is written, so that D may be computed for all of the update boxes
+c     of a patch before U is modified.  The update box may extend into
+c     the ghost cell region of U, D, and F.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine chebysmooth3d(
+     &     U,U_gcw,
+     &     D,D_gcw,
+     &     alpha,beta,
+     &     F,F_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     ilower2,iupper2,
+     &     blower0,bupper0,
+     &     blower1,bupper1,
+     &     blower2,bupper2,
+     &     dx,
+     &     omega_d,omega_r)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER ilower2,iupper2
+      INTEGER blower0,bupper0
+      INTEGER blower1,bupper1
+      INTEGER blower2,bupper2
+      INTEGER U_gcw,D_gcw,F_gcw
+
+      REAL alpha,beta
+      REAL omega_d,omega_r
+
+      REAL F(ilower0-F_gcw:iupper0+F_gcw,
+     &     ilower1-F_gcw:iupper1+F_gcw,
+     &     ilower2-F_gcw:iupper2+F_gcw)
+
+      REAL U(ilower0-U_gcw:iupper0+U_gcw,
+     &     ilower1-U_gcw:iupper1+U_gcw,
+     &     ilower2-U_gcw:iupper2+U_gcw)
+
+      REAL dx(0:NDIM-1)
+c
+c     Input/Output.
+c
+      REAL D(ilower0-D_gcw:iupper0+D_gcw,
+     &     ilower1-D_gcw:iupper1+D_gcw,
+     &     ilower2-D_gcw:iupper2+D_gcw)
+c
+c     Local variables.
+c
+      INTEGER i0,i1,i2
+      REAL    fac0,fac1,fac2,diag,fac
+c
+c     Update the search direction.
+c
+      fac0 = alpha/(dx(0)*dx(0))
+      fac1 = alpha/(dx(1)*dx(1))
+      fac2 = alpha/(dx(2)*dx(2))
+      diag = beta-2.d0*(fac0+fac1+fac2)
+      fac = omega_r/diag
+
+      do i2 = blower2,bupper2
+         do i1 = blower1,bupper1
+            do i0 = blower0,bupper0
+               D(i0,i1,i2) = omega_d*D(i0,i1,i2) + fac*(F(i0,i1,i2) -
+     &             fac0*(U(i0-1,i1,i2)+U(i0+1,i1,i2)) -
+     &             fac1*(U(i0,i1-1,i2)+U(i0,i1+1,i2)) -
+     &             fac2*(U(i0,i1,i2-1)+U(i0,i1,i2+1)) -
+     &             diag*U(i0,i1,i2))
+            enddo
+         enddo
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Perform a single step of Jacobi-preconditioned Chebyshev iteration
+c     for F = div alpha grad U + beta U on the box [blower,bupper].
+c
+c     The smoother is written for cell-centered U and side-centered
+c     alpha = (alpha0,alpha1,alpha2)
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine vccellchebysmooth3d(
+     &     U,U_gcw,
+     &     D,D_gcw,
+     &     alpha0,alpha1,alpha2,alpha_gcw,
+     &     beta,
+     &     F,F_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     ilower2,iupper2,
+     &     blower0,bupper0,
+     &     blower1,bupper1,
+     &     blower2,bupper2,
+     &     dx,
+     &     omega_d,omega_r)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER ilower2,iupper2
+      INTEGER blower0,bupper0
+      INTEGER blower1,bupper1
+      INTEGER blower2,bupper2
+      INTEGER U_gcw,D_gcw,F_gcw,alpha_gcw
+
+      REAL beta
+      REAL omega_d,omega_r
+
+      REAL F(ilower0-F_gcw:iupper0+F_gcw,
+     &     ilower1-F_gcw:iupper1+F_gcw,
+     &     ilower2-F_gcw:iupper2+F_gcw)
+
+      REAL alpha0(SIDE3d0(ilower,iupper,alpha_gcw))
+      REAL alpha1(SIDE3d1(ilower,iupper,alpha_gcw))
+      REAL alpha2(SIDE3d2(ilower,iupper,alpha_gcw))
+
+      REAL U(ilower0-U_gcw:iupper0+U_gcw,
+     &     ilower1-U_gcw:iupper1+U_gcw,
+     &     ilower2-U_gcw:iupper2+U_gcw)
+
+      REAL dx(0:NDIM-1)
+c
+c     Input/Output.
+c
+      REAL D(ilower0-D_gcw:iupper0+D_gcw,
+     &     ilower1-D_gcw:iupper1+D_gcw,
+     &     ilower2-D_gcw:iupper2+D_gcw)
+c
+c     Local variables.
+c
+      INTEGER i0,i1,i2
+      REAL    hx,hy,hz
+      REAL    facu0,facl0
+      REAL    facu1,facl1
+      REAL    facu2,facl2
+      REAL    diag
+c
+c     Update the search direction.
+c
+      hx = dx(0)
+      hy = dx(1)
+      hz = dx(2)
+
+      do i2 = blower2,bupper2
+         do i1 = blower1,bupper1
+            do i0 = blower0,bupper0
+               facu0 = alpha0(i0+1,i1,i2)/(hx*hx)
+               facl0 = alpha0(i0,i1,i2)/(hx*hx)
+               facu1 = alpha1(i0,i1+1,i2)/(hy*hy)
+               facl1 = alpha1(i0,i1,i2)/(hy*hy)
+               facu2 = alpha2(i0,i1,i2+1)/(hz*hz)
+               facl2 = alpha2(i0,i1,i2)/(hz*hz)
+               diag  = beta-(facu0+facl0+facu1+facl1+facu2+facl2)
+               D(i0,i1,i2) = omega_d*D(i0,i1,i2) +
+     &             (omega_r/diag)*(F(i0,i1,i2) -
+     &             facu0*U(i0+1,i1,i2) -
+     &             facl0*U(i0-1,i1,i2) -
+     &             facu1*U(i0,i1+1,i2) -
+     &             facl1*U(i0,i1-1,i2) -
+     &             facu2*U(i0,i1,i2+1) -
+     &             facl2*U(i0,i1,i2-1) -
+     &             diag*U(i0,i1,i2))
+            enddo
+         enddo
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Apply the Chebyshev search direction U := U + D on the box
+c     [blower,bupper].
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine chebyupdate3d(
+     &     U,U_gcw,
+     &     D,D_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     ilower2,iupper2,
+     &     blower0,bupper0,
+     &     blower1,bupper1,
+     &     blower2,bupper2)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER ilower2,iupper2
+      INTEGER blower0,bupper0
+      INTEGER blower1,bupper1
+      INTEGER blower2,bupper2
+      INTEGER U_gcw,D_gcw
+
+      REAL D(ilower0-D_gcw:iupper0+D_gcw,
+     &     ilower1-D_gcw:iupper1+D_gcw,
+     &     ilower2-D_gcw:iupper2+D_gcw)
+c
+c     Input/Output.
+c
+      REAL U(ilower0-U_gcw:iupper0+U_gcw,
+     &     ilower1-U_gcw:iupper1+U_gcw,
+     &     ilower2-U_gcw:iupper2+U_gcw)
+c
+c     Local variables.
+c
+      INTEGER i0,i1,i2
+c
+c     Update the solution.
+c
+      do i2 = blower2,bupper2
+         do i1 = blower1,bupper1
+            do i0 = blower0,bupper0
+               U(i0,i1,i2) = U(i0,i1,i2) + D(i0,i1,i2)
+            enddo
+         enddo
+      enddo
+c
+      return
+      end
+c
@@ -145,6 +145,14 @@ FACPreconditionerStrategy::initializeOperatorState(const SAMRAIVectorReal<NDIM,
     return;
 } // initializeOperatorState
 
+void
+FACPreconditionerStrategy::reinitializeOperatorState(const SAMRAIVectorReal<NDIM, double>& solution,
+                                                     const SAMRAIVectorReal<NDIM, double>& rhs)
+{
+    initializeOperatorState(solution, rhs);
+    return;
+} // reinitializeOperatorState
+
 void
 FACPreconditionerStrategy::deallocateOperatorState()
 {
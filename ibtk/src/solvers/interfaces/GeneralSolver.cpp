@@ -166,6 +166,13 @@ GeneralSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& /*u*/
     return;
 } // initializeSolverState
 
+void
+GeneralSolver::reinitializeSolverState(const SAMRAIVectorReal<NDIM, double>& x, const SAMRAIVectorReal<NDIM, double>& b)
+{
+    initializeSolverState(x, b);
+    return;
+} // reinitializeSolverState
+
 void
 GeneralSolver::deallocateSolverState()
 {
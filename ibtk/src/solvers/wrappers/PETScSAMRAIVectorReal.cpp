@@ -785,8 +785,13 @@ PETScSAMRAIVectorReal::VecDotNorm2_SAMRAI(Vec s, Vec t, PetscScalar* dp, PetscSc
 {
     IBTK_TIMER_START(t_vec_dot_norm2);
     PSVR_CHECK2(s, t);
-    *dp = PSVR_CAST2(s)->dot(PSVR_CAST2(t));
-    *nm = PSVR_CAST2(t)->dot(PSVR_CAST2(t));
+    static const bool local_only = true;
+    PetscScalar val[2];
+    val[0] = PSVR_CAST2(s)->dot(PSVR_CAST2(t), local_only);
+    val[1] = PSVR_CAST2(t)->dot(PSVR_CAST2(t), local_only);
+    SAMRAI_MPI::sumReduction(val, 2);
+    *dp = val[0];
+    *nm = val[1];
     IBTK_TIMER_STOP(t_vec_dot_norm2);
     PetscFunctionReturn(0);
 }
@@ -249,6 +249,10 @@ AppInitializer::AppInitializer(int argc, char* argv[], const std::string& defaul
         if (d_viz_writers[i] == "Silo")
         {
             d_silo_data_writer = new LSiloDataWriter("LSiloDataWriter", d_viz_dump_dirname);
+            if (main_db->keyExists("silo_asynchronous_output"))
+                d_silo_data_writer->setAsynchronousOutput(main_db->getBool("silo_asynchronous_output"));
+            if (main_db->keyExists("silo_number_of_output_files"))
+                d_silo_data_writer->setNumberOfOutputFiles(main_db->getInteger("silo_number_of_output_files"));
         }
 
         if (d_viz_writers[i] == "ExodusII")
@@ -77,6 +77,7 @@
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/HierarchyIntegrator.h"
 #include "ibtk/HierarchyMathOps.h"
+#include "ibtk/PerformanceProfiler.h"
 #include "ibtk/RefinePatchStrategySet.h"
 #include "ibtk/ibtk_enums.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
@@ -324,12 +325,17 @@ HierarchyIntegrator::advanceHierarchy(double dt)
     if (d_enable_logging)
         plog << d_object_name << "::advanceHierarchy(): time interval = [" << current_time << "," << new_time
              << "], dt = " << dt << "\n";
+    if (PerformanceProfiler::isEnabled())
+    {
+        PerformanceProfiler::getProfiler()->beginStep(d_integrator_step, current_time);
+    }
 
     // Regrid the patch hierarchy.
     if (atRegridPoint())
     {
         if (d_enable_logging)
             plog << d_object_name << "::advanceHierarchy(): regridding prior to timestep " << d_integrator_step << "\n";
+        ProfilingScope regrid_scope("regrid");
         d_regridding_hierarchy = true;
         regridHierarchy();
         d_regridding_hierarchy = false;
@@ -343,28 +349,37 @@ HierarchyIntegrator::advanceHierarchy(double dt)
     // Execute the preprocessing method of the parent integrator, and
     // recursively execute all preprocessing callbacks registered with the
     // parent and child integrators.
-    preprocessIntegrateHierarchy(current_time, new_time, d_current_num_cycles);
+    {
+        ProfilingScope preprocess_scope("preprocess");
+        preprocessIntegrateHierarchy(current_time, new_time, d_current_num_cycles);
+    }
 
     // Perform one or more cycles.  In each cycle, execute the integration
     // method of the parent integrator, and recursively execute all integration
     // callbacks registered with the parent and child integrators.
     if (d_enable_logging) plog << d_object_name << "::advanceHierarchy(): integrating hierarchy\n";
-    for (int cycle_num = 0; cycle_num < d_current_num_cycles; ++cycle_num)
     {
-        if (d_enable_logging && d_current_num_cycles != 1)
+        ProfilingScope integrate_scope("integrate");
+        for (int cycle_num = 0; cycle_num < d_current_num_cycles; ++cycle_num)
         {
-            if (d_enable_logging)
-                plog << d_object_name << "::advanceHierarchy(): executing cycle " << cycle_num + 1 << " of "
-                     << d_current_num_cycles << "\n";
+            if (d_enable_logging && d_current_num_cycles != 1)
+            {
+                if (d_enable_logging)
+                    plog << d_object_name << "::advanceHierarchy(): executing cycle " << cycle_num + 1 << " of "
+                         << d_current_num_cycles << "\n";
+            }
+            integrateHierarchy(current_time, new_time, cycle_num);
         }
-        integrateHierarchy(current_time, new_time, cycle_num);
     }
 
     // Execute the postprocessing method of the parent integrator, and
     // recursively execute all postprocessing callbacks registered with the
     // parent and child integrators.
     static const bool skip_synchronize_new_state_data = true;
-    postprocessIntegrateHierarchy(current_time, new_time, skip_synchronize_new_state_data, d_current_num_cycles);
+    {
+        ProfilingScope postprocess_scope("postprocess");
+        postprocessIntegrateHierarchy(current_time, new_time, skip_synchronize_new_state_data, d_current_num_cycles);
+    }
 
     // Ensure that the current values of num_cycles, cycle_num, and dt are
     // reset.
@@ -382,11 +397,17 @@ HierarchyIntegrator::advanceHierarchy(double dt)
 
     // Synchronize the updated data.
     if (d_enable_logging) plog << d_object_name << "::advanceHierarchy(): synchronizing updated data\n";
-    synchronizeHierarchyData(NEW_DATA);
+    {
+        ProfilingScope synchronize_scope("synchronize");
+        synchronizeHierarchyData(NEW_DATA);
+    }
 
     // Reset all time dependent data.
     if (d_enable_logging) plog << d_object_name << "::advanceHierarchy(): resetting time dependent data\n";
-    resetTimeDependentHierarchyData(new_time);
+    {
+        ProfilingScope reset_scope("reset");
+        resetTimeDependentHierarchyData(new_time);
+    }
 
     // Reset the regrid indicator.
     d_at_regrid_time_step = false;
@@ -583,6 +604,7 @@ HierarchyIntegrator::getVisItDataWriter() const
 void
 HierarchyIntegrator::setupPlotData()
 {
+    ProfilingScope io_scope("io");
     setupPlotDataSpecialized();
     for (std::set<HierarchyIntegrator*>::iterator it = d_child_integrators.begin(); it != d_child_integrators.end();
          ++it)
@@ -1594,6 +1616,14 @@ HierarchyIntegrator::getFromInput(Pointer<Database> db, bool is_from_restart)
     if (db->keyExists("enable_logging")) d_enable_logging = db->getBool("enable_logging");
     if (db->keyExists("bdry_extrap_type")) d_bdry_extrap_type = db->getString("bdry_extrap_type");
     if (db->keyExists("tag_buffer")) d_tag_buffer = db->getIntegerArray("tag_buffer");
+    if (db->keyExists("enable_profiling"))
+        PerformanceProfiler::getProfiler()->setEnabled(db->getBool("enable_profiling"));
+    if (db->keyExists("profile_log_interval"))
+        PerformanceProfiler::getProfiler()->setLogInterval(db->getInteger("profile_log_interval"));
+    if (db->keyExists("profile_max_log_entries"))
+        PerformanceProfiler::getProfiler()->setMaxLogEntries(db->getInteger("profile_max_log_entries"));
+    if (db->keyExists("profile_file_name"))
+        PerformanceProfiler::getProfiler()->setProfileFileName(db->getString("profile_file_name"));
     return;
 } // getFromInput
 
@@ -0,0 +1,504 @@
+// Filename: PerformanceProfiler.cpp
+// Created on 17 Oct 2026
+//
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ibtk/PerformanceProfiler.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/PIO.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/ShutdownRegistry.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+PerformanceProfiler* PerformanceProfiler::s_profiler_instance = NULL;
+bool PerformanceProfiler::s_registered_callback = false;
+unsigned char PerformanceProfiler::s_shutdown_priority = 200;
+bool PerformanceProfiler::s_enabled = false;
+
+namespace
+{
+inline double
+imbalance(const double max_val, const double avg_val)
+{
+    return avg_val > 0.0 ? max_val / avg_val : 1.0;
+} // imbalance
+
+inline bool
+ends_with(const std::string& str, const std::string& suffix)
+{
+    return str.size() >= suffix.size() && str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+} // ends_with
+
+// Used to sort the per-step summary entries in order of decreasing time.
+bool
+compare_entries(const std::pair<double, int>& a, const std::pair<double, int>& b)
+{
+    return a.first > b.first;
+} // compare_entries
+}
+
+PerformanceProfiler*
+PerformanceProfiler::getProfiler()
+{
+    if (!s_profiler_instance)
+    {
+        s_profiler_instance = new PerformanceProfiler();
+    }
+    if (!s_registered_callback)
+    {
+        ShutdownRegistry::registerShutdownRoutine(freeProfiler, s_shutdown_priority);
+        s_registered_callback = true;
+    }
+    return s_profiler_instance;
+} // getProfiler
+
+void
+PerformanceProfiler::freeProfiler()
+{
+    if (s_profiler_instance) s_profiler_instance->finalize();
+    delete s_profiler_instance;
+    s_profiler_instance = NULL;
+    s_enabled = false;
+    return;
+} // freeProfiler
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+void
+PerformanceProfiler::setEnabled(const bool enabled)
+{
+    s_enabled = enabled;
+    return;
+} // setEnabled
+
+void
+PerformanceProfiler::setLogInterval(const int log_interval)
+{
+    d_log_interval = log_interval;
+    return;
+} // setLogInterval
+
+void
+PerformanceProfiler::setMaxLogEntries(const int max_log_entries)
+{
+    d_max_log_entries = max_log_entries;
+    return;
+} // setMaxLogEntries
+
+void
+PerformanceProfiler::setProfileFileName(const std::string& file_name)
+{
+    d_profile_file_name = file_name;
+    d_profile_written = false;
+    return;
+} // setProfileFileName
+
+void
+PerformanceProfiler::beginStep(const int step_num, const double step_time)
+{
+    if (!s_enabled) return;
+    if (d_step_in_progress) endStep();
+    for (std::vector<ScopeNode>::iterator it = d_nodes.begin(); it != d_nodes.end(); ++it)
+    {
+        it->step_time = 0.0;
+    }
+    d_step_in_progress = true;
+    d_step_num = step_num;
+    d_step_time = step_time;
+    d_nodes[0].start_time = MPI_Wtime();
+    return;
+} // beginStep
+
+void
+PerformanceProfiler::finalize()
+{
+    if (d_step_in_progress) endStep();
+    if (d_profile_file_name.empty() || d_profile_written || d_nodes[0].num_calls == 0) return;
+    std::ofstream os;
+    if (SAMRAI_MPI::getRank() == 0) os.open(d_profile_file_name.c_str(), std::ios::out | std::ios::trunc);
+    if (ends_with(d_profile_file_name, ".csv"))
+    {
+        printCSV(os);
+    }
+    else
+    {
+        printJSON(os);
+    }
+    d_profile_written = true;
+    return;
+} // finalize
+
+void
+PerformanceProfiler::beginScope(const std::string& scope_name)
+{
+    const int parent_idx = d_active_nodes.empty() ? 0 : d_active_nodes.back();
+    int node_idx;
+    std::map<std::string, int>::const_iterator it = d_nodes[parent_idx].children.find(scope_name);
+    if (it != d_nodes[parent_idx].children.end())
+    {
+        node_idx = it->second;
+    }
+    else
+    {
+        node_idx = static_cast<int>(d_nodes.size());
+        ScopeNode node;
+        node.name = scope_name;
+        node.parent = parent_idx;
+        node.depth = d_nodes[parent_idx].depth + 1;
+        node.num_calls = 0;
+        node.start_time = 0.0;
+        node.step_time = 0.0;
+        node.total_time = 0.0;
+        d_nodes.push_back(node);
+        d_nodes[parent_idx].children[scope_name] = node_idx;
+    }
+    d_active_nodes.push_back(node_idx);
+    d_nodes[node_idx].start_time = MPI_Wtime();
+    return;
+} // beginScope
+
+void
+PerformanceProfiler::endScope()
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(!d_active_nodes.empty());
+#endif
+    ScopeNode& node = d_nodes[d_active_nodes.back()];
+    const double elapsed = MPI_Wtime() - node.start_time;
+    node.step_time += elapsed;
+    node.total_time += elapsed;
+    node.num_calls += 1;
+    d_active_nodes.pop_back();
+    return;
+} // endScope
+
+double
+PerformanceProfiler::getLocalTotalTime(const std::string& scope_name) const
+{
+    double total_time = 0.0;
+    for (unsigned int k = 1; k < d_nodes.size(); ++k)
+    {
+        if (d_nodes[k].name != scope_name) continue;
+        bool nested_in_same_name = false;
+        for (int p = d_nodes[k].parent; p > 0 && !nested_in_same_name; p = d_nodes[p].parent)
+        {
+            nested_in_same_name = d_nodes[p].name == scope_name;
+        }
+        if (!nested_in_same_name) total_time += d_nodes[k].total_time;
+    }
+    return total_time;
+} // getLocalTotalTime
+
+void
+PerformanceProfiler::printJSON(std::ostream& os)
+{
+    std::vector<double> min_vals, max_vals, avg_vals;
+    const bool consistent = reduceTotals(min_vals, max_vals, avg_vals);
+    if (SAMRAI_MPI::getRank() != 0) return;
+    os << std::setprecision(8) << std::scientific;
+    os << "{\n";
+    os << "  \"mpi_ranks\": " << SAMRAI_MPI::getNodes() << ",\n";
+    os << "  \"num_steps\": " << d_nodes[0].num_calls << ",\n";
+    os << "  \"consistent\": " << (consistent ? "true" : "false") << ",\n";
+    os << "  \"scopes\": [\n";
+    for (unsigned int k = 0; k < d_nodes.size(); ++k)
+    {
+        os << "    {\"path\": \"" << getScopePath(k) << "\", \"depth\": " << d_nodes[k].depth
+           << ", \"calls\": " << d_nodes[k].num_calls << ", \"min\": " << min_vals[k] << ", \"avg\": " << avg_vals[k]
+           << ", \"max\": " << max_vals[k] << ", \"imbalance\": " << imbalance(max_vals[k], avg_vals[k]) << "}"
+           << (k + 1 < d_nodes.size() ? ",\n" : "\n");
+    }
+    os << "  ],\n";
+    os << "  \"steps\": [\n";
+    for (unsigned int s = 0; s < d_step_records.size(); ++s)
+    {
+        const StepRecord& record = d_step_records[s];
+        os << "    {\"step\": " << record.step_num << ", \"time\": " << record.step_time
+           << ", \"consistent\": " << (record.consistent ? "true" : "false") << ", \"scopes\": {";
+        for (unsigned int k = 0; k < record.node_idxs.size(); ++k)
+        {
+            os << (k == 0 ? "" : ", ") << "\"" << getScopePath(record.node_idxs[k]) << "\": [" << record.max_vals[k]
+               << ", " << record.avg_vals[k] << "]";
+        }
+        os << "}}" << (s + 1 < d_step_records.size() ? ",\n" : "\n");
+    }
+    os << "  ]\n";
+    os << "}\n";
+    return;
+} // printJSON
+
+void
+PerformanceProfiler::printCSV(std::ostream& os)
+{
+    std::vector<double> min_vals, max_vals, avg_vals;
+    reduceTotals(min_vals, max_vals, avg_vals);
+    if (SAMRAI_MPI::getRank() != 0) return;
+    os << std::setprecision(8) << std::scientific;
+    os << "step,time,path,depth,calls,min,avg,max,imbalance\n";
+    for (unsigned int k = 0; k < d_nodes.size(); ++k)
+    {
+        os << "total,," << getScopePath(k) << "," << d_nodes[k].depth << "," << d_nodes[k].num_calls << ","
+           << min_vals[k] << "," << avg_vals[k] << "," << max_vals[k] << ","
+           << imbalance(max_vals[k], avg_vals[k]) << "\n";
+    }
+    for (unsigned int s = 0; s < d_step_records.size(); ++s)
+    {
+        const StepRecord& record = d_step_records[s];
+        for (unsigned int k = 0; k < record.node_idxs.size(); ++k)
+        {
+            const int node_idx = record.node_idxs[k];
+            os << record.step_num << "," << record.step_time << "," << getScopePath(node_idx) << ","
+               << d_nodes[node_idx].depth << ",,," << record.avg_vals[k] << "," << record.max_vals[k] << ","
+               << imbalance(record.max_vals[k], record.avg_vals[k]) << "\n";
+        }
+    }
+    return;
+} // printCSV
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+PerformanceProfiler::PerformanceProfiler()
+    : d_nodes(),
+      d_active_nodes(),
+      d_step_records(),
+      d_step_in_progress(false),
+      d_step_num(-1),
+      d_step_time(0.0),
+      d_log_interval(1),
+      d_max_log_entries(6),
+      d_profile_file_name(),
+      d_profile_written(false)
+{
+    ScopeNode root;
+    root.name = "step";
+    root.parent = -1;
+    root.depth = 0;
+    root.num_calls = 0;
+    root.start_time = 0.0;
+    root.step_time = 0.0;
+    root.total_time = 0.0;
+    d_nodes.push_back(root);
+    return;
+} // PerformanceProfiler
+
+PerformanceProfiler::~PerformanceProfiler()
+{
+    // intentionally blank
+    return;
+} // ~PerformanceProfiler
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+PerformanceProfiler::endStep()
+{
+    ScopeNode& root = d_nodes[0];
+    const double elapsed = MPI_Wtime() - root.start_time;
+    root.step_time = elapsed;
+    root.total_time += elapsed;
+    root.num_calls += 1;
+    d_step_in_progress = false;
+    const bool print_step = d_log_interval > 0 && d_step_num % d_log_interval == 0;
+    const bool record_step = !d_profile_file_name.empty();
+    if (!print_step && !record_step) return;
+
+    // Aggregate the step times by scope name.  A scope that is nested within a
+    // scope with the same name is not counted twice.
+    std::map<std::string, double> name_times;
+    for (unsigned int k = 1; k < d_nodes.size(); ++k)
+    {
+        bool nested_in_same_name = false;
+        for (int p = d_nodes[k].parent; p > 0 && !nested_in_same_name; p = d_nodes[p].parent)
+        {
+            nested_in_same_name = d_nodes[p].name == d_nodes[k].name;
+        }
+        if (!nested_in_same_name) name_times[d_nodes[k].name] += d_nodes[k].step_time;
+    }
+
+    // Reduce the step times over all processes.  The times can only be reduced
+    // if all processes have the same scope tree.
+    const int num_nodes = static_cast<int>(d_nodes.size());
+    const int num_names = static_cast<int>(name_times.size());
+    const bool consistent = haveConsistentScopeTrees();
+    std::vector<double> vals(num_nodes + num_names);
+    for (int k = 0; k < num_nodes; ++k) vals[k] = d_nodes[k].step_time;
+    int j = num_nodes;
+    for (std::map<std::string, double>::const_iterator it = name_times.begin(); it != name_times.end(); ++it, ++j)
+    {
+        vals[j] = it->second;
+    }
+    std::vector<double> max_vals(vals), avg_vals(vals);
+    if (consistent)
+    {
+        SAMRAI_MPI::maxReduction(&max_vals[0], static_cast<int>(max_vals.size()));
+        SAMRAI_MPI::sumReduction(&avg_vals[0], static_cast<int>(avg_vals.size()));
+        const int num_ranks = SAMRAI_MPI::getNodes();
+        for (unsigned int k = 0; k < avg_vals.size(); ++k) avg_vals[k] /= static_cast<double>(num_ranks);
+    }
+    if (SAMRAI_MPI::getRank() != 0) return;
+
+    // Record the step.
+    if (record_step)
+    {
+        StepRecord record;
+        record.step_num = d_step_num;
+        record.step_time = d_step_time;
+        record.consistent = consistent;
+        for (int k = 0; k < num_nodes; ++k)
+        {
+            if (max_vals[k] <= 0.0) continue;
+            record.node_idxs.push_back(k);
+            record.max_vals.push_back(max_vals[k]);
+            record.avg_vals.push_back(avg_vals[k]);
+        }
+        d_step_records.push_back(record);
+    }
+
+    // Print the per-step summary.
+    if (!print_step) return;
+    std::vector<std::pair<double, int> > entries;
+    std::vector<std::string> names;
+    j = num_nodes;
+    for (std::map<std::string, double>::const_iterator it = name_times.begin(); it != name_times.end(); ++it, ++j)
+    {
+        names.push_back(it->first);
+        if (max_vals[j] > 0.0) entries.push_back(std::make_pair(max_vals[j], j));
+    }
+    double accounted_time = 0.0;
+    for (std::map<std::string, int>::const_iterator it = root.children.begin(); it != root.children.end(); ++it)
+    {
+        accounted_time += avg_vals[it->second];
+    }
+    std::sort(entries.begin(), entries.end(), compare_entries);
+    std::ostringstream stream;
+    stream << "step " << d_step_num << " (t = " << std::setprecision(3) << std::scientific << d_step_time
+           << "): wall " << max_vals[0] << " s (imb " << std::fixed << std::setprecision(2)
+           << imbalance(max_vals[0], avg_vals[0]) << ")";
+    const int num_entries = std::min(static_cast<int>(entries.size()), d_max_log_entries);
+    for (int k = 0; k < num_entries; ++k)
+    {
+        const int idx = entries[k].second;
+        stream << " | " << names[idx - num_nodes] << " " << std::scientific << std::setprecision(3) << max_vals[idx]
+               << " (imb " << std::fixed << std::setprecision(2) << imbalance(max_vals[idx], avg_vals[idx]) << ")";
+    }
+    stream << " | other " << std::scientific << std::setprecision(3) << std::max(avg_vals[0] - accounted_time, 0.0);
+    if (!consistent) stream << " [local times only: scope trees differ across processes]";
+    pout << "PerformanceProfiler: " << stream.str() << "\n";
+    return;
+} // endStep
+
+bool
+PerformanceProfiler::reduceTotals(std::vector<double>& min_vals,
+                                  std::vector<double>& max_vals,
+                                  std::vector<double>& avg_vals)
+{
+    const int num_nodes = static_cast<int>(d_nodes.size());
+    const bool consistent = haveConsistentScopeTrees();
+    min_vals.resize(num_nodes);
+    for (int k = 0; k < num_nodes; ++k) min_vals[k] = d_nodes[k].total_time;
+    max_vals = min_vals;
+    avg_vals = min_vals;
+    if (consistent)
+    {
+        SAMRAI_MPI::minReduction(&min_vals[0], num_nodes);
+        SAMRAI_MPI::maxReduction(&max_vals[0], num_nodes);
+        SAMRAI_MPI::sumReduction(&avg_vals[0], num_nodes);
+        const int num_ranks = SAMRAI_MPI::getNodes();
+        for (int k = 0; k < num_nodes; ++k) avg_vals[k] /= static_cast<double>(num_ranks);
+    }
+    return consistent;
+} // reduceTotals
+
+bool
+PerformanceProfiler::haveConsistentScopeTrees() const
+{
+    // Compute an FNV-1a hash of the scope paths in node order.  Each scope
+    // path is determined by the name of the node and the path of its parent,
+    // which always precedes it, so it suffices to hash the parent index and the
+    // name of each node.  The hash is restricted to 31 bits so that it can be
+    // negated to obtain both its minimum and maximum over all processes from
+    // one max reduction.
+    unsigned int hash = 2166136261U;
+    for (unsigned int k = 0; k < d_nodes.size(); ++k)
+    {
+        const unsigned int parent = static_cast<unsigned int>(d_nodes[k].parent);
+        for (unsigned int b = 0; b < sizeof(parent); ++b)
+        {
+            hash = (hash ^ ((parent >> (8 * b)) & 0xffU)) * 16777619U;
+        }
+        const std::string& name = d_nodes[k].name;
+        for (std::string::const_iterator it = name.begin(); it != name.end(); ++it)
+        {
+            hash = (hash ^ static_cast<unsigned char>(*it)) * 16777619U;
+        }
+        hash = (hash ^ 0xffU) * 16777619U; // name terminator
+    }
+    const int num_nodes = static_cast<int>(d_nodes.size());
+    const int path_hash = static_cast<int>(hash & 0x7fffffffU);
+    int vals[4] = { num_nodes, -num_nodes, path_hash, -path_hash };
+    SAMRAI_MPI::maxReduction(vals, 4);
+    return vals[0] == -vals[1] && vals[2] == -vals[3];
+} // haveConsistentScopeTrees
+
+std::string
+PerformanceProfiler::getScopePath(const int node_idx) const
+{
+    std::string path = d_nodes[node_idx].name;
+    for (int p = d_nodes[node_idx].parent; p >= 0; p = d_nodes[p].parent)
+    {
+        path = d_nodes[p].name + "/" + path;
+    }
+    return path;
+} // getScopePath
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -38,6 +38,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "HierarchyFaceDataOpsReal.h"
 #include "IntVector.h"
@@ -52,6 +53,11 @@ namespace IBAMR
 {
 class ConvectiveOperator;
 } // namespace IBAMR
+namespace IBTK
+{
+class LaplaceOperator;
+class PoissonSolver;
+} // namespace IBTK
 namespace SAMRAI
 {
 namespace hier
@@ -71,6 +77,13 @@ namespace pdat
 template <int DIM, class TYPE>
 class CellVariable;
 } // namespace pdat
+namespace solv
+{
+template <int DIM, class TYPE>
+class SAMRAIVectorReal;
+template <int DIM>
+class RobinBcCoefStrategy;
+} // namespace solv
 } // namespace SAMRAI
 
 /////////////////////////////// CLASS DEFINITION /////////////////////////////
@@ -94,6 +107,17 @@ namespace IBAMR
  *
  * Various options are available for the spatial and temporal discretizations.
  *
+ * When the input database sets <tt>group_compatible_quantities = TRUE</tt>,
+ * transported quantities that share the same advection velocity, diffusion and
+ * damping coefficients, and time stepping and convective operator settings are
+ * advanced together.  The members of each such group are packed into a single
+ * multi-component variable, so that the group requires only one ghost cell
+ * fill and one application of the convective operator per evaluation, and one
+ * Helmholtz solve per cycle.  Quantities for which a custom convective
+ * operator, Helmholtz solver, or Helmholtz RHS operator has been provided, or
+ * which use a spatially varying diffusion coefficient, are always advanced
+ * individually.
+ *
  * \see HierarchyIntegrator
  * \see SAMRAI::mesh::StandardTagAndInitStrategy
  * \see SAMRAI::algs::TimeRefinementIntegrator
@@ -394,6 +418,47 @@ private:
      * by the object_name specified in the class constructor.
      */
     void getFromRestart();
+
+    /*!
+     * Determine which transported quantities may be advanced together and
+     * register the packed variables used to advance each group.
+     */
+    void setupTransportedQuantityGroups();
+
+    /*!
+     * Setup the operators and solvers and compute the right-hand-side terms for
+     * a group of transported quantities.
+     */
+    void preprocessIntegrateGroup(unsigned int g, double current_time, double new_time, int num_cycles);
+
+    /*!
+     * Perform a single step of fixed point iteration for a group of
+     * transported quantities.
+     */
+    void integrateGroup(unsigned int g, double current_time, double new_time, int cycle_num);
+
+    /*!
+     * Whether to advance compatible transported quantities together.
+     */
+    bool d_group_compatible_quantities;
+
+    /*!
+     * Groups of transported quantities that are advanced together, along with
+     * the packed variables, vectors, operators, and solvers used for each
+     * group.
+     */
+    std::map<SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> >, unsigned int> d_Q_group_map;
+    std::vector<std::vector<SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > > > d_Q_groups;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > > d_group_var, d_group_rhs_var,
+        d_group_N_var;
+    std::vector<std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*> > d_group_bc_coef;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > > d_group_sol_vecs,
+        d_group_rhs_vecs;
+    std::vector<SAMRAI::tbox::Pointer<IBTK::PoissonSolver> > d_group_helmholtz_solvers;
+    std::vector<SAMRAI::tbox::Pointer<IBTK::LaplaceOperator> > d_group_helmholtz_rhs_ops;
+    std::vector<SAMRAI::tbox::Pointer<ConvectiveOperator> > d_group_convective_ops;
+    std::vector<bool> d_group_helmholtz_solvers_need_init, d_group_helmholtz_rhs_ops_need_init,
+        d_group_convective_ops_need_init;
 };
 } // namespace IBAMR
 
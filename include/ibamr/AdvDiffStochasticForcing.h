@@ -77,6 +77,11 @@ namespace IBAMR
 /*!
  * \brief Class AdvDiffStochasticForcing provides an interface for specifying a
  * stochastic forcing term for cell-centered advection-diffusion solver solver.
+ *
+ * If the input database sets use_counter_based_rng to TRUE, the random fluxes
+ * are drawn from the counter-based generator in class RNG rather than the
+ * Mersenne Twister generator, so that they do not depend on the parallel
+ * decomposition.
  */
 class AdvDiffStochasticForcing : public IBTK::CartGridFunction
 {
@@ -194,6 +199,14 @@ private:
      */
     double d_dirichlet_bc_scaling, d_neumann_bc_scaling;
 
+    /*!
+     * Whether to generate the random fluxes using the counter-based random
+     * number generator, and the key that distinguishes the random values
+     * generated by this object from those generated by other objects.
+     */
+    bool d_use_counter_based_rng;
+    unsigned int d_rng_key;
+
     /*!
      * VariableContext and Variable objects for storing the components of the
      * stochastic fluxes.
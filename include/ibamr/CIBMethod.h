@@ -396,6 +396,22 @@ public:
                                  double f_periodic_corr,
                                  const int managing_rank);
 
+    // \see CIBStrategy::applyMobilityOperator() method.
+    /*!
+     * \brief Apply the regularized mobility operator of the structures
+     * identified by their indices without forming a dense matrix.
+     */
+    void applyMobilityOperator(Vec F,
+                               Vec U,
+                               MobilityMatrixType mat_type,
+                               const std::vector<unsigned>& struct_ids,
+                               const double* grid_dx,
+                               const double* domain_extents,
+                               double rho,
+                               double mu,
+                               const std::pair<double, double>& scale,
+                               double f_periodic_corr);
+
     // \see CIBStrategy::constructGeometricMatrix() method.
     /*!
      * \brief Generate block-diagonal geometric matrix for the prototypical structures
@@ -525,6 +541,18 @@ private:
      */
     void setInitialLambda(const int level_number);
 
+    /*!
+     * \brief Get the PETSc indices of the nodes of the specified structures,
+     * in the order of the structure indices.
+     */
+    void getPETScNodeIndices(std::vector<int>& petsc_node_idxs, const std::vector<unsigned>& struct_ids);
+
+    /*!
+     * \brief Copy the values of a distributed vector at the specified nodes
+     * into an array on every processor.
+     */
+    void copyVecToAllArrays(Vec b, double* array, const std::vector<int>& petsc_node_idxs, const int data_depth);
+
 }; // CIBMethod
 } // namespace IBAMR
 
@@ -518,6 +518,44 @@ public:
                                          double f_periodic_corr,
                                          const int managing_rank);
 
+    /*!
+     * \brief Apply the regularized mobility operator of the structures
+     * identified by their indices to a Lagrange multiplier vector without
+     * forming a dense mobility matrix, i.e. compute
+     * \f$ U = (\alpha M + \beta W) F \f$, where \f$ W \f$ is the diagonal
+     * regularization used in constructMobilityMatrix(). The positions of the
+     * structures at the midpoint of the time step are used.
+     * \note A default implementation is provided in this class that results in
+     * an unrecoverable error. The derived class provides the actual
+     * implementation.
+     *
+     * \param F Vector of nodal forces (Lagrange multipliers) for all the
+     * structures.
+     *
+     * \param U Vector of nodal velocities for all the structures. Entries
+     * corresponding to structures not in \em struct_ids are left unchanged.
+     * Each processor evaluates the entries of \em U that it owns.
+     *
+     * \param mat_type Type of mobility operator (RPY or EMPIRICAL).
+     *
+     * \param struct_ids Indices of the structures as registered with
+     * \see IBAMR::IBStrategy class. The structures interact hydrodynamically
+     * with each other.
+     *
+     * \see constructMobilityMatrix() for the description of the remaining
+     * parameters.
+     */
+    virtual void applyMobilityOperator(Vec F,
+                                       Vec U,
+                                       MobilityMatrixType mat_type,
+                                       const std::vector<unsigned>& struct_ids,
+                                       const double* grid_dx,
+                                       const double* domain_extents,
+                                       double rho,
+                                       double mu,
+                                       const std::pair<double, double>& scale,
+                                       double f_periodic_corr);
+
     /*!
      * \brief Construct a geometric matrix for the prototypical structures
      * identified by their indices. A geometric matrix maps center of mass rigid
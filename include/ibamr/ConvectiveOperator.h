@@ -35,7 +35,9 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <stddef.h>
 #include <string>
+#include <vector>
 
 #include "ibamr/ibamr_enums.h"
 #include "ibtk/GeneralOperator.h"
@@ -138,6 +140,24 @@ protected:
      */
     int d_u_idx;
 
+    /*!
+     * \brief Prepare the scratch buffers that are used by the threads that
+     * compute the convective derivative on different patches concurrently.
+     *
+     * \note This function must be called outside of any parallel region before
+     * calling getThreadScratchBuffer().
+     */
+    void prepareThreadScratchBuffers();
+
+    /*!
+     * \brief Return the scratch buffer owned by the calling thread, resized if
+     * needed to hold at least the specified number of values.
+     *
+     * The buffers are kept between calls, so that they are allocated only when
+     * a patch is larger than any that the calling thread has seen before.
+     */
+    double* getThreadScratchBuffer(size_t size);
+
 private:
     /*!
      * \brief Default constructor.
@@ -165,6 +185,11 @@ private:
      * \return A reference to this object.
      */
     ConvectiveOperator& operator=(const ConvectiveOperator& that);
+
+    /*!
+     * Scratch buffers, indexed by thread number.
+     */
+    std::vector<std::vector<double> > d_thread_scratch_buffers;
 };
 } // namespace IBAMR
 
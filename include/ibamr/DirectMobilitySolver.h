@@ -253,10 +253,22 @@ private:
                               const std::string& mat_name,
                               const std::string& err_msg);
 
+    /*!
+     * \brief Determine which mobility matrices are identical to a previously
+     * registered matrix managed by the same processor, and therefore can share
+     * its factorizations.
+     *
+     * \note If the mobility matrices are not recomputed, the storage for the
+     * duplicate matrices is released.
+     */
+    void findSharedFactorizations();
+
     /*!
      * \brief Compute solution and store in the rhs vector.
+     *
+     * \param num_rhs Number of right-hand sides stored contiguously in \p rhs.
      */
-    void computeSolution(Mat& mat, const MobilityMatrixInverseType& inv_type, int* ipiv, double* rhs);
+    void computeSolution(Mat& mat, const MobilityMatrixInverseType& inv_type, int* ipiv, double* rhs, int num_rhs = 1);
 
     // Solver stuff
     std::string d_object_name;
@@ -278,6 +290,7 @@ private:
     std::map<std::string, std::pair<double, double> > d_mat_scale_map;
     std::map<std::string, std::string> d_mat_filename_map;
     std::map<std::string, std::pair<int*, int*> > d_ipiv_map; // permutation matrices for LU
+    std::map<std::string, std::string> d_mat_factorization_map; // handle of the matrix whose factors are used
 
     // PETSc representation of matrices.
     std::map<std::string, std::pair<Mat, Mat> > d_petsc_mat_map;
@@ -292,6 +305,8 @@ private:
     double d_f_periodic_corr;
     bool d_recompute_mob_mat;
     double d_svd_replace_value, d_svd_eps;
+    bool d_share_factorizations;
+    double d_share_factorizations_tol;
 
 }; // DirectMobilitySolver
 
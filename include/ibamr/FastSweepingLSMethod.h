@@ -45,17 +45,10 @@
 
 namespace SAMRAI
 {
-namespace pdat
-{
-template <int DIM, class TYPE>
-class CellData;
-} // namespace pdat
 namespace hier
 {
 template <int DIM>
 class Box;
-template <int DIM>
-class Patch;
 } // namespace hier
 } // namespace SAMRAI
 
@@ -73,6 +66,14 @@ namespace IBAMR
  * specified through input file. In presence of a physical domain wall, the distance function
  * at a grid point is D = min(distance from interface, distance from wall location).
  *
+ * \note Each outer iteration sweeps all local patches of the hierarchy
+ * independently (threaded over patches when OpenMP is enabled), exchanges ghost
+ * cell values, and checks the global change in the solution for convergence.
+ * If a positive narrow_band_width (in number of grid cells) is specified, patches
+ * whose values (including ghost cells) are all farther than this distance from
+ * the interface are not swept, so that only a band around the interface is
+ * reinitialized. Multi-box physical domains are supported.
+ *
  * References
  * Zhao, H., <A HREF="http://www.ams.org/journals/mcom/2005-74-250/S0025-5718-04-01678-3/">
  * A Fast Sweeping Method For Eikonal Equations</A>
@@ -105,6 +106,7 @@ protected:
     // Algorithm parameters.
     bool d_consider_phys_bdry_wall;
     int d_wall_location_idx[2 * NDIM];
+    double d_narrow_band_width;
 
 private:
     /*!
@@ -114,10 +116,17 @@ private:
 
     /*!
      * \brief Do one fast sweep over a patch.
+     *
+     * \note This routine only operates on raw data so that it can be safely
+     * called concurrently for different patches.
      */
-    void fastSweep(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > dist_data,
-                   const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
-                   const SAMRAI::hier::Box<NDIM>& domain_box) const;
+    void fastSweep(double* D,
+                   int D_ghosts,
+                   const SAMRAI::hier::Box<NDIM>& patch_box,
+                   const SAMRAI::hier::Box<NDIM>& domain_box,
+                   const double* dx,
+                   int patch_touches_bdry,
+                   const int* touches_wall_loc_idx) const;
 
     /*!
      * Read input values from a given database.
@@ -191,9 +191,21 @@ public:
 
     /*!
      * Regrid the hierarchy.
+     *
+     * \note When a displacement-driven regrid policy is enabled (i.e., when
+     * regrid_tag_buffer_fraction is positive) and the IB points have not moved
+     * far enough to leave the tagged region, only the Lagrangian data are
+     * redistributed.
      */
     void regridHierarchy();
 
+    /*!
+     * Redistribute the Lagrangian data among the patches of the existing patch
+     * hierarchy without regridding the hierarchy.  Marker particles, if any,
+     * are also reassigned to the patches that own them.
+     */
+    void redistributeLagrangianData();
+
 protected:
     /*!
      * The constructor for class IBHierarchyIntegrator sets some default values,
@@ -212,6 +224,24 @@ protected:
      */
     bool atRegridPointSpecialized() const;
 
+    /*!
+     * Return the displacement (in units of the grid spacing of the finest level
+     * of the patch hierarchy) that the IB points may undergo before the patch
+     * hierarchy must be regenerated under the displacement-driven regrid
+     * policy.
+     */
+    double getRegridDisplacementThreshold() const;
+
+    /*!
+     * Set the workload estimates used for load balancing.  The workload of
+     * each cell is one plus the weighted Lagrangian workload contributed by the
+     * IB method implementation.  When measured workload weights are enabled
+     * and update_workload_weight is true, the weight is first refit using the
+     * time spent in the Lagrangian and Eulerian phases of the time steps taken
+     * since the previous update.
+     */
+    void computeWorkloadEstimates(bool update_workload_weight);
+
     /*!
      * Initialize data after the entire hierarchy has been constructed.
      *
@@ -292,6 +322,20 @@ protected:
      */
     double d_regrid_cfl_interval, d_regrid_cfl_estimate;
 
+    /*
+     * When positive, the regrid tag buffer fraction enables a regrid policy
+     * driven by the measured displacement of the IB points.  The patch
+     * hierarchy is regenerated only once the accumulated point displacement
+     * exceeds the specified fraction of the tag buffer of the finest level;
+     * otherwise, the Lagrangian data are redistributed among the existing
+     * patches whenever the points have moved d_regrid_cfl_interval meshwidths
+     * (or half a meshwidth, if no CFL-based interval is specified).
+     *
+     * The displacement estimate is an upper bound on the displacement of any
+     * point since the last regrid.
+     */
+    double d_regrid_tag_buffer_fraction, d_regrid_displacement_estimate;
+
     /*
      * IB method implementation object.
      */
@@ -335,6 +379,19 @@ protected:
     SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > d_workload_var;
     int d_workload_idx;
 
+    /*
+     * The Lagrangian workload weight is the cost of one unit of Lagrangian
+     * workload (e.g., one IB point or one FE quadrature point) relative to the
+     * cost of one Cartesian grid cell.  When measured workload weights are
+     * enabled, the weight is fit to the measured time spent computing,
+     * spreading, and interpolating Lagrangian quantities and to the time spent
+     * solving the fluid equations, and it is smoothed by an exponential moving
+     * average.  The accumulated times record the totals at the last update.
+     */
+    bool d_use_measured_workload_weights;
+    double d_lag_workload_weight, d_workload_weight_smoothing;
+    double d_eul_work_time, d_lag_work_time;
+
     /*
      * Lagrangian marker data structures.
      */
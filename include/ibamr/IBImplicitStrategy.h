@@ -133,6 +133,11 @@ public:
 
     /*!
      * Construct the linearized Lagrangian force Jacobian.
+     *
+     * \note On return, \a A holds a new reference to a matrix that may be
+     * cached and reused by the implementation, and the caller must release that
+     * reference with MatDestroy() once it is done with the matrix.  If \a A is
+     * non-NULL on entry, the reference it holds is released first.
      */
     virtual void constructLagrangianForceJacobian(Mat& A, MatType mat_type, double data_time) = 0;
 
@@ -160,6 +160,48 @@ public:
                                                 double data_time,
                                                 IBTK::LDataManager* l_data_manager);
 
+    /*!
+     * \brief Prepare to compute the action of the Jacobian of the force with
+     * respect to the specified structure configuration and velocity.
+     *
+     * Implementations may cache data that depend only on the configuration
+     * (e.g., the Jacobian blocks of the individual force elements), so that
+     * applyLagrangianForceJacobian() need not recompute them for every
+     * matrix-vector product.  This function must be called again whenever the
+     * configuration changes.
+     *
+     * \note A default implementation is provided that does nothing.
+     */
+    virtual void setupLagrangianForceJacobian(double X_coef,
+                                              SAMRAI::tbox::Pointer<IBTK::LData> X_data,
+                                              double U_coef,
+                                              SAMRAI::tbox::Pointer<IBTK::LData> U_data,
+                                              SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                                              int level_number,
+                                              double data_time,
+                                              IBTK::LDataManager* l_data_manager);
+
+    /*!
+     * \brief Compute the action of the Jacobian of the force with respect to
+     * the present structure configuration and velocity on the vector V,
+     * without forming the Jacobian matrix.
+     *
+     * \note The product J*V should be \em added to the force vector.
+     *
+     * \note A default implementation is provided that results in an assertion
+     * failure.
+     */
+    virtual void applyLagrangianForceJacobian(SAMRAI::tbox::Pointer<IBTK::LData> F_data,
+                                              SAMRAI::tbox::Pointer<IBTK::LData> V_data,
+                                              double X_coef,
+                                              SAMRAI::tbox::Pointer<IBTK::LData> X_data,
+                                              double U_coef,
+                                              SAMRAI::tbox::Pointer<IBTK::LData> U_data,
+                                              SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                                              int level_number,
+                                              double data_time,
+                                              IBTK::LDataManager* l_data_manager);
+
     /*!
      * \brief Compute the potential energy with respect to the present structure
      * configuration and velocity.
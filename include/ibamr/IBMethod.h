@@ -275,6 +275,11 @@ public:
 
     /*!
      * Construct the linearized Lagrangian force Jacobian.
+     *
+     * \note On return, \a A holds a new reference to a matrix that may be
+     * cached and reused by the implementation, and the caller must release that
+     * reference with MatDestroy() once it is done with the matrix.  If \a A is
+     * non-NULL on entry, the reference it holds is released first.
      */
     void constructLagrangianForceJacobian(Mat& A, MatType mat_type, double data_time);
 
@@ -300,6 +305,12 @@ public:
 
     /*!
      * Construct the IB interpolation operator.
+     *
+     * \note The operator is cached between calls.  If the DOF indexing and
+     * the stencil boxes of all IB points are unchanged, only the coefficients
+     * associated with IB points that have moved are recomputed.  The returned
+     * matrix holds a reference to the cached operator, and should be destroyed
+     * by the caller once it is no longer needed.
      */
     void constructInterpOp(Mat& J,
                            void (*spread_fnc)(const double, double*),
@@ -390,6 +401,13 @@ public:
     void endDataRedistribution(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                                SAMRAI::tbox::Pointer<SAMRAI::mesh::GriddingAlgorithm<NDIM> > gridding_alg);
 
+    /*!
+     * Return the maximum displacement of any IB point in any coordinate
+     * direction since the Lagrangian data were last redistributed, in units of
+     * the grid spacing of the level on which the point is stored.
+     */
+    double getMaxPointDisplacement() const;
+
     /*!
      * Initialize data on a new level after it is inserted into an AMR patch
      * hierarchy by the gridding algorithm.
@@ -496,6 +514,14 @@ protected:
 
     PetscErrorCode computeForce(Vec X, Vec F);
 
+    /*
+     * PETSc function for applying the Lagrangian force Jacobian without
+     * forming the matrix.
+     */
+    static PetscErrorCode applyForceJacobian_SAMRAI(Mat A, Vec V, Vec F);
+
+    PetscErrorCode applyForceJacobian(Vec V, Vec F);
+
     /*
      * Indicates whether the integrator should output logging messages.
      */
@@ -528,6 +554,7 @@ protected:
     IBTK::LDataManager* d_l_data_manager;
     std::string d_interp_kernel_fcn, d_spread_kernel_fcn;
     bool d_error_if_points_leave_domain;
+    bool d_use_morton_node_ordering;
     SAMRAI::hier::IntVector<NDIM> d_ghosts;
 
     /*
@@ -546,6 +573,12 @@ protected:
      */
     std::vector<std::set<int> > d_anchor_point_local_idxs;
 
+    /*
+     * Local IB point positions at the time the Lagrangian data were last
+     * redistributed.  These are used to measure point displacements.
+     */
+    std::vector<std::vector<double> > d_X_redistribution_data;
+
     /*
      * Instrumentation (flow meter and pressure gauge) algorithms and data
      * structures.
@@ -659,11 +692,27 @@ private:
     void getFromRestart();
 
     /*!
-     * Jacobian data.
+     * Jacobian data.  The Jacobian matrices and their non-zero structures are
+     * reused until the Lagrangian data are redistributed, so that subsequent
+     * evaluations only refresh the matrix values.
      */
-    bool d_force_jac_mffd;
+    bool d_force_jac_mffd, d_force_jac_matrix_free;
     Mat d_force_jac;
     double d_force_jac_data_time;
+    Mat d_assembled_force_jac;
+    std::string d_assembled_force_jac_type;
+
+    /*!
+     * Cached IB interpolation operator.  The matrix is updated in place when
+     * the IB points move within their current interpolation stencils and is
+     * reconstructed when the nonzero structure changes or following a regrid.
+     */
+    Mat d_interp_op;
+    void (*d_interp_op_fcn)(double r_lower, double* w);
+    int d_interp_op_stencil, d_interp_op_dof_index_idx;
+    std::vector<int> d_interp_op_num_dofs_per_proc;
+    std::vector<double> d_interp_op_X;
+    bool d_interp_op_needs_rebuild;
 };
 } // namespace IBAMR
 
@@ -33,6 +33,10 @@
 #ifndef included_IBAMR_IBSpringForceFunctions
 #define included_IBAMR_IBSpringForceFunctions
 
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <algorithm>
+
 /////////////////////////////// CLASS DEFINITION /////////////////////////////
 
 namespace IBAMR
@@ -65,6 +69,32 @@ typedef double (*SpringForceFcnPtr)(double R, const double* params, int lag_mast
  */
 typedef double (*SpringForceDerivFcnPtr)(double R, const double* params, int lag_mastr_idx, int lag_slave_idx);
 
+/*!
+ * \brief Typedef specifying the batched spring force function API.
+ *
+ * Batched force functions compute the (undirected) "tension" forces generated
+ * by a contiguous batch of springs that share the same force function.
+ *
+ * \param n              The number of springs in the batch.
+ * \param R              The lengths of the springs.
+ * \param params         The constitutive parameters of the springs.
+ * \param lag_mastr_idxs The Lagrangian indices of the "master" nodes associated with the springs.
+ * \param lag_slave_idxs The Lagrangian indices of the "slave" nodes associated with the springs.
+ * \param T              The tension forces generated by the springs (output).
+ *
+ * \note Springs of zero length may be included in a batch.  The tensions
+ * computed for such springs are ignored.
+ *
+ * \note Batched force functions may be called concurrently from multiple
+ * threads on disjoint batches of springs.
+ */
+typedef void (*SpringForceBatchFcnPtr)(int n,
+                                       const double* R,
+                                       const double* const* params,
+                                       const int* lag_mastr_idxs,
+                                       const int* lag_slave_idxs,
+                                       double* T);
+
 /*!
  * \brief Function to compute the (undirected) "tension" force generated by a
  * Hookean spring with either a zero or a non-zero resting length.
@@ -130,6 +160,38 @@ default_spring_force_deriv(double /*R*/, const double* params, int /*lag_mastr_i
     return params[0];
 } // default_spring_force_deriv
 
+/*!
+ * \brief Batched version of default_spring_force().
+ *
+ * The constitutive parameters are gathered into contiguous arrays so that the
+ * tension computation may be vectorized by the compiler.
+ */
+inline void
+default_spring_force_batch(const int n,
+                           const double* const R,
+                           const double* const* const params,
+                           const int* /*lag_mastr_idxs*/,
+                           const int* /*lag_slave_idxs*/,
+                           double* const T)
+{
+    static const int BATCH_SIZE = 64;
+    double kappa[BATCH_SIZE], rest_length[BATCH_SIZE];
+    for (int offset = 0; offset < n; offset += BATCH_SIZE)
+    {
+        const int m = std::min(BATCH_SIZE, n - offset);
+        for (int k = 0; k < m; ++k)
+        {
+            kappa[k] = params[offset + k][0];
+            rest_length[k] = params[offset + k][1];
+        }
+        for (int k = 0; k < m; ++k)
+        {
+            T[offset + k] = kappa[k] * (R[offset + k] - rest_length[k]);
+        }
+    }
+    return;
+} // default_spring_force_batch
+
 } // namespace IBAMR
 
 //////////////////////////////////////////////////////////////////////////////
@@ -79,6 +79,12 @@ namespace IBAMR
  * force function with any function that implements the interface required by
  * registerSpringForceFunction().  Users may also specify additional force
  * functions that may be associated with arbitrary integer indices.
+ *
+ * \note When IBAMR is compiled with OpenMP, the forces and their Jacobians may
+ * be computed by multiple threads by setting the input database key \p
+ * use_threaded_force_evaluation to TRUE.  Threading is disabled by default
+ * because the registered force functions are then called concurrently, and so
+ * must be thread safe.
  */
 class IBStandardForceGen : public IBLagrangianForceStrategy
 {
@@ -102,12 +108,21 @@ public:
      * particular spring for the specified displacement, spring constant, rest
      * length, and Lagrangian index.
      *
+     * An optional batched force function may also be provided.  When
+     * available, it is used in place of \a spring_force_fcn_ptr to compute the
+     * forces generated by batches of springs that share the same force
+     * function.
+     *
      * \note By default, function default_linear_spring_force() is associated
      * with \a force_fcn_idx 0.
+     *
+     * \note Spring forces are computed concurrently when OpenMP is enabled, so
+     * spring force functions must be thread safe.
      */
     void registerSpringForceFunction(int force_fcn_index,
                                      const SpringForceFcnPtr spring_force_fcn_ptr,
-                                     const SpringForceDerivFcnPtr spring_force_deriv_fcn_ptr = NULL);
+                                     const SpringForceDerivFcnPtr spring_force_deriv_fcn_ptr = NULL,
+                                     const SpringForceBatchFcnPtr spring_force_batch_fcn_ptr = NULL);
 
     /*!
      * \brief Setup the data needed to compute the forces on the specified level
@@ -164,6 +179,40 @@ public:
                                         double data_time,
                                         IBTK::LDataManager* l_data_manager);
 
+    /*!
+     * \brief Prepare to compute the action of the Jacobian of the force with
+     * respect to the specified structure configuration and velocity.
+     *
+     * The spring Jacobian blocks are computed here and are reused by
+     * applyLagrangianForceJacobian() until the configuration changes.
+     */
+    void setupLagrangianForceJacobian(double X_coef,
+                                      SAMRAI::tbox::Pointer<IBTK::LData> X_data,
+                                      double U_coef,
+                                      SAMRAI::tbox::Pointer<IBTK::LData> U_data,
+                                      SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                                      int level_number,
+                                      double data_time,
+                                      IBTK::LDataManager* l_data_manager);
+
+    /*!
+     * \brief Compute the action of the Jacobian of the force with respect to
+     * the present structure configuration and velocity on the vector V, without
+     * forming the Jacobian matrix.
+     *
+     * \note The product J*V is \em added to the force vector.
+     */
+    void applyLagrangianForceJacobian(SAMRAI::tbox::Pointer<IBTK::LData> F_data,
+                                      SAMRAI::tbox::Pointer<IBTK::LData> V_data,
+                                      double X_coef,
+                                      SAMRAI::tbox::Pointer<IBTK::LData> X_data,
+                                      double U_coef,
+                                      SAMRAI::tbox::Pointer<IBTK::LData> U_data,
+                                      SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                                      int level_number,
+                                      double data_time,
+                                      IBTK::LDataManager* l_data_manager);
+
     /*!
      * \brief Compute the potential energy with respect to the present structure
      * configuration and velocity.
@@ -205,9 +254,27 @@ private:
         std::vector<int> lag_mastr_node_idxs, lag_slave_node_idxs;
         std::vector<int> petsc_mastr_node_idxs, petsc_slave_node_idxs;
         std::vector<int> petsc_global_mastr_node_idxs, petsc_global_slave_node_idxs;
+        std::vector<int> force_fcn_idxs;
         std::vector<SpringForceFcnPtr> force_fcns;
         std::vector<SpringForceDerivFcnPtr> force_deriv_fcns;
         std::vector<const double*> parameters;
+
+        // Springs are sorted by color so that springs of the same color do not
+        // share nodes, and, within each color, by force function.  Springs
+        // are processed in batches of springs with the same color and force
+        // function.
+        struct Batch
+        {
+            int begin, end;
+            SpringForceFcnPtr force_fcn;
+            SpringForceBatchFcnPtr force_batch_fcn;
+        };
+        std::vector<Batch> batches;
+        std::vector<int> color_batch_offsets;
+
+        // The NDIM x NDIM blocks of the Jacobian of the spring forces, stored
+        // contiguously and in the same order as the springs.
+        std::vector<double> jac_blocks;
     };
     std::vector<SpringData> d_spring_data;
 
@@ -217,6 +284,10 @@ private:
         std::vector<int> petsc_global_mastr_node_idxs, petsc_global_next_node_idxs, petsc_global_prev_node_idxs;
         std::vector<const double*> rigidities;
         std::vector<const IBTK::Vector*> curvatures;
+
+        // Beams are sorted by color so that beams of the same color do not
+        // share nodes.
+        std::vector<int> color_offsets;
     };
     std::vector<BeamData> d_beam_data;
 
@@ -228,8 +299,21 @@ private:
     };
     std::vector<TargetPointData> d_target_point_data;
 
-    std::vector<SAMRAI::tbox::Pointer<IBTK::LData> > d_X_ghost_data, d_F_ghost_data, d_dX_data;
+    std::vector<SAMRAI::tbox::Pointer<IBTK::LData> > d_X_ghost_data, d_F_ghost_data, d_V_ghost_data, d_dX_data;
     std::vector<bool> d_is_initialized;
+
+    // The non-zero structure of the force Jacobian depends only on the
+    // connectivity of the force elements and is cached until the level data
+    // are reinitialized.
+    std::vector<std::vector<int> > d_jac_d_nnz, d_jac_o_nnz;
+    std::vector<bool> d_jac_nnz_is_cached;
+
+    // The configuration (and coefficient) passed to
+    // setupLagrangianForceJacobian(), for which the cached spring Jacobian
+    // blocks are valid.  Matrix-free Jacobian products at that configuration
+    // reuse the blocks instead of recomputing them.
+    std::vector<const IBTK::LData*> d_jac_blocks_X_data;
+    std::vector<double> d_jac_blocks_X_coef;
     //\}
 
     /*!
@@ -241,6 +325,8 @@ private:
                                    double init_data_time,
                                    bool initial_time,
                                    IBTK::LDataManager* l_data_manager);
+    void setupSpringBatches(int level_number);
+    void computeSpringJacobianBlocks(double X_coef, SAMRAI::tbox::Pointer<IBTK::LData> X_data, int level_number);
     void computeLagrangianSpringForce(SAMRAI::tbox::Pointer<IBTK::LData> F_data,
                                       SAMRAI::tbox::Pointer<IBTK::LData> X_data,
                                       SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
@@ -257,6 +343,7 @@ private:
                                  double init_data_time,
                                  bool initial_time,
                                  IBTK::LDataManager* l_data_manager);
+    void setupBeamColors(int level_number);
     void computeLagrangianBeamForce(SAMRAI::tbox::Pointer<IBTK::LData> F_data,
                                     SAMRAI::tbox::Pointer<IBTK::LData> X_data,
                                     SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
@@ -286,11 +373,18 @@ private:
      */
     std::map<int, SpringForceFcnPtr> d_spring_force_fcn_map;
     std::map<int, SpringForceDerivFcnPtr> d_spring_force_deriv_fcn_map;
+    std::map<int, SpringForceBatchFcnPtr> d_spring_force_batch_fcn_map;
 
     /*!
      * \brief Logging settings.
      */
     bool d_log_target_point_displacements;
+
+    /*!
+     * \brief Whether to compute the forces and their Jacobians using multiple
+     * threads.
+     */
+    bool d_use_threaded_force_evaluation;
 };
 } // namespace IBAMR
 
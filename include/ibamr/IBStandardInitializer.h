@@ -422,6 +422,54 @@ namespace IBAMR
  D2_x_2   D2_y_2   D2_z_2  # coordinates of director D2 associated with vertex 2
  ...
  \endverbatim
+ *
+ * <HR>
+ *
+ * <B>Binary file format</B>
+ *
+ * For very large structures, vertex, spring, beam, and target point data may
+ * instead be read from binary files, which are enabled by setting the input
+ * database entry <TT>use_binary_files = TRUE</TT>.  The binary counterpart of
+ * an ASCII input file has the extension <TT>".bin"</TT> appended to the
+ * ASCII filename, e.g., <TT>"heart.vertex.bin"</TT> or
+ * <TT>"heart.spring.bin"</TT>.  All other input files are always read in ASCII
+ * format.  Binary files may be generated from existing ASCII input files by
+ * convertASCIIToBinary(), or by setting <TT>convert_ascii_to_binary =
+ * TRUE</TT> together with <TT>use_binary_files = TRUE</TT>, in which case the
+ * ASCII files are converted by MPI process 0 when the initializer is
+ * initialized.
+ *
+ * Each binary file consists of a header followed by a sequence of records.
+ * All values are stored in native byte order; an integer check value in the
+ * header is used to detect files generated on machines with a different byte
+ * order.  The header is:
+ \verbatim
+ char[8]   "IBAMRSTR"
+ int       format version
+ int       file type (0 = vertex, 1 = spring, 2 = beam, 3 = target point)
+ int       spatial dimension
+ int       byte order check value
+ int       number of records
+ \endverbatim
+ * and the records are:
+ \verbatim
+ vertex:        double X[NDIM]
+ spring:        int i, int j, int fcn_idx, int num_params, double params[num_params]
+ beam:          int i, int j, int k, double bend, double curvature[NDIM]
+ target point:  int i, double kappa, double eta
+ \endverbatim
+ * Record values have the same meanings as the corresponding values in the
+ * ASCII input files.  Spring records always include the spring constant and
+ * rest length as the first two parameters.
+ *
+ * If <TT>distribute_binary_force_specs = TRUE</TT>, the spring, beam, and
+ * target point data are not read when the initializer is initialized.
+ * Instead, these data are read when each level of the patch hierarchy is
+ * initialized, and each MPI process keeps only the specifications associated
+ * with the vertices that it owns in the initial distribution of the Lagrangian
+ * data.  In this case, the spring connectivity of the entire structure is
+ * retained only if an LSiloDataWriter has been registered with the
+ * initializer.
 */
 class IBStandardInitializer : public IBAMR::IBRedundantInitializer
 {
@@ -441,6 +489,37 @@ public:
      */
     void init();
 
+    /*!
+     * \brief Initialize the LNode and LData data needed to specify the
+     * configuration of the curvilinear mesh on the patch level.
+     *
+     * \note If binary force specifications are distributed, the force
+     * specifications associated with the local vertices are read from the
+     * binary input files before the level data are initialized.
+     *
+     * \return The number of local nodes initialized on the patch level.
+     */
+    unsigned int initializeDataOnPatchLevel(int lag_node_index_idx,
+                                            unsigned int global_index_offset,
+                                            unsigned int local_index_offset,
+                                            SAMRAI::tbox::Pointer<IBTK::LData> X_data,
+                                            SAMRAI::tbox::Pointer<IBTK::LData> U_data,
+                                            SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                                            int level_number,
+                                            double init_data_time,
+                                            bool can_be_refined,
+                                            bool initial_time,
+                                            IBTK::LDataManager* l_data_manager);
+
+    /*!
+     * \brief Convert the ASCII vertex, spring, beam, and target point input
+     * files associated with the specified structure into binary input files.
+     *
+     * The vertex file is required.  Spring, beam, and target point files are
+     * converted only if they exist.
+     */
+    static void convertASCIIToBinary(const std::string& base_filename);
+
 protected:
 private:
     /*!
@@ -526,6 +605,38 @@ private:
      */
     void readSourceFiles(const std::string& file_extension);
 
+    /*!
+     * \brief Read the vertex data from one or more binary input files.
+     */
+    void readBinaryVertexFiles(const std::string& extension);
+
+    /*!
+     * \brief Read the spring, beam, and target point data on the specified
+     * level from binary input files.
+     *
+     * If a vertex mask is provided, only the specifications whose master
+     * vertex is marked in the mask are kept.
+     */
+    void readBinaryForceSpecFiles(int level_number, const std::vector<bool>* local_vertex_mask);
+
+    /*!
+     * \brief Read the spring data for the specified structure from a binary
+     * input file.
+     */
+    void readBinarySpringFile(int level_number, unsigned int j, const std::vector<bool>* local_vertex_mask);
+
+    /*!
+     * \brief Read the beam data for the specified structure from a binary
+     * input file.
+     */
+    void readBinaryBeamFile(int level_number, unsigned int j, const std::vector<bool>* local_vertex_mask);
+
+    /*!
+     * \brief Read the target point data for the specified structure from a
+     * binary input file.
+     */
+    void readBinaryTargetPointFile(int level_number, unsigned int j, const std::vector<bool>* local_vertex_mask);
+
     /*!
      * \return The specification objects associated with the specified vertex.
      */
@@ -553,6 +664,17 @@ private:
      */
     bool d_use_file_batons;
 
+    /*
+     * Boolean values indicating whether vertex, spring, beam, and target point
+     * data are read from binary input files, whether ASCII input files are
+     * first converted into binary input files, and whether the force
+     * specifications read from binary input files are distributed among the
+     * MPI processes.
+     */
+    bool d_use_binary_files;
+    bool d_convert_ascii_to_binary;
+    bool d_distribute_binary_force_specs;
+
     /*
      * The maximum number of levels in the Cartesian grid patch hierarchy and a
      * vector of boolean values indicating whether a particular level has been
@@ -372,6 +372,19 @@ public:
     virtual void endDataRedistribution(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                                        SAMRAI::tbox::Pointer<SAMRAI::mesh::GriddingAlgorithm<NDIM> > gridding_alg);
 
+    /*!
+     * Return the maximum displacement of any Lagrangian point in any
+     * coordinate direction since the Lagrangian data were last redistributed,
+     * measured in units of the grid spacing of the level on which the point is
+     * stored.  A negative value indicates that the displacement is not tracked
+     * by the implementation.
+     *
+     * A default implementation is provided that returns -1.0.
+     *
+     * \note This is a collective operation.
+     */
+    virtual double getMaxPointDisplacement() const;
+
     /*!
      * Initialize data on a new level after it is inserted into an AMR patch
      * hierarchy by the gridding algorithm.
@@ -357,6 +357,15 @@ private:
     SAMRAI::tbox::Pointer<StaggeredStokesSolver> d_stokes_solver;
     bool d_stokes_solver_needs_init;
 
+    /*!
+     * Data used to refresh the numerical values used by the solvers without
+     * rebuilding their structural data when only the time step size or the
+     * fluid coefficients change.
+     */
+    bool d_reuse_solver_structure;
+    bool d_velocity_solver_needs_reinit, d_pressure_solver_needs_reinit, d_stokes_solver_needs_reinit;
+    double d_solver_rho, d_solver_mu, d_solver_lambda;
+
     /*!
      * Fluid solver variables.
      */
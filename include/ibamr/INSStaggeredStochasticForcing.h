@@ -78,6 +78,11 @@ namespace IBAMR
  * \brief Class INSStaggeredStochasticForcing provides an interface for
  * specifying a stochastic forcing term for a staggered-grid incompressible
  * Navier-Stokes solver.
+ *
+ * Setting use_counter_based_rng to TRUE in the input database generates the
+ * random stresses with the counter-based generator in class RNG instead of the
+ * Mersenne Twister generator, which makes them independent of the patch
+ * layout and the number of processes.
  */
 class INSStaggeredStochasticForcing : public IBTK::CartGridFunction
 {
@@ -189,6 +194,14 @@ private:
      */
     double d_velocity_bc_scaling, d_traction_bc_scaling;
 
+    /*!
+     * Whether to generate the random stresses using the counter-based random
+     * number generator, and the key that distinguishes the random values
+     * generated by this object from those generated by other objects.
+     */
+    bool d_use_counter_based_rng;
+    unsigned int d_rng_key;
+
     /*!
      * VariableContext and Variable objects for storing the components of the
      * stochastic stresses.
@@ -40,6 +40,7 @@
 #include "PoissonSpecifications.h"
 #include "RobinBcCoefStrategy.h"
 #include "SAMRAIVectorReal.h"
+#include "ibamr/ibamr_enums.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "petscksp.h"
 #include "tbox/Database.h"
@@ -71,6 +72,13 @@ namespace IBAMR
  * operator, \f$ L \f$ is the Stokes operator, and \f$ S \f$ is the spreading
  * operator.
  *
+ * When pc_type is set to "shell", the system is preconditioned by an
+ * approximate inverse of the free-space mobility operator (RPY or EMPIRICAL,
+ * selected by pc_mobility_type). The preconditioner is applied matrix-free
+ * through CIBStrategy::applyMobilityOperator() and inverted inexactly with a
+ * few CG iterations (pc_max_iterations, pc_rel_residual_tol). Since the
+ * preconditioner is then not a fixed linear operator, a flexible outer Krylov
+ * method (e.g. fgmres) should be used.
  */
 class KrylovMobilitySolver : public SAMRAI::tbox::DescribedClass
 {
@@ -288,6 +296,12 @@ private:
      */
     static PetscErrorCode PCApply_KMInv(PC pc, Vec x, Vec y);
 
+    /*!
+     * \brief Compute the matrix vector product with the approximate mobility
+     * operator used in the preconditioner.
+     */
+    static PetscErrorCode MatVecMult_PC(Mat A, Vec x, Vec y);
+
     /*!
      * \brief Set KSP monitoring routine for the KSP.
      */
@@ -305,6 +319,15 @@ private:
     KSP d_petsc_ksp;
     Mat d_petsc_mat;
 
+    // Matrix-free approximate mobility operator and its inexact solver used in
+    // the shell preconditioner.
+    KSP d_pc_ksp;
+    Mat d_pc_mat;
+    MobilityMatrixType d_pc_mobility_type;
+    int d_pc_max_iterations;
+    double d_pc_rel_residual_tol;
+    double d_f_periodic_corr;
+
     // Linear operator.
     std::vector<SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, PetscScalar> > > d_samrai_temp;
     SAMRAI::tbox::Pointer<IBAMR::INSStaggeredHierarchyIntegrator> d_ins_integrator;
@@ -114,6 +114,74 @@ public:
                                            const int num_nodes,
                                            const double periodic_correction,
                                            double* mm);
+
+    /*!
+     * \brief Apply the empirical mobility operator to a vector of nodal forces
+     * without forming the dense mobility matrix, i.e. compute the specified
+     * rows of \f$ U = M F \f$.
+     *
+     * The pairwise interactions are summed directly, so the cost is
+     * \f$ O(N) \f$ per row but the memory footprint is only \f$ O(N) \f$. The
+     * summation is threaded over the rows when OpenMP is enabled.
+     *
+     * \param F Array of nodal forces of size num_nodes*NDIM.
+     *
+     * \param rows Indices of the nodes at which the velocities are evaluated.
+     *
+     * \param num_rows Number of entries of \a rows.
+     *
+     * \param U Array of nodal velocities of size num_rows*NDIM, in the order of
+     * \a rows.
+     *
+     * \see constructEmpiricalMobilityMatrix() for the description of the
+     * remaining parameters.
+     */
+    static void applyEmpiricalMobilityOperator(const char* kernel_name,
+                                               const double mu,
+                                               const double rho,
+                                               const double dt,
+                                               const double dx,
+                                               const double* X,
+                                               const int num_nodes,
+                                               const int reset_constants,
+                                               const double periodic_correction,
+                                               const double l_domain,
+                                               const double* F,
+                                               const int* rows,
+                                               const int num_rows,
+                                               double* U);
+
+    /*!
+     * \brief Apply the Rotne-Pragner-Yamakawa mobility operator to a vector of
+     * nodal forces without forming the dense mobility matrix, i.e. compute the
+     * specified rows of \f$ U = M F \f$.
+     *
+     * The pairwise interactions are summed directly, so the cost is
+     * \f$ O(N) \f$ per row but the memory footprint is only \f$ O(N) \f$. The
+     * summation is threaded over the rows when OpenMP is enabled.
+     *
+     * \param F Array of nodal forces of size num_nodes*NDIM.
+     *
+     * \param rows Indices of the nodes at which the velocities are evaluated.
+     *
+     * \param num_rows Number of entries of \a rows.
+     *
+     * \param U Array of nodal velocities of size num_rows*NDIM, in the order of
+     * \a rows.
+     *
+     * \see constructRPYMobilityMatrix() for the description of the remaining
+     * parameters.
+     */
+    static void applyRPYMobilityOperator(const char* kernel_name,
+                                         const double mu,
+                                         const double dx,
+                                         const double* X,
+                                         const int num_nodes,
+                                         const double periodic_correction,
+                                         const double* F,
+                                         const int* rows,
+                                         const int num_rows,
+                                         double* U);
 }; // MobilityFunctions
 
 } // namespace IBAMR
@@ -35,9 +35,12 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <vector>
+
 #include "tbox/Array.h"
 #include "ibtk/LData.h"
 #include "ibtk/LDataManager.h"
+#include "ibtk/LMesh.h"
 #include "ibamr/IBLagrangianForceStrategy.h"
 #include "muParser.h"
 
@@ -45,6 +48,34 @@
 
 namespace IBAMR
 {
+/*!
+ * \brief Class NonbondedForceEvaluator computes pairwise (nonbonded) forces
+ * between all Lagrangian nodes that are within a specified interaction radius
+ * of each other.
+ *
+ * Interacting pairs are determined using a Verlet neighbor list that includes
+ * all pairs within a distance of interaction_radius + 2 * regrid_alpha grid
+ * cells.  The list is built using a cell list over the nodes of each patch
+ * (including periodic images in the patch ghost cell region), and it is reused
+ * until the data are redistributed or some node has moved more than
+ * regrid_alpha grid cells since the list was built.  The force function is
+ * evaluated for all pairs in the list, and it is responsible for applying any
+ * cutoff.  Pairs of nodes that are owned by the same patch
+ * are evaluated once and Newton's third law is used to update both nodes;
+ * pairs that involve a node in the ghost cell region of a patch are evaluated
+ * by each of the patches that own the nodes, and only the owned node is
+ * updated.  When IBAMR is compiled with OpenMP, the pair loop is threaded.
+ *
+ * Input database keys:
+ *  - \p interaction_radius: the interaction radius, in units of the grid
+ *    spacing of the level
+ *  - \p regrid_alpha: the distance, in units of the grid spacing of the
+ *    level, that nodes may move before the neighbor list is rebuilt
+ *  - \p parameters: the parameters passed to the force function
+ *
+ * \note interaction_radius + 2 * regrid_alpha should not exceed the width of
+ * the ghost cell region of the Lagrangian index data.
+ */
 class NonbondedForceEvaluator : public IBLagrangianForceStrategy
 {
 public:
@@ -61,7 +92,11 @@ public:
     NonbondedForceEvaluator(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db,
                             SAMRAI::tbox::Pointer<SAMRAI::geom::CartesianGridGeometry<NDIM> > grid_geometry);
 
-    // Function to evaluate forces.
+    // Add the force between the nodes at mstr_petsc_idx and search_petsc_idx to
+    // F_data.  cell_offset is the periodic offset of the search node in units
+    // of the extents of the physical domain.  The pair is evaluated in the same
+    // way as the pairs in the neighbor list used by computeLagrangianForce(),
+    // and only locally owned nodes are updated.
     void evaluateForces(int mstr_petsc_idx,
                         int search_petsc_idx,
                         SAMRAI::tbox::Pointer<IBTK::LData> X_data,
@@ -102,6 +137,33 @@ private:
     // parameters for force function:
     SAMRAI::tbox::Array<double> d_parameters;
 
+    // Determine whether the neighbor list must be rebuilt.
+    bool neighborListNeedsRebuild(const double* X_node,
+                                  int num_nodes,
+                                  int level_number,
+                                  IBTK::LDataManager* l_data_manager) const;
+
+    // Rebuild the neighbor list from the nodes in the patches of the level.
+    void buildNeighborList(const double* X_node,
+                           int num_nodes,
+                           SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                           int level_number,
+                           IBTK::LDataManager* l_data_manager);
+
+    // Neighbor list data: the mesh and level number for which the list was
+    // built, the node positions at the time the list was built, the distance
+    // that nodes may move before the list must be rebuilt, the pairs of
+    // local PETSc indices of nodes that are both updated, and the pairs (along
+    // with the periodic shift of the second node) for which only the first node
+    // is updated.
+    SAMRAI::tbox::Pointer<IBTK::LMesh> d_neighbor_list_mesh;
+    int d_neighbor_list_level_number;
+    std::vector<double> d_neighbor_list_X;
+    double d_neighbor_list_max_displacement;
+    std::vector<int> d_full_pairs;
+    std::vector<int> d_half_pairs;
+    std::vector<double> d_half_pair_shifts;
+
     // grid geometry
     SAMRAI::tbox::Pointer<SAMRAI::geom::CartesianGridGeometry<NDIM> > d_grid_geometry;
 
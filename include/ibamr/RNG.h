@@ -1,11 +1,28 @@
 #ifndef included_IBAMR_RNG
 #define included_IBAMR_RNG
 
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <string>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
 namespace IBAMR
 {
 /*!
  * \brief Class RNG organizes functions that provide random-number generator
  * functionality.
+ *
+ * Two generators are provided.  The Mersenne Twister generator (srandgen(),
+ * genrand(), and genrandn(double*)) is seeded differently on each MPI process
+ * by parallel_seed(), so the values that it produces depend on the patch
+ * layout and the number of processes.  The Philox4x32-10 counter-based
+ * generator (philox4x32() and genrandn(double*, const unsigned int*, const
+ * unsigned int*)) is stateless: each value is a pure function of a counter
+ * and a key.  Keying it on the global seed (getGlobalSeed()), an object name
+ * (hash_object_name()), and the time step number, and counting by stream
+ * (rng_stream()) and grid index, makes the values independent of the parallel
+ * decomposition.
  */
 class RNG
 {
@@ -18,6 +35,50 @@ public:
 
     static void parallel_seed(int global_seed);
 
+    /*!
+     * \brief Return the global seed used by the most recent call to
+     * parallel_seed().
+     *
+     * Unlike the seed of the Mersenne Twister generator, which differs on each
+     * MPI process, the global seed has the same value on all processes.
+     */
+    static unsigned int getGlobalSeed();
+
+    /*!
+     * \brief Compute the Philox4x32-10 counter-based random bijection of the
+     * counter ctr using the key key.
+     *
+     * The result depends only on the counter and key values, so distinct
+     * counters can be evaluated independently, in any order, and on any
+     * process.
+     */
+    static void philox4x32(const unsigned int ctr[4], const unsigned int key[2], unsigned int result[4]);
+
+    /*!
+     * \brief Generate four independent standard normal random numbers from
+     * the counter ctr using the key key.
+     *
+     * This function has no internal state and is thread-safe.
+     */
+    static void genrandn(double result[4], const unsigned int ctr[4], const unsigned int key[2]);
+
+    /*!
+     * \brief Compute a hash (FNV-1a) of the specified object name, for use in
+     * the key of the counter-based generator, so that different objects
+     * generate different random values.
+     */
+    static unsigned int hash_object_name(const std::string& object_name);
+
+    /*!
+     * \brief Determine the stream number of the counter-based generator that
+     * is used for the random value index k, patch level number level_num, and
+     * data component component.
+     *
+     * Stream numbers are distinct for k < 2^12, level_num < 2^8, and
+     * component < 2^4.
+     */
+    static unsigned int rng_stream(int k, int level_num, int component);
+
 private:
     RNG();
     RNG(RNG&);
@@ -152,6 +152,22 @@ public:
     void initializeSolverState(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
                                const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b);
 
+    /*!
+     * \brief Refresh coefficient-dependent data required for solving
+     * \f$Ax=b\f$.
+     *
+     * The hierarchy-dependent data maintained by block preconditioners do not
+     * depend on the problem coefficients, so this is a no-op when the solver
+     * state is already initialized for the same hierarchy configuration.
+     * Otherwise, the solver state is fully reinitialized via
+     * initializeSolverState().
+     *
+     * \note The velocity and pressure subdomain solvers are not refreshed by
+     * this method.
+     */
+    void reinitializeSolverState(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                                 const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b);
+
     /*!
      * \brief Remove all hierarchy dependent data allocated by
      * initializeSolverState().
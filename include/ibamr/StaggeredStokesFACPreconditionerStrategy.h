@@ -327,6 +327,23 @@ public:
     void initializeOperatorState(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& solution,
                                  const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& rhs);
 
+    /*!
+     * \brief Refresh coefficient-dependent data while reusing the
+     * hierarchy-dependent data computed by initializeOperatorState().
+     *
+     * The coarse level solver is refreshed via
+     * IBTK::GeneralSolver::reinitializeSolverState(), and
+     * implementation-specific data are refreshed via
+     * reinitializeOperatorStateSpecialized().  Transfer operators, communication
+     * schedules, and scratch data are reused.
+     *
+     * \note If the operator state is not initialized, or if the hierarchy
+     * configuration has changed, the operator state is fully reinitialized via
+     * initializeOperatorState().
+     */
+    void reinitializeOperatorState(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& solution,
+                                   const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& rhs);
+
     /*!
      * \brief Remove all hierarchy-dependent data.
      *
@@ -352,6 +369,15 @@ protected:
      */
     virtual void deallocateOperatorStateSpecialized(int coarsest_reset_ln, int finest_reset_ln) = 0;
 
+    /*!
+     * \brief Refresh implementation-specific coefficient-dependent data.
+     *
+     * The default implementation deallocates and reinitializes the
+     * implementation-specific data on all levels of the hierarchy.
+     */
+    virtual void reinitializeOperatorStateSpecialized(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& solution,
+                                                      const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& rhs);
+
     /*!
      * \name Methods for executing, caching, and resetting communication
      * schedules.
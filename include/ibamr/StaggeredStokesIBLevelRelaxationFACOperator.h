@@ -168,12 +168,19 @@ public:
     /*!
      * \brief Set the IB-force Jacobian at the finest patch level (where the
      * structure resides).
+     *
+     * \note The operator takes its own reference to the matrix and releases it
+     * when a new matrix is set or when the operator is destroyed.  The caller
+     * keeps, and remains responsible for releasing, its own reference.
      */
     void setIBForceJacobian(Mat& A);
 
     /*!
      * \brief Set the IB-interpolation operator at the finest patch level (where the
      * structure resides).
+     *
+     * \note As with setIBForceJacobian(), the operator holds its own reference
+     * to the matrix.
      */
     void setIBInterpOp(Mat& J);
 
@@ -155,6 +155,12 @@ protected:
      */
     void deallocateOperatorStateSpecialized(int coarsest_reset_ln, int finest_reset_ln);
 
+    /*!
+     * \brief Refresh the level solvers using the current problem coefficients.
+     */
+    void reinitializeOperatorStateSpecialized(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& solution,
+                                              const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& rhs);
+
 private:
     /*!
      * \brief Default constructor.
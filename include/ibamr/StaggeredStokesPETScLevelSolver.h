@@ -123,6 +123,13 @@ protected:
      */
     void deallocateSolverStateSpecialized();
 
+    /*!
+     * \brief Recompute the entries of the MAC Stokes matrix in place using the
+     * current problem coefficients.
+     */
+    bool reinitializeSolverStateSpecialized(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                                            const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b);
+
     /*!
      * \brief Copy a generic vector to the PETSc representation.
      */
@@ -79,6 +79,11 @@ public:
      * \brief Construct a parallel PETSc Mat object corresponding to a MAC
      * discretization of the time-dependent incompressible Stokes equations on a
      * single SAMRAI::hier::PatchLevel.
+     *
+     * When \a reuse_nonzero_structure is \p true, \a mat must have been created
+     * by a previous call to this function using the same DOF indices.  In this
+     * case, the matrix entries are overwritten in place and the nonzero
+     * structure of the matrix is not recomputed.
      */
     static void constructPatchLevelMACStokesOp(Mat& mat,
                                                const SAMRAI::solv::PoissonSpecifications& u_problem_coefs,
@@ -87,7 +92,8 @@ public:
                                                const std::vector<int>& num_dofs_per_proc,
                                                int u_dof_index_idx,
                                                int p_dof_index_idx,
-                                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
+                                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level,
+                                               bool reuse_nonzero_structure = false);
 
     /*!
      * \brief Partition the patch level into subdomains suitable to be used for
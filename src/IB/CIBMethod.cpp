@@ -37,6 +37,7 @@
 #include "ibamr/MobilityFunctions.h"
 #include "ibamr/StokesSpecifications.h"
 #include "ibamr/namespaces.h"
+#include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/LSiloDataWriter.h"
 
 namespace IBAMR
@@ -1479,6 +1480,118 @@ CIBMethod::constructMobilityMatrix(const std::string& /*mat_name*/,
     return;
 } // constructMobilityMatrix
 
+void
+CIBMethod::applyMobilityOperator(Vec F,
+                                 Vec U,
+                                 MobilityMatrixType mat_type,
+                                 const std::vector<unsigned>& struct_ids,
+                                 const double* grid_dx,
+                                 const double* domain_extents,
+                                 double rho,
+                                 double mu,
+                                 const std::pair<double, double>& scale,
+                                 double f_periodic_corr)
+{
+    if (struct_ids.empty()) return;
+    const double dt = d_new_time - d_current_time;
+    const int struct_ln = getStructuresLevelNumber();
+    const char* ib_kernel = d_l_data_manager->getDefaultInterpKernelFunction().c_str();
+
+    std::vector<int> petsc_node_idxs;
+    getPETScNodeIndices(petsc_node_idxs, struct_ids);
+    const int num_nodes = static_cast<int>(petsc_node_idxs.size());
+    const int size = num_nodes * NDIM;
+
+    // Every processor requires the positions and forces of all of the nodes.
+    std::vector<double> XW(size), FW(size);
+    std::vector<Pointer<LData> >* X_half_data;
+    bool* X_half_needs_ghost_fill;
+    getPositionData(&X_half_data, &X_half_needs_ghost_fill, d_half_time);
+    Vec X = (*X_half_data)[struct_ln]->getVec();
+    copyVecToAllArrays(X, &XW[0], petsc_node_idxs, /*depth*/ NDIM);
+    copyVecToAllArrays(F, &FW[0], petsc_node_idxs, /*depth*/ NDIM);
+
+    // Each processor only evaluates the rows of the mobility operator that
+    // correspond to its locally owned entries of U.
+    int ierr;
+    PetscInt U_lower, U_upper;
+    ierr = VecGetOwnershipRange(U, &U_lower, &U_upper);
+    IBTK_CHKERRQ(ierr);
+    std::vector<int> local_rows;
+    for (int j = 0; j < num_nodes; ++j)
+    {
+        const PetscInt idx = petsc_node_idxs[j] * NDIM;
+        if (U_lower <= idx && idx < U_upper) local_rows.push_back(j);
+    }
+    const int num_local_rows = static_cast<int>(local_rows.size());
+    if (num_local_rows == 0) return;
+
+    // Apply the mobility operator.
+    std::vector<double> UW(num_local_rows * NDIM);
+    if (mat_type == RPY)
+    {
+        MobilityFunctions::applyRPYMobilityOperator(ib_kernel,
+                                                    mu,
+                                                    grid_dx[0],
+                                                    &XW[0],
+                                                    num_nodes,
+                                                    f_periodic_corr,
+                                                    &FW[0],
+                                                    &local_rows[0],
+                                                    num_local_rows,
+                                                    &UW[0]);
+    }
+    else if (mat_type == EMPIRICAL)
+    {
+        MobilityFunctions::applyEmpiricalMobilityOperator(ib_kernel,
+                                                          mu,
+                                                          rho,
+                                                          dt,
+                                                          grid_dx[0],
+                                                          &XW[0],
+                                                          num_nodes,
+                                                          0,
+                                                          f_periodic_corr,
+                                                          domain_extents[0],
+                                                          &FW[0],
+                                                          &local_rows[0],
+                                                          num_local_rows,
+                                                          &UW[0]);
+    }
+    else
+    {
+        TBOX_ERROR("CIBMethod::applyMobilityOperator(): Invalid type of a mobility operator." << std::endl);
+    }
+
+    // Regularize the mobility operator and set the locally owned entries of U.
+    Vec W = d_l_data_manager->getLData("regulator", struct_ln)->getVec();
+#if !defined(NDEBUG)
+    PetscInt W_lower, W_upper;
+    VecGetOwnershipRange(W, &W_lower, &W_upper);
+    TBOX_ASSERT(W_lower == U_lower && W_upper == U_upper);
+#endif
+    double *U_array, *W_array;
+    ierr = VecGetArray(U, &U_array);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGetArray(W, &W_array);
+    IBTK_CHKERRQ(ierr);
+    for (int k = 0; k < num_local_rows; ++k)
+    {
+        const int j = local_rows[k];
+        const int local_idx = petsc_node_idxs[j] * NDIM - U_lower;
+        for (int d = 0; d < NDIM; ++d)
+        {
+            U_array[local_idx + d] =
+                scale.first * UW[k * NDIM + d] + scale.second * W_array[local_idx + d] * FW[j * NDIM + d];
+        }
+    }
+    ierr = VecRestoreArray(U, &U_array);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecRestoreArray(W, &W_array);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // applyMobilityOperator
+
 void
 CIBMethod::constructGeometricMatrix(const std::string& /*mat_name*/,
                                     Mat& geometric_mat,
@@ -2018,6 +2131,62 @@ CIBMethod::setInitialLambda(const int level_number)
     return;
 } // setInitialLambda
 
+void
+CIBMethod::getPETScNodeIndices(std::vector<int>& petsc_node_idxs, const std::vector<unsigned>& struct_ids)
+{
+    petsc_node_idxs.clear();
+    for (unsigned k = 0; k < struct_ids.size(); ++k)
+    {
+        const std::pair<int, int>& lag_idx_range = d_struct_lag_idx_range[struct_ids[k]];
+        const unsigned struct_nodes = getNumberOfNodes(struct_ids[k]);
+        for (unsigned j = 0; j < struct_nodes; ++j)
+        {
+            petsc_node_idxs.push_back(lag_idx_range.first + j);
+        }
+    }
+    d_l_data_manager->mapLagrangianToPETSc(petsc_node_idxs, getStructuresLevelNumber());
+    return;
+} // getPETScNodeIndices
+
+void
+CIBMethod::copyVecToAllArrays(Vec b, double* array, const std::vector<int>& petsc_node_idxs, const int data_depth)
+{
+    const PetscInt size = static_cast<PetscInt>(petsc_node_idxs.size()) * data_depth;
+    if (size == 0) return;
+
+    // Wrap the array in a sequential PETSc Vec on every processor.
+    Vec array_vec;
+    VecCreateSeqWithArray(PETSC_COMM_SELF, /*blocksize*/ 1, size, array, &array_vec);
+
+    // Create index sets to define global index mapping.
+    std::vector<PetscInt> vec_indices;
+    vec_indices.reserve(size);
+    for (unsigned j = 0; j < petsc_node_idxs.size(); ++j)
+    {
+        for (int d = 0; d < data_depth; ++d)
+        {
+            vec_indices.push_back(petsc_node_idxs[j] * data_depth + d);
+        }
+    }
+    IS is_vec;
+    IS is_array;
+    ISCreateGeneral(PETSC_COMM_SELF, size, &vec_indices[0], PETSC_COPY_VALUES, &is_vec);
+    ISCreateStride(PETSC_COMM_SELF, size, 0, 1, &is_array);
+
+    // Scatter values
+    VecScatter ctx;
+    VecScatterCreate(b, is_vec, array_vec, is_array, &ctx);
+    VecScatterBegin(ctx, b, array_vec, INSERT_VALUES, SCATTER_FORWARD);
+    VecScatterEnd(ctx, b, array_vec, INSERT_VALUES, SCATTER_FORWARD);
+
+    // Cleanup temporary objects.
+    VecScatterDestroy(&ctx);
+    ISDestroy(&is_vec);
+    ISDestroy(&is_array);
+    VecDestroy(&array_vec);
+    return;
+} // copyVecToAllArrays
+
 } // namespace IBAMR
 
 //////////////////////////////////////////////////////////////////////////////
@@ -833,6 +833,23 @@ CIBStrategy::constructMobilityMatrix(const std::string& /*mat_name*/,
     return;
 } // constructMobilityMatrix
 
+void
+CIBStrategy::applyMobilityOperator(Vec /*F*/,
+                                   Vec /*U*/,
+                                   MobilityMatrixType /*mat_type*/,
+                                   const std::vector<unsigned>& /*struct_ids*/,
+                                   const double* /*grid_dx*/,
+                                   const double* /*domain_extents*/,
+                                   double /*rho*/,
+                                   double /*mu*/,
+                                   const std::pair<double, double>& /*scale*/,
+                                   double /*f_periodic_corr*/)
+{
+    TBOX_ERROR("CIBStrategy::applyMobilityOperator(): Not implemented for this strategy." << std::endl);
+
+    return;
+} // applyMobilityOperator
+
 void
 CIBStrategy::constructGeometricMatrix(const std::string& /*mat_name*/,
                                       Mat& /*geometric_mat*/,
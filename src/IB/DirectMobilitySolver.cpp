@@ -99,6 +99,21 @@ void dsyevr_(const char* jobz,
              int* iwork,
              const int& liwork,
              int& info);
+
+// BLAS function to do matrix-matrix multiplication.
+void dgemm_(const char* transa,
+            const char* transb,
+            const int& m,
+            const int& n,
+            const int& k,
+            const double& alpha,
+            const double* a,
+            const int& lda,
+            const double* b,
+            const int& ldb,
+            const double& beta,
+            double* c,
+            const int& ldc);
 }
 
 namespace IBAMR
@@ -112,6 +127,20 @@ static Timer* t_solve_system;
 static Timer* t_solve_body_system;
 static Timer* t_initialize_solver_state;
 static Timer* t_deallocate_solver_state;
+
+// Check whether two dense matrices are identical to within a relative
+// tolerance.
+inline bool
+dense_matrices_match(const double* const a, const double* const b, const int size, const double tol)
+{
+    double max_abs = 0.0, max_diff = 0.0;
+    for (int i = 0; i < size; ++i)
+    {
+        max_abs = std::max(max_abs, fabs(a[i]));
+        max_diff = std::max(max_diff, fabs(a[i] - b[i]));
+    }
+    return max_diff <= tol * max_abs;
+} // dense_matrices_match
 }
 
 ////////////////////////////// PUBLIC ////////////////////////////////////////
@@ -128,6 +157,8 @@ DirectMobilitySolver::DirectMobilitySolver(const std::string& object_name,
     d_is_initialized = false;
     d_recompute_mob_mat = false;
     d_f_periodic_corr = 0.0;
+    d_share_factorizations = true;
+    d_share_factorizations_tol = 1.0e-12;
 
     // Get from input
     if (input_db) getFromInput(input_db);
@@ -247,6 +278,7 @@ DirectMobilitySolver::registerMobilityMat(const std::string& mat_name,
     d_mat_map[mat_name] = std::make_pair<double*, double*>(NULL, NULL);
     d_geometric_mat_map[mat_name] = NULL;
     d_ipiv_map[mat_name] = std::make_pair<int*, int*>(NULL, NULL);
+    d_mat_factorization_map[mat_name] = mat_name;
     d_petsc_mat_map[mat_name] = std::make_pair<Mat, Mat>(NULL, NULL);
     d_petsc_geometric_mat_map[mat_name] = NULL;
 
@@ -359,17 +391,22 @@ DirectMobilitySolver::solveSystem(Vec x, Vec b)
          ++it)
     {
         const std::string& mat_name = it->first;
-        Mat& mat = d_petsc_mat_map[mat_name].first;
+        const std::string& factor_name = d_mat_factorization_map[mat_name];
+        Mat& mat = d_petsc_mat_map[factor_name].first;
         const MobilityMatrixInverseType& inv_type = d_mat_inv_type_map[mat_name].first;
         const std::vector<std::vector<unsigned> >& struct_ids = d_mat_actual_id_map[mat_name];
         const int managing_proc = d_mat_proc_map[mat_name];
         const int mat_size = d_mat_nodes_map[mat_name] * data_depth;
         const int num_structs = static_cast<int>(struct_ids.size());
+        if (num_structs == 0) continue;
 
+        // Gather the right-hand sides of all the structures associated with
+        // this matrix and solve for them together.
+        std::vector<double> rhs_data;
+        if (rank == managing_proc) rhs_data.resize(mat_size * num_structs);
         for (int k = 0; k < num_structs; ++k)
         {
-            double* rhs = NULL;
-            if (rank == managing_proc) rhs = new double[mat_size];
+            double* rhs = (rank == managing_proc) ? &rhs_data[k * mat_size] : NULL;
             d_cib_strategy->copyVecToArray(b, rhs, struct_ids[k], data_depth, managing_proc);
             if (!d_recompute_mob_mat)
             {
@@ -379,7 +416,14 @@ DirectMobilitySolver::solveSystem(Vec x, Vec b)
                                             managing_proc,
                                             data_depth);
             }
-            if (rank == managing_proc) computeSolution(mat, inv_type, d_ipiv_map[mat_name].first, rhs);
+        }
+        if (rank == managing_proc)
+        {
+            computeSolution(mat, inv_type, d_ipiv_map[factor_name].first, &rhs_data[0], num_structs);
+        }
+        for (int k = 0; k < num_structs; ++k)
+        {
+            double* rhs = (rank == managing_proc) ? &rhs_data[k * mat_size] : NULL;
             if (!d_recompute_mob_mat)
             {
                 d_cib_strategy->rotateArray(rhs,
@@ -389,7 +433,6 @@ DirectMobilitySolver::solveSystem(Vec x, Vec b)
                                             data_depth);
             }
             d_cib_strategy->copyArrayToVec(x, rhs, struct_ids[k], data_depth, managing_proc);
-            delete[] rhs;
         }
     }
 
@@ -415,17 +458,22 @@ DirectMobilitySolver::solveBodySystem(Vec x, Vec b)
          ++it)
     {
         const std::string& mat_name = it->first;
-        Mat& mat = d_petsc_mat_map[mat_name].second;
+        const std::string& factor_name = d_mat_factorization_map[mat_name];
+        Mat& mat = d_petsc_mat_map[factor_name].second;
         const MobilityMatrixInverseType& inv_type = d_mat_inv_type_map[mat_name].second;
         const std::vector<std::vector<unsigned> >& struct_ids = d_mat_actual_id_map[mat_name];
         const int mat_size = d_mat_parts_map[mat_name] * data_depth;
         const int managing_proc = d_mat_proc_map[mat_name];
         const int num_structs = static_cast<int>(struct_ids.size());
+        if (num_structs == 0) continue;
 
+        // Gather the right-hand sides of all the structures associated with
+        // this matrix and solve for them together.
+        std::vector<double> rhs_data;
+        if (rank == managing_proc) rhs_data.resize(mat_size * num_structs);
         for (int k = 0; k < num_structs; ++k)
         {
-            double* rhs = NULL;
-            if (rank == managing_proc) rhs = new double[mat_size];
+            double* rhs = (rank == managing_proc) ? &rhs_data[k * mat_size] : NULL;
             d_cib_strategy->copyFreeDOFsVecToArray(b, rhs, struct_ids[k], managing_proc);
             if (!d_recompute_mob_mat)
             {
@@ -435,7 +483,14 @@ DirectMobilitySolver::solveBodySystem(Vec x, Vec b)
                                             managing_proc,
                                             data_depth);
             }
-            if (rank == managing_proc) computeSolution(mat, inv_type, d_ipiv_map[mat_name].second, rhs);
+        }
+        if (rank == managing_proc)
+        {
+            computeSolution(mat, inv_type, d_ipiv_map[factor_name].second, &rhs_data[0], num_structs);
+        }
+        for (int k = 0; k < num_structs; ++k)
+        {
+            double* rhs = (rank == managing_proc) ? &rhs_data[k * mat_size] : NULL;
             if (!d_recompute_mob_mat)
             {
                 d_cib_strategy->rotateArray(rhs,
@@ -445,7 +500,6 @@ DirectMobilitySolver::solveBodySystem(Vec x, Vec b)
                                             data_depth);
             }
             d_cib_strategy->copyFreeDOFsArrayToVec(x, rhs, struct_ids[k], managing_proc);
-            delete[] rhs;
         }
     }
 
@@ -538,6 +592,7 @@ DirectMobilitySolver::initializeSolverState(Vec x, Vec /*b*/)
             // nodal velocity.
             d_cib_strategy->constructGeometricMatrix(mat_name, geometric_mat, struct_ids, initial_time, managing_proc);
         }
+        findSharedFactorizations();
         factorizeMobilityMatrix();
         constructBodyMobilityMatrix();
         factorizeBodyMobilityMatrix();
@@ -595,6 +650,9 @@ DirectMobilitySolver::getFromInput(Pointer<Database> input_db)
     // Other parameters
     d_f_periodic_corr = input_db->getDoubleWithDefault("f_periodic_correction", d_f_periodic_corr);
     d_recompute_mob_mat = input_db->getBoolWithDefault("recompute_mob_mat_perstep", d_recompute_mob_mat);
+    d_share_factorizations = input_db->getBoolWithDefault("share_factorizations", d_share_factorizations);
+    d_share_factorizations_tol =
+        input_db->getDoubleWithDefault("share_factorizations_tolerance", d_share_factorizations_tol);
 
     return;
 } // getFromInput
@@ -609,6 +667,7 @@ DirectMobilitySolver::factorizeMobilityMatrix()
     {
         const std::string& mat_name = it->first;
         if (rank != d_mat_proc_map[mat_name]) continue;
+        if (d_mat_factorization_map[mat_name] != mat_name) continue;
 
         Mat& mat = d_petsc_mat_map[mat_name].first;
         const MobilityMatrixInverseType& inv_type = d_mat_inv_type_map[mat_name].first;
@@ -632,6 +691,7 @@ DirectMobilitySolver::constructBodyMobilityMatrix()
     {
         const std::string& mat_name = it->first;
         if (rank != d_mat_proc_map[mat_name]) continue;
+        if (d_mat_factorization_map[mat_name] != mat_name) continue;
 
         const int row_size = d_mat_nodes_map[mat_name] * NDIM;
         const int col_size = d_mat_parts_map[mat_name] * s_max_free_dofs;
@@ -648,13 +708,10 @@ DirectMobilitySolver::constructBodyMobilityMatrix()
         MatCreateSeqDense(PETSC_COMM_SELF, row_size, col_size, product_mat_data, &product_mat);
         MatCopy(geometric_mat, product_mat, SAME_NONZERO_PATTERN);
 
-        for (int col = 0; col < col_size; ++col)
-        {
-            double* col_data;
-            MatDenseGetArray(product_mat, &col_data);
-            computeSolution(mobility_mat, mobility_inv_type, d_ipiv_map[mat_name].first, &col_data[col * row_size]);
-            MatDenseRestoreArray(product_mat, &col_data);
-        }
+        double* col_data;
+        MatDenseGetArray(product_mat, &col_data);
+        computeSolution(mobility_mat, mobility_inv_type, d_ipiv_map[mat_name].first, col_data, col_size);
+        MatDenseRestoreArray(product_mat, &col_data);
         MatTransposeMatMult(geometric_mat, product_mat, MAT_REUSE_MATRIX, PETSC_DEFAULT, &body_mob_mat);
 
         MatDestroy(&product_mat);
@@ -674,6 +731,7 @@ DirectMobilitySolver::factorizeBodyMobilityMatrix()
     {
         const std::string& mat_name = it->first;
         if (rank != d_mat_proc_map[mat_name]) continue;
+        if (d_mat_factorization_map[mat_name] != mat_name) continue;
 
         Mat& mat = d_petsc_mat_map[mat_name].second;
         const MobilityMatrixInverseType& inv_type = d_mat_inv_type_map[mat_name].second;
@@ -858,7 +916,90 @@ DirectMobilitySolver::factorizeDenseMatrix(double* mat_data,
 } // factorizeDenseMatrix
 
 void
-DirectMobilitySolver::computeSolution(Mat& mat, const MobilityMatrixInverseType& inv_type, int* ipiv, double* rhs)
+DirectMobilitySolver::findSharedFactorizations()
+{
+    const int rank = SAMRAI_MPI::getRank();
+    std::vector<std::string> factorized_mats;
+    for (std::map<std::string, std::pair<Mat, Mat> >::iterator it = d_petsc_mat_map.begin();
+         it != d_petsc_mat_map.end();
+         ++it)
+    {
+        const std::string& mat_name = it->first;
+        d_mat_factorization_map[mat_name] = mat_name;
+        if (!d_share_factorizations || rank != d_mat_proc_map[mat_name]) continue;
+
+        // Look for a previously factorized matrix with identical mobility and
+        // geometric matrices.  Such matrices arise, e.g., when several
+        // prototypical structures share the same shape.
+        const int mobility_mat_size = d_mat_nodes_map[mat_name] * NDIM;
+        const int body_mobility_mat_size = d_mat_parts_map[mat_name] * s_max_free_dofs;
+        for (unsigned k = 0; k < factorized_mats.size(); ++k)
+        {
+            const std::string& other_name = factorized_mats[k];
+            if (d_mat_proc_map[other_name] != rank || d_mat_nodes_map[other_name] != d_mat_nodes_map[mat_name] ||
+                d_mat_parts_map[other_name] != d_mat_parts_map[mat_name] ||
+                d_mat_inv_type_map[other_name] != d_mat_inv_type_map[mat_name])
+            {
+                continue;
+            }
+
+            double *mat_data = NULL, *other_mat_data = NULL;
+            MatDenseGetArray(d_petsc_mat_map[mat_name].first, &mat_data);
+            MatDenseGetArray(d_petsc_mat_map[other_name].first, &other_mat_data);
+            bool found_match = dense_matrices_match(
+                mat_data, other_mat_data, mobility_mat_size * mobility_mat_size, d_share_factorizations_tol);
+            MatDenseRestoreArray(d_petsc_mat_map[mat_name].first, &mat_data);
+            MatDenseRestoreArray(d_petsc_mat_map[other_name].first, &other_mat_data);
+            if (!found_match) continue;
+
+            MatDenseGetArray(d_petsc_geometric_mat_map[mat_name], &mat_data);
+            MatDenseGetArray(d_petsc_geometric_mat_map[other_name], &other_mat_data);
+            found_match = dense_matrices_match(
+                mat_data, other_mat_data, mobility_mat_size * body_mobility_mat_size, d_share_factorizations_tol);
+            MatDenseRestoreArray(d_petsc_geometric_mat_map[mat_name], &mat_data);
+            MatDenseRestoreArray(d_petsc_geometric_mat_map[other_name], &other_mat_data);
+            if (!found_match) continue;
+
+            d_mat_factorization_map[mat_name] = other_name;
+            break;
+        }
+
+        if (d_mat_factorization_map[mat_name] == mat_name)
+        {
+            factorized_mats.push_back(mat_name);
+            continue;
+        }
+
+        plog << "DirectMobilitySolver::findSharedFactorizations(): Matrix with handle " << mat_name
+             << " will use the factorizations of matrix with handle " << d_mat_factorization_map[mat_name]
+             << std::endl;
+
+        // The duplicate matrices are never rebuilt if the mobility matrices are
+        // not recomputed, so their storage can be released.
+        if (!d_recompute_mob_mat)
+        {
+            MatDestroy(&d_petsc_mat_map[mat_name].first);
+            MatDestroy(&d_petsc_mat_map[mat_name].second);
+            MatDestroy(&d_petsc_geometric_mat_map[mat_name]);
+            delete[] d_mat_map[mat_name].first;
+            delete[] d_mat_map[mat_name].second;
+            delete[] d_geometric_mat_map[mat_name];
+            delete[] d_ipiv_map[mat_name].first;
+            delete[] d_ipiv_map[mat_name].second;
+            d_mat_map[mat_name] = std::make_pair<double*, double*>(NULL, NULL);
+            d_geometric_mat_map[mat_name] = NULL;
+            d_ipiv_map[mat_name] = std::make_pair<int*, int*>(NULL, NULL);
+        }
+    }
+    return;
+} // findSharedFactorizations
+
+void
+DirectMobilitySolver::computeSolution(Mat& mat,
+                                      const MobilityMatrixInverseType& inv_type,
+                                      int* ipiv,
+                                      double* rhs,
+                                      const int num_rhs)
 {
     // Get pointer to matrix.
     int mat_size;
@@ -869,7 +1010,7 @@ DirectMobilitySolver::computeSolution(Mat& mat, const MobilityMatrixInverseType&
     int err = 0;
     if (inv_type == LAPACK_CHOLESKY)
     {
-        dpotrs_((char*)"L", mat_size, 1, mat_data, mat_size, rhs, mat_size, err);
+        dpotrs_((char*)"L", mat_size, num_rhs, mat_data, mat_size, rhs, mat_size, err);
         if (err)
         {
             TBOX_ERROR("DirectMobilitySolver::computeSolution(). Solution failed using "
@@ -880,7 +1021,7 @@ DirectMobilitySolver::computeSolution(Mat& mat, const MobilityMatrixInverseType&
     }
     else if (inv_type == LAPACK_LU)
     {
-        dgetrs_((char*)"N", mat_size, 1, mat_data, mat_size, ipiv, rhs, mat_size, err);
+        dgetrs_((char*)"N", mat_size, num_rhs, mat_data, mat_size, ipiv, rhs, mat_size, err);
 
         if (err)
         {
@@ -892,24 +1033,35 @@ DirectMobilitySolver::computeSolution(Mat& mat, const MobilityMatrixInverseType&
     }
     else if (inv_type == LAPACK_SVD)
     {
-        std::vector<double> temp(mat_size);
-        for (int i = 0; i < mat_size; ++i)
-        {
-            temp[i] = 0.0;
-            for (int j = 0; j < mat_size; ++j)
-            {
-                temp[i] += mat_data[i * mat_size + j] * rhs[j];
-            }
-        }
-
-        for (int i = 0; i < mat_size; ++i)
-        {
-            rhs[i] = 0.0;
-            for (int j = 0; j < mat_size; ++j)
-            {
-                rhs[i] += mat_data[j * mat_size + i] * temp[j];
-            }
-        }
+        // The factorized matrix A stores the scaled eigenvectors, so that the
+        // inverse is given by A*A^T.
+        std::vector<double> temp(mat_size * num_rhs);
+        dgemm_((char*)"T",
+               (char*)"N",
+               mat_size,
+               num_rhs,
+               mat_size,
+               1.0,
+               mat_data,
+               mat_size,
+               rhs,
+               mat_size,
+               0.0,
+               &temp[0],
+               mat_size);
+        dgemm_((char*)"N",
+               (char*)"N",
+               mat_size,
+               num_rhs,
+               mat_size,
+               1.0,
+               mat_data,
+               mat_size,
+               &temp[0],
+               mat_size,
+               0.0,
+               rhs,
+               mat_size);
     }
     else
     {
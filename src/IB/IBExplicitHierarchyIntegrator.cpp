@@ -59,6 +59,7 @@
 #include "ibamr/ibamr_utilities.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "ibtk/CartGridFunction.h"
+#include "ibtk/PerformanceProfiler.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
 #include "ibtk/ibtk_enums.h"
 #include "tbox/Database.h"
@@ -296,19 +297,22 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
     d_ib_method_ops->preprocessSolveFluidEquations(current_time, new_time, cycle_num);
     if (d_enable_logging)
         plog << d_object_name << "::integrateHierarchy(): solving the incompressible Navier-Stokes equations\n";
-    if (d_current_num_cycles > 1)
-    {
-        d_ins_hier_integrator->integrateHierarchy(current_time, new_time, cycle_num);
-    }
-    else
     {
+        ProfilingScope fluid_solve_scope("fluid_solve");
+        if (d_current_num_cycles > 1)
+        {
+            d_ins_hier_integrator->integrateHierarchy(current_time, new_time, cycle_num);
+        }
+        else
+        {
 #if !defined(NDEBUG)
-        TBOX_ASSERT(d_current_num_cycles == 1);
+            TBOX_ASSERT(d_current_num_cycles == 1);
 #endif
-        const int ins_num_cycles = d_ins_hier_integrator->getNumberOfCycles();
-        for (int ins_cycle_num = 0; ins_cycle_num < ins_num_cycles; ++ins_cycle_num)
-        {
-            d_ins_hier_integrator->integrateHierarchy(current_time, new_time, ins_cycle_num);
+            const int ins_num_cycles = d_ins_hier_integrator->getNumberOfCycles();
+            for (int ins_cycle_num = 0; ins_cycle_num < ins_num_cycles; ++ins_cycle_num)
+            {
+                d_ins_hier_integrator->integrateHierarchy(current_time, new_time, ins_cycle_num);
+            }
         }
     }
     d_ib_method_ops->postprocessSolveFluidEquations(current_time, new_time, cycle_num);
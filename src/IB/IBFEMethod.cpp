@@ -73,6 +73,7 @@
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/IndexUtilities.h"
 #include "ibtk/LEInteractor.h"
+#include "ibtk/PerformanceProfiler.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/libmesh_utilities.h"
@@ -964,6 +965,7 @@ IBFEMethod::interpolateVelocity(const int u_data_idx,
                                 const std::vector<Pointer<RefineSchedule<NDIM> > >& u_ghost_fill_scheds,
                                 const double data_time)
 {
+    ProfilingScope profiling_scope("interp");
     std::vector<NumericVector<double>*> U_vecs(d_num_parts), X_vecs(d_num_parts);
     for (unsigned int part = 0; part < d_num_parts; ++part)
     {
@@ -1133,6 +1135,7 @@ IBFEMethod::trapezoidalStep(const double current_time, const double new_time)
 void
 IBFEMethod::computeLagrangianForce(const double data_time)
 {
+    ProfilingScope profiling_scope("force");
     TBOX_ASSERT(MathUtilities<double>::equalEps(data_time, d_half_time));
     for (unsigned part = 0; part < d_num_parts; ++part)
     {
@@ -1185,6 +1188,7 @@ IBFEMethod::spreadForce(const int f_data_idx,
                         const std::vector<Pointer<RefineSchedule<NDIM> > >& /*f_prolongation_scheds*/,
                         const double data_time)
 {
+    ProfilingScope profiling_scope("spread");
     TBOX_ASSERT(MathUtilities<double>::equalEps(data_time, d_half_time));
 
     // Communicate ghost data.
@@ -3700,6 +3704,7 @@ IBFEMethod::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
     {
         d_ghosts = static_cast<int>(std::ceil(db->getDouble("min_ghost_cell_width")));
     }
+    if (db->isDatabase("LEInteractor")) LEInteractor::setFromDatabase(db->getDatabase("LEInteractor"));
     if (db->keyExists("do_log"))
         d_do_log = db->getBool("do_log");
     else if (db->keyExists("enable_logging"))
@@ -74,6 +74,7 @@
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/IndexUtilities.h"
 #include "ibtk/LEInteractor.h"
+#include "ibtk/PerformanceProfiler.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/libmesh_utilities.h"
@@ -506,6 +507,7 @@ IBFESurfaceMethod::interpolateVelocity(const int u_data_idx,
                                        const std::vector<Pointer<RefineSchedule<NDIM> > >& u_ghost_fill_scheds,
                                        const double data_time)
 {
+    ProfilingScope profiling_scope("interp");
     for (unsigned int part = 0; part < d_num_parts; ++part)
     {
         NumericVector<double>* U_vec = NULL;
@@ -854,6 +856,7 @@ IBFESurfaceMethod::trapezoidalStep(const double current_time, const double new_t
 void
 IBFESurfaceMethod::computeLagrangianForce(const double data_time)
 {
+    ProfilingScope profiling_scope("force");
     TBOX_ASSERT(MathUtilities<double>::equalEps(data_time, d_half_time));
     for (unsigned part = 0; part < d_num_parts; ++part)
     {
@@ -1106,6 +1109,7 @@ IBFESurfaceMethod::spreadForce(const int f_data_idx,
                                const std::vector<Pointer<RefineSchedule<NDIM> > >& /*f_prolongation_scheds*/,
                                const double data_time)
 {
+    ProfilingScope profiling_scope("spread");
     TBOX_ASSERT(MathUtilities<double>::equalEps(data_time, d_half_time));
     for (unsigned int part = 0; part < d_num_parts; ++part)
     {
@@ -2109,6 +2113,7 @@ IBFESurfaceMethod::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
     {
         d_ghosts = static_cast<int>(std::ceil(db->getDouble("min_ghost_cell_width")));
     }
+    if (db->isDatabase("LEInteractor")) LEInteractor::setFromDatabase(db->getDatabase("LEInteractor"));
     if (db->keyExists("do_log"))
         d_do_log = db->getBool("do_log");
     else if (db->keyExists("enable_logging"))
@@ -34,12 +34,16 @@
 
 #include <stddef.h>
 #include <algorithm>
+#include <limits>
 #include <ostream>
 #include <string>
 
 #include "BasePatchHierarchy.h"
 #include "BasePatchLevel.h"
+#include "Box.h"
 #include "CartesianGridGeometry.h"
+#include "CellData.h"
+#include "CellIndex.h"
 #include "CellVariable.h"
 #include "CoarsenAlgorithm.h"
 #include "CoarsenOperator.h"
@@ -52,6 +56,7 @@
 #include "IntVector.h"
 #include "LoadBalancer.h"
 #include "MultiblockDataTranslator.h"
+#include "Patch.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
 #include "RefineAlgorithm.h"
@@ -73,6 +78,7 @@
 #include "ibtk/HierarchyIntegrator.h"
 #include "ibtk/LMarkerSetVariable.h"
 #include "ibtk/LMarkerUtilities.h"
+#include "ibtk/PerformanceProfiler.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
 #include "ibtk/ibtk_utilities.h"
 #include "tbox/Array.h"
@@ -81,6 +87,7 @@
 #include "tbox/PIO.h"
 #include "tbox/Pointer.h"
 #include "tbox/RestartManager.h"
+#include "tbox/SAMRAI_MPI.h"
 #include "tbox/Utilities.h"
 
 namespace SAMRAI
@@ -457,12 +464,26 @@ IBHierarchyIntegrator::initializePatchHierarchy(Pointer<PatchHierarchy<NDIM> > h
 void
 IBHierarchyIntegrator::regridHierarchy()
 {
+    // When the regrid policy is driven by the measured displacement of the IB
+    // points, only redistribute the Lagrangian data if the points cannot yet
+    // have left the tagged region.
+    const bool initial_time = MathUtilities<double>::equalEps(d_integrator_time, d_start_time);
+    if (d_regrid_tag_buffer_fraction > 0.0 && d_hierarchy_is_initialized && !initial_time)
+    {
+        const double displacement = d_ib_method_ops->getMaxPointDisplacement();
+        if (displacement >= 0.0 && d_regrid_displacement_estimate + displacement < getRegridDisplacementThreshold())
+        {
+            d_regrid_displacement_estimate += displacement;
+            redistributeLagrangianData();
+            return;
+        }
+    }
+
     // Update the workload pre-regridding.
     if (d_load_balancer)
     {
         if (d_enable_logging) plog << d_object_name << "::regridHierarchy(): updating workload estimates\n";
-        d_hier_cc_data_ops->setToScalar(d_workload_idx, 1.0);
-        d_ib_method_ops->updateWorkloadEstimates(d_hierarchy, d_workload_idx);
+        computeWorkloadEstimates(/*update_workload_weight*/ true);
     }
 
     // Collect the marker particles to level 0 of the patch hierarchy.
@@ -490,11 +511,57 @@ IBHierarchyIntegrator::regridHierarchy()
         LMarkerUtilities::pruneInvalidMarkers(d_mark_current_idx, d_hierarchy);
     }
 
-    // Reset the regrid CFL estimate.
+    // Report the load balance attained by the new patch hierarchy.
+    if (d_load_balancer && d_enable_logging)
+    {
+        plog << d_object_name << "::regridHierarchy(): workload estimates after regridding\n";
+        computeWorkloadEstimates(/*update_workload_weight*/ false);
+    }
+
+    // Reset the regrid CFL and displacement estimates.
     d_regrid_cfl_estimate = 0.0;
+    d_regrid_displacement_estimate = 0.0;
     return;
 } // regridHierarchy
 
+void
+IBHierarchyIntegrator::redistributeLagrangianData()
+{
+    if (d_enable_logging)
+        plog << d_object_name << "::redistributeLagrangianData(): redistributing Lagrangian data\n";
+    d_ib_method_ops->beginDataRedistribution(d_hierarchy, d_gridding_alg);
+    d_ib_method_ops->endDataRedistribution(d_hierarchy, d_gridding_alg);
+
+    // Re-bin the marker particles, which may have crossed patch boundaries
+    // since the last regrid: collect them on the coarsest level, refine them
+    // back onto the finer levels, and prune any duplicates that are left in
+    // the "invalid" regions of coarser levels.
+    if (d_mark_var)
+    {
+        const int finest_ln = d_hierarchy->getFinestLevelNumber();
+        LMarkerUtilities::collectMarkersOnPatchHierarchy(d_mark_current_idx, d_hierarchy);
+        if (finest_ln > 0)
+        {
+            LMarkerUtilities::initializeMarkersOnLevel(d_mark_current_idx,
+                                                       d_mark_init_posns,
+                                                       d_hierarchy,
+                                                       finest_ln,
+                                                       /*initial_time*/ false,
+                                                       Pointer<BasePatchLevel<NDIM> >(NULL));
+        }
+        LMarkerUtilities::pruneInvalidMarkers(d_mark_current_idx, d_hierarchy);
+    }
+    if (d_enable_logging)
+        plog << d_object_name << "::redistributeLagrangianData(): estimated upper bound on IB point "
+                                 "displacement since last regrid = "
+             << d_regrid_displacement_estimate << "\n";
+
+    // Reset the regrid CFL estimate, which bounds the displacement since the
+    // Lagrangian data were last redistributed.
+    d_regrid_cfl_estimate = 0.0;
+    return;
+} // redistributeLagrangianData
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 IBHierarchyIntegrator::IBHierarchyIntegrator(const std::string& object_name,
@@ -532,17 +599,34 @@ IBHierarchyIntegrator::IBHierarchyIntegrator(const std::string& object_name,
     d_time_stepping_type = MIDPOINT_RULE;
     d_regrid_cfl_interval = 0.0;
     d_regrid_cfl_estimate = 0.0;
+    d_regrid_tag_buffer_fraction = 0.0;
+    d_regrid_displacement_estimate = 0.0;
     d_error_on_dt_change = true;
     d_warn_on_dt_change = false;
 
     // Do not allocate a workload variable by default.
     d_workload_var.setNull();
     d_workload_idx = -1;
+    d_use_measured_workload_weights = false;
+    d_lag_workload_weight = 1.0;
+    d_workload_weight_smoothing = 0.5;
+    d_eul_work_time = 0.0;
+    d_lag_work_time = 0.0;
 
     // Initialize object with data read from the input and restart databases.
     bool from_restart = RestartManager::getManager()->isFromRestart();
     if (from_restart) getFromRestart();
     if (input_db) getFromInput(input_db, from_restart);
+
+    // The measured workload weights are fit to the times recorded by the
+    // performance profiler.  If profiling has not been requested, the profiler
+    // only accumulates the scope times.
+    if (d_use_measured_workload_weights && !PerformanceProfiler::isEnabled())
+    {
+        PerformanceProfiler* profiler = PerformanceProfiler::getProfiler();
+        profiler->setEnabled(true);
+        profiler->setLogInterval(0);
+    }
     return;
 } // IBHierarchyIntegrator
 
@@ -551,6 +635,18 @@ IBHierarchyIntegrator::atRegridPointSpecialized() const
 {
     const bool initial_time = MathUtilities<double>::equalEps(d_integrator_time, d_start_time);
     if (initial_time) return true;
+    if (d_regrid_tag_buffer_fraction > 0.0)
+    {
+        const double displacement = d_ib_method_ops->getMaxPointDisplacement();
+        if (displacement >= 0.0)
+        {
+            const double regrid_threshold = getRegridDisplacementThreshold();
+            const double redistribution_threshold =
+                std::min(d_regrid_cfl_interval > 0.0 ? d_regrid_cfl_interval : 0.5, regrid_threshold);
+            return (displacement >= redistribution_threshold ||
+                    d_regrid_displacement_estimate + displacement >= regrid_threshold);
+        }
+    }
     if (d_regrid_cfl_interval > 0.0)
     {
         return (d_regrid_cfl_estimate >= d_regrid_cfl_interval);
@@ -562,6 +658,99 @@ IBHierarchyIntegrator::atRegridPointSpecialized() const
     return false;
 } // atRegridPointSpecialized
 
+double
+IBHierarchyIntegrator::getRegridDisplacementThreshold() const
+{
+    if (d_gridding_alg->getMaxLevels() <= 1) return std::numeric_limits<double>::max();
+    const int ln = std::max(d_hierarchy->getFinestLevelNumber(), 1);
+    const int tag_buffer = d_tag_buffer[std::min(ln - 1, d_tag_buffer.size() - 1)];
+    const int ratio = d_gridding_alg->getRatioToCoarserLevel(ln).min();
+    return d_regrid_tag_buffer_fraction * static_cast<double>(tag_buffer * ratio);
+} // getRegridDisplacementThreshold
+
+void
+IBHierarchyIntegrator::computeWorkloadEstimates(const bool update_workload_weight)
+{
+    d_hier_cc_data_ops->setToScalar(d_workload_idx, 1.0);
+    d_ib_method_ops->updateWorkloadEstimates(d_hierarchy, d_workload_idx);
+    if (!d_use_measured_workload_weights && !d_enable_logging && d_lag_workload_weight == 1.0) return;
+
+    // Extract the Lagrangian workload and determine its distribution among the
+    // processors along with the distribution of the grid cells.
+    d_hier_cc_data_ops->addScalar(d_workload_idx, d_workload_idx, -1.0);
+    double local_work[2] = { 0.0, 0.0 };
+    const int coarsest_ln = 0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<CellData<NDIM, double> > workload_data = patch->getPatchData(d_workload_idx);
+            local_work[0] += static_cast<double>(patch_box.size());
+            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            {
+                const CellIndex<NDIM> i(b());
+                local_work[1] += (*workload_data)(i);
+            }
+        }
+    }
+    double total_work[2] = { local_work[0], local_work[1] };
+    SAMRAI_MPI::sumReduction(total_work, 2);
+
+    // Refit the Lagrangian workload weight to the measured cost of the
+    // Lagrangian and Eulerian computations since the previous update.  Because
+    // the time spent by each processor includes time spent waiting on other
+    // processors, the weight is fit to the totals over all processors.
+    if (update_workload_weight && d_use_measured_workload_weights)
+    {
+        PerformanceProfiler* profiler = PerformanceProfiler::getProfiler();
+        const double eul_work_time = profiler->getLocalTotalTime("fluid_solve");
+        const double lag_work_time = profiler->getLocalTotalTime("force") + profiler->getLocalTotalTime("spread") +
+                                     profiler->getLocalTotalTime("interp");
+        double work_time[2] = { eul_work_time - d_eul_work_time, lag_work_time - d_lag_work_time };
+        d_eul_work_time = eul_work_time;
+        d_lag_work_time = lag_work_time;
+        SAMRAI_MPI::sumReduction(work_time, 2);
+        if (work_time[0] > 0.0 && work_time[1] > 0.0 && total_work[0] > 0.0 && total_work[1] > 0.0)
+        {
+            const double measured_weight = (work_time[1] / total_work[1]) / (work_time[0] / total_work[0]);
+            d_lag_workload_weight = (1.0 - d_workload_weight_smoothing) * d_lag_workload_weight +
+                                    d_workload_weight_smoothing * measured_weight;
+            if (d_enable_logging)
+                plog << d_object_name << "::computeWorkloadEstimates(): measured Lagrangian workload weight = "
+                     << measured_weight << ", updated weight = " << d_lag_workload_weight << "\n";
+        }
+    }
+
+    // Report the load imbalance (the ratio of the maximum to the mean workload
+    // per processor) of the cells, the Lagrangian workload, and the combined
+    // workload used for load balancing.
+    if (d_enable_logging)
+    {
+        double max_work[3] = { local_work[0], local_work[1], local_work[0] + d_lag_workload_weight * local_work[1] };
+        SAMRAI_MPI::maxReduction(max_work, 3);
+        const double num_procs = static_cast<double>(SAMRAI_MPI::getNodes());
+        const double avg_work[3] = { total_work[0] / num_procs,
+                                     total_work[1] / num_procs,
+                                     (total_work[0] + d_lag_workload_weight * total_work[1]) / num_procs };
+        plog << d_object_name << "::computeWorkloadEstimates(): load imbalance:";
+        static const char* const work_names[3] = { "cells", "Lagrangian", "combined" };
+        for (int k = 0; k < 3; ++k)
+        {
+            plog << " " << work_names[k] << " = " << (avg_work[k] > 0.0 ? max_work[k] / avg_work[k] : 1.0);
+        }
+        plog << "\n";
+    }
+
+    // Set the combined workload.
+    d_hier_cc_data_ops->scale(d_workload_idx, d_lag_workload_weight, d_workload_idx);
+    d_hier_cc_data_ops->addScalar(d_workload_idx, d_workload_idx, 1.0);
+    return;
+} // computeWorkloadEstimates
+
 void
 IBHierarchyIntegrator::initializeCompositeHierarchyDataSpecialized(double /*init_data_time*/, bool initial_time)
 {
@@ -616,6 +805,15 @@ IBHierarchyIntegrator::initializeLevelDataSpecialized(const Pointer<BasePatchHie
     // Initialize IB data.
     d_ib_method_ops->initializeLevelData(
         hierarchy, level_number, init_data_time, can_be_refined, initial_time, old_level, allocate_data);
+
+    // Weight the Lagrangian workload estimates set by the IB method.
+    if (d_workload_idx != -1 && d_lag_workload_weight != 1.0)
+    {
+        HierarchyCellDataOpsReal<NDIM, double> level_cc_data_ops(hierarchy, level_number, level_number);
+        level_cc_data_ops.addScalar(d_workload_idx, d_workload_idx, -1.0);
+        level_cc_data_ops.scale(d_workload_idx, d_lag_workload_weight, d_workload_idx);
+        level_cc_data_ops.addScalar(d_workload_idx, d_workload_idx, 1.0);
+    }
     return;
 } // initializeLevelDataSpecialized
 
@@ -670,15 +868,20 @@ IBHierarchyIntegrator::putToDatabaseSpecialized(Pointer<Database> db)
     db->putString("d_time_stepping_type", enum_to_string<TimeSteppingType>(d_time_stepping_type));
     db->putDouble("d_regrid_cfl_interval", d_regrid_cfl_interval);
     db->putDouble("d_regrid_cfl_estimate", d_regrid_cfl_estimate);
+    db->putDouble("d_regrid_tag_buffer_fraction", d_regrid_tag_buffer_fraction);
+    db->putDouble("d_regrid_displacement_estimate", d_regrid_displacement_estimate);
+    db->putDouble("d_lag_workload_weight", d_lag_workload_weight);
     return;
 } // putToDatabaseSpecialized
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 void
-IBHierarchyIntegrator::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
+IBHierarchyIntegrator::getFromInput(Pointer<Database> db, bool is_from_restart)
 {
     if (db->keyExists("regrid_cfl_interval")) d_regrid_cfl_interval = db->getDouble("regrid_cfl_interval");
+    if (db->keyExists("regrid_tag_buffer_fraction"))
+        d_regrid_tag_buffer_fraction = db->getDouble("regrid_tag_buffer_fraction");
     if (db->keyExists("error_on_dt_change"))
         d_error_on_dt_change = db->getBool("error_on_dt_change");
     else if (db->keyExists("error_on_timestep_change"))
@@ -696,6 +899,18 @@ IBHierarchyIntegrator::getFromInput(Pointer<Database> db, bool /*is_from_restart
     else if (db->keyExists("timestepping_type"))
         d_time_stepping_type = string_to_enum<TimeSteppingType>(db->getString("timestepping_type"));
     if (db->keyExists("marker_file_name")) d_mark_file_name = db->getString("marker_file_name");
+    if (db->keyExists("use_measured_workload_weights"))
+        d_use_measured_workload_weights = db->getBool("use_measured_workload_weights");
+    if (!is_from_restart && db->keyExists("lagrangian_workload_weight"))
+        d_lag_workload_weight = db->getDouble("lagrangian_workload_weight");
+    if (db->keyExists("workload_weight_smoothing"))
+        d_workload_weight_smoothing = db->getDouble("workload_weight_smoothing");
+    if (d_lag_workload_weight <= 0.0 || d_workload_weight_smoothing <= 0.0 || d_workload_weight_smoothing > 1.0)
+    {
+        TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                 << "  lagrangian_workload_weight must be positive and\n"
+                                 << "  workload_weight_smoothing must be in the range (0,1]\n");
+    }
     return;
 } // getFromInput
 
@@ -722,6 +937,11 @@ IBHierarchyIntegrator::getFromRestart()
     d_time_stepping_type = string_to_enum<TimeSteppingType>(db->getString("d_time_stepping_type"));
     d_regrid_cfl_interval = db->getDouble("d_regrid_cfl_interval");
     d_regrid_cfl_estimate = db->getDouble("d_regrid_cfl_estimate");
+    if (db->keyExists("d_regrid_tag_buffer_fraction"))
+        d_regrid_tag_buffer_fraction = db->getDouble("d_regrid_tag_buffer_fraction");
+    if (db->keyExists("d_regrid_displacement_estimate"))
+        d_regrid_displacement_estimate = db->getDouble("d_regrid_displacement_estimate");
+    if (db->keyExists("d_lag_workload_weight")) d_lag_workload_weight = db->getDouble("d_lag_workload_weight");
     return;
 } // getFromRestart
 
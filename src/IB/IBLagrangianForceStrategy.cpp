@@ -144,6 +144,38 @@ IBLagrangianForceStrategy::computeLagrangianForceJacobian(Mat& /*J_mat*/,
     return;
 } // computeLagrangianForceJacobian
 
+void
+IBLagrangianForceStrategy::setupLagrangianForceJacobian(const double /*X_coef*/,
+                                                        Pointer<LData> /*X_data*/,
+                                                        const double /*U_coef*/,
+                                                        Pointer<LData> /*U_data*/,
+                                                        const Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
+                                                        const int /*level_number*/,
+                                                        const double /*data_time*/,
+                                                        LDataManager* const /*l_data_manager*/)
+{
+    // intentionally blank
+    return;
+} // setupLagrangianForceJacobian
+
+void
+IBLagrangianForceStrategy::applyLagrangianForceJacobian(Pointer<LData> /*F_data*/,
+                                                        Pointer<LData> /*V_data*/,
+                                                        const double /*X_coef*/,
+                                                        Pointer<LData> /*X_data*/,
+                                                        const double /*U_coef*/,
+                                                        Pointer<LData> /*U_data*/,
+                                                        const Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
+                                                        const int /*level_number*/,
+                                                        const double /*data_time*/,
+                                                        LDataManager* const /*l_data_manager*/)
+{
+    TBOX_ERROR("IBLagrangianForceStrategy::applyLagrangianForceJacobian():\n"
+               << "  Jacobian functionality not implemented for this IBLagrangianForceStrategy."
+               << std::endl);
+    return;
+} // applyLagrangianForceJacobian
+
 double
 IBLagrangianForceStrategy::computeLagrangianEnergy(Pointer<LData> /*X_data*/,
                                                    Pointer<LData> /*U_data*/,
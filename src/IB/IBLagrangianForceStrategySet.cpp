@@ -159,6 +159,48 @@ IBLagrangianForceStrategySet::computeLagrangianForceJacobian(Mat& J_mat,
     return;
 } // computeLagrangianForceJacobian
 
+void
+IBLagrangianForceStrategySet::setupLagrangianForceJacobian(const double X_coef,
+                                                           Pointer<LData> X_data,
+                                                           const double U_coef,
+                                                           Pointer<LData> U_data,
+                                                           const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                                           const int level_number,
+                                                           const double data_time,
+                                                           LDataManager* const l_data_manager)
+{
+    for (std::vector<Pointer<IBLagrangianForceStrategy> >::const_iterator cit = d_strategy_set.begin();
+         cit != d_strategy_set.end();
+         ++cit)
+    {
+        (*cit)->setupLagrangianForceJacobian(
+            X_coef, X_data, U_coef, U_data, hierarchy, level_number, data_time, l_data_manager);
+    }
+    return;
+} // setupLagrangianForceJacobian
+
+void
+IBLagrangianForceStrategySet::applyLagrangianForceJacobian(Pointer<LData> F_data,
+                                                           Pointer<LData> V_data,
+                                                           const double X_coef,
+                                                           Pointer<LData> X_data,
+                                                           const double U_coef,
+                                                           Pointer<LData> U_data,
+                                                           const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                                           const int level_number,
+                                                           const double data_time,
+                                                           LDataManager* const l_data_manager)
+{
+    for (std::vector<Pointer<IBLagrangianForceStrategy> >::const_iterator cit = d_strategy_set.begin();
+         cit != d_strategy_set.end();
+         ++cit)
+    {
+        (*cit)->applyLagrangianForceJacobian(
+            F_data, V_data, X_coef, X_data, U_coef, U_data, hierarchy, level_number, data_time, l_data_manager);
+    }
+    return;
+} // applyLagrangianForceJacobian
+
 double
 IBLagrangianForceStrategySet::computeLagrangianEnergy(Pointer<LData> X_data,
                                                       Pointer<LData> U_data,
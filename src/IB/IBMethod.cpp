@@ -87,6 +87,7 @@
 #include "ibtk/LNode.h"
 #include "ibtk/LSiloDataWriter.h"
 #include "ibtk/PETScMatUtilities.h"
+#include "ibtk/PerformanceProfiler.h"
 #include "ibtk/ibtk_utilities.h"
 #include "petscmat.h"
 #include "petscsys.h"
@@ -166,9 +167,11 @@ IBMethod::IBMethod(const std::string& object_name, Pointer<Database> input_db, b
     d_interp_kernel_fcn = "IB_4";
     d_spread_kernel_fcn = "IB_4";
     d_error_if_points_leave_domain = false;
+    d_use_morton_node_ordering = false;
     d_ghosts = std::max(LEInteractor::getMinimumGhostWidth(d_interp_kernel_fcn),
                         LEInteractor::getMinimumGhostWidth(d_spread_kernel_fcn));
     d_force_jac_mffd = false;
+    d_force_jac_matrix_free = false;
     d_do_log = false;
 
     // Initialize object with data read from the input and restart databases.
@@ -194,6 +197,7 @@ IBMethod::IBMethod(const std::string& object_name, Pointer<Database> input_db, b
                                                 d_ghosts,
                                                 d_registered_for_restart);
     d_ghosts = d_l_data_manager->getGhostCellWidth();
+    d_l_data_manager->setUseMortonNodeOrdering(d_use_morton_node_ordering);
 
     // Create the instrument panel object.
     d_instrument_panel =
@@ -217,8 +221,15 @@ IBMethod::IBMethod(const std::string& object_name, Pointer<Database> input_db, b
     d_F_new_needs_ghost_fill = true;
     d_F_half_needs_ghost_fill = true;
 
-    // Indicate that the Jacobian matrix has not been allocated.
+    // Indicate that the Jacobian matrix and the interpolation operator have
+    // not been allocated.
     d_force_jac = NULL;
+    d_assembled_force_jac = NULL;
+    d_interp_op = NULL;
+    d_interp_op_fcn = NULL;
+    d_interp_op_stencil = -1;
+    d_interp_op_dof_index_idx = -1;
+    d_interp_op_needs_rebuild = true;
     return;
 } // IBMethod
 
@@ -235,6 +246,18 @@ IBMethod::~IBMethod()
         ierr = MatDestroy(&d_force_jac);
         IBTK_CHKERRQ(ierr);
     }
+    if (d_assembled_force_jac)
+    {
+        PetscErrorCode ierr;
+        ierr = MatDestroy(&d_assembled_force_jac);
+        IBTK_CHKERRQ(ierr);
+    }
+    if (d_interp_op)
+    {
+        PetscErrorCode ierr;
+        ierr = MatDestroy(&d_interp_op);
+        IBTK_CHKERRQ(ierr);
+    }
     return;
 } // ~IBMethod
 
@@ -566,12 +589,6 @@ IBMethod::setLinearizedPosition(Vec& X_vec, const double data_time)
     IBTK_CHKERRQ(ierr);
     *X_jac_needs_ghost_fill = true;
 
-    if (d_force_jac)
-    {
-        ierr = MatDestroy(&d_force_jac);
-        IBTK_CHKERRQ(ierr);
-        d_force_jac = NULL;
-    }
     d_force_jac_data_time = data_time;
     int n_local, n_global;
     ierr = VecGetLocalSize(X_vec, &n_local);
@@ -579,16 +596,20 @@ IBMethod::setLinearizedPosition(Vec& X_vec, const double data_time)
     ierr = VecGetSize(X_vec, &n_global);
     IBTK_CHKERRQ(ierr);
 
+    // NOTE: d_force_jac is reused until the Lagrangian data are redistributed.
     if (d_force_jac_mffd)
     {
-        ierr = MatCreateMFFD(PETSC_COMM_WORLD, n_local, n_local, n_global, n_global, &d_force_jac);
-        IBTK_CHKERRQ(ierr);
-        ierr = MatMFFDSetFunction(d_force_jac, computeForce_SAMRAI, this);
-        IBTK_CHKERRQ(ierr);
-        ierr = MatSetOptionsPrefix(d_force_jac, "ib_jac_");
-        IBTK_CHKERRQ(ierr);
-        ierr = MatSetFromOptions(d_force_jac);
-        IBTK_CHKERRQ(ierr);
+        if (!d_force_jac)
+        {
+            ierr = MatCreateMFFD(PETSC_COMM_WORLD, n_local, n_local, n_global, n_global, &d_force_jac);
+            IBTK_CHKERRQ(ierr);
+            ierr = MatMFFDSetFunction(d_force_jac, computeForce_SAMRAI, this);
+            IBTK_CHKERRQ(ierr);
+            ierr = MatSetOptionsPrefix(d_force_jac, "ib_jac_");
+            IBTK_CHKERRQ(ierr);
+            ierr = MatSetFromOptions(d_force_jac);
+            IBTK_CHKERRQ(ierr);
+        }
         ierr = MatMFFDSetBase(d_force_jac, (*X_jac_data)[level_num]->getVec(), NULL);
         IBTK_CHKERRQ(ierr);
         ierr = MatAssemblyBegin(d_force_jac, MAT_FINAL_ASSEMBLY);
@@ -596,33 +617,66 @@ IBMethod::setLinearizedPosition(Vec& X_vec, const double data_time)
         ierr = MatAssemblyEnd(d_force_jac, MAT_FINAL_ASSEMBLY);
         IBTK_CHKERRQ(ierr);
     }
+    else if (d_force_jac_matrix_free)
+    {
+        // The action of the Jacobian is evaluated from the linearized position
+        // at the time of each matrix-vector product.  Configuration-dependent
+        // data are set up here once rather than for every product.
+        d_ib_force_fcn->setupLagrangianForceJacobian(1.0,
+                                                     (*X_jac_data)[level_num],
+                                                     0.0,
+                                                     Pointer<IBTK::LData>(NULL),
+                                                     d_hierarchy,
+                                                     level_num,
+                                                     data_time,
+                                                     d_l_data_manager);
+        if (!d_force_jac)
+        {
+            ierr = MatCreateShell(
+                PETSC_COMM_WORLD, n_local, n_local, n_global, n_global, static_cast<void*>(this), &d_force_jac);
+            IBTK_CHKERRQ(ierr);
+            ierr = MatShellSetOperation(
+                d_force_jac, MATOP_MULT, reinterpret_cast<void (*)(void)>(IBMethod::applyForceJacobian_SAMRAI));
+            IBTK_CHKERRQ(ierr);
+            ierr = MatSetBlockSize(d_force_jac, NDIM);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
     else
     {
-        std::vector<int> d_nnz, o_nnz;
-        d_ib_force_fcn->computeLagrangianForceJacobianNonzeroStructure(
-            d_nnz, o_nnz, d_hierarchy, level_num, d_l_data_manager);
-        std::vector<int> d_nnz_unblocked(NDIM * d_nnz.size()), o_nnz_unblocked(NDIM * o_nnz.size());
-        for (unsigned int k = 0; k < d_nnz.size(); ++k)
+        if (!d_force_jac)
         {
-            for (unsigned int d = 0; d < NDIM; ++d)
+            std::vector<int> d_nnz, o_nnz;
+            d_ib_force_fcn->computeLagrangianForceJacobianNonzeroStructure(
+                d_nnz, o_nnz, d_hierarchy, level_num, d_l_data_manager);
+            std::vector<int> d_nnz_unblocked(NDIM * d_nnz.size()), o_nnz_unblocked(NDIM * o_nnz.size());
+            for (unsigned int k = 0; k < d_nnz.size(); ++k)
             {
-                d_nnz_unblocked[NDIM * k + d] = NDIM * d_nnz[k];
-                o_nnz_unblocked[NDIM * k + d] = NDIM * o_nnz[k];
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    d_nnz_unblocked[NDIM * k + d] = NDIM * d_nnz[k];
+                    o_nnz_unblocked[NDIM * k + d] = NDIM * o_nnz[k];
+                }
             }
+            ierr = MatCreateAIJ(PETSC_COMM_WORLD,
+                                n_local,
+                                n_local,
+                                n_global,
+                                n_global,
+                                0,
+                                n_local ? &d_nnz_unblocked[0] : NULL,
+                                0,
+                                n_local ? &o_nnz_unblocked[0] : NULL,
+                                &d_force_jac);
+            IBTK_CHKERRQ(ierr);
+            ierr = MatSetBlockSize(d_force_jac, NDIM);
+            IBTK_CHKERRQ(ierr);
+        }
+        else
+        {
+            ierr = MatZeroEntries(d_force_jac);
+            IBTK_CHKERRQ(ierr);
         }
-        ierr = MatCreateAIJ(PETSC_COMM_WORLD,
-                            n_local,
-                            n_local,
-                            n_global,
-                            n_global,
-                            0,
-                            n_local ? &d_nnz_unblocked[0] : NULL,
-                            0,
-                            n_local ? &o_nnz_unblocked[0] : NULL,
-                            &d_force_jac);
-        IBTK_CHKERRQ(ierr);
-        ierr = MatSetBlockSize(d_force_jac, NDIM);
-        IBTK_CHKERRQ(ierr);
         d_ib_force_fcn->computeLagrangianForceJacobian(d_force_jac,
                                                        MAT_FINAL_ASSEMBLY,
                                                        1.0,
@@ -633,6 +687,10 @@ IBMethod::setLinearizedPosition(Vec& X_vec, const double data_time)
                                                        level_num,
                                                        data_time,
                                                        d_l_data_manager);
+
+        // The non-zero structure is fixed by the first assembly.
+        ierr = MatSetOption(d_force_jac, MAT_NEW_NONZERO_LOCATION_ERR, PETSC_TRUE);
+        IBTK_CHKERRQ(ierr);
     }
     return;
 } // setLinearizedPosition
@@ -691,11 +749,34 @@ IBMethod::interpolateVelocity(const int u_data_idx,
                               const std::vector<Pointer<RefineSchedule<NDIM> > >& u_ghost_fill_scheds,
                               const double data_time)
 {
+    ProfilingScope profiling_scope("interp");
     std::vector<Pointer<LData> > *U_data, *X_LE_data;
     bool* X_LE_needs_ghost_fill;
     getVelocityData(&U_data, data_time);
     getLECouplingPositionData(&X_LE_data, &X_LE_needs_ghost_fill, data_time);
+
+    // Interpolation only requires the local positions, so the ghost node
+    // values that will be needed to spread forces at the same time are
+    // communicated while the velocity is interpolated.
+    const int coarsest_ln = 0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    const bool X_LE_ghost_update = *X_LE_needs_ghost_fill;
+    if (X_LE_ghost_update)
+    {
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            if (d_l_data_manager->levelContainsLagrangianData(ln)) (*X_LE_data)[ln]->beginGhostUpdate();
+        }
+    }
     d_l_data_manager->interp(u_data_idx, *U_data, *X_LE_data, u_synch_scheds, u_ghost_fill_scheds, data_time);
+    if (X_LE_ghost_update)
+    {
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            if (d_l_data_manager->levelContainsLagrangianData(ln)) (*X_LE_data)[ln]->endGhostUpdate();
+        }
+        *X_LE_needs_ghost_fill = false;
+    }
     resetAnchorPointValues(*U_data,
                            /*coarsest_ln*/ 0,
                            /*finest_ln*/ d_hierarchy->getFinestLevelNumber());
@@ -844,6 +925,7 @@ IBMethod::hasFluidSources() const
 void
 IBMethod::computeLagrangianForce(const double data_time)
 {
+    ProfilingScope profiling_scope("force");
     int ierr;
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
@@ -888,6 +970,15 @@ IBMethod::constructLagrangianForceJacobian(Mat& A, MatType mat_type, const doubl
 {
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
 
+    // NOTE: The returned matrix holds a new reference to the cached Jacobian,
+    // which must be released by the caller with MatDestroy().
+    int ierr;
+    if (A)
+    {
+        ierr = MatDestroy(&A);
+        IBTK_CHKERRQ(ierr);
+    }
+
     if (!strcmp(mat_type, MATMFFD) || !strcmp(mat_type, MATSHELL))
     {
         if (!d_force_jac)
@@ -896,16 +987,11 @@ IBMethod::constructLagrangianForceJacobian(Mat& A, MatType mat_type, const doubl
             setLinearizedPosition(X_current, data_time);
         }
         A = d_force_jac;
+        ierr = PetscObjectReference(reinterpret_cast<PetscObject>(A));
+        IBTK_CHKERRQ(ierr);
     }
     else
     {
-        int ierr;
-        if (A)
-        {
-            ierr = MatDestroy(&A);
-            IBTK_CHKERRQ(ierr);
-        }
-
         // Get the "frozen" position for Lagrangian structure.
         std::vector<Pointer<LData> >* X_LE_data;
         bool* X_LE_needs_ghost_fill;
@@ -913,71 +999,87 @@ IBMethod::constructLagrangianForceJacobian(Mat& A, MatType mat_type, const doubl
 
         TBOX_ASSERT(d_ib_force_fcn);
 
-        // Build the Jacobian matrix.
-        const int num_local_nodes = d_l_data_manager->getNumberOfLocalNodes(finest_ln);
-        std::vector<int> d_nnz, o_nnz;
-        d_ib_force_fcn->computeLagrangianForceJacobianNonzeroStructure(
-            d_nnz, o_nnz, d_hierarchy, finest_ln, d_l_data_manager);
-        if (!strcmp(mat_type, MATBAIJ) || !strcmp(mat_type, MATMPIBAIJ))
+        // Build the Jacobian matrix.  The matrix is reused, and only its values
+        // are refreshed, until the Lagrangian data are redistributed.
+        if (d_assembled_force_jac && d_assembled_force_jac_type != mat_type)
         {
-            ierr = MatCreateBAIJ(PETSC_COMM_WORLD,
-                                 NDIM,
-                                 NDIM * num_local_nodes,
-                                 NDIM * num_local_nodes,
-                                 PETSC_DETERMINE,
-                                 PETSC_DETERMINE,
-                                 0,
-                                 num_local_nodes ? &d_nnz[0] : NULL,
-                                 0,
-                                 num_local_nodes ? &o_nnz[0] : NULL,
-                                 &A);
+            ierr = MatDestroy(&d_assembled_force_jac);
             IBTK_CHKERRQ(ierr);
+            d_assembled_force_jac = NULL;
         }
-        else if (!strcmp(mat_type, MATAIJ) || !strcmp(mat_type, MATMPIAIJ))
+        if (d_assembled_force_jac)
         {
-            std::vector<int> d_nnz_unblocked(NDIM * d_nnz.size()), o_nnz_unblocked(NDIM * o_nnz.size());
-            for (unsigned int k = 0; k < d_nnz.size(); ++k)
+            ierr = MatZeroEntries(d_assembled_force_jac);
+            IBTK_CHKERRQ(ierr);
+        }
+        else
+        {
+            const int num_local_nodes = d_l_data_manager->getNumberOfLocalNodes(finest_ln);
+            std::vector<int> d_nnz, o_nnz;
+            d_ib_force_fcn->computeLagrangianForceJacobianNonzeroStructure(
+                d_nnz, o_nnz, d_hierarchy, finest_ln, d_l_data_manager);
+            if (!strcmp(mat_type, MATBAIJ) || !strcmp(mat_type, MATMPIBAIJ))
             {
-                for (unsigned int d = 0; d < NDIM; ++d)
+                ierr = MatCreateBAIJ(PETSC_COMM_WORLD,
+                                     NDIM,
+                                     NDIM * num_local_nodes,
+                                     NDIM * num_local_nodes,
+                                     PETSC_DETERMINE,
+                                     PETSC_DETERMINE,
+                                     0,
+                                     num_local_nodes ? &d_nnz[0] : NULL,
+                                     0,
+                                     num_local_nodes ? &o_nnz[0] : NULL,
+                                     &d_assembled_force_jac);
+                IBTK_CHKERRQ(ierr);
+            }
+            else if (!strcmp(mat_type, MATAIJ) || !strcmp(mat_type, MATMPIAIJ))
+            {
+                std::vector<int> d_nnz_unblocked(NDIM * d_nnz.size()), o_nnz_unblocked(NDIM * o_nnz.size());
+                for (unsigned int k = 0; k < d_nnz.size(); ++k)
                 {
-                    d_nnz_unblocked[NDIM * k + d] = NDIM * d_nnz[k];
-                    o_nnz_unblocked[NDIM * k + d] = NDIM * o_nnz[k];
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        d_nnz_unblocked[NDIM * k + d] = NDIM * d_nnz[k];
+                        o_nnz_unblocked[NDIM * k + d] = NDIM * o_nnz[k];
+                    }
                 }
+                ierr = MatCreateAIJ(PETSC_COMM_WORLD,
+                                    NDIM * num_local_nodes,
+                                    NDIM * num_local_nodes,
+                                    PETSC_DETERMINE,
+                                    PETSC_DETERMINE,
+                                    0,
+                                    num_local_nodes ? &d_nnz_unblocked[0] : NULL,
+                                    0,
+                                    num_local_nodes ? &o_nnz_unblocked[0] : NULL,
+                                    &d_assembled_force_jac);
+                IBTK_CHKERRQ(ierr);
             }
-            ierr = MatCreateAIJ(PETSC_COMM_WORLD,
-                                NDIM * num_local_nodes,
-                                NDIM * num_local_nodes,
-                                PETSC_DETERMINE,
-                                PETSC_DETERMINE,
-                                0,
-                                num_local_nodes ? &d_nnz_unblocked[0] : NULL,
-                                0,
-                                num_local_nodes ? &o_nnz_unblocked[0] : NULL,
-                                &A);
+            else
+            {
+                TBOX_ERROR(d_object_name + "::getLagrangianForceJacobian()."
+                           << "Matrix of the type "
+                           << mat_type
+                           << " given. Supported types are "
+                           << MATSHELL
+                           << "/"
+                           << MATMFFD
+                           << " , "
+                           << MATBAIJ
+                           << "/"
+                           << MATMPIBAIJ
+                           << " , "
+                           << MATAIJ
+                           << "/"
+                           << MATMPIAIJ
+                           << std::endl);
+            }
+            ierr = MatSetBlockSize(d_assembled_force_jac, NDIM);
             IBTK_CHKERRQ(ierr);
+            d_assembled_force_jac_type = mat_type;
         }
-        else
-        {
-            TBOX_ERROR(d_object_name + "::getLagrangianForceJacobian()."
-                       << "Matrix of the type "
-                       << mat_type
-                       << " given. Supported types are "
-                       << MATSHELL
-                       << "/"
-                       << MATMFFD
-                       << " , "
-                       << MATBAIJ
-                       << "/"
-                       << MATMPIBAIJ
-                       << " , "
-                       << MATAIJ
-                       << "/"
-                       << MATMPIAIJ
-                       << std::endl);
-        }
-        ierr = MatSetBlockSize(A, NDIM);
-        IBTK_CHKERRQ(ierr);
-        d_ib_force_fcn->computeLagrangianForceJacobian(A,
+        d_ib_force_fcn->computeLagrangianForceJacobian(d_assembled_force_jac,
                                                        MAT_FINAL_ASSEMBLY,
                                                        1.0,
                                                        (*X_LE_data)[finest_ln],
@@ -987,6 +1089,11 @@ IBMethod::constructLagrangianForceJacobian(Mat& A, MatType mat_type, const doubl
                                                        finest_ln,
                                                        data_time,
                                                        d_l_data_manager);
+        ierr = MatSetOption(d_assembled_force_jac, MAT_NEW_NONZERO_LOCATION_ERR, PETSC_TRUE);
+        IBTK_CHKERRQ(ierr);
+        A = d_assembled_force_jac;
+        ierr = PetscObjectReference(reinterpret_cast<PetscObject>(A));
+        IBTK_CHKERRQ(ierr);
     }
     return;
 } // getLagrangianForceJacobian
@@ -997,6 +1104,7 @@ IBMethod::spreadForce(const int f_data_idx,
                       const std::vector<Pointer<RefineSchedule<NDIM> > >& f_prolongation_scheds,
                       const double data_time)
 {
+    ProfilingScope profiling_scope("spread");
     std::vector<Pointer<LData> > *F_data, *X_LE_data;
     bool *F_needs_ghost_fill, *X_LE_needs_ghost_fill;
     getForceData(&F_data, &F_needs_ghost_fill, data_time);
@@ -1063,13 +1171,43 @@ IBMethod::constructInterpOp(Mat& J,
     bool* X_LE_needs_ghost_fill;
     getLECouplingPositionData(&X_LE_data, &X_LE_needs_ghost_fill, data_time);
 
-    // Build the Jacobian matrix.
+    // Update the cached interpolation operator in place when possible;
+    // otherwise, rebuild it.
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
     Pointer<PatchLevel<NDIM> > finest_level = d_hierarchy->getPatchLevel(finest_ln);
     Vec X_vec = (*X_LE_data)[finest_ln]->getVec();
-    PETScMatUtilities::constructPatchLevelSCInterpOp(
-        J, spread_fnc, stencil_width, X_vec, num_dofs_per_proc, dof_index_idx, finest_level);
+    bool rebuild = d_interp_op_needs_rebuild || !d_interp_op || d_interp_op_fcn != spread_fnc ||
+                   d_interp_op_stencil != stencil_width || d_interp_op_dof_index_idx != dof_index_idx ||
+                   d_interp_op_num_dofs_per_proc != num_dofs_per_proc;
+    if (!rebuild)
+    {
+        rebuild = !PETScMatUtilities::updatePatchLevelSCInterpOp(
+            d_interp_op, spread_fnc, stencil_width, X_vec, d_interp_op_X, dof_index_idx, finest_level);
+    }
+    if (rebuild)
+    {
+        PETScMatUtilities::constructPatchLevelSCInterpOp(
+            d_interp_op, spread_fnc, stencil_width, X_vec, num_dofs_per_proc, dof_index_idx, finest_level);
+        int m_local;
+        ierr = VecGetLocalSize(X_vec, &m_local);
+        IBTK_CHKERRQ(ierr);
+        const double* X_arr;
+        ierr = VecGetArrayRead(X_vec, &X_arr);
+        IBTK_CHKERRQ(ierr);
+        d_interp_op_X.assign(X_arr, X_arr + m_local);
+        ierr = VecRestoreArrayRead(X_vec, &X_arr);
+        IBTK_CHKERRQ(ierr);
+        d_interp_op_fcn = spread_fnc;
+        d_interp_op_stencil = stencil_width;
+        d_interp_op_dof_index_idx = dof_index_idx;
+        d_interp_op_num_dofs_per_proc = num_dofs_per_proc;
+        d_interp_op_needs_rebuild = false;
+    }
 
+    // Hand a new reference to the cached operator back to the caller.
+    J = d_interp_op;
+    ierr = PetscObjectReference(reinterpret_cast<PetscObject>(J));
+    IBTK_CHKERRQ(ierr);
     return;
 
 } // getInterpOperator
@@ -1500,6 +1638,12 @@ IBMethod::initializePatchHierarchy(Pointer<PatchHierarchy<NDIM> > hierarchy,
         ierr = MatDestroy(&d_force_jac);
         IBTK_CHKERRQ(ierr);
     }
+    if (d_assembled_force_jac)
+    {
+        PetscErrorCode ierr;
+        ierr = MatDestroy(&d_assembled_force_jac);
+        IBTK_CHKERRQ(ierr);
+    }
     return;
 } // initializePatchHierarchy
 
@@ -1526,6 +1670,22 @@ void IBMethod::beginDataRedistribution(Pointer<PatchHierarchy<NDIM> > /*hierarch
                                        Pointer<GriddingAlgorithm<NDIM> > /*gridding_alg*/)
 {
     d_l_data_manager->beginDataRedistribution();
+
+    // The cached interpolation operator and Jacobian matrices are invalidated by
+    // the redistribution of the Lagrangian data.
+    d_interp_op_needs_rebuild = true;
+    if (d_force_jac)
+    {
+        PetscErrorCode ierr;
+        ierr = MatDestroy(&d_force_jac);
+        IBTK_CHKERRQ(ierr);
+    }
+    if (d_assembled_force_jac)
+    {
+        PetscErrorCode ierr;
+        ierr = MatDestroy(&d_assembled_force_jac);
+        IBTK_CHKERRQ(ierr);
+    }
     return;
 } // beginDataRedistribution
 
@@ -1582,12 +1742,60 @@ IBMethod::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > hierarchy,
         X_data[ln]->restoreArrays();
     }
 
+    // Record the positions of the local IB points so that displacements since
+    // the last redistribution can be measured.
+    d_X_redistribution_data.clear();
+    d_X_redistribution_data.resize(hierarchy->getFinestLevelNumber() + 1);
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+        const double* const X_arr = X_data[ln]->getLocalFormVecArray()->data();
+        d_X_redistribution_data[ln].assign(X_arr, X_arr + NDIM * X_data[ln]->getLocalNodeCount());
+        X_data[ln]->restoreArrays();
+    }
+
     // Indicate that the force and source strategies need to be re-initialized.
     d_ib_force_fcn_needs_init = true;
     d_ib_source_fcn_needs_init = true;
     return;
 } // endDataRedistribution
 
+double
+IBMethod::getMaxPointDisplacement() const
+{
+    // Displacements are not available until the Lagrangian data have been
+    // redistributed at least once.
+    if (d_X_redistribution_data.empty()) return -1.0;
+
+    double max_displacement = 0.0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+    const double* const dx0 = grid_geom->getDx();
+    for (int ln = 0; ln <= finest_ln && ln < static_cast<int>(d_X_redistribution_data.size()); ++ln)
+    {
+        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+        Pointer<LData> X_data = d_l_data_manager->getLData(LDataManager::POSN_DATA_NAME, ln);
+        const std::vector<double>& X_old = d_X_redistribution_data[ln];
+        const unsigned int n_local = NDIM * X_data->getLocalNodeCount();
+        if (X_old.size() != n_local)
+        {
+            TBOX_ERROR(d_object_name << "::getMaxPointDisplacement():\n"
+                                     << "  Lagrangian data has changed since the last redistribution on level " << ln
+                                     << std::endl);
+        }
+        const IntVector<NDIM>& ratio = d_hierarchy->getPatchLevel(ln)->getRatio();
+        const double* const X_arr = X_data->getLocalFormVecArray()->data();
+        for (unsigned int k = 0; k < n_local; ++k)
+        {
+            const int d = k % NDIM;
+            const double dx = dx0[d] / static_cast<double>(ratio(d));
+            max_displacement = std::max(max_displacement, std::abs(X_arr[k] - X_old[k]) / dx);
+        }
+        X_data->restoreArrays();
+    }
+    return SAMRAI_MPI::maxReduction(max_displacement);
+} // getMaxPointDisplacement
+
 void
 IBMethod::initializeLevelData(Pointer<BasePatchHierarchy<NDIM> > hierarchy,
                               int level_number,
@@ -1634,6 +1842,9 @@ IBMethod::resetHierarchyConfiguration(Pointer<BasePatchHierarchy<NDIM> > hierarc
     d_P_src.resize(finest_hier_level + 1);
     d_Q_src.resize(finest_hier_level + 1);
     d_n_src.resize(finest_hier_level + 1, 0);
+
+    // The DOF indexing of the finest level is no longer valid.
+    d_interp_op_needs_rebuild = true;
     return;
 } // resetHierarchyConfiguration
 
@@ -2067,9 +2278,19 @@ IBMethod::getFromInput(Pointer<Database> db, bool is_from_restart)
         if (db->isBool("normalize_source_strength"))
             d_normalize_source_strength = db->getBool("normalize_source_strength");
     }
+    if (db->isDatabase("LEInteractor")) LEInteractor::setFromDatabase(db->getDatabase("LEInteractor"));
     if (db->keyExists("error_if_points_leave_domain"))
         d_error_if_points_leave_domain = db->getBool("error_if_points_leave_domain");
+    if (db->keyExists("use_morton_node_ordering"))
+        d_use_morton_node_ordering = db->getBool("use_morton_node_ordering");
     if (db->keyExists("force_jac_mffd")) d_force_jac_mffd = db->getBool("force_jac_mffd");
+    if (db->keyExists("force_jac_matrix_free")) d_force_jac_matrix_free = db->getBool("force_jac_matrix_free");
+    if (d_force_jac_mffd && d_force_jac_matrix_free)
+    {
+        TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                 << "  force_jac_mffd and force_jac_matrix_free cannot both be TRUE"
+                                 << std::endl);
+    }
     if (db->keyExists("do_log"))
         d_do_log = db->getBool("do_log");
     else if (db->keyExists("enable_logging"))
@@ -2179,6 +2400,44 @@ IBMethod::computeForce(Vec X, Vec F)
     return ierr;
 } // computeForce
 
+PetscErrorCode
+IBMethod::applyForceJacobian_SAMRAI(Mat A, Vec V, Vec F)
+{
+    PetscErrorCode ierr;
+    void* ctx;
+    ierr = MatShellGetContext(A, &ctx);
+    CHKERRQ(ierr);
+    IBMethod* ib_method_ops = static_cast<IBMethod*>(ctx);
+    ierr = ib_method_ops->applyForceJacobian(V, F);
+    CHKERRQ(ierr);
+    return ierr;
+} // applyForceJacobian_SAMRAI
+
+PetscErrorCode
+IBMethod::applyForceJacobian(Vec V, Vec F)
+{
+    PetscErrorCode ierr;
+    std::vector<Pointer<LData> >* X_jac_data;
+    bool* X_jac_needs_ghost_fill;
+    getLinearizedPositionData(&X_jac_data, &X_jac_needs_ghost_fill);
+    const int level_num = d_hierarchy->getFinestLevelNumber();
+    Pointer<LData> V_data = new LData("IBMethod::V", V, std::vector<int>(), false);
+    Pointer<LData> F_data = new LData("IBMethod::F", F, std::vector<int>(), false);
+    ierr = VecSet(F, 0.0);
+    CHKERRQ(ierr);
+    d_ib_force_fcn->applyLagrangianForceJacobian(F_data,
+                                                 V_data,
+                                                 1.0,
+                                                 (*X_jac_data)[level_num],
+                                                 0.0,
+                                                 Pointer<IBTK::LData>(NULL),
+                                                 d_hierarchy,
+                                                 level_num,
+                                                 d_force_jac_data_time,
+                                                 d_l_data_manager);
+    return ierr;
+} // applyForceJacobian
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
@@ -39,6 +39,7 @@
 #include <iterator>
 #include <limits>
 #include <map>
+#include <numeric>
 #include <ostream>
 #include <set>
 #include <utility>
@@ -123,6 +124,294 @@ resetLocalOrNonlocalPETScIndices(std::vector<int>& inds,
     }
     return;
 } // resetLocalOrNonlocalPETScIndices
+
+// Maximum number of force elements processed together in a single batch.
+static const int FORCE_BATCH_SIZE = 64;
+
+// Orders force elements first by color and then by a secondary sort key.
+struct ForceElementOrder
+{
+    ForceElementOrder(const std::vector<int>& colors, const std::vector<int>& keys) : d_colors(colors), d_keys(keys)
+    {
+        // intentionally blank
+        return;
+    } // ForceElementOrder
+
+    bool operator()(const int a, const int b) const
+    {
+        if (d_colors[a] != d_colors[b]) return d_colors[a] < d_colors[b];
+        return !d_keys.empty() && d_keys[a] < d_keys[b];
+    } // operator()
+
+    const std::vector<int>& d_colors;
+    const std::vector<int>& d_keys;
+};
+
+// Greedily color a collection of force elements so that no two elements of
+// the same color share a node, and determine the permutation that sorts the
+// elements by color and then by the (optional) sort keys.
+//
+// NOTE: The node indices are local PETSc indices multiplied by NDIM.
+void
+color_force_elements(std::vector<int>& perm,
+                     std::vector<int>& color_offsets,
+                     const std::vector<const std::vector<int>*>& elem_node_idxs,
+                     const std::vector<int>& sort_keys)
+{
+    const int num_elems = static_cast<int>(elem_node_idxs[0]->size());
+    int max_node_idx = -1;
+    for (unsigned int i = 0; i < elem_node_idxs.size(); ++i)
+    {
+        for (int k = 0; k < num_elems; ++k)
+        {
+            max_node_idx = std::max(max_node_idx, (*elem_node_idxs[i])[k] / NDIM);
+        }
+    }
+    std::vector<std::vector<int> > node_colors(max_node_idx + 1);
+    std::vector<int> elem_colors(num_elems);
+    int num_colors = 0;
+    for (int k = 0; k < num_elems; ++k)
+    {
+        // Find the smallest color not already used by any node of the element.
+        int color = 0;
+        bool color_is_used = true;
+        while (color_is_used)
+        {
+            color_is_used = false;
+            for (unsigned int i = 0; i < elem_node_idxs.size() && !color_is_used; ++i)
+            {
+                const std::vector<int>& colors = node_colors[(*elem_node_idxs[i])[k] / NDIM];
+                color_is_used = std::find(colors.begin(), colors.end(), color) != colors.end();
+            }
+            if (color_is_used) ++color;
+        }
+        elem_colors[k] = color;
+        for (unsigned int i = 0; i < elem_node_idxs.size(); ++i)
+        {
+            node_colors[(*elem_node_idxs[i])[k] / NDIM].push_back(color);
+        }
+        num_colors = std::max(num_colors, color + 1);
+    }
+
+    perm.resize(num_elems);
+    for (int k = 0; k < num_elems; ++k) perm[k] = k;
+    std::stable_sort(perm.begin(), perm.end(), ForceElementOrder(elem_colors, sort_keys));
+    color_offsets.assign(num_colors + 1, 0);
+    for (int k = 0; k < num_elems; ++k) ++color_offsets[elem_colors[k] + 1];
+    std::partial_sum(color_offsets.begin(), color_offsets.end(), color_offsets.begin());
+    return;
+} // color_force_elements
+
+template <class T>
+void
+permute_vector(std::vector<T>& v, const std::vector<int>& perm)
+{
+    std::vector<T> v_perm(v.size());
+    for (unsigned int k = 0; k < perm.size(); ++k)
+    {
+        v_perm[k] = v[perm[k]];
+    }
+    v.swap(v_perm);
+    return;
+} // permute_vector
+
+// Accumulate the forces generated by a batch of springs that share the same
+// force function.  The springs in the batch must not share nodes.
+inline void
+compute_spring_batch_force(double* const F_node,
+                           const double* const X_node,
+                           const int begin,
+                           const int end,
+                           const int* const petsc_mastr_node_idxs,
+                           const int* const petsc_slave_node_idxs,
+                           const int* const lag_mastr_node_idxs,
+                           const int* const lag_slave_node_idxs,
+                           const double* const* const parameters,
+                           const SpringForceFcnPtr force_fcn,
+                           const SpringForceBatchFcnPtr force_batch_fcn)
+{
+    const int n = end - begin;
+    double D[NDIM][FORCE_BATCH_SIZE], R[FORCE_BATCH_SIZE], T_over_R[FORCE_BATCH_SIZE];
+
+    // Gather the spring displacements.
+    for (int j = 0; j < n; ++j)
+    {
+        const int mastr_idx = petsc_mastr_node_idxs[begin + j];
+        const int slave_idx = petsc_slave_node_idxs[begin + j];
+#if !defined(NDEBUG)
+        TBOX_ASSERT(mastr_idx != slave_idx);
+#endif
+        for (int d = 0; d < NDIM; ++d)
+        {
+            D[d][j] = X_node[slave_idx + d] - X_node[mastr_idx + d];
+        }
+    }
+
+    // Compute the spring lengths.
+    for (int j = 0; j < n; ++j)
+    {
+#if (NDIM == 2)
+        R[j] = sqrt(D[0][j] * D[0][j] + D[1][j] * D[1][j]);
+#endif
+#if (NDIM == 3)
+        R[j] = sqrt(D[0][j] * D[0][j] + D[1][j] * D[1][j] + D[2][j] * D[2][j]);
+#endif
+    }
+
+    // Compute the spring tensions.  Springs of zero length do not generate
+    // forces.
+    if (force_batch_fcn)
+    {
+        force_batch_fcn(
+            n, R, parameters + begin, lag_mastr_node_idxs + begin, lag_slave_node_idxs + begin, T_over_R);
+    }
+    else
+    {
+        for (int j = 0; j < n; ++j)
+        {
+            const int k = begin + j;
+            T_over_R[j] = UNLIKELY(R[j] < std::numeric_limits<double>::epsilon()) ?
+                              0.0 :
+                              force_fcn(R[j], parameters[k], lag_mastr_node_idxs[k], lag_slave_node_idxs[k]);
+        }
+    }
+    for (int j = 0; j < n; ++j)
+    {
+        T_over_R[j] = R[j] < std::numeric_limits<double>::epsilon() ? 0.0 : T_over_R[j] / R[j];
+    }
+
+    // Scatter the spring forces to the nodes.
+    for (int j = 0; j < n; ++j)
+    {
+        const int mastr_idx = petsc_mastr_node_idxs[begin + j];
+        const int slave_idx = petsc_slave_node_idxs[begin + j];
+        for (int d = 0; d < NDIM; ++d)
+        {
+            const double F = T_over_R[j] * D[d][j];
+            F_node[mastr_idx + d] += F;
+            F_node[slave_idx + d] -= F;
+        }
+    }
+    return;
+} // compute_spring_batch_force
+
+// Accumulate the forces generated by a batch of beams.  The beams in the batch
+// must not share nodes.
+inline void
+compute_beam_batch_force(double* const F_node,
+                         const double* const X_node,
+                         const int begin,
+                         const int end,
+                         const int* const petsc_mastr_node_idxs,
+                         const int* const petsc_next_node_idxs,
+                         const int* const petsc_prev_node_idxs,
+                         const double* const* const rigidities,
+                         const Vector* const* const curvatures)
+{
+    const int n = end - begin;
+    double K[FORCE_BATCH_SIZE], F[NDIM][FORCE_BATCH_SIZE];
+
+    // Gather the discrete curvatures.
+    for (int j = 0; j < n; ++j)
+    {
+        const int k = begin + j;
+        const int mastr_idx = petsc_mastr_node_idxs[k];
+        const int next_idx = petsc_next_node_idxs[k];
+        const int prev_idx = petsc_prev_node_idxs[k];
+#if !defined(NDEBUG)
+        TBOX_ASSERT(mastr_idx != next_idx);
+        TBOX_ASSERT(mastr_idx != prev_idx);
+#endif
+        const double* const D2X0 = curvatures[k]->data();
+        K[j] = *rigidities[k];
+        for (int d = 0; d < NDIM; ++d)
+        {
+            F[d][j] = X_node[next_idx + d] + X_node[prev_idx + d] - 2.0 * X_node[mastr_idx + d] - D2X0[d];
+        }
+    }
+
+    // Compute the beam forces.
+    for (int d = 0; d < NDIM; ++d)
+    {
+        for (int j = 0; j < n; ++j)
+        {
+            F[d][j] *= K[j];
+        }
+    }
+
+    // Scatter the beam forces to the nodes.
+    for (int j = 0; j < n; ++j)
+    {
+        const int k = begin + j;
+        const int mastr_idx = petsc_mastr_node_idxs[k];
+        const int next_idx = petsc_next_node_idxs[k];
+        const int prev_idx = petsc_prev_node_idxs[k];
+        for (int d = 0; d < NDIM; ++d)
+        {
+            F_node[mastr_idx + d] += 2.0 * F[d][j];
+            F_node[next_idx + d] -= F[d][j];
+            F_node[prev_idx + d] -= F[d][j];
+        }
+    }
+    return;
+} // compute_beam_batch_force
+
+// Compute the Jacobian of the force applied by a spring to its "master" node
+// with respect to the position of its "slave" node.
+inline void
+compute_spring_jacobian_block(double* const dF_dX,
+                              const double* const X_node,
+                              const int petsc_mastr_idx,
+                              const int petsc_slave_idx,
+                              const int lag_mastr_idx,
+                              const int lag_slave_idx,
+                              const double* const params,
+                              const SpringForceFcnPtr force_fcn,
+                              const SpringForceDerivFcnPtr force_deriv_fcn,
+                              const double X_coef)
+{
+    Vector D;
+    for (unsigned int i = 0; i < NDIM; ++i)
+    {
+        D(i) = X_node[petsc_slave_idx + i] - X_node[petsc_mastr_idx + i];
+    }
+    const double R = D.norm();
+    const double T = force_fcn(R, params, lag_mastr_idx, lag_slave_idx);
+    double dT_dR;
+    if (!force_deriv_fcn)
+    {
+        // Use finite differences to approximate dT/dR.
+        const double eps = std::max(R, 1.0) * pow(std::numeric_limits<double>::epsilon(), 1.0 / 3.0);
+        dT_dR = (force_fcn(R + eps, params, lag_mastr_idx, lag_slave_idx) -
+                 force_fcn(R - eps, params, lag_mastr_idx, lag_slave_idx)) /
+                (2.0 * eps);
+    }
+    else
+    {
+        dT_dR = force_deriv_fcn(R, params, lag_mastr_idx, lag_slave_idx);
+    }
+
+    // F = T(R) D/R
+    //
+    // dF_k/dx_l = (dT/dR * dR/dx_l * D/R) + (T/R * dD/dx_l) + (T *D* (-1/R^2)* dR/dx_l)
+    //
+    // dR/dx_l = 1/R * D if x_l is "slave" and dR/dx_l = -1/R * D if x_l is "master"
+    //
+    // dD/dx_l = e_l outer e_k dD_k/dx_l = e_l outer e_l = I if x_l is "slave"
+    // and e_l outer -e_l = -I if x_l is master.
+    //
+    // => dF_k/dx_l = (1/R^2 * dT/dR * D outer D) + (T/R * I) - (1/R^2 * T/R * D outer D) if x_l is "slave"
+    // and -dF_k/dx_l if x_l is "master"
+    for (unsigned int i = 0; i < NDIM; ++i)
+    {
+        for (unsigned int j = 0; j < NDIM; ++j)
+        {
+            dF_dX[i * NDIM + j] =
+                X_coef * ((T / R) * ((i == j ? 1.0 : 0.0)) + (dT_dR - T / R) * D[i] * D[j] / (R * R));
+        }
+    }
+    return;
+} // compute_spring_jacobian_block
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -130,16 +419,19 @@ resetLocalOrNonlocalPETScIndices(std::vector<int>& inds,
 IBStandardForceGen::IBStandardForceGen(Pointer<Database> input_db)
 {
     // Setup the default force generation functions.
-    registerSpringForceFunction(0, &default_spring_force, &default_spring_force_deriv);
+    registerSpringForceFunction(0, &default_spring_force, &default_spring_force_deriv, &default_spring_force_batch);
 
     // Set some default values.
     d_log_target_point_displacements = false;
+    d_use_threaded_force_evaluation = false;
 
     // Set up force generator from input.
     if (input_db)
     {
         if (input_db->keyExists("log_target_point_displacements"))
             d_log_target_point_displacements = input_db->getBool("log_target_point_displacements");
+        if (input_db->keyExists("use_threaded_force_evaluation"))
+            d_use_threaded_force_evaluation = input_db->getBool("use_threaded_force_evaluation");
     }
     return;
 } // IBStandardForceGen
@@ -153,10 +445,12 @@ IBStandardForceGen::~IBStandardForceGen()
 void
 IBStandardForceGen::registerSpringForceFunction(const int force_fcn_index,
                                                 const SpringForceFcnPtr spring_force_fcn_ptr,
-                                                const SpringForceDerivFcnPtr spring_force_deriv_fcn_ptr)
+                                                const SpringForceDerivFcnPtr spring_force_deriv_fcn_ptr,
+                                                const SpringForceBatchFcnPtr spring_force_batch_fcn_ptr)
 {
     d_spring_force_fcn_map[force_fcn_index] = spring_force_fcn_ptr;
     d_spring_force_deriv_fcn_map[force_fcn_index] = spring_force_deriv_fcn_ptr;
+    d_spring_force_batch_fcn_map[force_fcn_index] = spring_force_batch_fcn_ptr;
     return;
 } // registerSpringForceFunction
 
@@ -183,8 +477,14 @@ IBStandardForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM> > hie
     d_target_point_data.resize(new_size);
     d_X_ghost_data.resize(new_size);
     d_F_ghost_data.resize(new_size);
+    d_V_ghost_data.resize(new_size);
     d_dX_data.resize(new_size);
     d_is_initialized.resize(new_size, false);
+    d_jac_d_nnz.resize(new_size);
+    d_jac_o_nnz.resize(new_size);
+    d_jac_nnz_is_cached.resize(new_size, false);
+    d_jac_blocks_X_data.resize(new_size, NULL);
+    d_jac_blocks_X_coef.resize(new_size, 0.0);
 
     // Keep track of all of the nonlocal PETSc indices required to compute the
     // forces.
@@ -224,6 +524,10 @@ IBStandardForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM> > hie
     F_name_stream << "IBStandardForceGen::F_ghost_" << level_number;
     d_F_ghost_data[level_number] = new LData(F_name_stream.str(), num_local_nodes, NDIM, nonlocal_petsc_idxs);
 
+    std::ostringstream V_name_stream;
+    V_name_stream << "IBStandardForceGen::V_ghost_" << level_number;
+    d_V_ghost_data[level_number] = new LData(V_name_stream.str(), num_local_nodes, NDIM, nonlocal_petsc_idxs);
+
     std::ostringstream dX_name_stream;
     dX_name_stream << "IBStandardForceGen::dX_" << level_number;
     d_dX_data[level_number] = new LData(dX_name_stream.str(), num_local_nodes, NDIM);
@@ -296,6 +600,17 @@ IBStandardForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM> > hie
                    d_target_point_data[level_number].petsc_global_node_idxs.begin(),
                    std::bind2nd(std::multiplies<int>(), NDIM));
 
+    // Reorder the springs and beams so that force elements that do not share
+    // nodes can be processed concurrently.
+    setupSpringBatches(level_number);
+    setupBeamColors(level_number);
+
+    // The non-zero structure of the force Jacobian must be recomputed.
+    d_jac_d_nnz[level_number].clear();
+    d_jac_o_nnz[level_number].clear();
+    d_jac_nnz_is_cached[level_number] = false;
+    d_jac_blocks_X_data[level_number] = NULL;
+
     // Indicate that the level data has been initialized.
     d_is_initialized[level_number] = true;
     return;
@@ -366,6 +681,15 @@ IBStandardForceGen::computeLagrangianForceJacobianNonzeroStructure(std::vector<i
     TBOX_ASSERT(d_is_initialized[level_number]);
 #endif
 
+    // The non-zero structure does not change until the level data are
+    // reinitialized, so we reuse any previously computed structure.
+    if (d_jac_nnz_is_cached[level_number])
+    {
+        d_nnz = d_jac_d_nnz[level_number];
+        o_nnz = d_jac_o_nnz[level_number];
+        return;
+    }
+
     int ierr;
 
     // Determine the global node offset and the number of local nodes.
@@ -532,6 +856,10 @@ IBStandardForceGen::computeLagrangianForceJacobianNonzeroStructure(std::vector<i
     IBTK_CHKERRQ(ierr);
     ierr = VecDestroy(&o_nnz_vec);
     IBTK_CHKERRQ(ierr);
+
+    d_jac_d_nnz[level_number] = d_nnz;
+    d_jac_o_nnz[level_number] = o_nnz;
+    d_jac_nnz_is_cached[level_number] = true;
     return;
 } // computeLagrangianForceJacobianNonzeroStructure
 
@@ -555,104 +883,47 @@ IBStandardForceGen::computeLagrangianForceJacobian(Mat& J_mat,
 #endif
 
     int ierr;
-    Pointer<LData> X_ghost_data = d_X_ghost_data[level_number];
-    Pointer<LData> dX_data = d_dX_data[level_number];
-    ierr = VecAXPBYPCZ(X_ghost_data->getVec(), 1.0, 1.0, 0.0, X_data->getVec(), dX_data->getVec());
-    IBTK_CHKERRQ(ierr);
-    ierr = VecGhostUpdateBegin(X_ghost_data->getVec(), INSERT_VALUES, SCATTER_FORWARD);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecGhostUpdateEnd(X_ghost_data->getVec(), INSERT_VALUES, SCATTER_FORWARD);
-    IBTK_CHKERRQ(ierr);
-
     { // Spring forces.
-        const std::vector<int>& lag_mastr_node_idxs = d_spring_data[level_number].lag_mastr_node_idxs;
-        const std::vector<int>& lag_slave_node_idxs = d_spring_data[level_number].lag_slave_node_idxs;
-        const std::vector<int>& petsc_mastr_node_idxs = d_spring_data[level_number].petsc_mastr_node_idxs;
-        const std::vector<int>& petsc_slave_node_idxs = d_spring_data[level_number].petsc_slave_node_idxs;
+        computeSpringJacobianBlocks(X_coef, X_data, level_number);
+
+        // NOTE: The Jacobian blocks may be computed concurrently, but the matrix
+        // values are set serially because MatSetValues() is not thread safe.
         const std::vector<int>& petsc_global_mastr_node_idxs = d_spring_data[level_number].petsc_global_mastr_node_idxs;
         const std::vector<int>& petsc_global_slave_node_idxs = d_spring_data[level_number].petsc_global_slave_node_idxs;
-        const std::vector<SpringForceFcnPtr>& force_fcns = d_spring_data[level_number].force_fcns;
-        const std::vector<SpringForceDerivFcnPtr>& force_deriv_fcns = d_spring_data[level_number].force_deriv_fcns;
-        const std::vector<const double*>& parameters = d_spring_data[level_number].parameters;
-        const double* const X_node = X_ghost_data->getGhostedLocalFormVecArray()->data();
-        MatrixNd dF_dX;
-        Vector D;
-        double R, T, dT_dR, eps;
-        for (unsigned int k = 0; k < petsc_mastr_node_idxs.size(); ++k)
+        const std::vector<double>& jac_blocks = d_spring_data[level_number].jac_blocks;
+        double minus_dF_dX[NDIM * NDIM];
+        for (unsigned int k = 0; k < petsc_global_mastr_node_idxs.size(); ++k)
         {
-            // Compute the Jacobian of the force applied by the spring to the
-            // "master" node with respect to the position of the "slave" node.
-            const int& lag_mastr_idx = lag_mastr_node_idxs[k];
-            const int& lag_slave_idx = lag_slave_node_idxs[k];
-            int petsc_mastr_idx = petsc_mastr_node_idxs[k];
-            int petsc_slave_idx = petsc_slave_node_idxs[k];
-            int petsc_global_mastr_idx = petsc_global_mastr_node_idxs[k];
-            int petsc_global_slave_idx = petsc_global_slave_node_idxs[k];
-            const SpringForceFcnPtr force_fcn = force_fcns[k];
-            const SpringForceDerivFcnPtr force_deriv_fcn = force_deriv_fcns[k];
-            const double* const params = parameters[k];
-            for (unsigned int i = 0; i < NDIM; ++i)
-            {
-                D(i) = X_node[petsc_slave_idx + i] - X_node[petsc_mastr_idx + i];
-            }
-            R = D.norm();
-            T = force_fcn(R, params, lag_mastr_idx, lag_slave_idx);
-            if (!force_deriv_fcn)
-            {
-                // Use finite differences to approximate dT/dR.
-                eps = std::max(R, 1.0) * pow(std::numeric_limits<double>::epsilon(), 1.0 / 3.0);
-                dT_dR = (force_fcn(R + eps, params, lag_mastr_idx, lag_slave_idx) -
-                         force_fcn(R - eps, params, lag_mastr_idx, lag_slave_idx)) /
-                        (2.0 * eps);
-            }
-            else
-            {
-                dT_dR = force_deriv_fcn(R, params, lag_mastr_idx, lag_slave_idx);
-            }
-
-            // F = T(R) D/R
-            //
-            // dF_k/dx_l = (dT/dR * dR/dx_l * D/R) + (T/R * dD/dx_l) + (T *D* (-1/R^2)* dR/dx_l)
-            //
-            // dR/dx_l = 1/R * D if x_l is "slave" and dR/dx_l = -1/R * D if x_l is "master"
-            //
-            // dD/dx_l = e_l outer e_k dD_k/dx_l = e_l outer e_l = I if x_l is "slave"
-            // and e_l outer -e_l = -I if x_l is master.
-            //
-            // => dF_k/dx_l = (1/R^2 * dT/dR * D outer D) + (T/R * I) - (1/R^2 * T/R * D outer D) if x_l is "slave"
-            // and -dF_k/dx_l if x_l is "master"
-
-            for (unsigned int i = 0; i < NDIM; ++i)
-            {
-                for (unsigned int j = 0; j < NDIM; ++j)
-                {
-                    dF_dX(i, j) = X_coef * ((T / R) * ((i == j ? 1.0 : 0.0)) + (dT_dR - T / R) * D[i] * D[j] / (R * R));
-                }
-            }
+            // The Jacobian of the force applied by the spring to the "master"
+            // node with respect to the position of the "slave" node.
+            const double* const dF_dX = &jac_blocks[NDIM * NDIM * k];
 
             // Rows and cols for blocked matrix.
-            petsc_global_mastr_idx /= NDIM;
-            petsc_global_slave_idx /= NDIM;
+            const int petsc_global_mastr_idx = petsc_global_mastr_node_idxs[k] / NDIM;
+            const int petsc_global_slave_idx = petsc_global_slave_node_idxs[k] / NDIM;
 
             // Accumulate the off-diagonal parts of the matrix.
             ierr = MatSetValuesBlocked(
-                J_mat, 1, &petsc_global_mastr_idx, 1, &petsc_global_slave_idx, dF_dX.data(), ADD_VALUES);
+                J_mat, 1, &petsc_global_mastr_idx, 1, &petsc_global_slave_idx, dF_dX, ADD_VALUES);
             IBTK_CHKERRQ(ierr);
             ierr = MatSetValuesBlocked(
-                J_mat, 1, &petsc_global_slave_idx, 1, &petsc_global_mastr_idx, dF_dX.data(), ADD_VALUES);
+                J_mat, 1, &petsc_global_slave_idx, 1, &petsc_global_mastr_idx, dF_dX, ADD_VALUES);
             IBTK_CHKERRQ(ierr);
 
             // Negate dF_dX to obtain the Jacobian of the force applied by the
             // spring to the "master" node with respect to the position of the
             // "master" node.
-            dF_dX *= -1.0;
+            for (unsigned int i = 0; i < NDIM * NDIM; ++i)
+            {
+                minus_dF_dX[i] = -dF_dX[i];
+            }
 
             // Accumulate the diagonal parts of the matrix.
             ierr = MatSetValuesBlocked(
-                J_mat, 1, &petsc_global_mastr_idx, 1, &petsc_global_mastr_idx, dF_dX.data(), ADD_VALUES);
+                J_mat, 1, &petsc_global_mastr_idx, 1, &petsc_global_mastr_idx, minus_dF_dX, ADD_VALUES);
             IBTK_CHKERRQ(ierr);
             ierr = MatSetValuesBlocked(
-                J_mat, 1, &petsc_global_slave_idx, 1, &petsc_global_slave_idx, dF_dX.data(), ADD_VALUES);
+                J_mat, 1, &petsc_global_slave_idx, 1, &petsc_global_slave_idx, minus_dF_dX, ADD_VALUES);
             IBTK_CHKERRQ(ierr);
         }
     }
@@ -742,6 +1013,194 @@ IBStandardForceGen::computeLagrangianForceJacobian(Mat& J_mat,
     return;
 } // computeLagrangianForceJacobian
 
+void
+IBStandardForceGen::setupLagrangianForceJacobian(const double X_coef,
+                                                 Pointer<LData> X_data,
+                                                 const double /*U_coef*/,
+                                                 Pointer<LData> /*U_data*/,
+                                                 const Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
+                                                 const int level_number,
+                                                 const double /*data_time*/,
+                                                 LDataManager* const l_data_manager)
+{
+    if (!l_data_manager->levelContainsLagrangianData(level_number)) return;
+
+#if !defined(NDEBUG)
+    TBOX_ASSERT(level_number < static_cast<int>(d_is_initialized.size()));
+    TBOX_ASSERT(d_is_initialized[level_number]);
+#endif
+
+    computeSpringJacobianBlocks(X_coef, X_data, level_number);
+    d_jac_blocks_X_data[level_number] = X_data.getPointer();
+    d_jac_blocks_X_coef[level_number] = X_coef;
+    return;
+} // setupLagrangianForceJacobian
+
+void
+IBStandardForceGen::applyLagrangianForceJacobian(Pointer<LData> F_data,
+                                                 Pointer<LData> V_data,
+                                                 const double X_coef,
+                                                 Pointer<LData> X_data,
+                                                 const double U_coef,
+                                                 Pointer<LData> /*U_data*/,
+                                                 const Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
+                                                 const int level_number,
+                                                 const double /*data_time*/,
+                                                 LDataManager* const l_data_manager)
+{
+    if (!l_data_manager->levelContainsLagrangianData(level_number)) return;
+
+#if !defined(NDEBUG)
+    TBOX_ASSERT(level_number < static_cast<int>(d_is_initialized.size()));
+    TBOX_ASSERT(d_is_initialized[level_number]);
+#endif
+
+    int ierr;
+
+    // Initialize ghost data.
+    Pointer<LData> F_ghost_data = d_F_ghost_data[level_number];
+    Vec F_ghost_local_form_vec;
+    ierr = VecGhostGetLocalForm(F_ghost_data->getVec(), &F_ghost_local_form_vec);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecSet(F_ghost_local_form_vec, 0.0);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGhostRestoreLocalForm(F_ghost_data->getVec(), &F_ghost_local_form_vec);
+    IBTK_CHKERRQ(ierr);
+
+    Pointer<LData> V_ghost_data = d_V_ghost_data[level_number];
+    ierr = VecCopy(V_data->getVec(), V_ghost_data->getVec());
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGhostUpdateBegin(V_ghost_data->getVec(), INSERT_VALUES, SCATTER_FORWARD);
+    IBTK_CHKERRQ(ierr);
+
+    // The spring Jacobian blocks depend on the configuration, and are normally
+    // computed once by setupLagrangianForceJacobian() rather than for every
+    // product; the beam and target point Jacobians are constant.
+    if (d_jac_blocks_X_data[level_number] != X_data.getPointer() || d_jac_blocks_X_coef[level_number] != X_coef)
+    {
+        computeSpringJacobianBlocks(X_coef, X_data, level_number);
+    }
+
+    ierr = VecGhostUpdateEnd(V_ghost_data->getVec(), INSERT_VALUES, SCATTER_FORWARD);
+    IBTK_CHKERRQ(ierr);
+    double* const F_node = F_ghost_data->getGhostedLocalFormVecArray()->data();
+    const double* const V_node = V_ghost_data->getGhostedLocalFormVecArray()->data();
+
+    { // Spring forces.
+        const std::vector<SpringData::Batch>& batches = d_spring_data[level_number].batches;
+        const std::vector<int>& color_batch_offsets = d_spring_data[level_number].color_batch_offsets;
+        const int num_colors = static_cast<int>(color_batch_offsets.size()) - 1;
+        if (num_colors > 0)
+        {
+            const int* const petsc_mastr_node_idxs = &d_spring_data[level_number].petsc_mastr_node_idxs[0];
+            const int* const petsc_slave_node_idxs = &d_spring_data[level_number].petsc_slave_node_idxs[0];
+            const double* const jac_blocks = &d_spring_data[level_number].jac_blocks[0];
+#ifdef _OPENMP
+#pragma omp parallel if (d_use_threaded_force_evaluation)
+#endif
+            {
+                for (int c = 0; c < num_colors; ++c)
+                {
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+                    for (int b = color_batch_offsets[c]; b < color_batch_offsets[c + 1]; ++b)
+                    {
+                        for (int k = batches[b].begin; k < batches[b].end; ++k)
+                        {
+                            const int mastr_idx = petsc_mastr_node_idxs[k];
+                            const int slave_idx = petsc_slave_node_idxs[k];
+                            const double* const dF_dX = jac_blocks + NDIM * NDIM * k;
+                            for (int i = 0; i < NDIM; ++i)
+                            {
+                                double JV = 0.0;
+                                for (int j = 0; j < NDIM; ++j)
+                                {
+                                    JV += dF_dX[i * NDIM + j] * (V_node[slave_idx + j] - V_node[mastr_idx + j]);
+                                }
+                                F_node[mastr_idx + i] += JV;
+                                F_node[slave_idx + i] -= JV;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    { // Beam forces.
+        const std::vector<int>& color_offsets = d_beam_data[level_number].color_offsets;
+        const int num_colors = static_cast<int>(color_offsets.size()) - 1;
+        if (num_colors > 0)
+        {
+            const int* const petsc_mastr_node_idxs = &d_beam_data[level_number].petsc_mastr_node_idxs[0];
+            const int* const petsc_next_node_idxs = &d_beam_data[level_number].petsc_next_node_idxs[0];
+            const int* const petsc_prev_node_idxs = &d_beam_data[level_number].petsc_prev_node_idxs[0];
+            const double* const* const rigidities = &d_beam_data[level_number].rigidities[0];
+#ifdef _OPENMP
+#pragma omp parallel if (d_use_threaded_force_evaluation)
+#endif
+            {
+                for (int c = 0; c < num_colors; ++c)
+                {
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+                    for (int k = color_offsets[c]; k < color_offsets[c + 1]; ++k)
+                    {
+                        const int mastr_idx = petsc_mastr_node_idxs[k];
+                        const int next_idx = petsc_next_node_idxs[k];
+                        const int prev_idx = petsc_prev_node_idxs[k];
+                        const double bend = X_coef * (*rigidities[k]);
+                        for (int d = 0; d < NDIM; ++d)
+                        {
+                            const double JV =
+                                bend * (V_node[next_idx + d] + V_node[prev_idx + d] - 2.0 * V_node[mastr_idx + d]);
+                            F_node[mastr_idx + d] += 2.0 * JV;
+                            F_node[next_idx + d] -= JV;
+                            F_node[prev_idx + d] -= JV;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    { // Target point forces.
+        const int num_target_points = static_cast<int>(d_target_point_data[level_number].petsc_node_idxs.size());
+        if (num_target_points > 0)
+        {
+            const int* const petsc_node_idxs = &d_target_point_data[level_number].petsc_node_idxs[0];
+            const double* const* const kappa = &d_target_point_data[level_number].kappa[0];
+            const double* const* const eta = &d_target_point_data[level_number].eta[0];
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (d_use_threaded_force_evaluation)
+#endif
+            for (int k = 0; k < num_target_points; ++k)
+            {
+                const int idx = petsc_node_idxs[k];
+                const double dF_dX = -X_coef * (*kappa[k]) - U_coef * (*eta[k]);
+                for (int d = 0; d < NDIM; ++d)
+                {
+                    F_node[idx + d] += dF_dX * V_node[idx + d];
+                }
+            }
+        }
+    }
+
+    F_ghost_data->restoreArrays();
+    V_ghost_data->restoreArrays();
+
+    // Add the locally computed values to the output vector.
+    ierr = VecGhostUpdateBegin(F_ghost_data->getVec(), ADD_VALUES, SCATTER_REVERSE);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGhostUpdateEnd(F_ghost_data->getVec(), ADD_VALUES, SCATTER_REVERSE);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecAXPY(F_data->getVec(), 1.0, F_ghost_data->getVec());
+    IBTK_CHKERRQ(ierr);
+    return;
+} // applyLagrangianForceJacobian
+
 double
 IBStandardForceGen::computeLagrangianEnergy(Pointer<LData> /*X_data*/,
                                             Pointer<LData> /*U_data*/,
@@ -775,6 +1234,7 @@ IBStandardForceGen::initializeSpringLevelData(std::set<int>& nonlocal_petsc_idx_
     std::vector<int>& petsc_slave_node_idxs = d_spring_data[level_number].petsc_slave_node_idxs;
     std::vector<int>& petsc_global_mastr_node_idxs = d_spring_data[level_number].petsc_global_mastr_node_idxs;
     std::vector<int>& petsc_global_slave_node_idxs = d_spring_data[level_number].petsc_global_slave_node_idxs;
+    std::vector<int>& force_fcn_idxs = d_spring_data[level_number].force_fcn_idxs;
     std::vector<SpringForceFcnPtr>& force_fcns = d_spring_data[level_number].force_fcns;
     std::vector<SpringForceDerivFcnPtr>& force_deriv_fcns = d_spring_data[level_number].force_deriv_fcns;
     std::vector<const double*>& parameters = d_spring_data[level_number].parameters;
@@ -800,6 +1260,7 @@ IBStandardForceGen::initializeSpringLevelData(std::set<int>& nonlocal_petsc_idx_
     petsc_slave_node_idxs.resize(num_springs);
     petsc_global_mastr_node_idxs.resize(num_springs);
     petsc_global_slave_node_idxs.resize(num_springs);
+    force_fcn_idxs.resize(num_springs);
     force_fcns.resize(num_springs);
     force_deriv_fcns.resize(num_springs);
     parameters.resize(num_springs);
@@ -831,6 +1292,7 @@ IBStandardForceGen::initializeSpringLevelData(std::set<int>& nonlocal_petsc_idx_
             lag_mastr_node_idxs[current_spring] = lag_idx;
             lag_slave_node_idxs[current_spring] = slv[k];
             petsc_mastr_node_idxs[current_spring] = petsc_idx;
+            force_fcn_idxs[current_spring] = fcn[k];
             force_fcns[current_spring] = d_spring_force_fcn_map[fcn[k]];
             force_deriv_fcns[current_spring] = d_spring_force_deriv_fcn_map[fcn[k]];
             parameters[current_spring] = params.empty() ? NULL : &params[k][0];
@@ -863,6 +1325,112 @@ IBStandardForceGen::initializeSpringLevelData(std::set<int>& nonlocal_petsc_idx_
     return;
 } // initializeSpringLevelData
 
+void
+IBStandardForceGen::setupSpringBatches(const int level_number)
+{
+    SpringData& spring_data = d_spring_data[level_number];
+    const int num_springs = static_cast<int>(spring_data.lag_mastr_node_idxs.size());
+    spring_data.batches.clear();
+    spring_data.color_batch_offsets.assign(1, 0);
+    if (num_springs == 0) return;
+
+    // Color the springs and sort them by color and by force function.
+    std::vector<const std::vector<int>*> node_idxs(2);
+    node_idxs[0] = &spring_data.petsc_mastr_node_idxs;
+    node_idxs[1] = &spring_data.petsc_slave_node_idxs;
+    std::vector<int> perm, color_offsets;
+    color_force_elements(perm, color_offsets, node_idxs, spring_data.force_fcn_idxs);
+    permute_vector(spring_data.lag_mastr_node_idxs, perm);
+    permute_vector(spring_data.lag_slave_node_idxs, perm);
+    permute_vector(spring_data.petsc_mastr_node_idxs, perm);
+    permute_vector(spring_data.petsc_slave_node_idxs, perm);
+    permute_vector(spring_data.petsc_global_mastr_node_idxs, perm);
+    permute_vector(spring_data.petsc_global_slave_node_idxs, perm);
+    permute_vector(spring_data.force_fcn_idxs, perm);
+    permute_vector(spring_data.force_fcns, perm);
+    permute_vector(spring_data.force_deriv_fcns, perm);
+    permute_vector(spring_data.parameters, perm);
+
+    // Split each color into batches of springs that share a force function.
+    const int num_colors = static_cast<int>(color_offsets.size()) - 1;
+    for (int c = 0; c < num_colors; ++c)
+    {
+        int begin = color_offsets[c];
+        while (begin < color_offsets[c + 1])
+        {
+            const int fcn_idx = spring_data.force_fcn_idxs[begin];
+            int end = begin + 1;
+            while (end < color_offsets[c + 1] && end - begin < FORCE_BATCH_SIZE &&
+                   spring_data.force_fcn_idxs[end] == fcn_idx)
+            {
+                ++end;
+            }
+            SpringData::Batch batch;
+            batch.begin = begin;
+            batch.end = end;
+            batch.force_fcn = spring_data.force_fcns[begin];
+            batch.force_batch_fcn = d_spring_force_batch_fcn_map[fcn_idx];
+            spring_data.batches.push_back(batch);
+            begin = end;
+        }
+        spring_data.color_batch_offsets.push_back(static_cast<int>(spring_data.batches.size()));
+    }
+    return;
+} // setupSpringBatches
+
+void
+IBStandardForceGen::computeSpringJacobianBlocks(const double X_coef, Pointer<LData> X_data, const int level_number)
+{
+    SpringData& spring_data = d_spring_data[level_number];
+    const int num_springs = static_cast<int>(spring_data.lag_mastr_node_idxs.size());
+    spring_data.jac_blocks.resize(NDIM * NDIM * num_springs);
+    d_jac_blocks_X_data[level_number] = NULL;
+    if (num_springs == 0) return;
+
+    // Fill the ghosted configuration.
+    int ierr;
+    Pointer<LData> X_ghost_data = d_X_ghost_data[level_number];
+    Pointer<LData> dX_data = d_dX_data[level_number];
+    ierr = VecAXPBYPCZ(X_ghost_data->getVec(), 1.0, 1.0, 0.0, X_data->getVec(), dX_data->getVec());
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGhostUpdateBegin(X_ghost_data->getVec(), INSERT_VALUES, SCATTER_FORWARD);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGhostUpdateEnd(X_ghost_data->getVec(), INSERT_VALUES, SCATTER_FORWARD);
+    IBTK_CHKERRQ(ierr);
+
+    const int* const lag_mastr_node_idxs = &spring_data.lag_mastr_node_idxs[0];
+    const int* const lag_slave_node_idxs = &spring_data.lag_slave_node_idxs[0];
+    const int* const petsc_mastr_node_idxs = &spring_data.petsc_mastr_node_idxs[0];
+    const int* const petsc_slave_node_idxs = &spring_data.petsc_slave_node_idxs[0];
+    const SpringForceFcnPtr* const force_fcns = &spring_data.force_fcns[0];
+    const SpringForceDerivFcnPtr* const force_deriv_fcns = &spring_data.force_deriv_fcns[0];
+    const double* const* const parameters = &spring_data.parameters[0];
+    double* const jac_blocks = &spring_data.jac_blocks[0];
+    const double* const X_node = X_ghost_data->getGhostedLocalFormVecArray()->data();
+
+    // Each spring has its own Jacobian block, so the blocks can be computed
+    // concurrently.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (d_use_threaded_force_evaluation)
+#endif
+    for (int k = 0; k < num_springs; ++k)
+    {
+        compute_spring_jacobian_block(jac_blocks + NDIM * NDIM * k,
+                                      X_node,
+                                      petsc_mastr_node_idxs[k],
+                                      petsc_slave_node_idxs[k],
+                                      lag_mastr_node_idxs[k],
+                                      lag_slave_node_idxs[k],
+                                      parameters[k],
+                                      force_fcns[k],
+                                      force_deriv_fcns[k],
+                                      X_coef);
+    }
+
+    X_ghost_data->restoreArrays();
+    return;
+} // computeSpringJacobianBlocks
+
 void
 IBStandardForceGen::computeLagrangianSpringForce(Pointer<LData> F_data,
                                                  Pointer<LData> X_data,
@@ -877,103 +1445,43 @@ IBStandardForceGen::computeLagrangianSpringForce(Pointer<LData> F_data,
     const int* const lag_slave_node_idxs = &d_spring_data[level_number].lag_slave_node_idxs[0];
     const int* const petsc_mastr_node_idxs = &d_spring_data[level_number].petsc_mastr_node_idxs[0];
     const int* const petsc_slave_node_idxs = &d_spring_data[level_number].petsc_slave_node_idxs[0];
-    const SpringForceFcnPtr* const force_fcns = &d_spring_data[level_number].force_fcns[0];
-    const double** const parameters = &d_spring_data[level_number].parameters[0];
+    const double* const* const parameters = &d_spring_data[level_number].parameters[0];
+    const std::vector<SpringData::Batch>& batches = d_spring_data[level_number].batches;
+    const std::vector<int>& color_batch_offsets = d_spring_data[level_number].color_batch_offsets;
     double* const F_node = F_data->getLocalFormVecArray()->data();
     const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
 
-    static const int BLOCKSIZE = 16; // this parameter needs to be tuned
-    int k, kblock, kunroll, mastr_idx, slave_idx;
-    double F[NDIM], D[NDIM], R, T_over_R;
-    kblock = 0;
-    for (; kblock < (num_springs - 1) / BLOCKSIZE;
-         ++kblock) // ensure that the last block is NOT handled by this first loop
+    // Springs of the same color do not share nodes, so the batches of springs
+    // of a given color can be processed concurrently.  A single parallel region
+    // is used for all colors; the barrier at the end of each worksharing loop
+    // separates consecutive colors.
+    const int num_colors = static_cast<int>(color_batch_offsets.size()) - 1;
+#ifdef _OPENMP
+#pragma omp parallel if (d_use_threaded_force_evaluation)
+#endif
     {
-        PREFETCH_READ_NTA_BLOCK(lag_mastr_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(lag_slave_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(petsc_mastr_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(petsc_slave_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(force_fcns + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(parameters + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        for (kunroll = 0; kunroll < BLOCKSIZE; ++kunroll)
+        for (int c = 0; c < num_colors; ++c)
         {
-            k = kblock * BLOCKSIZE + kunroll;
-            mastr_idx = petsc_mastr_node_idxs[k];
-            slave_idx = petsc_slave_node_idxs[k];
-#if !defined(NDEBUG)
-            TBOX_ASSERT(mastr_idx != slave_idx);
-#endif
-            PREFETCH_READ_NTA_NDIM_BLOCK(F_node + petsc_mastr_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(F_node + petsc_slave_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_mastr_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_slave_node_idxs[k + 1]);
-            PREFETCH_READ_NTA(parameters[k + 1]);
-            D[0] = X_node[slave_idx + 0] - X_node[mastr_idx + 0];
-            D[1] = X_node[slave_idx + 1] - X_node[mastr_idx + 1];
-#if (NDIM == 3)
-            D[2] = X_node[slave_idx + 2] - X_node[mastr_idx + 2];
-#endif
-#if (NDIM == 2)
-            R = sqrt(D[0] * D[0] + D[1] * D[1]);
-#endif
-#if (NDIM == 3)
-            R = sqrt(D[0] * D[0] + D[1] * D[1] + D[2] * D[2]);
-#endif
-            if (UNLIKELY(R < std::numeric_limits<double>::epsilon())) continue;
-            T_over_R = (force_fcns[k])(R, parameters[k], lag_mastr_node_idxs[k], lag_slave_node_idxs[k]) / R;
-            F[0] = T_over_R * D[0];
-            F[1] = T_over_R * D[1];
-#if (NDIM == 3)
-            F[2] = T_over_R * D[2];
-#endif
-            F_node[mastr_idx + 0] += F[0];
-            F_node[mastr_idx + 1] += F[1];
-#if (NDIM == 3)
-            F_node[mastr_idx + 2] += F[2];
-#endif
-            F_node[slave_idx + 0] -= F[0];
-            F_node[slave_idx + 1] -= F[1];
-#if (NDIM == 3)
-            F_node[slave_idx + 2] -= F[2];
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
 #endif
+            for (int b = color_batch_offsets[c]; b < color_batch_offsets[c + 1]; ++b)
+            {
+                const SpringData::Batch& batch = batches[b];
+                compute_spring_batch_force(F_node,
+                                           X_node,
+                                           batch.begin,
+                                           batch.end,
+                                           petsc_mastr_node_idxs,
+                                           petsc_slave_node_idxs,
+                                           lag_mastr_node_idxs,
+                                           lag_slave_node_idxs,
+                                           parameters,
+                                           batch.force_fcn,
+                                           batch.force_batch_fcn);
+            }
         }
     }
-    for (k = kblock * BLOCKSIZE; k < num_springs; ++k)
-    {
-        mastr_idx = petsc_mastr_node_idxs[k];
-        slave_idx = petsc_slave_node_idxs[k];
-#if !defined(NDEBUG)
-        TBOX_ASSERT(mastr_idx != slave_idx);
-#endif
-        D[0] = X_node[slave_idx + 0] - X_node[mastr_idx + 0];
-        D[1] = X_node[slave_idx + 1] - X_node[mastr_idx + 1];
-#if (NDIM == 3)
-        D[2] = X_node[slave_idx + 2] - X_node[mastr_idx + 2];
-#endif
-#if (NDIM == 2)
-        R = sqrt(D[0] * D[0] + D[1] * D[1]);
-#endif
-#if (NDIM == 3)
-        R = sqrt(D[0] * D[0] + D[1] * D[1] + D[2] * D[2]);
-#endif
-        if (UNLIKELY(R < std::numeric_limits<double>::epsilon())) continue;
-        T_over_R = (force_fcns[k])(R, parameters[k], lag_mastr_node_idxs[k], lag_slave_node_idxs[k]) / R;
-        F[0] = T_over_R * D[0];
-        F[1] = T_over_R * D[1];
-#if (NDIM == 3)
-        F[2] = T_over_R * D[2];
-#endif
-        F_node[mastr_idx + 0] += F[0];
-        F_node[mastr_idx + 1] += F[1];
-#if (NDIM == 3)
-        F_node[mastr_idx + 2] += F[2];
-#endif
-        F_node[slave_idx + 0] -= F[0];
-        F_node[slave_idx + 1] -= F[1];
-#if (NDIM == 3)
-        F_node[slave_idx + 2] -= F[2];
-#endif
-    }
 
     F_data->restoreArrays();
     X_data->restoreArrays();
@@ -1089,6 +1597,32 @@ IBStandardForceGen::initializeBeamLevelData(std::set<int>& nonlocal_petsc_idx_se
     return;
 } // initializeBeamLevelData
 
+void
+IBStandardForceGen::setupBeamColors(const int level_number)
+{
+    BeamData& beam_data = d_beam_data[level_number];
+    const int num_beams = static_cast<int>(beam_data.petsc_mastr_node_idxs.size());
+    beam_data.color_offsets.assign(1, 0);
+    if (num_beams == 0) return;
+
+    // Color the beams and sort them by color.
+    std::vector<const std::vector<int>*> node_idxs(3);
+    node_idxs[0] = &beam_data.petsc_mastr_node_idxs;
+    node_idxs[1] = &beam_data.petsc_next_node_idxs;
+    node_idxs[2] = &beam_data.petsc_prev_node_idxs;
+    std::vector<int> perm;
+    color_force_elements(perm, beam_data.color_offsets, node_idxs, std::vector<int>());
+    permute_vector(beam_data.petsc_mastr_node_idxs, perm);
+    permute_vector(beam_data.petsc_next_node_idxs, perm);
+    permute_vector(beam_data.petsc_prev_node_idxs, perm);
+    permute_vector(beam_data.petsc_global_mastr_node_idxs, perm);
+    permute_vector(beam_data.petsc_global_next_node_idxs, perm);
+    permute_vector(beam_data.petsc_global_prev_node_idxs, perm);
+    permute_vector(beam_data.rigidities, perm);
+    permute_vector(beam_data.curvatures, perm);
+    return;
+} // setupBeamColors
+
 void
 IBStandardForceGen::computeLagrangianBeamForce(Pointer<LData> F_data,
                                                Pointer<LData> X_data,
@@ -1102,99 +1636,44 @@ IBStandardForceGen::computeLagrangianBeamForce(Pointer<LData> F_data,
     const int* const petsc_mastr_node_idxs = &d_beam_data[level_number].petsc_mastr_node_idxs[0];
     const int* const petsc_next_node_idxs = &d_beam_data[level_number].petsc_next_node_idxs[0];
     const int* const petsc_prev_node_idxs = &d_beam_data[level_number].petsc_prev_node_idxs[0];
-    const double** const rigidities = &d_beam_data[level_number].rigidities[0];
-    const Vector** const curvatures = &d_beam_data[level_number].curvatures[0];
+    const double* const* const rigidities = &d_beam_data[level_number].rigidities[0];
+    const Vector* const* const curvatures = &d_beam_data[level_number].curvatures[0];
+    const std::vector<int>& color_offsets = d_beam_data[level_number].color_offsets;
     double* const F_node = F_data->getLocalFormVecArray()->data();
     const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
 
-    static const int BLOCKSIZE = 16; // This parameter needs to be tuned.
-    int k, kblock, kunroll, mastr_idx, next_idx, prev_idx;
-    double K;
-    const double* D2X0;
-    double F[NDIM];
-    kblock = 0;
-    for (; kblock < (num_beams - 1) / BLOCKSIZE;
-         ++kblock) // ensure that the last block is NOT handled by this first loop
+    // Beams of the same color do not share nodes, so the batches of beams of a
+    // given color can be processed concurrently, using a single parallel region
+    // for all colors.
+    const int num_colors = static_cast<int>(color_offsets.size()) - 1;
+#ifdef _OPENMP
+#pragma omp parallel if (d_use_threaded_force_evaluation)
+#endif
     {
-        PREFETCH_READ_NTA_BLOCK(petsc_mastr_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(petsc_next_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(petsc_prev_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(rigidities + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(curvatures + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        for (kunroll = 0; kunroll < BLOCKSIZE; ++kunroll)
+        for (int c = 0; c < num_colors; ++c)
         {
-            k = kblock * BLOCKSIZE + kunroll;
-            mastr_idx = petsc_mastr_node_idxs[k];
-            next_idx = petsc_next_node_idxs[k];
-            prev_idx = petsc_prev_node_idxs[k];
-#if !defined(NDEBUG)
-            TBOX_ASSERT(mastr_idx != next_idx);
-            TBOX_ASSERT(mastr_idx != prev_idx);
-#endif
-            PREFETCH_READ_NTA_NDIM_BLOCK(F_node + petsc_mastr_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(F_node + petsc_next_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(F_node + petsc_prev_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_mastr_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_next_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_prev_node_idxs[k + 1]);
-            PREFETCH_READ_NTA(rigidities[k + 1]);
-            PREFETCH_READ_NTA(curvatures[k + 1]);
-            K = *rigidities[k];
-            D2X0 = curvatures[k]->data();
-            F[0] = K * (X_node[next_idx + 0] + X_node[prev_idx + 0] - 2.0 * X_node[mastr_idx + 0] - D2X0[0]);
-            F[1] = K * (X_node[next_idx + 1] + X_node[prev_idx + 1] - 2.0 * X_node[mastr_idx + 1] - D2X0[1]);
-#if (NDIM == 3)
-            F[2] = K * (X_node[next_idx + 2] + X_node[prev_idx + 2] - 2.0 * X_node[mastr_idx + 2] - D2X0[2]);
-#endif
-            F_node[mastr_idx + 0] += 2.0 * F[0];
-            F_node[mastr_idx + 1] += 2.0 * F[1];
-#if (NDIM == 3)
-            F_node[mastr_idx + 2] += 2.0 * F[2];
-#endif
-            F_node[next_idx + 0] -= F[0];
-            F_node[next_idx + 1] -= F[1];
-#if (NDIM == 3)
-            F_node[next_idx + 2] -= F[2];
-#endif
-            F_node[prev_idx + 0] -= F[0];
-            F_node[prev_idx + 1] -= F[1];
-#if (NDIM == 3)
-            F_node[prev_idx + 2] -= F[2];
+            const int color_begin = color_offsets[c];
+            const int color_end = color_offsets[c + 1];
+            const int num_batches = (color_end - color_begin + FORCE_BATCH_SIZE - 1) / FORCE_BATCH_SIZE;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
 #endif
+            for (int b = 0; b < num_batches; ++b)
+            {
+                const int begin = color_begin + b * FORCE_BATCH_SIZE;
+                const int end = std::min(begin + FORCE_BATCH_SIZE, color_end);
+                compute_beam_batch_force(F_node,
+                                         X_node,
+                                         begin,
+                                         end,
+                                         petsc_mastr_node_idxs,
+                                         petsc_next_node_idxs,
+                                         petsc_prev_node_idxs,
+                                         rigidities,
+                                         curvatures);
+            }
         }
     }
-    for (k = kblock * BLOCKSIZE; k < num_beams; ++k)
-    {
-        mastr_idx = petsc_mastr_node_idxs[k];
-        next_idx = petsc_next_node_idxs[k];
-        prev_idx = petsc_prev_node_idxs[k];
-#if !defined(NDEBUG)
-        TBOX_ASSERT(mastr_idx != next_idx);
-        TBOX_ASSERT(mastr_idx != prev_idx);
-#endif
-        K = *rigidities[k];
-        D2X0 = curvatures[k]->data();
-        F[0] = K * (X_node[next_idx + 0] + X_node[prev_idx + 0] - 2.0 * X_node[mastr_idx + 0] - D2X0[0]);
-        F[1] = K * (X_node[next_idx + 1] + X_node[prev_idx + 1] - 2.0 * X_node[mastr_idx + 1] - D2X0[1]);
-#if (NDIM == 3)
-        F[2] = K * (X_node[next_idx + 2] + X_node[prev_idx + 2] - 2.0 * X_node[mastr_idx + 2] - D2X0[2]);
-#endif
-        F_node[mastr_idx + 0] += 2.0 * F[0];
-        F_node[mastr_idx + 1] += 2.0 * F[1];
-#if (NDIM == 3)
-        F_node[mastr_idx + 2] += 2.0 * F[2];
-#endif
-        F_node[next_idx + 0] -= F[0];
-        F_node[next_idx + 1] -= F[1];
-#if (NDIM == 3)
-        F_node[next_idx + 2] -= F[2];
-#endif
-        F_node[prev_idx + 0] -= F[0];
-        F_node[prev_idx + 1] -= F[1];
-#if (NDIM == 3)
-        F_node[prev_idx + 2] -= F[2];
-#endif
-    }
 
     F_data->restoreArrays();
     X_data->restoreArrays();
@@ -1275,54 +1754,17 @@ IBStandardForceGen::computeLagrangianTargetPointForce(Pointer<LData> F_data,
     const double* const X_node = X_data->getLocalFormVecArray()->data();
     const double* const U_node = U_data->getLocalFormVecArray()->data();
 
-    static const int BLOCKSIZE = 16; // This parameter needs to be tuned.
-    int k, kblock, kunroll, idx;
-    double K, E, dX;
-    const double* X_target;
-    kblock = 0;
-    for (; kblock < (num_target_points - 1) / BLOCKSIZE;
-         ++kblock) // ensure that the last block is NOT handled by this first loop
-    {
-        PREFETCH_READ_NTA_BLOCK(petsc_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(kappa + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(eta + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(X0 + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        for (kunroll = 0; kunroll < BLOCKSIZE; ++kunroll)
-        {
-            k = kblock * BLOCKSIZE + kunroll;
-            idx = petsc_node_idxs[k];
-            PREFETCH_READ_NTA_NDIM_BLOCK(F_node + petsc_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_node_idxs[k + 1]);
-            PREFETCH_READ_NTA(kappa[k + 1]);
-            PREFETCH_READ_NTA(eta[k + 1]);
-            PREFETCH_READ_NTA(X0[k + 1]);
-            K = *kappa[k];
-            E = *eta[k];
-            X_target = X0[k]->data();
-            F_node[idx + 0] += K * (X_target[0] - X_node[idx + 0]) - E * U_node[idx + 0];
-            F_node[idx + 1] += K * (X_target[1] - X_node[idx + 1]) - E * U_node[idx + 1];
-#if (NDIM == 3)
-            F_node[idx + 2] += K * (X_target[2] - X_node[idx + 2]) - E * U_node[idx + 2];
-#endif
-            if (d_log_target_point_displacements)
-            {
-                dX = 0.0;
-                dX += (X_target[0] - X_node[idx + 0]) * (X_target[0] - X_node[idx + 0]);
-                dX += (X_target[1] - X_node[idx + 1]) * (X_target[1] - X_node[idx + 1]);
-#if (NDIM == 3)
-                dX += (X_target[2] - X_node[idx + 2]) * (X_target[2] - X_node[idx + 2]);
+    // Each node is associated with at most one target point, so the target
+    // point forces can be computed concurrently.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(max : max_displacement) if (d_use_threaded_force_evaluation)
 #endif
-                dX = sqrt(dX);
-                max_displacement = std::max(max_displacement, dX);
-            }
-        }
-    }
-    for (k = kblock * BLOCKSIZE; k < num_target_points; ++k)
+    for (int k = 0; k < num_target_points; ++k)
     {
-        idx = petsc_node_idxs[k];
-        K = *kappa[k];
-        E = *eta[k];
-        X_target = X0[k]->data();
+        const int idx = petsc_node_idxs[k];
+        const double K = *kappa[k];
+        const double E = *eta[k];
+        const double* const X_target = X0[k]->data();
         F_node[idx + 0] += K * (X_target[0] - X_node[idx + 0]) - E * U_node[idx + 0];
         F_node[idx + 1] += K * (X_target[1] - X_node[idx + 1]) - E * U_node[idx + 1];
 #if (NDIM == 3)
@@ -1330,7 +1772,7 @@ IBStandardForceGen::computeLagrangianTargetPointForce(Pointer<LData> F_data,
 #endif
         if (d_log_target_point_displacements)
         {
-            dX = 0.0;
+            double dX = 0.0;
             dX += (X_target[0] - X_node[idx + 0]) * (X_target[0] - X_node[idx + 0]);
             dX += (X_target[1] - X_node[idx + 1]) * (X_target[1] - X_node[idx + 1]);
 #if (NDIM == 3)
@@ -35,6 +35,7 @@
 #include <stddef.h>
 #include <algorithm>
 #include <cmath>
+#include <fstream>
 #include <ios>
 #include <iosfwd>
 #include <istream>
@@ -123,6 +124,127 @@ discard_comments(const std::string& input_string)
     string_stream.clear();
     return output_string;
 } // discard_comments
+
+// Binary structure file header data.
+static const char BINARY_FILE_MAGIC[8] = { 'I', 'B', 'A', 'M', 'R', 'S', 'T', 'R' };
+static const int BINARY_FILE_VERSION = 1;
+static const int BINARY_FILE_BYTE_ORDER_CHECK = 0x01020304;
+
+// Binary structure file types.
+enum BinaryFileType
+{
+    BINARY_VERTEX_FILE = 0,
+    BINARY_SPRING_FILE = 1,
+    BINARY_BEAM_FILE = 2,
+    BINARY_TARGET_FILE = 3
+};
+
+// Binary structure file extension.
+static const std::string BINARY_FILE_EXTENSION = ".bin";
+
+template <typename T>
+inline void
+write_binary(std::ofstream& file_stream, const T& val)
+{
+    file_stream.write(reinterpret_cast<const char*>(&val), sizeof(T));
+    return;
+} // write_binary
+
+template <typename T>
+inline bool
+read_binary(std::ifstream& file_stream, T& val)
+{
+    file_stream.read(reinterpret_cast<char*>(&val), sizeof(T));
+    return !file_stream.fail();
+} // read_binary
+
+inline void
+write_binary_header(std::ofstream& file_stream, const BinaryFileType file_type, const int num_records)
+{
+    file_stream.write(BINARY_FILE_MAGIC, sizeof(BINARY_FILE_MAGIC));
+    write_binary(file_stream, BINARY_FILE_VERSION);
+    write_binary(file_stream, static_cast<int>(file_type));
+    write_binary(file_stream, static_cast<int>(NDIM));
+    write_binary(file_stream, BINARY_FILE_BYTE_ORDER_CHECK);
+    write_binary(file_stream, num_records);
+    return;
+} // write_binary_header
+
+inline int
+read_binary_header(std::ifstream& file_stream,
+                   const BinaryFileType file_type,
+                   const std::string& filename,
+                   const std::string& object_name)
+{
+    char magic[sizeof(BINARY_FILE_MAGIC)];
+    int version = -1, type = -1, dim = -1, byte_order_check = 0, num_records = -1;
+    file_stream.read(magic, sizeof(magic));
+    if (file_stream.fail() || !std::equal(magic, magic + sizeof(magic), BINARY_FILE_MAGIC))
+    {
+        TBOX_ERROR(object_name << ":\n  File " << filename << " is not a binary structure file" << std::endl);
+    }
+    if (!read_binary(file_stream, version) || !read_binary(file_stream, type) || !read_binary(file_stream, dim) ||
+        !read_binary(file_stream, byte_order_check) || !read_binary(file_stream, num_records))
+    {
+        TBOX_ERROR(object_name << ":\n  Premature end to binary input file encountered in header of file "
+                               << filename
+                               << std::endl);
+    }
+    if (byte_order_check != BINARY_FILE_BYTE_ORDER_CHECK)
+    {
+        TBOX_ERROR(object_name << ":\n  Binary input file " << filename
+                               << " was generated on a machine with a different byte order" << std::endl);
+    }
+    if (version != BINARY_FILE_VERSION)
+    {
+        TBOX_ERROR(object_name << ":\n  Binary input file " << filename << " has unsupported format version "
+                               << version
+                               << std::endl);
+    }
+    if (type != file_type)
+    {
+        TBOX_ERROR(object_name << ":\n  Binary input file " << filename << " has unexpected file type " << type
+                               << std::endl);
+    }
+    if (dim != NDIM)
+    {
+        TBOX_ERROR(object_name << ":\n  Binary input file " << filename << " was generated for NDIM = " << dim
+                               << std::endl);
+    }
+    if (num_records <= 0)
+    {
+        TBOX_ERROR(object_name << ":\n  Invalid number of records in header of binary input file " << filename
+                               << std::endl);
+    }
+    return num_records;
+} // read_binary_header
+
+inline std::string
+get_ascii_line(std::ifstream& file_stream, const int line_number, const std::string& filename)
+{
+    std::string line_string;
+    if (!std::getline(file_stream, line_string))
+    {
+        TBOX_ERROR("IBStandardInitializer::convertASCIIToBinary():\n  Premature end to input file encountered "
+                   "before line "
+                   << line_number
+                   << " of file "
+                   << filename
+                   << std::endl);
+    }
+    return discard_comments(line_string);
+} // get_ascii_line
+
+inline void
+ascii_line_error(const int line_number, const std::string& filename)
+{
+    TBOX_ERROR("IBStandardInitializer::convertASCIIToBinary():\n  Invalid entry in input file encountered on line "
+               << line_number
+               << " of file "
+               << filename
+               << std::endl);
+    return;
+} // ascii_line_error
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -131,6 +253,9 @@ IBStandardInitializer::IBStandardInitializer(const std::string& object_name, Poi
     : IBRedundantInitializer(object_name, input_db),
       d_object_name(object_name),
       d_use_file_batons(true),
+      d_use_binary_files(false),
+      d_convert_ascii_to_binary(false),
+      d_distribute_binary_force_specs(false),
       d_max_levels(-1),
       d_level_is_initialized(),
       d_silo_writer(NULL),
@@ -218,23 +343,67 @@ IBStandardInitializer::init()
     }
     else
     {
-        // Process the vertex information.
-        readVertexFiles(".vertex");
+        if (d_use_binary_files)
+        {
+            // Generate the binary input files from the ASCII input files.
+            if (d_convert_ascii_to_binary)
+            {
+                if (SAMRAI_MPI::getRank() == 0)
+                {
+                    for (int ln = 0; ln < d_max_levels; ++ln)
+                    {
+                        for (unsigned int j = 0; j < d_base_filename[ln].size(); ++j)
+                        {
+                            convertASCIIToBinary(d_base_filename[ln][j]);
+                        }
+                    }
+                }
+                SAMRAI_MPI::barrier();
+            }
 
-        // Process the spring information.
-        readSpringFiles(".spring", /*input_uses_global_idxs*/ false);
+            // Process the vertex information.
+            readBinaryVertexFiles(".vertex");
 
-        // Process the crosslink spring ("x-spring") information.
-        readXSpringFiles(".xspring", /*input_uses_global_idxs*/ true);
+            // Process the spring, beam, and target point information.
+            //
+            // NOTE: When the force specifications are distributed, these data
+            // are read when each level of the patch hierarchy is initialized.
+            for (int ln = 0; ln < d_max_levels; ++ln)
+            {
+                const size_t num_base_filename = d_base_filename[ln].size();
+                d_spring_edge_map[ln].resize(num_base_filename);
+                d_spring_spec_data[ln].resize(num_base_filename);
+                d_beam_spec_data[ln].resize(num_base_filename);
+                d_target_spec_data[ln].resize(num_base_filename);
+                if (!d_distribute_binary_force_specs) readBinaryForceSpecFiles(ln, NULL);
+            }
 
-        // Process the beam information.
-        readBeamFiles(".beam", /*input_uses_global_idxs*/ false);
+            // Process the crosslink spring ("x-spring") information.
+            readXSpringFiles(".xspring", /*input_uses_global_idxs*/ true);
 
-        // Process the rod information.
-        readRodFiles(".rod", /*input_uses_global_idxs*/ false);
+            // Process the rod information.
+            readRodFiles(".rod", /*input_uses_global_idxs*/ false);
+        }
+        else
+        {
+            // Process the vertex information.
+            readVertexFiles(".vertex");
 
-        // Process the target point information.
-        readTargetPointFiles(".target");
+            // Process the spring information.
+            readSpringFiles(".spring", /*input_uses_global_idxs*/ false);
+
+            // Process the crosslink spring ("x-spring") information.
+            readXSpringFiles(".xspring", /*input_uses_global_idxs*/ true);
+
+            // Process the beam information.
+            readBeamFiles(".beam", /*input_uses_global_idxs*/ false);
+
+            // Process the rod information.
+            readRodFiles(".rod", /*input_uses_global_idxs*/ false);
+
+            // Process the target point information.
+            readTargetPointFiles(".target");
+        }
 
         // Process the anchor point information.
         readAnchorPointFiles(".anchor");
@@ -258,6 +427,255 @@ IBStandardInitializer::init()
     return;
 }
 
+unsigned int
+IBStandardInitializer::initializeDataOnPatchLevel(const int lag_node_index_idx,
+                                                  const unsigned int global_index_offset,
+                                                  const unsigned int local_index_offset,
+                                                  Pointer<LData> X_data,
+                                                  Pointer<LData> U_data,
+                                                  const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                                  const int level_number,
+                                                  const double init_data_time,
+                                                  const bool can_be_refined,
+                                                  const bool initial_time,
+                                                  LDataManager* const l_data_manager)
+{
+    // Read the force specifications associated with the vertices that are
+    // initially assigned to the local patches.
+    //
+    // NOTE: This level may be initialized more than once during initial
+    // gridding, so the force specifications are re-read each time.
+    if (d_use_binary_files && d_distribute_binary_force_specs)
+    {
+        const int num_level_vertex =
+            std::accumulate(d_num_vertex[level_number].begin(), d_num_vertex[level_number].end(), 0);
+        std::vector<bool> local_vertex_mask(num_level_vertex, false);
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            std::vector<std::pair<int, int> > patch_vertices;
+            getPatchVertices(patch_vertices, patch, hierarchy);
+            for (std::vector<std::pair<int, int> >::const_iterator it = patch_vertices.begin();
+                 it != patch_vertices.end();
+                 ++it)
+            {
+                local_vertex_mask[getCanonicalLagrangianIndex(*it, level_number)] = true;
+            }
+        }
+        readBinaryForceSpecFiles(level_number, &local_vertex_mask);
+    }
+
+    return IBRedundantInitializer::initializeDataOnPatchLevel(lag_node_index_idx,
+                                                              global_index_offset,
+                                                              local_index_offset,
+                                                              X_data,
+                                                              U_data,
+                                                              hierarchy,
+                                                              level_number,
+                                                              init_data_time,
+                                                              can_be_refined,
+                                                              initial_time,
+                                                              l_data_manager);
+} // initializeDataOnPatchLevel
+
+void
+IBStandardInitializer::convertASCIIToBinary(const std::string& base_filename)
+{
+    std::string line_string;
+
+    // Convert the vertex file.
+    int num_vertex = -1;
+    {
+        const std::string vertex_filename = base_filename + ".vertex";
+        std::ifstream file_stream(vertex_filename.c_str(), std::ios::in);
+        if (!file_stream.is_open())
+        {
+            TBOX_ERROR("IBStandardInitializer::convertASCIIToBinary():\n  Cannot find required vertex file: "
+                       << vertex_filename
+                       << std::endl);
+        }
+        line_string = get_ascii_line(file_stream, 1, vertex_filename);
+        std::istringstream header_stream(line_string);
+        if (!(header_stream >> num_vertex) || num_vertex <= 0) ascii_line_error(1, vertex_filename);
+
+        const std::string binary_filename = vertex_filename + BINARY_FILE_EXTENSION;
+        std::ofstream binary_stream(binary_filename.c_str(), std::ios::out | std::ios::binary);
+        write_binary_header(binary_stream, BINARY_VERTEX_FILE, num_vertex);
+        for (int k = 0; k < num_vertex; ++k)
+        {
+            line_string = get_ascii_line(file_stream, k + 2, vertex_filename);
+            std::istringstream line_stream(line_string);
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                double X;
+                if (!(line_stream >> X)) ascii_line_error(k + 2, vertex_filename);
+                write_binary(binary_stream, X);
+            }
+        }
+        if (!binary_stream.good())
+        {
+            TBOX_ERROR("IBStandardInitializer::convertASCIIToBinary():\n  Error writing binary file: "
+                       << binary_filename
+                       << std::endl);
+        }
+        plog << "IBStandardInitializer::convertASCIIToBinary():  "
+             << "converted " << num_vertex << " vertices from ASCII input file named " << vertex_filename << std::endl;
+    }
+
+    // Convert the spring file, if any.
+    {
+        const std::string spring_filename = base_filename + ".spring";
+        std::ifstream file_stream(spring_filename.c_str(), std::ios::in);
+        if (file_stream.is_open())
+        {
+            int num_edges = -1;
+            line_string = get_ascii_line(file_stream, 1, spring_filename);
+            std::istringstream header_stream(line_string);
+            if (!(header_stream >> num_edges) || num_edges <= 0) ascii_line_error(1, spring_filename);
+
+            const std::string binary_filename = spring_filename + BINARY_FILE_EXTENSION;
+            std::ofstream binary_stream(binary_filename.c_str(), std::ios::out | std::ios::binary);
+            write_binary_header(binary_stream, BINARY_SPRING_FILE, num_edges);
+            for (int k = 0; k < num_edges; ++k)
+            {
+                line_string = get_ascii_line(file_stream, k + 2, spring_filename);
+                std::istringstream line_stream(line_string);
+                int idx1, idx2, force_fcn_idx = 0;
+                std::vector<double> parameters(2);
+                if (!(line_stream >> idx1 >> idx2 >> parameters[0] >> parameters[1]))
+                {
+                    ascii_line_error(k + 2, spring_filename);
+                }
+                if (line_stream >> force_fcn_idx)
+                {
+                    double param;
+                    while (line_stream >> param)
+                    {
+                        parameters.push_back(param);
+                    }
+                }
+                else
+                {
+                    force_fcn_idx = 0; // default force function specification.
+                }
+                write_binary(binary_stream, idx1);
+                write_binary(binary_stream, idx2);
+                write_binary(binary_stream, force_fcn_idx);
+                write_binary(binary_stream, static_cast<int>(parameters.size()));
+                binary_stream.write(reinterpret_cast<const char*>(&parameters[0]),
+                                    parameters.size() * sizeof(double));
+            }
+            if (!binary_stream.good())
+            {
+                TBOX_ERROR("IBStandardInitializer::convertASCIIToBinary():\n  Error writing binary file: "
+                           << binary_filename
+                           << std::endl);
+            }
+            plog << "IBStandardInitializer::convertASCIIToBinary():  "
+                 << "converted " << num_edges << " edges from ASCII input file named " << spring_filename
+                 << std::endl;
+        }
+    }
+
+    // Convert the beam file, if any.
+    {
+        const std::string beam_filename = base_filename + ".beam";
+        std::ifstream file_stream(beam_filename.c_str(), std::ios::in);
+        if (file_stream.is_open())
+        {
+            int num_beams = -1;
+            line_string = get_ascii_line(file_stream, 1, beam_filename);
+            std::istringstream header_stream(line_string);
+            if (!(header_stream >> num_beams) || num_beams <= 0) ascii_line_error(1, beam_filename);
+
+            const std::string binary_filename = beam_filename + BINARY_FILE_EXTENSION;
+            std::ofstream binary_stream(binary_filename.c_str(), std::ios::out | std::ios::binary);
+            write_binary_header(binary_stream, BINARY_BEAM_FILE, num_beams);
+            for (int k = 0; k < num_beams; ++k)
+            {
+                line_string = get_ascii_line(file_stream, k + 2, beam_filename);
+                std::istringstream line_stream(line_string);
+                int prev_idx, curr_idx, next_idx;
+                double bend;
+                if (!(line_stream >> prev_idx >> curr_idx >> next_idx >> bend))
+                {
+                    ascii_line_error(k + 2, beam_filename);
+                }
+                double curv[NDIM];
+                bool curv_found_in_input = false;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    curv[d] = 0.0;
+                    if (line_stream >> curv[d])
+                    {
+                        curv_found_in_input = true;
+                    }
+                    else if (curv_found_in_input)
+                    {
+                        ascii_line_error(k + 2, beam_filename);
+                    }
+                }
+                write_binary(binary_stream, prev_idx);
+                write_binary(binary_stream, curr_idx);
+                write_binary(binary_stream, next_idx);
+                write_binary(binary_stream, bend);
+                binary_stream.write(reinterpret_cast<const char*>(curv), NDIM * sizeof(double));
+            }
+            if (!binary_stream.good())
+            {
+                TBOX_ERROR("IBStandardInitializer::convertASCIIToBinary():\n  Error writing binary file: "
+                           << binary_filename
+                           << std::endl);
+            }
+            plog << "IBStandardInitializer::convertASCIIToBinary():  "
+                 << "converted " << num_beams << " beams from ASCII input file named " << beam_filename << std::endl;
+        }
+    }
+
+    // Convert the target point file, if any.
+    {
+        const std::string target_filename = base_filename + ".target";
+        std::ifstream file_stream(target_filename.c_str(), std::ios::in);
+        if (file_stream.is_open())
+        {
+            int num_target_points = -1;
+            line_string = get_ascii_line(file_stream, 1, target_filename);
+            std::istringstream header_stream(line_string);
+            if (!(header_stream >> num_target_points) || num_target_points <= 0)
+            {
+                ascii_line_error(1, target_filename);
+            }
+
+            const std::string binary_filename = target_filename + BINARY_FILE_EXTENSION;
+            std::ofstream binary_stream(binary_filename.c_str(), std::ios::out | std::ios::binary);
+            write_binary_header(binary_stream, BINARY_TARGET_FILE, num_target_points);
+            for (int k = 0; k < num_target_points; ++k)
+            {
+                line_string = get_ascii_line(file_stream, k + 2, target_filename);
+                std::istringstream line_stream(line_string);
+                int n;
+                double kappa, eta = 0.0;
+                if (!(line_stream >> n >> kappa)) ascii_line_error(k + 2, target_filename);
+                if (!(line_stream >> eta)) eta = 0.0;
+                write_binary(binary_stream, n);
+                write_binary(binary_stream, kappa);
+                write_binary(binary_stream, eta);
+            }
+            if (!binary_stream.good())
+            {
+                TBOX_ERROR("IBStandardInitializer::convertASCIIToBinary():\n  Error writing binary file: "
+                           << binary_filename
+                           << std::endl);
+            }
+            plog << "IBStandardInitializer::convertASCIIToBinary():  "
+                 << "converted " << num_target_points << " target points from ASCII input file named "
+                 << target_filename << std::endl;
+        }
+    }
+    return;
+} // convertASCIIToBinary
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
@@ -2712,6 +3130,533 @@ IBStandardInitializer::readSourceFiles(const std::string& extension)
     return;
 } // readSourceFiles
 
+void
+IBStandardInitializer::readBinaryVertexFiles(const std::string& extension)
+{
+    const int rank = SAMRAI_MPI::getRank();
+    const int nodes = SAMRAI_MPI::getNodes();
+    int flag = 1;
+    int sz = 1;
+
+    for (int ln = 0; ln < d_max_levels; ++ln)
+    {
+        const size_t num_base_filename = d_base_filename[ln].size();
+        d_num_vertex[ln].resize(num_base_filename, 0);
+        d_vertex_offset[ln].resize(num_base_filename, std::numeric_limits<int>::max());
+        d_vertex_posn[ln].resize(num_base_filename);
+        for (unsigned int j = 0; j < num_base_filename; ++j)
+        {
+            // Wait for the previous MPI process to finish reading the current file.
+            if (d_use_file_batons && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
+
+            if (j == 0)
+            {
+                d_vertex_offset[ln][j] = 0;
+            }
+            else
+            {
+                d_vertex_offset[ln][j] = d_vertex_offset[ln][j - 1] + d_num_vertex[ln][j - 1];
+            }
+
+            // Ensure that the file exists.
+            const std::string vertex_filename = d_base_filename[ln][j] + extension + BINARY_FILE_EXTENSION;
+            std::ifstream file_stream;
+            file_stream.open(vertex_filename.c_str(), std::ios::in | std::ios::binary);
+            if (file_stream.is_open())
+            {
+                plog << d_object_name << ":  "
+                     << "processing vertex data from binary input file named " << vertex_filename << std::endl
+                     << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
+
+                // The header indicates the number of vertices.
+                d_num_vertex[ln][j] =
+                    read_binary_header(file_stream, BINARY_VERTEX_FILE, vertex_filename, d_object_name);
+
+                // The vertex positions are stored contiguously.
+                std::vector<double> X_raw(NDIM * d_num_vertex[ln][j]);
+                file_stream.read(reinterpret_cast<char*>(&X_raw[0]), X_raw.size() * sizeof(double));
+                if (file_stream.fail())
+                {
+                    TBOX_ERROR(d_object_name << ":\n  Premature end to binary input file encountered in file "
+                                             << vertex_filename
+                                             << std::endl);
+                }
+                d_vertex_posn[ln][j].resize(d_num_vertex[ln][j]);
+                for (int k = 0; k < d_num_vertex[ln][j]; ++k)
+                {
+                    Point& X = d_vertex_posn[ln][j][k];
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        X[d] = d_length_scale_factor * (X_raw[NDIM * k + d] + d_posn_shift[d]);
+                    }
+                }
+
+                // Close the input file.
+                file_stream.close();
+
+                plog << d_object_name << ":  "
+                     << "read " << d_num_vertex[ln][j] << " vertices from binary input file named "
+                     << vertex_filename << std::endl
+                     << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
+            }
+            else
+            {
+                TBOX_ERROR(d_object_name << ":\n  Cannot find required vertex file: " << vertex_filename << std::endl);
+            }
+
+            // Free the next MPI process to start reading the current file.
+            if (d_use_file_batons && rank != nodes - 1) SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
+        }
+    }
+
+    // Synchronize the processes.
+    if (d_use_file_batons) SAMRAI_MPI::barrier();
+    return;
+} // readBinaryVertexFiles
+
+void
+IBStandardInitializer::readBinaryForceSpecFiles(const int level_number, const std::vector<bool>* local_vertex_mask)
+{
+    const int rank = SAMRAI_MPI::getRank();
+    const int nodes = SAMRAI_MPI::getNodes();
+    int flag = 1;
+    int sz = 1;
+
+    const size_t num_base_filename = d_base_filename[level_number].size();
+    for (unsigned int j = 0; j < num_base_filename; ++j)
+    {
+        // Wait for the previous MPI process to finish reading the current files.
+        if (d_use_file_batons && rank != 0) SAMRAI_MPI::recv(&flag, sz, rank - 1, false, j);
+
+        readBinarySpringFile(level_number, j, local_vertex_mask);
+        readBinaryBeamFile(level_number, j, local_vertex_mask);
+        readBinaryTargetPointFile(level_number, j, local_vertex_mask);
+
+        // Free the next MPI process to start reading the current files.
+        if (d_use_file_batons && rank != nodes - 1) SAMRAI_MPI::send(&flag, sz, rank + 1, false, j);
+    }
+
+    // Synchronize the processes.
+    if (d_use_file_batons) SAMRAI_MPI::barrier();
+    return;
+} // readBinaryForceSpecFiles
+
+void
+IBStandardInitializer::readBinarySpringFile(const int ln,
+                                            const unsigned int j,
+                                            const std::vector<bool>* const local_vertex_mask)
+{
+    d_spring_edge_map[ln][j].clear();
+    d_spring_spec_data[ln][j].clear();
+
+    // The complete spring connectivity is needed for visualization.
+    const bool keep_all_edges = !local_vertex_mask || IBRedundantInitializer::d_silo_writer;
+
+    const std::string spring_filename = d_base_filename[ln][j] + ".spring" + BINARY_FILE_EXTENSION;
+    std::ifstream file_stream;
+    file_stream.open(spring_filename.c_str(), std::ios::in | std::ios::binary);
+    if (!file_stream.is_open()) return;
+
+    plog << d_object_name << ":  "
+         << "processing spring data from binary input file named " << spring_filename << std::endl
+         << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
+
+    bool warned = false;
+    const int min_idx = 0;
+    const int max_idx = d_num_vertex[ln][j];
+    const int num_edges = read_binary_header(file_stream, BINARY_SPRING_FILE, spring_filename, d_object_name);
+    int num_local_edges = 0;
+    for (int k = 0; k < num_edges; ++k)
+    {
+        Edge e;
+        int force_fcn_idx, num_params;
+        if (!read_binary(file_stream, e.first) || !read_binary(file_stream, e.second) ||
+            !read_binary(file_stream, force_fcn_idx) || !read_binary(file_stream, num_params) || num_params < 2)
+        {
+            TBOX_ERROR(d_object_name << ":\n  Invalid entry in binary input file encountered in record " << k
+                                     << " of file "
+                                     << spring_filename
+                                     << std::endl);
+        }
+        std::vector<double> parameters(num_params);
+        file_stream.read(reinterpret_cast<char*>(&parameters[0]), num_params * sizeof(double));
+        if (file_stream.fail())
+        {
+            TBOX_ERROR(d_object_name << ":\n  Premature end to binary input file encountered in record " << k
+                                     << " of file "
+                                     << spring_filename
+                                     << std::endl);
+        }
+        if ((e.first < min_idx) || (e.first >= max_idx) || (e.second < min_idx) || (e.second >= max_idx))
+        {
+            TBOX_ERROR(d_object_name << ":\n  Invalid entry in binary input file encountered in record " << k
+                                     << " of file "
+                                     << spring_filename
+                                     << std::endl
+                                     << "  vertex index is out of range"
+                                     << std::endl);
+        }
+        if (parameters[0] < 0.0)
+        {
+            TBOX_ERROR(d_object_name << ":\n  Invalid entry in binary input file encountered in record " << k
+                                     << " of file "
+                                     << spring_filename
+                                     << std::endl
+                                     << "  spring constant is negative"
+                                     << std::endl);
+        }
+        if (parameters[1] < 0.0)
+        {
+            TBOX_ERROR(d_object_name << ":\n  Invalid entry in binary input file encountered in record " << k
+                                     << " of file "
+                                     << spring_filename
+                                     << std::endl
+                                     << "  spring resting length is negative"
+                                     << std::endl);
+        }
+        parameters[1] *= d_length_scale_factor;
+
+        // Modify kappa and length according to whether uniform values are to
+        // be employed for this particular structure.
+        if (d_using_uniform_spring_stiffness[ln][j])
+        {
+            parameters[0] = d_uniform_spring_stiffness[ln][j];
+        }
+        if (d_using_uniform_spring_rest_length[ln][j])
+        {
+            parameters[1] = d_uniform_spring_rest_length[ln][j];
+        }
+        if (d_using_uniform_spring_force_fcn_idx[ln][j])
+        {
+            force_fcn_idx = d_uniform_spring_force_fcn_idx[ln][j];
+        }
+
+        // Check to see if the spring constant is zero and, if so, emit a
+        // warning.
+        if (!warned && d_enable_springs[ln][j] &&
+            (parameters[0] == 0.0 || MathUtilities<double>::equalEps(parameters[0], 0.0)))
+        {
+            TBOX_WARNING(d_object_name << ":\n  Spring with zero spring constant "
+                                          "encountered in binary input file named "
+                                       << spring_filename
+                                       << "."
+                                       << std::endl);
+            warned = true;
+        }
+
+        // Correct the edge numbers to be in the global Lagrangian indexing
+        // scheme, and associate each edge with only the first vertex.
+        e.first += d_vertex_offset[ln][j];
+        e.second += d_vertex_offset[ln][j];
+        if (e.first > e.second)
+        {
+            std::swap<int>(e.first, e.second);
+        }
+        const bool is_local = !local_vertex_mask || (*local_vertex_mask)[e.first];
+        if (!is_local && !keep_all_edges) continue;
+
+        bool found_connection = false;
+        std::pair<std::multimap<int, Edge>::iterator, std::multimap<int, Edge>::iterator> range =
+            d_spring_edge_map[ln][j].equal_range(e.first);
+        for (std::multimap<int, Edge>::iterator it = range.first; it != range.second; ++it)
+        {
+            if (it->second == e) found_connection = true;
+        }
+        if (found_connection)
+        {
+            TBOX_WARNING(d_object_name << ":\n  Duplicate spring connection between nodes "
+                                       << e.first - d_vertex_offset[ln][j] << " and "
+                                       << e.second - d_vertex_offset[ln][j]
+                                       << " encountered in binary input file named " << spring_filename << ".\n"
+                                       << "  Skipping duplicated connection." << std::endl);
+        }
+        else
+        {
+            d_spring_edge_map[ln][j].insert(std::make_pair(e.first, e));
+            if (is_local)
+            {
+                SpringSpec spec_data;
+                spec_data.parameters = parameters;
+                spec_data.force_fcn_idx = force_fcn_idx;
+                d_spring_spec_data[ln][j].insert(std::make_pair(e, spec_data));
+                ++num_local_edges;
+            }
+        }
+    }
+
+    // Close the input file.
+    file_stream.close();
+
+    plog << d_object_name << ":  "
+         << "read " << num_edges << " edges (" << num_local_edges << " local) from binary input file named "
+         << spring_filename << std::endl
+         << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
+    return;
+} // readBinarySpringFile
+
+void
+IBStandardInitializer::readBinaryBeamFile(const int ln,
+                                          const unsigned int j,
+                                          const std::vector<bool>* const local_vertex_mask)
+{
+    d_beam_spec_data[ln][j].clear();
+
+    const std::string beam_filename = d_base_filename[ln][j] + ".beam" + BINARY_FILE_EXTENSION;
+    std::ifstream file_stream;
+    file_stream.open(beam_filename.c_str(), std::ios::in | std::ios::binary);
+    if (!file_stream.is_open()) return;
+
+    plog << d_object_name << ":  "
+         << "processing beam data from binary input file named " << beam_filename << std::endl
+         << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
+
+    bool warned = false;
+    const int min_idx = 0;
+    const int max_idx = d_num_vertex[ln][j];
+    const int num_beams = read_binary_header(file_stream, BINARY_BEAM_FILE, beam_filename, d_object_name);
+    int num_local_beams = 0;
+    for (int k = 0; k < num_beams; ++k)
+    {
+        int prev_idx, curr_idx, next_idx;
+        double bend;
+        Vector curv(Vector::Zero());
+        if (!read_binary(file_stream, prev_idx) || !read_binary(file_stream, curr_idx) ||
+            !read_binary(file_stream, next_idx) || !read_binary(file_stream, bend))
+        {
+            TBOX_ERROR(d_object_name << ":\n  Premature end to binary input file encountered in record " << k
+                                     << " of file "
+                                     << beam_filename
+                                     << std::endl);
+        }
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            if (!read_binary(file_stream, curv[d]))
+            {
+                TBOX_ERROR(d_object_name << ":\n  Premature end to binary input file encountered in record " << k
+                                         << " of file "
+                                         << beam_filename
+                                         << std::endl);
+            }
+        }
+        if ((prev_idx < min_idx) || (prev_idx >= max_idx) || (curr_idx < min_idx) || (curr_idx >= max_idx) ||
+            (next_idx < min_idx) || (next_idx >= max_idx))
+        {
+            TBOX_ERROR(d_object_name << ":\n  Invalid entry in binary input file encountered in record " << k
+                                     << " of file "
+                                     << beam_filename
+                                     << std::endl
+                                     << "  vertex index is out of range"
+                                     << std::endl);
+        }
+        if (bend < 0.0)
+        {
+            TBOX_ERROR(d_object_name << ":\n  Invalid entry in binary input file encountered in record " << k
+                                     << " of file "
+                                     << beam_filename
+                                     << std::endl
+                                     << "  beam constant is negative"
+                                     << std::endl);
+        }
+
+        // Modify bend and curvature according to whether uniform values are to
+        // be employed for this particular structure.
+        if (d_using_uniform_beam_bend_rigidity[ln][j])
+        {
+            bend = d_uniform_beam_bend_rigidity[ln][j];
+        }
+        if (d_using_uniform_beam_curvature[ln][j])
+        {
+            curv = d_uniform_beam_curvature[ln][j];
+        }
+
+        // Check to see if the bending rigidity is zero and, if so, emit a
+        // warning.
+        if (!warned && d_enable_beams[ln][j] && (bend == 0.0 || MathUtilities<double>::equalEps(bend, 0.0)))
+        {
+            TBOX_WARNING(d_object_name << ":\n  Beam with zero bending rigidity "
+                                          "encountered in binary input file named "
+                                       << beam_filename
+                                       << "."
+                                       << std::endl);
+            warned = true;
+        }
+
+        // Correct the node numbers to be in the global Lagrangian indexing
+        // scheme.  Each beam is associated with only the "current" vertex.
+        prev_idx += d_vertex_offset[ln][j];
+        curr_idx += d_vertex_offset[ln][j];
+        next_idx += d_vertex_offset[ln][j];
+        if (local_vertex_mask && !(*local_vertex_mask)[curr_idx]) continue;
+
+        bool found_connection = false;
+        std::pair<std::multimap<int, BeamSpec>::iterator, std::multimap<int, BeamSpec>::iterator> range =
+            d_beam_spec_data[ln][j].equal_range(curr_idx);
+        for (std::multimap<int, BeamSpec>::iterator it = range.first; it != range.second; ++it)
+        {
+            const BeamSpec& spec_data = it->second;
+            if (spec_data.neighbor_idxs == std::make_pair(next_idx, prev_idx)) found_connection = true;
+        }
+        if (found_connection)
+        {
+            TBOX_WARNING(d_object_name << ":\n  Duplicate beam connection between nodes "
+                                       << prev_idx - d_vertex_offset[ln][j] << ",  "
+                                       << curr_idx - d_vertex_offset[ln][j] << ", and "
+                                       << next_idx - d_vertex_offset[ln][j]
+                                       << " encountered in binary input file named " << beam_filename << ".\n"
+                                       << "  Skipping duplicated connection." << std::endl);
+        }
+        else
+        {
+            BeamSpec spec_data;
+            spec_data.neighbor_idxs = std::make_pair(next_idx, prev_idx);
+            spec_data.bend_rigidity = bend;
+            spec_data.curvature = curv;
+            d_beam_spec_data[ln][j].insert(std::make_pair(curr_idx, spec_data));
+            ++num_local_beams;
+        }
+    }
+
+    // Close the input file.
+    file_stream.close();
+
+    plog << d_object_name << ":  "
+         << "read " << num_beams << " beams (" << num_local_beams << " local) from binary input file named "
+         << beam_filename << std::endl
+         << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
+    return;
+} // readBinaryBeamFile
+
+void
+IBStandardInitializer::readBinaryTargetPointFile(const int ln,
+                                                 const unsigned int j,
+                                                 const std::vector<bool>* const local_vertex_mask)
+{
+    TargetSpec default_spec;
+    default_spec.stiffness = 0.0;
+    default_spec.damping = 0.0;
+    d_target_spec_data[ln][j].assign(d_num_vertex[ln][j], default_spec);
+
+    const std::string target_point_stiffness_filename = d_base_filename[ln][j] + ".target" + BINARY_FILE_EXTENSION;
+    std::ifstream file_stream;
+    file_stream.open(target_point_stiffness_filename.c_str(), std::ios::in | std::ios::binary);
+    if (file_stream.is_open())
+    {
+        plog << d_object_name << ":  "
+             << "processing target point data from binary input file named " << target_point_stiffness_filename
+             << std::endl
+             << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
+
+        bool warned = false;
+        const int min_idx = 0;
+        const int max_idx = d_num_vertex[ln][j];
+        std::set<int> target_point_idxs;
+        const int num_target_points = read_binary_header(
+            file_stream, BINARY_TARGET_FILE, target_point_stiffness_filename, d_object_name);
+        for (int k = 0; k < num_target_points; ++k)
+        {
+            int n;
+            double kappa, eta;
+            if (!read_binary(file_stream, n) || !read_binary(file_stream, kappa) || !read_binary(file_stream, eta))
+            {
+                TBOX_ERROR(d_object_name << ":\n  Premature end to binary input file encountered in record " << k
+                                         << " of file "
+                                         << target_point_stiffness_filename
+                                         << std::endl);
+            }
+            if ((n < min_idx) || (n >= max_idx))
+            {
+                TBOX_ERROR(d_object_name << ":\n  Invalid entry in binary input file encountered in record " << k
+                                         << " of file "
+                                         << target_point_stiffness_filename
+                                         << std::endl
+                                         << "  vertex index "
+                                         << n
+                                         << " is out of range"
+                                         << std::endl);
+            }
+            if (kappa < 0.0)
+            {
+                TBOX_ERROR(d_object_name << ":\n  Invalid entry in binary input file encountered in record " << k
+                                         << " of file "
+                                         << target_point_stiffness_filename
+                                         << std::endl
+                                         << "  target point spring constant is negative"
+                                         << std::endl);
+            }
+            if (eta < 0.0)
+            {
+                TBOX_ERROR(d_object_name << ":\n  Invalid entry in binary input file encountered in record " << k
+                                         << " of file "
+                                         << target_point_stiffness_filename
+                                         << std::endl
+                                         << "  target point damping coefficient is negative"
+                                         << std::endl);
+            }
+            if (local_vertex_mask && !(*local_vertex_mask)[n + d_vertex_offset[ln][j]]) continue;
+
+            if (target_point_idxs.count(n))
+            {
+                TBOX_WARNING(d_object_name << ":\n  Duplicate target point node " << n
+                                           << " encountered in binary input file named "
+                                           << target_point_stiffness_filename << ".\n"
+                                           << "  Skipping duplicated point." << std::endl);
+            }
+            else
+            {
+                target_point_idxs.insert(n);
+                d_target_spec_data[ln][j][n].stiffness = kappa;
+                d_target_spec_data[ln][j][n].damping = eta;
+
+                // Check to see if the penalty spring constant is zero and, if
+                // so, emit a warning.
+                if (!warned && d_enable_target_points[ln][j] &&
+                    (kappa == 0.0 || MathUtilities<double>::equalEps(kappa, 0.0)))
+                {
+                    TBOX_WARNING(d_object_name << ":\n  Target point with zero penalty spring "
+                                                  "constant encountered in binary input file "
+                                                  "named "
+                                               << target_point_stiffness_filename << "." << std::endl);
+                    warned = true;
+                }
+            }
+        }
+
+        // Close the input file.
+        file_stream.close();
+
+        plog << d_object_name << ":  "
+             << "read " << num_target_points << " target points from binary input file named "
+             << target_point_stiffness_filename << std::endl
+             << "  on MPI process " << SAMRAI_MPI::getRank() << std::endl;
+    }
+
+    // Modify the target point stiffness constants according to whether target
+    // point penalty forces are enabled, or whether uniform values are to be
+    // employed, for this particular structure.
+    if (!d_enable_target_points[ln][j])
+    {
+        d_target_spec_data[ln][j].assign(d_num_vertex[ln][j], default_spec);
+    }
+    else
+    {
+        if (d_using_uniform_target_stiffness[ln][j])
+        {
+            for (int k = 0; k < d_num_vertex[ln][j]; ++k)
+            {
+                d_target_spec_data[ln][j][k].stiffness = d_uniform_target_stiffness[ln][j];
+            }
+        }
+        if (d_using_uniform_target_damping[ln][j])
+        {
+            for (int k = 0; k < d_num_vertex[ln][j]; ++k)
+            {
+                d_target_spec_data[ln][j][k].damping = d_uniform_target_damping[ln][j];
+            }
+        }
+    }
+    return;
+} // readBinaryTargetPointFile
+
 std::vector<Pointer<Streamable> >
 IBStandardInitializer::initializeNodeData(const std::pair<int, int>& point_index,
                                           const unsigned int global_index_offset,
@@ -2900,6 +3845,29 @@ IBStandardInitializer::getFromInput(Pointer<Database> db)
     // reading the same file at once.
     if (db->keyExists("use_file_batons")) d_use_file_batons = db->getBool("use_file_batons");
 
+    // Determine whether to read vertex, spring, beam, and target point data
+    // from binary input files.
+    if (db->keyExists("use_binary_files")) d_use_binary_files = db->getBool("use_binary_files");
+    if (db->keyExists("convert_ascii_to_binary")) d_convert_ascii_to_binary = db->getBool("convert_ascii_to_binary");
+    if (db->keyExists("distribute_binary_force_specs"))
+        d_distribute_binary_force_specs = db->getBool("distribute_binary_force_specs");
+    if (d_convert_ascii_to_binary && !d_use_binary_files)
+    {
+        TBOX_WARNING(d_object_name << ":  "
+                                   << "Key data `convert_ascii_to_binary' is TRUE but `use_binary_files' is FALSE.\n"
+                                   << "  `convert_ascii_to_binary' has no effect, and binary input files will not be "
+                                      "generated."
+                                   << std::endl);
+    }
+    if (d_distribute_binary_force_specs && !d_use_binary_files)
+    {
+        TBOX_WARNING(d_object_name << ":  "
+                                   << "Key data `distribute_binary_force_specs' is TRUE but `use_binary_files' is "
+                                      "FALSE.\n"
+                                   << "  Force specifications will not be distributed." << std::endl);
+        d_distribute_binary_force_specs = false;
+    }
+
     // Determine the (maximum) number of levels in the locally refined grid.
     // Note that each piece of the Lagrangian structure must be assigned to a
     // particular level of the grid.
@@ -85,6 +85,7 @@
 #include "ibtk/LSet.h"
 #include "ibtk/LSetData.h"
 #include "ibtk/LSiloDataWriter.h"
+#include "ibtk/PerformanceProfiler.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
 #include "ibtk/libmesh_utilities.h"
 #include "libmesh/tensor_value.h"
@@ -414,6 +415,7 @@ IMPMethod::interpolateVelocity(const int u_data_idx,
                                const std::vector<Pointer<RefineSchedule<NDIM> > >& u_ghost_fill_scheds,
                                const double data_time)
 {
+    ProfilingScope profiling_scope("interp");
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
@@ -736,6 +738,7 @@ IMPMethod::trapezoidalStep(const double current_time, const double new_time)
 void
 IMPMethod::computeLagrangianForce(const double data_time)
 {
+    ProfilingScope profiling_scope("force");
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
     std::vector<Pointer<LData> > *X_data, *F_data;
@@ -804,6 +807,7 @@ IMPMethod::spreadForce(const int f_data_idx,
                        const std::vector<Pointer<RefineSchedule<NDIM> > >& /*f_prolongation_scheds*/,
                        const double data_time)
 {
+    ProfilingScope profiling_scope("spread");
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
@@ -34,6 +34,7 @@
 
 #include <limits>
 
+#include "CartesianGridGeometry.h"
 #include "ibamr/CIBStrategy.h"
 #include "ibamr/IBStrategy.h"
 #include "ibamr/INSStaggeredHierarchyIntegrator.h"
@@ -96,6 +97,12 @@ KrylovMobilitySolver::KrylovMobilitySolver(const std::string& object_name,
     d_petsc_comm = petsc_comm;
     d_petsc_ksp = NULL;
     d_petsc_mat = NULL;
+    d_pc_ksp = NULL;
+    d_pc_mat = NULL;
+    d_pc_mobility_type = RPY;
+    d_pc_max_iterations = 50;
+    d_pc_rel_residual_tol = 1.0e-3;
+    d_f_periodic_corr = 0.0;
     d_samrai_temp.resize(2, Pointer<SAMRAIVectorReal<NDIM, PetscScalar> >(NULL));
     d_ins_integrator = navier_stokes_integrator;
     d_cib_strategy = cib_strategy;
@@ -314,6 +321,16 @@ KrylovMobilitySolver::~KrylovMobilitySolver()
         KSPDestroy(&d_petsc_ksp);
         d_petsc_ksp = NULL;
     }
+    if (d_pc_mat)
+    {
+        MatDestroy(&d_pc_mat);
+        d_pc_mat = NULL;
+    }
+    if (d_pc_ksp)
+    {
+        KSPDestroy(&d_pc_ksp);
+        d_pc_ksp = NULL;
+    }
 } // ~KrylovMobilitySolver
 
 void
@@ -570,6 +587,21 @@ KrylovMobilitySolver::getFromInput(Pointer<Database> input_db)
     if (input_db->keyExists("normalize_pressure")) d_normalize_pressure = input_db->getBool("normalize_pressure");
     if (input_db->keyExists("normalize_velocity")) d_normalize_velocity = input_db->getBool("normalize_velocity");
     if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
+    if (input_db->keyExists("pc_mobility_type"))
+    {
+        d_pc_mobility_type = IBAMR::string_to_enum<MobilityMatrixType>(input_db->getString("pc_mobility_type"));
+        if (d_pc_mobility_type != RPY && d_pc_mobility_type != EMPIRICAL)
+        {
+            TBOX_ERROR(d_object_name << "::getFromInput()\n"
+                                     << "  valid values for pc_mobility_type are: RPY, EMPIRICAL"
+                                     << std::endl);
+        }
+    }
+    if (input_db->keyExists("pc_max_iterations")) d_pc_max_iterations = input_db->getInteger("pc_max_iterations");
+    if (input_db->keyExists("pc_rel_residual_tol"))
+        d_pc_rel_residual_tol = input_db->getDouble("pc_rel_residual_tol");
+    if (input_db->keyExists("f_periodic_correction"))
+        d_f_periodic_corr = input_db->getDouble("f_periodic_correction");
 } // getFromInput
 
 void
@@ -810,6 +842,16 @@ KrylovMobilitySolver::destroyKSP()
 {
     KSPDestroy(&d_petsc_ksp);
     d_petsc_ksp = NULL;
+    if (d_pc_mat)
+    {
+        MatDestroy(&d_pc_mat);
+        d_pc_mat = NULL;
+    }
+    if (d_pc_ksp)
+    {
+        KSPDestroy(&d_pc_ksp);
+        d_pc_ksp = NULL;
+    }
 } // destroyKSP
 
 void
@@ -901,6 +943,27 @@ KrylovMobilitySolver::resetKSPPC()
         PCSetType(petsc_pc, PCSHELL);
         PCShellSetContext(petsc_pc, static_cast<void*>(this));
         PCShellSetApply(petsc_pc, KrylovMobilitySolver::PCApply_KMInv);
+
+        // Setup the inexact solver for the approximate mobility operator.
+        if (d_pc_mat) MatDestroy(&d_pc_mat);
+        int n;
+        VecGetLocalSize(d_petsc_b, &n);
+        MatCreateShell(d_petsc_comm, n, n, PETSC_DETERMINE, PETSC_DETERMINE, static_cast<void*>(this), &d_pc_mat);
+        MatShellSetOperation(
+            d_pc_mat, MATOP_MULT, reinterpret_cast<void (*)(void)>(KrylovMobilitySolver::MatVecMult_PC));
+
+        if (d_pc_ksp) KSPDestroy(&d_pc_ksp);
+        KSPCreate(d_petsc_comm, &d_pc_ksp);
+        KSPSetType(d_pc_ksp, KSPCG);
+        KSPSetOperators(d_pc_ksp, d_pc_mat, d_pc_mat);
+        KSPSetTolerances(d_pc_ksp, d_pc_rel_residual_tol, PETSC_DEFAULT, PETSC_DEFAULT, d_pc_max_iterations);
+        KSPSetInitialGuessNonzero(d_pc_ksp, PETSC_FALSE);
+        KSPSetNormType(d_pc_ksp, KSP_NORM_UNPRECONDITIONED);
+        PC inner_pc;
+        KSPGetPC(d_pc_ksp, &inner_pc);
+        PCSetType(inner_pc, PCNONE);
+        KSPSetOptionsPrefix(d_pc_ksp, (d_options_prefix + "pc_mob_").c_str());
+        KSPSetFromOptions(d_pc_ksp);
     }
     else
     {
@@ -987,14 +1050,79 @@ KrylovMobilitySolver::MatVecMult_KMInv(Mat A, Vec x, Vec y)
     PetscFunctionReturn(0);
 } // MatVecMult_KMInv
 
-// Routine to apply DirectMobility preconditioner
-PetscErrorCode KrylovMobilitySolver::PCApply_KMInv(PC /*pc*/, Vec /*x*/, Vec /*y*/)
+// Routine to apply the approximate inverse of the free-space mobility operator
+PetscErrorCode
+KrylovMobilitySolver::PCApply_KMInv(PC pc, Vec x, Vec y)
 {
-    TBOX_ERROR(
-        "KrylovMobilitySolver::PCApply_KMInv(). Shell Preconditioner for KrylovMobilitySolver not implemented.\n");
+    void* ctx;
+    PCShellGetContext(pc, &ctx);
+    KrylovMobilitySolver* solver = static_cast<KrylovMobilitySolver*>(ctx);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(solver);
+    TBOX_ASSERT(solver->d_pc_ksp);
+#endif
+
+    KSPSolve(solver->d_pc_ksp, x, y);
+    if (solver->d_enable_logging)
+    {
+        int its;
+        KSPGetIterationNumber(solver->d_pc_ksp, &its);
+        plog << solver->d_object_name << "::PCApply_KMInv(): " << its << " iterations of approximate mobility solve\n";
+    }
+
     PetscFunctionReturn(0);
 } // PCApply_KMInv
 
+PetscErrorCode
+KrylovMobilitySolver::MatVecMult_PC(Mat A, Vec x, Vec y)
+{
+    void* p_ctx;
+    MatShellGetContext(A, &p_ctx);
+    KrylovMobilitySolver* solver = static_cast<KrylovMobilitySolver*>(p_ctx);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(solver);
+    TBOX_ASSERT(solver->d_hierarchy);
+#endif
+
+    // Get grid-info of the structure level.
+    Pointer<PatchHierarchy<NDIM> > patch_hierarchy = solver->d_hierarchy;
+    const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+    const IntVector<NDIM>& ratio = patch_hierarchy->getPatchLevel(finest_ln)->getRatio();
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = patch_hierarchy->getGridGeometry();
+    const double* dx0 = grid_geom->getDx();
+    const double* X_upper = grid_geom->getXUpper();
+    const double* X_lower = grid_geom->getXLower();
+    double domain_extents[NDIM], dx[NDIM];
+    for (int d = 0; d < NDIM; ++d)
+    {
+        dx[d] = dx0[d] / ratio(d);
+        domain_extents[d] = X_upper[d] - X_lower[d];
+    }
+
+    // Set y := [beta*gamma*M + beta*delta*W]x, which approximates the operator
+    // applied in MatVecMult_KMInv().
+    const double gamma = solver->d_scale_spread;
+    const double beta = solver->d_scale_interp;
+    const double delta = solver->d_reg_mob_factor;
+    const StokesSpecifications& stokes_spec = *solver->d_ins_integrator->getStokesSpecifications();
+    const unsigned num_structs = solver->d_cib_strategy->getNumberOfRigidStructures();
+    std::vector<unsigned> struct_ids(num_structs);
+    for (unsigned k = 0; k < num_structs; ++k) struct_ids[k] = k;
+    VecSet(y, 0.0);
+    solver->d_cib_strategy->applyMobilityOperator(x,
+                                                  y,
+                                                  solver->d_pc_mobility_type,
+                                                  struct_ids,
+                                                  dx,
+                                                  domain_extents,
+                                                  stokes_spec.getRho(),
+                                                  stokes_spec.getMu(),
+                                                  std::make_pair(beta * gamma, beta * delta),
+                                                  solver->d_f_periodic_corr);
+
+    PetscFunctionReturn(0);
+} // MatVecMult_PC
+
 // Routine to log output of KrylovMobilitySolver
 PetscErrorCode
 KrylovMobilitySolver::monitorKSP(KSP ksp, int it, PetscReal rnorm, void* /*mctx*/)
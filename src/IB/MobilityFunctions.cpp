@@ -697,6 +697,127 @@ MobilityFunctions::constructRPYMobilityMatrix(const char* IBKernelName,
     return;
 } // constructRPYMobilityMatrix
 
+void
+MobilityFunctions::applyEmpiricalMobilityOperator(const char* IBKernelName,
+                                                  const double MU,
+                                                  const double rho,
+                                                  const double Dt,
+                                                  const double DX,
+                                                  const double* X,
+                                                  const int N,
+                                                  const int resetAllConstants,
+                                                  const double /*PERIODIC_CORRECTION*/,
+                                                  const double L_domain,
+                                                  const double* F,
+                                                  const int* const rows,
+                                                  const int num_rows,
+                                                  double* U)
+{
+    // Initialize the fitting constants once, before the (possibly threaded)
+    // summation reads them.
+    double F_0, G_0;
+    getEmpiricalMobilityComponents(IBKernelName, MU, rho, Dt, 0.0, DX, resetAllConstants, L_domain, &F_0, &G_0);
+
+    int k;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (k = 0; k < num_rows; k++)
+    {
+        const int row = rows[k];
+        double u[NDIM];
+        int idir, jdir;
+        for (idir = 0; idir < NDIM; idir++) u[idir] = F_0 * F[row * NDIM + idir];
+
+        for (int col = 0; col < N; col++)
+        {
+            if (row == col) continue;
+
+            double r_vec[NDIM];
+            for (idir = 0; idir < NDIM; idir++)
+            {
+                r_vec[idir] = X[row * NDIM + idir] - X[col * NDIM + idir]; // r(i) - r(j)
+            }
+            const double rsq = get_sqnorm(r_vec);
+            const double r = sqrt(rsq);
+            double F_R, G_R;
+            getEmpiricalMobilityComponents(IBKernelName, MU, rho, Dt, r, DX, 0, L_domain, &F_R, &G_R);
+
+            double r_dot_f = 0.0;
+            for (jdir = 0; jdir < NDIM; jdir++) r_dot_f += r_vec[jdir] * F[col * NDIM + jdir];
+            for (idir = 0; idir < NDIM; idir++)
+            {
+                u[idir] += F_R * F[col * NDIM + idir] + G_R * r_vec[idir] * r_dot_f / rsq;
+            }
+        }
+        for (idir = 0; idir < NDIM; idir++) U[k * NDIM + idir] = u[idir];
+    }
+    return;
+} // applyEmpiricalMobilityOperator
+
+void
+MobilityFunctions::applyRPYMobilityOperator(const char* IBKernelName,
+                                            const double MU,
+                                            const double DX,
+                                            const double* X,
+                                            const int N,
+                                            const double PERIODIC_CORRECTION,
+                                            const double* F,
+                                            const int* const rows,
+                                            const int num_rows,
+                                            double* U)
+{
+    const double a = getHydroRadius(IBKernelName) * DX;
+    const double mu_tt = 1. / (6.0 * M_PI * MU * a);
+
+    int k;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (k = 0; k < num_rows; k++)
+    {
+        const int row = rows[k];
+        double u[NDIM];
+        int idir, jdir;
+        for (idir = 0; idir < NDIM; idir++) u[idir] = (mu_tt - PERIODIC_CORRECTION) * F[row * NDIM + idir];
+
+        for (int col = 0; col < N; col++)
+        {
+            if (row == col) continue;
+
+            double r_vec[NDIM];
+            for (idir = 0; idir < NDIM; idir++)
+            {
+                r_vec[idir] = X[row * NDIM + idir] - X[col * NDIM + idir]; // r(i) - r(j)
+            }
+            const double rsq = get_sqnorm(r_vec);
+            const double r = sqrt(rsq);
+
+            double c_delta, c_rr;
+            if (r <= 2.0 * a)
+            {
+                c_delta = mu_tt * (1 - 9.0 / 32.0 * r / a) - PERIODIC_CORRECTION;
+                c_rr = mu_tt * 3.0 * r / 32. / a;
+            }
+            else
+            {
+                const double cube = a * a * a / r / r / r;
+                c_delta = mu_tt * (3.0 / 4.0 * a / r + 1.0 / 2.0 * cube) - PERIODIC_CORRECTION;
+                c_rr = mu_tt * (3.0 / 4.0 * a / r - 3.0 / 2.0 * cube);
+            }
+
+            double r_dot_f = 0.0;
+            for (jdir = 0; jdir < NDIM; jdir++) r_dot_f += r_vec[jdir] * F[col * NDIM + jdir];
+            for (idir = 0; idir < NDIM; idir++)
+            {
+                u[idir] += c_delta * F[col * NDIM + idir] + c_rr * r_vec[idir] * r_dot_f / rsq;
+            }
+        }
+        for (idir = 0; idir < NDIM; idir++) U[k * NDIM + idir] = u[idir];
+    }
+    return;
+} // applyRPYMobilityOperator
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // IBAMR
@@ -32,9 +32,22 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "CartesianPatchGeometry.h"
+#include "Patch.h"
+#include "PatchLevel.h"
 #include "ibamr/NonbondedForceEvaluator.h"
 #include "ibamr/namespaces.h"
 #include "ibtk/LNodeSetData.h"
+#include "tbox/Utilities.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
@@ -42,10 +55,45 @@ namespace IBAMR
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// The number of cells in the neighborhood of a cell (including the cell
+// itself) that are searched for neighboring nodes.
+#if (NDIM == 2)
+static const int NUM_NEIGHBOR_CELLS = 9;
+#endif
+#if (NDIM == 3)
+static const int NUM_NEIGHBOR_CELLS = 27;
+#endif
+
+// Evaluate the force that the node at X_i experiences due to the node at
+// X_j - shift.
+inline void
+evaluate_pair_force(const NonbondedForceEvaluator::NonBddForceFcnPtr force_fcn_ptr,
+                    const double* const X_i,
+                    const double* const X_j,
+                    const double* const shift,
+                    const Array<double>& parameters,
+                    double* const F_pair)
+{
+    double D[NDIM];
+    for (int d = 0; d < NDIM; ++d)
+    {
+        D[d] = X_i[d] - X_j[d] - (shift ? shift[d] : 0.0);
+    }
+    (force_fcn_ptr)(D, parameters, F_pair);
+    return;
+} // evaluate_pair_force
+}
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 NonbondedForceEvaluator::NonbondedForceEvaluator(Pointer<Database> input_db,
                                                  Pointer<CartesianGridGeometry<NDIM> > grid_geometry)
+    : d_neighbor_list_mesh(NULL),
+      d_neighbor_list_level_number(-1),
+      d_neighbor_list_max_displacement(0.0),
+      d_force_fcn_ptr(NULL)
 {
     // get interaction radius
     if (input_db->keyExists("interaction_radius"))
@@ -56,6 +104,10 @@ NonbondedForceEvaluator::NonbondedForceEvaluator(Pointer<Database> input_db,
     {
         TBOX_ERROR("Must specify interaction_radius for NonbondedForceEvaluator.");
     }
+    if (d_interaction_radius <= 0.0)
+    {
+        TBOX_ERROR("interaction_radius for NonbondedForceEvaluator must be positive.");
+    }
 
     // get regrid_alpha
     if (input_db->keyExists("regrid_alpha"))
@@ -66,71 +118,54 @@ NonbondedForceEvaluator::NonbondedForceEvaluator(Pointer<Database> input_db,
     {
         TBOX_ERROR("Must specify regrid_alpha for NonbondedForceEvaluator.");
     }
+    if (d_regrid_alpha < 0.0)
+    {
+        TBOX_ERROR("regrid_alpha for NonbondedForceEvaluator must be nonnegative.");
+    }
 
-    // get grid geometry and grid bounds
+    // get grid geometry
     d_grid_geometry = grid_geometry;
 
-    // this will only work if the domain is a single box.
-    assert(d_grid_geometry->getDomainIsSingleBox());
-
     // get parameters for force function
     d_parameters = input_db->getDoubleArray("parameters");
 }
 
 void
-NonbondedForceEvaluator::evaluateForces(int mstr_petsc_idx,
-                                        int search_petsc_idx,
+NonbondedForceEvaluator::evaluateForces(const int mstr_petsc_idx,
+                                        const int search_petsc_idx,
                                         Pointer<LData> X_data,
                                         std::vector<int> cell_offset,
                                         Pointer<LData> F_data)
 {
-    //   Function to add nonbonded forces from the interaction between the nodes at
-    //   mstr_petsc_idx and search_petsc_idx.
-    //
-    //   inputs: mstr_petsc_idx:    integer petsc index of the master node
-    //           search_petsc_idx:  integer petsc index of the search node
-    //           X_data:            pointer to LData of location values for the particles
-    //           cell_offset:       vector of periodic offsets of the search particle,
-    //                    integer value in units of the entire domain.  E.G. a particle
-    //                    image at position (120, -20, 10)  in a length 100^3 domain
-    //                    would have cell_offset = (1, -1, 0).
-    //
-    //   outputs:
-    //          F_data - pointer to LData object containing forces on particles.  Will
-    //                   be added to by this function.
-    //
-    //////////////////////////////////////////////////////////////////////////////////
-
-    // get vectors of data
-    // How costly is this?  TODO: Check, maybe just do this once in the loop.
-    PetscScalar* position;
-    VecGetArray(X_data->getVec(), &position);
-    PetscScalar* force;
-    VecGetArray(F_data->getVec(), &force);
-
-    // get domain bounds
-    const double* x_lower = d_grid_geometry->getXLower();
-    const double* x_upper = d_grid_geometry->getXUpper();
-
-    double R = 0.0; // distance between particles
-    double D[NDIM]; // vector connecting particles.
-
-    for (int k = 0; k < NDIM; ++k)
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_force_fcn_ptr);
+    TBOX_ASSERT(cell_offset.size() >= NDIM);
+#endif
+    // The periodic offset of the search node is specified in units of the
+    // extents of the physical domain.
+    const double* const x_lower = d_grid_geometry->getXLower();
+    const double* const x_upper = d_grid_geometry->getXUpper();
+    double shift[NDIM];
+    for (int d = 0; d < NDIM; ++d)
     {
-        D[k] = (position[mstr_petsc_idx * NDIM + k] - position[search_petsc_idx * NDIM + k] -
-                cell_offset[k] * (x_upper[k] - x_lower[k]));
-        R += pow(D[k], 2);
+        shift[d] = static_cast<double>(cell_offset[d]) * (x_upper[d] - x_lower[d]);
     }
-    R = sqrt(R);
 
-    double nonbdd_force[NDIM];
-    (d_force_fcn_ptr)(D, d_parameters, nonbdd_force);
-    for (int k = 0; k < NDIM; ++k)
+    // Evaluate the pair force as in the neighbor list loop in
+    // computeLagrangianForce().  Only locally owned nodes are updated.
+    const int num_local_nodes = static_cast<int>(F_data->getLocalNodeCount());
+    const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
+    double* const F_node = F_data->getLocalFormVecArray()->data();
+    double F_pair[NDIM];
+    evaluate_pair_force(
+        d_force_fcn_ptr, &X_node[NDIM * mstr_petsc_idx], &X_node[NDIM * search_petsc_idx], shift, d_parameters, F_pair);
+    for (int d = 0; d < NDIM; ++d)
     {
-        force[mstr_petsc_idx * NDIM + k] += nonbdd_force[k];
-        force[search_petsc_idx * NDIM + k] += -1.0 * nonbdd_force[k];
+        if (mstr_petsc_idx < num_local_nodes) F_node[NDIM * mstr_petsc_idx + d] += F_pair[d];
+        if (search_petsc_idx < num_local_nodes) F_node[NDIM * search_petsc_idx + d] -= F_pair[d];
     }
-    VecRestoreArray(F_data->getVec(), &force);
+    F_data->restoreArrays();
+    X_data->restoreArrays();
     return;
 } // evaluateForces
 
@@ -143,100 +178,337 @@ NonbondedForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
                                                 const double /*data_time*/,
                                                 LDataManager* const l_data_manager)
 {
-    // Get grid geometry and relevant lower and upper limits.
-    Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
-    if (!grid_geom->getDomainIsSingleBox()) TBOX_ERROR("physical domain must be a single box...\n");
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_force_fcn_ptr);
+#endif
+    // Make sure that the positions of the nodes in the ghost cell region are
+    // current.
+    X_data->beginGhostUpdate();
+    X_data->endGhostUpdate();
+    const int num_local_nodes = static_cast<int>(X_data->getLocalNodeCount());
+    const int num_nodes = num_local_nodes + static_cast<int>(X_data->getGhostNodeCount());
+    const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
+
+    // Rebuild the neighbor list only when necessary.
+    if (neighborListNeedsRebuild(X_node, num_nodes, level_number, l_data_manager))
+    {
+        buildNeighborList(X_node, num_nodes, hierarchy, level_number, l_data_manager);
+    }
 
-    // These will only work if the domain is a single box.
-    assert(grid_geom->getDomainIsSingleBox());
-    const double* const x_lower = grid_geom->getXLower();
-    const double* const x_upper = grid_geom->getXUpper();
+    // Evaluate the forces for all pairs in the neighbor list.  As with the
+    // original cell-based search, the force function is evaluated for every
+    // candidate pair, and it is responsible for any cutoff.  When multiple
+    // threads are used, each thread accumulates forces in its own
+    // buffer, and the buffers are summed once all pairs have been evaluated.
+    double* const F_node = F_data->getLocalFormVecArray()->data();
+    const int num_full_pairs = static_cast<int>(d_full_pairs.size()) / 2;
+    const int num_half_pairs = static_cast<int>(d_half_pairs.size()) / 2;
+    const int* const full_pairs = num_full_pairs > 0 ? &d_full_pairs[0] : NULL;
+    const int* const half_pairs = num_half_pairs > 0 ? &d_half_pairs[0] : NULL;
+    const double* const half_pair_shifts = num_half_pairs > 0 ? &d_half_pair_shifts[0] : NULL;
+    const int F_size = NDIM * num_local_nodes;
+    std::vector<double> F_thread_data;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        int num_threads = 1, thread_num = 0;
+#ifdef _OPENMP
+        num_threads = omp_get_num_threads();
+        thread_num = omp_get_thread_num();
+#pragma omp single
+#endif
+        F_thread_data.assign((num_threads - 1) * F_size, 0.0);
+        double* const F = thread_num == 0 ? F_node : &F_thread_data[(thread_num - 1) * F_size];
 
-    // we will grow the search box by interaction_radius + 2.0*regrid_alpha
-    IntVector<NDIM> grow_amount(int(ceil(d_interaction_radius + 2.0 * d_regrid_alpha)));
-    const int lag_node_idx_current_idx = l_data_manager->getLNodePatchDescriptorIndex();
+        // SAMRAI arrays are reference counted, so each thread uses its own copy
+        // of the force function parameters.
+        Array<double> parameters(d_parameters.getSize());
+        for (int k = 0; k < d_parameters.getSize(); ++k)
+        {
+            parameters[k] = d_parameters[k];
+        }
+
+        double F_pair[NDIM];
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int k = 0; k < num_full_pairs; ++k)
+        {
+            const int i = full_pairs[2 * k];
+            const int j = full_pairs[2 * k + 1];
+            evaluate_pair_force(d_force_fcn_ptr, &X_node[NDIM * i], &X_node[NDIM * j], NULL, parameters, F_pair);
+            for (int d = 0; d < NDIM; ++d)
+            {
+                F[NDIM * i + d] += F_pair[d];
+                F[NDIM * j + d] -= F_pair[d];
+            }
+        }
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int k = 0; k < num_half_pairs; ++k)
+        {
+            const int i = half_pairs[2 * k];
+            const int j = half_pairs[2 * k + 1];
+            evaluate_pair_force(
+                d_force_fcn_ptr, &X_node[NDIM * i], &X_node[NDIM * j], &half_pair_shifts[NDIM * k], parameters, F_pair);
+            for (int d = 0; d < NDIM; ++d)
+            {
+                F[NDIM * i + d] += F_pair[d];
+            }
+        }
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int l = 0; l < F_size; ++l)
+        {
+            for (int t = 1; t < num_threads; ++t)
+            {
+                F_node[l] += F_thread_data[(t - 1) * F_size + l];
+            }
+        }
+    }
+    F_data->restoreArrays();
+    X_data->restoreArrays();
+    return;
+} // computeLagrangianForce
+
+void
+NonbondedForceEvaluator::registerForceFcnPtr(NonBddForceFcnPtr force_fcn_ptr)
+{
+    // set the nonbonded force function pointer to the given force function pointer
+    d_force_fcn_ptr = force_fcn_ptr;
+    return;
+} // registerForceFcnPtr
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+bool
+NonbondedForceEvaluator::neighborListNeedsRebuild(const double* const X_node,
+                                                  const int num_nodes,
+                                                  const int level_number,
+                                                  LDataManager* const l_data_manager) const
+{
+    // The list must be rebuilt whenever the Lagrangian data are redistributed,
+    // because the local indexing of the nodes changes.
+    if (level_number != d_neighbor_list_level_number) return true;
+    if (d_neighbor_list_mesh.getPointer() != l_data_manager->getLMesh(level_number).getPointer()) return true;
+    if (static_cast<int>(d_neighbor_list_X.size()) != NDIM * num_nodes) return true;
 
-    // iterate through levels.
+    // Otherwise, the list only needs to be rebuilt if some node has moved more
+    // than regrid_alpha grid cells.
+    const double max_displacement_sq = d_neighbor_list_max_displacement * d_neighbor_list_max_displacement;
+    for (int k = 0; k < num_nodes; ++k)
+    {
+        double displacement_sq = 0.0;
+        for (int d = 0; d < NDIM; ++d)
+        {
+            const double dX = X_node[NDIM * k + d] - d_neighbor_list_X[NDIM * k + d];
+            displacement_sq += dX * dX;
+        }
+        if (displacement_sq > max_displacement_sq) return true;
+    }
+    return false;
+} // neighborListNeedsRebuild
+
+void
+NonbondedForceEvaluator::buildNeighborList(const double* const X_node,
+                                           const int num_nodes,
+                                           const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                           const int level_number,
+                                           LDataManager* const l_data_manager)
+{
+    d_full_pairs.clear();
+    d_half_pairs.clear();
+    d_half_pair_shifts.clear();
+
+    // The interaction radius and regrid_alpha are specified in units of the
+    // grid spacing of the level.  As in the original cell-based search, the
+    // list includes all pairs within interaction_radius + 2 * regrid_alpha
+    // grid cells, and it remains valid until some node moves more than
+    // regrid_alpha grid cells.
     Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+    const double* const dx_coarsest = d_grid_geometry->getDx();
+    const IntVector<NDIM>& ratio = level->getRatio();
+    double h = 0.0;
+    for (int d = 0; d < NDIM; ++d)
+    {
+        h = std::max(h, dx_coarsest[d] / static_cast<double>(ratio(d)));
+    }
+    const double R_list = (d_interaction_radius + 2.0 * d_regrid_alpha) * h;
+    const double R_list_sq = R_list * R_list;
+    const IntVector<NDIM>& ghost_width = l_data_manager->getGhostCellWidth();
+    const int lag_node_idx_current_idx = l_data_manager->getLNodePatchDescriptorIndex();
+
+    std::vector<int> petsc_idxs, lag_idxs, node_cells, cell_offsets, cell_nodes;
+    std::vector<double> posns, shifts;
     for (PatchLevel<NDIM>::Iterator p(level); p; p++)
     {
         Pointer<Patch<NDIM> > patch = level->getPatch(p());
-        Pointer<LNodeSetData> current_idx_data = patch->getPatchData(lag_node_idx_current_idx);
-        const Box<NDIM>& patch_box = patch->getBox();
+        const Pointer<LNodeSetData> idx_data = patch->getPatchData(lag_node_idx_current_idx);
+        const std::vector<int>& interior_petsc_idxs = idx_data->getInteriorLocalPETScIndices();
+        const std::vector<int>& ghost_petsc_idxs = idx_data->getGhostLocalPETScIndices();
+        const int num_interior_nodes = static_cast<int>(interior_petsc_idxs.size());
+        const int num_patch_nodes = num_interior_nodes + static_cast<int>(ghost_petsc_idxs.size());
+        if (num_interior_nodes == 0) continue;
+
+        // Pairs that extend beyond the ghost cell region cannot be found.
         const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
         const double* const patch_dx = patch_geom->getDx();
+        static bool warned = false;
+        for (int d = 0; d < NDIM && !warned; ++d)
+        {
+            if (R_list > static_cast<double>(ghost_width(d)) * patch_dx[d])
+            {
+                TBOX_WARNING("NonbondedForceEvaluator::buildNeighborList():\n"
+                             << "  interaction_radius + 2 * regrid_alpha exceeds the width of the ghost cell region.\n"
+                             << "  some interacting pairs may be missed.\n");
+                warned = true;
+            }
+        }
+
+        // Collect the nodes (and periodic images of nodes) in the patch.  The
+        // nodes in the patch interior are stored first.
+        petsc_idxs = interior_petsc_idxs;
+        petsc_idxs.insert(petsc_idxs.end(), ghost_petsc_idxs.begin(), ghost_petsc_idxs.end());
+        lag_idxs = idx_data->getInteriorLagrangianIndices();
+        lag_idxs.insert(
+            lag_idxs.end(), idx_data->getGhostLagrangianIndices().begin(), idx_data->getGhostLagrangianIndices().end());
+        shifts = idx_data->getInteriorPeriodicShifts();
+        shifts.insert(
+            shifts.end(), idx_data->getGhostPeriodicShifts().begin(), idx_data->getGhostPeriodicShifts().end());
+        posns.resize(NDIM * num_patch_nodes);
+        double x_lower[NDIM], x_upper[NDIM];
+        for (int d = 0; d < NDIM; ++d)
+        {
+            x_lower[d] = +std::numeric_limits<double>::max();
+            x_upper[d] = -std::numeric_limits<double>::max();
+        }
+        for (int a = 0; a < num_patch_nodes; ++a)
+        {
+            for (int d = 0; d < NDIM; ++d)
+            {
+                const double X = X_node[NDIM * petsc_idxs[a] + d] + shifts[NDIM * a + d];
+                posns[NDIM * a + d] = X;
+                x_lower[d] = std::min(x_lower[d], X);
+                x_upper[d] = std::max(x_upper[d], X);
+            }
+        }
 
-        std::vector<int> cell_offset(NDIM);
-        // Loop through cells in this processors patch. For each iteration, this
-        // is the "master" cell. Iterate through particles in the box, and add
-        // springs.
-        for (LNodeSetData::CellIterator cit(patch_box); cit; cit++)
+        // Bin the nodes into cells that are at least as wide as the neighbor
+        // list radius.  The cells are coarsened if necessary so that there are
+        // not many more cells than nodes.
+        int num_cells[NDIM];
+        double cell_width[NDIM];
+        int total_num_cells = 1;
+        for (double min_cell_width = R_list;; min_cell_width *= 2.0)
+        {
+            double total_num_cells_estimate = 1.0;
+            for (int d = 0; d < NDIM; ++d)
+            {
+                total_num_cells_estimate *= std::max(1.0, std::floor((x_upper[d] - x_lower[d]) / min_cell_width));
+            }
+            if (total_num_cells_estimate > 8.0 * num_patch_nodes) continue;
+            total_num_cells = 1;
+            for (int d = 0; d < NDIM; ++d)
+            {
+                num_cells[d] = std::max(1, static_cast<int>(std::floor((x_upper[d] - x_lower[d]) / min_cell_width)));
+                cell_width[d] = std::max((x_upper[d] - x_lower[d]) / static_cast<double>(num_cells[d]), min_cell_width);
+                total_num_cells *= num_cells[d];
+            }
+            break;
+        }
+        node_cells.resize(NDIM * num_patch_nodes);
+        cell_offsets.assign(total_num_cells + 1, 0);
+        for (int a = 0; a < num_patch_nodes; ++a)
         {
-            // get list of particles in this cell
-            const Index<NDIM>& first_cell_idx = *cit;
-            LNodeSet* const mstr_node_set = current_idx_data->getItem(first_cell_idx);
-            if (mstr_node_set)
+            int cell = 0;
+            for (int d = NDIM - 1; d >= 0; --d)
             {
-                Box<NDIM> search_box(first_cell_idx, first_cell_idx);
-                // loop over neighboring cells, up to interaction_radius +
-                // 2*regrid_alpha away.
-                for (LNodeSetData::CellIterator scit(Box<NDIM>::grow(search_box, grow_amount)); scit; scit++)
+                const double X_rel = (posns[NDIM * a + d] - x_lower[d]) / cell_width[d];
+                const int i = std::min(num_cells[d] - 1, static_cast<int>(std::floor(X_rel)));
+                node_cells[NDIM * a + d] = i;
+                cell = cell * num_cells[d] + i;
+            }
+            ++cell_offsets[cell + 1];
+        }
+        for (int cell = 0; cell < total_num_cells; ++cell)
+        {
+            cell_offsets[cell + 1] += cell_offsets[cell];
+        }
+        cell_nodes.resize(num_patch_nodes);
+        std::vector<int> cell_fill(cell_offsets.begin(), cell_offsets.end() - 1);
+        for (int a = 0; a < num_patch_nodes; ++a)
+        {
+            int cell = 0;
+            for (int d = NDIM - 1; d >= 0; --d)
+            {
+                cell = cell * num_cells[d] + node_cells[NDIM * a + d];
+            }
+            cell_nodes[cell_fill[cell]++] = a;
+        }
+
+        // Find the neighbors of each node in the patch interior.  Pairs of
+        // interior nodes are recorded once, and pairs that involve a node in
+        // the ghost cell region are recorded for the interior node only.
+        for (int a = 0; a < num_interior_nodes; ++a)
+        {
+            for (int nbr = 0; nbr < NUM_NEIGHBOR_CELLS; ++nbr)
+            {
+                int offset[NDIM];
+                for (int d = 0, t = nbr; d < NDIM; ++d, t /= 3)
+                {
+                    offset[d] = t % 3 - 1;
+                }
+                int cell = 0;
+                bool valid_cell = true;
+                for (int d = NDIM - 1; d >= 0 && valid_cell; --d)
+                {
+                    const int i = node_cells[NDIM * a + d] + offset[d];
+                    valid_cell = i >= 0 && i < num_cells[d];
+                    cell = cell * num_cells[d] + i;
+                }
+                if (!valid_cell) continue;
+                for (int k = cell_offsets[cell]; k < cell_offsets[cell + 1]; ++k)
                 {
-                    // loop over particles in the neighbor cell, adding up
-                    // forces onto the particle in the "master" cell At this
-                    // point we know both cells, need to figure out periodic
-                    // additions.
-                    const Index<NDIM>& search_cell_idx = *scit;
-
-                    // search across periodic boundaries.
-                    for (int k = 0; k < NDIM; ++k)
+                    const int b = cell_nodes[k];
+                    if (lag_idxs[a] == lag_idxs[b]) continue;
+                    const bool b_is_interior = b < num_interior_nodes;
+                    if (b_is_interior && lag_idxs[a] > lag_idxs[b]) continue;
+                    double R_sq = 0.0;
+                    for (int d = 0; d < NDIM; ++d)
+                    {
+                        const double D = posns[NDIM * a + d] - posns[NDIM * b + d];
+                        R_sq += D * D;
+                    }
+                    if (R_sq > R_list_sq) continue;
+                    if (b_is_interior)
                     {
-                        // Difference between lower boundary and this search cell.
-                        double absolute_diff = search_cell_idx[k] * patch_dx[k];
-                        // Periodic offset of this cell.
-                        cell_offset[k] = floor(absolute_diff / (x_upper[k] - x_lower[k]));
+                        d_full_pairs.push_back(petsc_idxs[a]);
+                        d_full_pairs.push_back(petsc_idxs[b]);
                     }
-                    LNodeSet* search_node_set = current_idx_data->getItem(search_cell_idx);
-                    if (search_node_set)
+                    else
                     {
-                        // we have a set of nodes in the first cell and the search cell,
-                        // add up forces
-                        // and accumulate for the first cell.
-                        for (LNodeSet::iterator it = mstr_node_set->begin(); it != mstr_node_set->end(); ++it)
+                        d_half_pairs.push_back(petsc_idxs[a]);
+                        d_half_pairs.push_back(petsc_idxs[b]);
+                        for (int d = 0; d < NDIM; ++d)
                         {
-                            // master nodes
-                            LNodeSet::value_type& mstr_node_idx = *it;
-                            const int mstr_lag_idx = mstr_node_idx->getLagrangianIndex();
-                            const int mstr_petsc_idx = mstr_node_idx->getLocalPETScIndex();
-
-                            for (LNodeSet::iterator sit = search_node_set->begin(); sit != search_node_set->end();
-                                 ++sit)
-                            {
-                                LNodeSet::value_type& search_node_idx = *sit;
-                                const int search_lag_idx = search_node_idx->getLagrangianIndex();
-                                const int search_petsc_idx = search_node_idx->getLocalPETScIndex();
-                                if (mstr_lag_idx < search_lag_idx)
-                                {
-                                    // apply forces with the force evaluator
-                                    evaluateForces(mstr_petsc_idx, search_petsc_idx, X_data, cell_offset, F_data);
-                                }
-                            } // search node index
-                        }     // mstr node index
-                    }         // if(search node set)
-                }             // search cell loop
-            }                 // if mastr_node_idx
-        }                     // first cell
-    }                         // patches
-    return;
-} // computeLagrangianForce
+                            d_half_pair_shifts.push_back(shifts[NDIM * b + d] - shifts[NDIM * a + d]);
+                        }
+                    }
+                }
+            }
+        }
+    }
 
-void
-NonbondedForceEvaluator::registerForceFcnPtr(NonBddForceFcnPtr force_fcn_ptr)
-{
-    // set the nonbonded force function pointer to the given force function pointer
-    d_force_fcn_ptr = force_fcn_ptr;
+    // Keep track of the configuration for which the list was built.
+    d_neighbor_list_mesh = l_data_manager->getLMesh(level_number);
+    d_neighbor_list_level_number = level_number;
+    d_neighbor_list_max_displacement = d_regrid_alpha * h;
+    d_neighbor_list_X.assign(X_node, X_node + NDIM * num_nodes);
     return;
-} // registerForceFcnPtr
+} // buildNeighborList
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -134,6 +134,10 @@ StaggeredStokesIBLevelRelaxationFACOperator::StaggeredStokesIBLevelRelaxationFAC
     // Set the time stepping type to UNKNOWN to ensure that the IB solver sets it correctly.
     d_time_stepping_type = UNKNOWN_TIME_STEPPING_TYPE;
 
+    // The IB operators are provided later by the IB solver.
+    d_A_mat = NULL;
+    d_J_mat = NULL;
+
     // Indicate that this subclass handles initializaing the coarse-grid solver.
     d_coarse_solver_init_subclass = true;
 
@@ -194,6 +198,17 @@ StaggeredStokesIBLevelRelaxationFACOperator::~StaggeredStokesIBLevelRelaxationFA
     {
         deallocateOperatorState();
     }
+    int ierr;
+    if (d_A_mat)
+    {
+        ierr = MatDestroy(&d_A_mat);
+        IBTK_CHKERRQ(ierr);
+    }
+    if (d_J_mat)
+    {
+        ierr = MatDestroy(&d_J_mat);
+        IBTK_CHKERRQ(ierr);
+    }
     return;
 } // ~StaggeredStokesIBLevelRelaxationFACOperator
 
@@ -216,6 +231,15 @@ StaggeredStokesIBLevelRelaxationFACOperator::setIBForceJacobian(Mat& A)
 #if !defined(NDEBUG)
     TBOX_ASSERT(A);
 #endif
+    // Hold a reference to the new operator and release the one that was
+    // previously set, so that it is freed once the caller releases it too.
+    int ierr = PetscObjectReference(reinterpret_cast<PetscObject>(A));
+    IBTK_CHKERRQ(ierr);
+    if (d_A_mat)
+    {
+        ierr = MatDestroy(&d_A_mat);
+        IBTK_CHKERRQ(ierr);
+    }
     d_A_mat = A;
     return;
 } // setIBForceJacobian
@@ -232,6 +256,15 @@ StaggeredStokesIBLevelRelaxationFACOperator::setIBInterpOp(Mat& J)
 #if !defined(NDEBUG)
     TBOX_ASSERT(J);
 #endif
+    // Hold a reference to the new operator and release the one that was
+    // previously set, so that it is freed once the caller releases it too.
+    int ierr = PetscObjectReference(reinterpret_cast<PetscObject>(J));
+    IBTK_CHKERRQ(ierr);
+    if (d_J_mat)
+    {
+        ierr = MatDestroy(&d_J_mat);
+        IBTK_CHKERRQ(ierr);
+    }
     d_J_mat = J;
     return;
 } // setIBInterpOp
@@ -38,6 +38,7 @@
 #include <map>
 #include <ostream>
 #include <set>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -45,7 +46,10 @@
 #include "BasePatchHierarchy.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
+#include "CellData.h"
 #include "CellDataFactory.h"
+#include "CellIndex.h"
+#include "CellIterator.h"
 #include "CellVariable.h"
 #include "FaceData.h"
 #include "FaceVariable.h"
@@ -61,6 +65,7 @@
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
 #include "PoissonSpecifications.h"
+#include "SAMRAIVectorReal.h"
 #include "SideVariable.h"
 #include "Variable.h"
 #include "VariableContext.h"
@@ -72,6 +77,8 @@
 #include "ibamr/ibamr_enums.h"
 #include "ibamr/ibamr_utilities.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
+#include "ibtk/CCLaplaceOperator.h"
+#include "ibtk/CCPoissonSolverManager.h"
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/LaplaceOperator.h"
 #include "ibtk/PoissonSolver.h"
@@ -111,6 +118,77 @@ namespace IBAMR
 // Number of ghosts cells used for each variable quantity.
 static const int CELLG = 1;
 
+namespace
+{
+inline int
+get_cc_depth(Pointer<CellVariable<NDIM, double> > var)
+{
+    Pointer<CellDataFactory<NDIM, double> > factory = var->getPatchDataFactory();
+    return factory->getDefaultDepth();
+} // get_cc_depth
+
+// Copy depth components [src_depth, src_depth + depth) of the cell-centered
+// data src_idx into components [dst_depth, dst_depth + depth) of dst_idx.
+void
+copy_cc_data_depths(const int dst_idx,
+                    const int dst_depth,
+                    const int src_idx,
+                    const int src_depth,
+                    const int depth,
+                    Pointer<PatchHierarchy<NDIM> > hierarchy)
+{
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
+            Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
+            for (int d = 0; d < depth; ++d)
+            {
+                dst_data->copyDepth(dst_depth + d, *src_data, src_depth + d);
+            }
+        }
+    }
+    return;
+} // copy_cc_data_depths
+
+// Add alpha times depth components [src_depth, src_depth + depth) of the
+// cell-centered data src_idx to components [dst_depth, dst_depth + depth) of
+// dst_idx on the patch interiors.
+void
+axpy_cc_data_depths(const int dst_idx,
+                    const int dst_depth,
+                    const double alpha,
+                    const int src_idx,
+                    const int src_depth,
+                    const int depth,
+                    Pointer<PatchHierarchy<NDIM> > hierarchy)
+{
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
+            Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
+            for (int d = 0; d < depth; ++d)
+            {
+                for (CellIterator<NDIM> ic(patch_box); ic; ic++)
+                {
+                    const CellIndex<NDIM>& i = ic();
+                    (*dst_data)(i, dst_depth + d) += alpha * (*src_data)(i, src_depth + d);
+                }
+            }
+        }
+    }
+    return;
+} // axpy_cc_data_depths
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 AdvDiffSemiImplicitHierarchyIntegrator::AdvDiffSemiImplicitHierarchyIntegrator(const std::string& object_name,
@@ -127,6 +205,7 @@ AdvDiffSemiImplicitHierarchyIntegrator::AdvDiffSemiImplicitHierarchyIntegrator(c
     d_default_init_convective_time_stepping_type = MIDPOINT_RULE;
     d_default_convective_op_type = AdvDiffConvectiveOperatorManager::DEFAULT;
     d_default_convective_op_input_db = new MemoryDatabase(d_object_name + "::default_convective_op_input_db");
+    d_group_compatible_quantities = false;
 
     // Initialize object with data read from the input and restart databases.
     bool from_restart = RestartManager::getManager()->isFromRestart();
@@ -413,11 +492,15 @@ AdvDiffSemiImplicitHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<Pa
     // Register variables using the default variable registration routine.
     AdvDiffHierarchyIntegrator::registerVariables();
 
+    // Determine which transported quantities are advanced together.
+    setupTransportedQuantityGroups();
+
     // Setup the convective operators.
     for (std::vector<Pointer<CellVariable<NDIM, double> > >::const_iterator cit = d_Q_var.begin(); cit != d_Q_var.end();
          ++cit)
     {
         Pointer<CellVariable<NDIM, double> > Q_var = *cit;
+        if (d_Q_group_map.count(Q_var)) continue;
         getConvectiveOperator(Q_var);
     }
 
@@ -454,6 +537,27 @@ AdvDiffSemiImplicitHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<Pa
     // of AdvDiffHierarchyIntegrator.
     AdvDiffHierarchyIntegrator::initializeHierarchyIntegrator(hierarchy, gridding_alg);
 
+    // Setup the solvers and operators used with groups of transported
+    // quantities.
+    for (unsigned int g = 0; g < d_Q_groups.size(); ++g)
+    {
+        const std::string& name = d_group_var[g]->getName();
+        std::ostringstream solver_prefix, precond_prefix;
+        solver_prefix << "adv_diff_group_" << g << "_";
+        precond_prefix << "adv_diff_group_pc_" << g << "_";
+        d_group_helmholtz_solvers[g] =
+            CCPoissonSolverManager::getManager()->allocateSolver(d_helmholtz_solver_type,
+                                                                 d_object_name + "::helmholtz_solver::" + name,
+                                                                 d_helmholtz_solver_db,
+                                                                 solver_prefix.str(),
+                                                                 d_helmholtz_precond_type,
+                                                                 d_object_name + "::helmholtz_precond::" + name,
+                                                                 d_helmholtz_precond_db,
+                                                                 precond_prefix.str());
+        d_group_helmholtz_rhs_ops[g] =
+            new CCLaplaceOperator(d_object_name + "::helmholtz_rhs_op::" + name, /*homogeneous_bc*/ false);
+    }
+
     // Indicate that the integrator has been initialized.
     d_integrator_is_initialized = true;
     return;
@@ -501,6 +605,8 @@ AdvDiffSemiImplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const doubl
     {
         std::fill(d_helmholtz_solvers_need_init.begin(), d_helmholtz_solvers_need_init.end(), true);
         std::fill(d_helmholtz_rhs_ops_need_init.begin(), d_helmholtz_rhs_ops_need_init.end(), true);
+        std::fill(d_group_helmholtz_solvers_need_init.begin(), d_group_helmholtz_solvers_need_init.end(), true);
+        std::fill(d_group_helmholtz_rhs_ops_need_init.begin(), d_group_helmholtz_rhs_ops_need_init.end(), true);
         d_coarsest_reset_ln = 0;
         d_finest_reset_ln = finest_ln;
     }
@@ -553,6 +659,7 @@ AdvDiffSemiImplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const doubl
          ++cit, ++l)
     {
         Pointer<CellVariable<NDIM, double> > Q_var = *cit;
+        if (d_Q_group_map.count(Q_var)) continue;
         Pointer<CellVariable<NDIM, double> > Q_rhs_var = d_Q_Q_rhs_map[Q_var];
         Pointer<SideVariable<NDIM, double> > D_var = d_Q_diffusion_coef_variable[Q_var];
         Pointer<SideVariable<NDIM, double> > D_rhs_var = d_diffusion_coef_rhs_map[D_var];
@@ -697,6 +804,10 @@ AdvDiffSemiImplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const doubl
         // Set the initial guess.
         d_hier_cc_data_ops->copyData(Q_new_idx, Q_current_idx);
     }
+    for (unsigned int g = 0; g < d_Q_groups.size(); ++g)
+    {
+        preprocessIntegrateGroup(g, current_time, new_time, num_cycles);
+    }
 
     // Execute any registered callbacks.
     executePreprocessIntegrateHierarchyCallbackFcns(current_time, new_time, num_cycles);
@@ -731,6 +842,7 @@ AdvDiffSemiImplicitHierarchyIntegrator::integrateHierarchy(const double current_
          ++cit, ++l)
     {
         Pointer<CellVariable<NDIM, double> > Q_var = *cit;
+        if (d_Q_group_map.count(Q_var)) continue;
         Pointer<CellVariable<NDIM, double> > F_var = d_Q_F_map[Q_var];
         Pointer<CellVariable<NDIM, double> > Q_rhs_var = d_Q_Q_rhs_map[Q_var];
 
@@ -884,6 +996,10 @@ AdvDiffSemiImplicitHierarchyIntegrator::integrateHierarchy(const double current_
             d_hier_cc_data_ops->copyData(F_new_idx, F_scratch_idx);
         }
     }
+    for (unsigned int g = 0; g < d_Q_groups.size(); ++g)
+    {
+        integrateGroup(g, current_time, new_time, cycle_num);
+    }
 
     // Execute any registered callbacks.
     executeIntegrateHierarchyCallbackFcns(current_time, new_time, cycle_num);
@@ -956,6 +1072,28 @@ AdvDiffSemiImplicitHierarchyIntegrator::resetHierarchyConfigurationSpecialized(
         d_Q_convective_op_needs_init[Q_var] = true;
     }
     AdvDiffHierarchyIntegrator::resetHierarchyConfigurationSpecialized(base_hierarchy, coarsest_level, finest_level);
+
+    // Reset the solution and rhs vectors used with groups of transported
+    // quantities.
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    const int wgt_idx = d_hier_math_ops->getCellWeightPatchDescriptorIndex();
+    for (unsigned int g = 0; g < d_Q_groups.size(); ++g)
+    {
+        const std::string& name = d_group_var[g]->getName();
+
+        const int G_scratch_idx = var_db->mapVariableAndContextToIndex(d_group_var[g], getScratchContext());
+        d_group_sol_vecs[g] =
+            new SAMRAIVectorReal<NDIM, double>(d_object_name + "::sol_vec::" + name, d_hierarchy, 0, finest_hier_level);
+        d_group_sol_vecs[g]->addComponent(d_group_var[g], G_scratch_idx, wgt_idx, d_hier_cc_data_ops);
+
+        const int G_rhs_scratch_idx = var_db->mapVariableAndContextToIndex(d_group_rhs_var[g], getScratchContext());
+        d_group_rhs_vecs[g] =
+            new SAMRAIVectorReal<NDIM, double>(d_object_name + "::rhs_vec::" + name, d_hierarchy, 0, finest_hier_level);
+        d_group_rhs_vecs[g]->addComponent(d_group_rhs_var[g], G_rhs_scratch_idx, wgt_idx, d_hier_cc_data_ops);
+    }
+    std::fill(d_group_helmholtz_solvers_need_init.begin(), d_group_helmholtz_solvers_need_init.end(), true);
+    std::fill(d_group_helmholtz_rhs_ops_need_init.begin(), d_group_helmholtz_rhs_ops_need_init.end(), true);
+    std::fill(d_group_convective_ops_need_init.begin(), d_group_convective_ops_need_init.end(), true);
     return;
 } // resetHierarchyConfigurationSpecialized
 
@@ -1021,6 +1159,8 @@ AdvDiffSemiImplicitHierarchyIntegrator::getFromInput(Pointer<Database> db, bool
         else if (db->keyExists("default_convective_op_db"))
             d_default_convective_op_input_db = db->getDatabase("default_convective_op_db");
     }
+    if (db->keyExists("group_compatible_quantities"))
+        d_group_compatible_quantities = db->getBool("group_compatible_quantities");
     return;
 } // getFromInput
 
@@ -1047,6 +1187,434 @@ AdvDiffSemiImplicitHierarchyIntegrator::getFromRestart()
     return;
 } // getFromRestart
 
+void
+AdvDiffSemiImplicitHierarchyIntegrator::setupTransportedQuantityGroups()
+{
+    d_Q_group_map.clear();
+    d_Q_groups.clear();
+    if (!d_group_compatible_quantities) return;
+
+    // Collect the transported quantities that share the same advection
+    // velocity, coefficients, and discretization settings.  Quantities with
+    // user-supplied operators or solvers, or with variable diffusion
+    // coefficients, are advanced individually.
+    std::vector<std::vector<Pointer<CellVariable<NDIM, double> > > > Q_groups;
+    unsigned int l = 0;
+    for (std::vector<Pointer<CellVariable<NDIM, double> > >::const_iterator cit = d_Q_var.begin(); cit != d_Q_var.end();
+         ++cit, ++l)
+    {
+        Pointer<CellVariable<NDIM, double> > Q_var = *cit;
+        if (d_Q_convective_op[Q_var]) continue;
+        if (l < d_helmholtz_solvers.size() && d_helmholtz_solvers[l]) continue;
+        if (l < d_helmholtz_rhs_ops.size() && d_helmholtz_rhs_ops[l]) continue;
+        if (isDiffusionCoefficientVariable(Q_var)) continue;
+        Pointer<FaceVariable<NDIM, double> > u_var = d_Q_u_map[Q_var];
+        bool found_group = false;
+        for (unsigned int g = 0; g < Q_groups.size() && !found_group; ++g)
+        {
+            Pointer<CellVariable<NDIM, double> > P_var = Q_groups[g].front();
+            bool compatible = u_var == d_Q_u_map[P_var] &&
+                              d_Q_diffusion_time_stepping_type[Q_var] == d_Q_diffusion_time_stepping_type[P_var] &&
+                              MathUtilities<double>::equalEps(d_Q_diffusion_coef[Q_var], d_Q_diffusion_coef[P_var]) &&
+                              MathUtilities<double>::equalEps(d_Q_damping_coef[Q_var], d_Q_damping_coef[P_var]);
+            if (compatible && u_var)
+            {
+                compatible =
+                    d_Q_convective_time_stepping_type[Q_var] == d_Q_convective_time_stepping_type[P_var] &&
+                    d_Q_init_convective_time_stepping_type[Q_var] == d_Q_init_convective_time_stepping_type[P_var] &&
+                    d_Q_convective_op_type[Q_var] == d_Q_convective_op_type[P_var] &&
+                    d_Q_convective_op_input_db[Q_var] == d_Q_convective_op_input_db[P_var] &&
+                    d_Q_difference_form[Q_var] == d_Q_difference_form[P_var];
+            }
+            if (compatible)
+            {
+                Q_groups[g].push_back(Q_var);
+                found_group = true;
+            }
+        }
+        if (!found_group) Q_groups.push_back(std::vector<Pointer<CellVariable<NDIM, double> > >(1, Q_var));
+    }
+    for (unsigned int g = 0; g < Q_groups.size(); ++g)
+    {
+        if (Q_groups[g].size() > 1) d_Q_groups.push_back(Q_groups[g]);
+    }
+
+    // Register the packed variables used to advance each group.
+    const unsigned int num_groups = static_cast<unsigned int>(d_Q_groups.size());
+    d_group_var.resize(num_groups);
+    d_group_rhs_var.resize(num_groups);
+    d_group_N_var.resize(num_groups);
+    d_group_bc_coef.resize(num_groups);
+    d_group_sol_vecs.resize(num_groups);
+    d_group_rhs_vecs.resize(num_groups);
+    d_group_helmholtz_solvers.resize(num_groups);
+    d_group_helmholtz_rhs_ops.resize(num_groups);
+    d_group_convective_ops.resize(num_groups);
+    d_group_helmholtz_solvers_need_init.resize(num_groups, true);
+    d_group_helmholtz_rhs_ops_need_init.resize(num_groups, true);
+    d_group_convective_ops_need_init.resize(num_groups, true);
+    const IntVector<NDIM> cell_ghosts = CELLG;
+    for (unsigned int g = 0; g < num_groups; ++g)
+    {
+        const std::vector<Pointer<CellVariable<NDIM, double> > >& Q_group = d_Q_groups[g];
+        int group_depth = 0;
+        for (unsigned int k = 0; k < Q_group.size(); ++k)
+        {
+            Pointer<CellVariable<NDIM, double> > Q_var = Q_group[k];
+            group_depth += get_cc_depth(Q_var);
+            d_group_bc_coef[g].insert(d_group_bc_coef[g].end(), d_Q_bc_coef[Q_var].begin(), d_Q_bc_coef[Q_var].end());
+            d_Q_group_map[Q_var] = g;
+        }
+        std::ostringstream name;
+        name << d_object_name << "::group_" << g;
+
+        d_group_var[g] = new CellVariable<NDIM, double>(name.str() + "::Q", group_depth);
+        int G_scratch_idx;
+        registerVariable(G_scratch_idx, d_group_var[g], cell_ghosts, getScratchContext());
+
+        d_group_rhs_var[g] = new CellVariable<NDIM, double>(name.str() + "::Q_rhs", group_depth);
+        int G_rhs_scratch_idx;
+        registerVariable(G_rhs_scratch_idx, d_group_rhs_var[g], cell_ghosts, getScratchContext());
+
+        d_group_N_var[g] = new CellVariable<NDIM, double>(name.str() + "::N", group_depth);
+        int G_N_scratch_idx;
+        registerVariable(G_N_scratch_idx, d_group_N_var[g], cell_ghosts, getScratchContext());
+
+        Pointer<CellVariable<NDIM, double> > Q_var = Q_group.front();
+        if (d_Q_u_map[Q_var])
+        {
+            AdvDiffConvectiveOperatorManager* convective_op_manager = AdvDiffConvectiveOperatorManager::getManager();
+            d_group_convective_ops[g] =
+                convective_op_manager->allocateOperator(d_Q_convective_op_type[Q_var],
+                                                        name.str() + "::ConvectiveOperator",
+                                                        d_group_var[g],
+                                                        d_Q_convective_op_input_db[Q_var],
+                                                        d_Q_difference_form[Q_var],
+                                                        d_group_bc_coef[g]);
+        }
+        if (d_enable_logging)
+        {
+            plog << d_object_name << ": "
+                 << "advancing " << Q_group.size() << " transported quantities as variable group " << g << "\n";
+        }
+    }
+    return;
+} // setupTransportedQuantityGroups
+
+void
+AdvDiffSemiImplicitHierarchyIntegrator::preprocessIntegrateGroup(const unsigned int g,
+                                                                 const double current_time,
+                                                                 const double new_time,
+                                                                 const int num_cycles)
+{
+    const double dt = new_time - current_time;
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    const std::vector<Pointer<CellVariable<NDIM, double> > >& Q_group = d_Q_groups[g];
+    Pointer<CellVariable<NDIM, double> > Q_var = Q_group.front();
+    TimeSteppingType diffusion_time_stepping_type = d_Q_diffusion_time_stepping_type[Q_var];
+    const double lambda = d_Q_damping_coef[Q_var];
+    const double kappa = d_Q_diffusion_coef[Q_var];
+
+    const int G_scratch_idx = var_db->mapVariableAndContextToIndex(d_group_var[g], getScratchContext());
+    const int G_rhs_scratch_idx = var_db->mapVariableAndContextToIndex(d_group_rhs_var[g], getScratchContext());
+    const int G_N_scratch_idx = var_db->mapVariableAndContextToIndex(d_group_N_var[g], getScratchContext());
+
+    // Setup the problem coefficients for the linear solve for Q(n+1).
+    double K = 0.0;
+    switch (diffusion_time_stepping_type)
+    {
+    case BACKWARD_EULER:
+        K = 1.0;
+        break;
+    case FORWARD_EULER:
+        K = 0.0;
+        break;
+    case TRAPEZOIDAL_RULE:
+        K = 0.5;
+        break;
+    default:
+        TBOX_ERROR(d_object_name << "::preprocessIntegrateGroup():\n"
+                                 << "  unsupported diffusion time stepping type: "
+                                 << enum_to_string<TimeSteppingType>(diffusion_time_stepping_type)
+                                 << " \n"
+                                 << "  valid choices are: BACKWARD_EULER, FORWARD_EULER, TRAPEZOIDAL_RULE\n");
+    }
+    PoissonSpecifications solver_spec(d_object_name + "::solver_spec::" + d_group_var[g]->getName());
+    PoissonSpecifications rhs_op_spec(d_object_name + "::rhs_op_spec::" + d_group_var[g]->getName());
+    solver_spec.setCConstant(1.0 / dt + K * lambda);
+    rhs_op_spec.setCConstant(1.0 / dt - (1.0 - K) * lambda);
+    solver_spec.setDConstant(-K * kappa);
+    rhs_op_spec.setDConstant(+(1.0 - K) * kappa);
+
+    // Pack the current values of the grouped quantities and set the initial
+    // guess.
+    int offset = 0;
+    for (unsigned int k = 0; k < Q_group.size(); ++k)
+    {
+        const int Q_depth = get_cc_depth(Q_group[k]);
+        const int Q_current_idx = var_db->mapVariableAndContextToIndex(Q_group[k], getCurrentContext());
+        const int Q_new_idx = var_db->mapVariableAndContextToIndex(Q_group[k], getNewContext());
+        copy_cc_data_depths(G_scratch_idx, offset, Q_current_idx, 0, Q_depth, d_hierarchy);
+        d_hier_cc_data_ops->copyData(Q_new_idx, Q_current_idx);
+        offset += Q_depth;
+    }
+
+    // Initialize the RHS operator and compute the RHS vector.
+    Pointer<LaplaceOperator> helmholtz_rhs_op = d_group_helmholtz_rhs_ops[g];
+    helmholtz_rhs_op->setPoissonSpecifications(rhs_op_spec);
+    helmholtz_rhs_op->setPhysicalBcCoefs(d_group_bc_coef[g]);
+    helmholtz_rhs_op->setHomogeneousBc(false);
+    helmholtz_rhs_op->setSolutionTime(current_time);
+    helmholtz_rhs_op->setTimeInterval(current_time, new_time);
+    if (d_group_helmholtz_rhs_ops_need_init[g])
+    {
+        if (d_enable_logging)
+        {
+            plog << d_object_name << ": "
+                 << "Initializing Helmholtz RHS operator for variable group " << g << "\n";
+        }
+        helmholtz_rhs_op->initializeOperatorState(*d_group_sol_vecs[g], *d_group_rhs_vecs[g]);
+        d_group_helmholtz_rhs_ops_need_init[g] = false;
+    }
+    helmholtz_rhs_op->apply(*d_group_sol_vecs[g], *d_group_rhs_vecs[g]);
+
+    // Initialize the linear solver.
+    Pointer<PoissonSolver> helmholtz_solver = d_group_helmholtz_solvers[g];
+    helmholtz_solver->setPoissonSpecifications(solver_spec);
+    helmholtz_solver->setPhysicalBcCoefs(d_group_bc_coef[g]);
+    helmholtz_solver->setHomogeneousBc(false);
+    helmholtz_solver->setSolutionTime(new_time);
+    helmholtz_solver->setTimeInterval(current_time, new_time);
+    if (d_group_helmholtz_solvers_need_init[g])
+    {
+        if (d_enable_logging)
+        {
+            plog << d_object_name << ": "
+                 << "Initializing Helmholtz solvers for variable group " << g << "\n";
+        }
+        helmholtz_solver->initializeSolverState(*d_group_sol_vecs[g], *d_group_rhs_vecs[g]);
+        d_group_helmholtz_solvers_need_init[g] = false;
+    }
+
+    // Account for the convective difference term.
+    Pointer<FaceVariable<NDIM, double> > u_var = d_Q_u_map[Q_var];
+    if (u_var)
+    {
+        TimeSteppingType convective_time_stepping_type = d_Q_convective_time_stepping_type[Q_var];
+        if (getIntegratorStep() == 0 && is_multistep_time_stepping_type(convective_time_stepping_type))
+        {
+            convective_time_stepping_type = d_Q_init_convective_time_stepping_type[Q_var];
+        }
+        if ((num_cycles == 1) &&
+            (convective_time_stepping_type == MIDPOINT_RULE || convective_time_stepping_type == TRAPEZOIDAL_RULE))
+        {
+            TBOX_ERROR(d_object_name << "::preprocessIntegrateGroup():\n"
+                                     << "  time stepping type: "
+                                     << enum_to_string<TimeSteppingType>(convective_time_stepping_type)
+                                     << " requires num_cycles > 1.\n"
+                                     << "  at current time step, num_cycles = "
+                                     << num_cycles
+                                     << "\n");
+        }
+        Pointer<ConvectiveOperator> convective_op = d_group_convective_ops[g];
+        if (d_group_convective_ops_need_init[g])
+        {
+            convective_op->initializeOperatorState(*d_group_sol_vecs[g], *d_group_rhs_vecs[g]);
+            d_group_convective_ops_need_init[g] = false;
+        }
+        const int u_current_idx = var_db->mapVariableAndContextToIndex(u_var, getCurrentContext());
+        convective_op->setAdvectionVelocity(u_current_idx);
+        convective_op->setSolutionTime(current_time);
+        convective_op->applyConvectiveOperator(G_scratch_idx, G_N_scratch_idx);
+        offset = 0;
+        for (unsigned int k = 0; k < Q_group.size(); ++k)
+        {
+            const int Q_depth = get_cc_depth(Q_group[k]);
+            const int N_old_new_idx = var_db->mapVariableAndContextToIndex(d_Q_N_old_map[Q_group[k]], getNewContext());
+            copy_cc_data_depths(N_old_new_idx, 0, G_N_scratch_idx, offset, Q_depth, d_hierarchy);
+            offset += Q_depth;
+        }
+        if (convective_time_stepping_type == FORWARD_EULER)
+        {
+            d_hier_cc_data_ops->axpy(G_rhs_scratch_idx, -1.0, G_N_scratch_idx, G_rhs_scratch_idx);
+        }
+        else if (convective_time_stepping_type == TRAPEZOIDAL_RULE)
+        {
+            d_hier_cc_data_ops->axpy(G_rhs_scratch_idx, -0.5, G_N_scratch_idx, G_rhs_scratch_idx);
+        }
+    }
+    return;
+} // preprocessIntegrateGroup
+
+void
+AdvDiffSemiImplicitHierarchyIntegrator::integrateGroup(const unsigned int g,
+                                                       const double current_time,
+                                                       const double new_time,
+                                                       const int cycle_num)
+{
+    const double dt = new_time - current_time;
+    const double half_time = current_time + 0.5 * dt;
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    const std::vector<Pointer<CellVariable<NDIM, double> > >& Q_group = d_Q_groups[g];
+    Pointer<CellVariable<NDIM, double> > Q_var = Q_group.front();
+
+    const int G_scratch_idx = var_db->mapVariableAndContextToIndex(d_group_var[g], getScratchContext());
+    const int G_rhs_scratch_idx = var_db->mapVariableAndContextToIndex(d_group_rhs_var[g], getScratchContext());
+    const int G_N_scratch_idx = var_db->mapVariableAndContextToIndex(d_group_N_var[g], getScratchContext());
+
+    // Account for the convective difference term.
+    Pointer<FaceVariable<NDIM, double> > u_var = d_Q_u_map[Q_var];
+    TimeSteppingType convective_time_stepping_type = UNKNOWN_TIME_STEPPING_TYPE;
+    if (u_var)
+    {
+        Pointer<ConvectiveOperator> convective_op = d_group_convective_ops[g];
+        convective_time_stepping_type = d_Q_convective_time_stepping_type[Q_var];
+        if (is_multistep_time_stepping_type(convective_time_stepping_type))
+        {
+#if !defined(NDEBUG)
+            TBOX_ASSERT(convective_time_stepping_type == ADAMS_BASHFORTH);
+#endif
+            if (getIntegratorStep() == 0)
+            {
+                convective_time_stepping_type = d_Q_init_convective_time_stepping_type[Q_var];
+            }
+            else if (cycle_num > 0)
+            {
+                convective_time_stepping_type = MIDPOINT_RULE;
+            }
+        }
+        if (cycle_num > 0)
+        {
+            // Update the advection velocity.
+            const int u_current_idx = var_db->mapVariableAndContextToIndex(u_var, getCurrentContext());
+            const int u_scratch_idx = var_db->mapVariableAndContextToIndex(u_var, getScratchContext());
+            const int u_new_idx = var_db->mapVariableAndContextToIndex(u_var, getNewContext());
+            if (d_u_fcn[u_var])
+            {
+                d_u_fcn[u_var]->setDataOnPatchHierarchy(u_new_idx, u_var, d_hierarchy, new_time);
+            }
+            d_hier_fc_data_ops->linearSum(u_scratch_idx, 0.5, u_current_idx, 0.5, u_new_idx);
+
+            if (convective_time_stepping_type == MIDPOINT_RULE || convective_time_stepping_type == TRAPEZOIDAL_RULE)
+            {
+                const bool midpoint = convective_time_stepping_type == MIDPOINT_RULE;
+                int offset = 0;
+                for (unsigned int k = 0; k < Q_group.size(); ++k)
+                {
+                    const int Q_depth = get_cc_depth(Q_group[k]);
+                    const int Q_current_idx = var_db->mapVariableAndContextToIndex(Q_group[k], getCurrentContext());
+                    const int Q_scratch_idx = var_db->mapVariableAndContextToIndex(Q_group[k], getScratchContext());
+                    const int Q_new_idx = var_db->mapVariableAndContextToIndex(Q_group[k], getNewContext());
+                    if (midpoint)
+                    {
+                        d_hier_cc_data_ops->linearSum(Q_scratch_idx, 0.5, Q_current_idx, 0.5, Q_new_idx);
+                        copy_cc_data_depths(G_scratch_idx, offset, Q_scratch_idx, 0, Q_depth, d_hierarchy);
+                    }
+                    else
+                    {
+                        copy_cc_data_depths(G_scratch_idx, offset, Q_new_idx, 0, Q_depth, d_hierarchy);
+                    }
+                    offset += Q_depth;
+                }
+                convective_op->setAdvectionVelocity(midpoint ? u_scratch_idx : u_new_idx);
+                convective_op->setSolutionTime(midpoint ? half_time : new_time);
+                convective_op->applyConvectiveOperator(G_scratch_idx, G_N_scratch_idx);
+            }
+        }
+        if (convective_time_stepping_type == ADAMS_BASHFORTH)
+        {
+#if !defined(NDEBUG)
+            TBOX_ASSERT(cycle_num == 0);
+#endif
+            const double omega = dt / d_dt_previous[0];
+            d_hier_cc_data_ops->scale(G_N_scratch_idx, 1.0 + 0.5 * omega, G_N_scratch_idx);
+            int offset = 0;
+            for (unsigned int k = 0; k < Q_group.size(); ++k)
+            {
+                const int Q_depth = get_cc_depth(Q_group[k]);
+                const int N_old_current_idx =
+                    var_db->mapVariableAndContextToIndex(d_Q_N_old_map[Q_group[k]], getCurrentContext());
+                axpy_cc_data_depths(G_N_scratch_idx, offset, -0.5 * omega, N_old_current_idx, 0, Q_depth, d_hierarchy);
+                offset += Q_depth;
+            }
+        }
+        if (convective_time_stepping_type == ADAMS_BASHFORTH || convective_time_stepping_type == MIDPOINT_RULE)
+        {
+            d_hier_cc_data_ops->axpy(G_rhs_scratch_idx, -1.0, G_N_scratch_idx, G_rhs_scratch_idx);
+        }
+        else if (convective_time_stepping_type == TRAPEZOIDAL_RULE)
+        {
+            d_hier_cc_data_ops->axpy(G_rhs_scratch_idx, -0.5, G_N_scratch_idx, G_rhs_scratch_idx);
+        }
+    }
+
+    // Account for forcing terms.
+    int offset = 0;
+    for (unsigned int k = 0; k < Q_group.size(); ++k)
+    {
+        const int Q_depth = get_cc_depth(Q_group[k]);
+        Pointer<CellVariable<NDIM, double> > F_var = d_Q_F_map[Q_group[k]];
+        if (d_F_fcn[F_var])
+        {
+            const int F_scratch_idx = var_db->mapVariableAndContextToIndex(F_var, getScratchContext());
+            d_F_fcn[F_var]->setDataOnPatchHierarchy(F_scratch_idx, F_var, d_hierarchy, half_time);
+            axpy_cc_data_depths(G_rhs_scratch_idx, offset, 1.0, F_scratch_idx, 0, Q_depth, d_hierarchy);
+        }
+        offset += Q_depth;
+    }
+
+    // Solve for Q(n+1) for all members of the group simultaneously.
+    Pointer<PoissonSolver> helmholtz_solver = d_group_helmholtz_solvers[g];
+    helmholtz_solver->solveSystem(*d_group_sol_vecs[g], *d_group_rhs_vecs[g]);
+    offset = 0;
+    for (unsigned int k = 0; k < Q_group.size(); ++k)
+    {
+        const int Q_depth = get_cc_depth(Q_group[k]);
+        const int Q_new_idx = var_db->mapVariableAndContextToIndex(Q_group[k], getNewContext());
+        copy_cc_data_depths(Q_new_idx, 0, G_scratch_idx, offset, Q_depth, d_hierarchy);
+        offset += Q_depth;
+    }
+    if (d_enable_logging)
+        plog << d_object_name << "::integrateHierarchy(): diffusion solve number of iterations = "
+             << helmholtz_solver->getNumIterations() << "\n";
+    if (d_enable_logging)
+        plog << d_object_name << "::integrateHierarchy(): diffusion solve residual norm        = "
+             << helmholtz_solver->getResidualNorm() << "\n";
+    if (helmholtz_solver->getNumIterations() == helmholtz_solver->getMaxIterations())
+    {
+        pout << d_object_name << "::integrateHierarchy():"
+             << "  WARNING: linear solver iterations == max iterations\n";
+    }
+
+    // Reset the right-hand side vector.
+    if (u_var)
+    {
+        if (convective_time_stepping_type == ADAMS_BASHFORTH || convective_time_stepping_type == MIDPOINT_RULE)
+        {
+            d_hier_cc_data_ops->axpy(G_rhs_scratch_idx, +1.0, G_N_scratch_idx, G_rhs_scratch_idx);
+        }
+        else if (convective_time_stepping_type == TRAPEZOIDAL_RULE)
+        {
+            d_hier_cc_data_ops->axpy(G_rhs_scratch_idx, +0.5, G_N_scratch_idx, G_rhs_scratch_idx);
+        }
+    }
+    offset = 0;
+    for (unsigned int k = 0; k < Q_group.size(); ++k)
+    {
+        const int Q_depth = get_cc_depth(Q_group[k]);
+        Pointer<CellVariable<NDIM, double> > F_var = d_Q_F_map[Q_group[k]];
+        if (d_F_fcn[F_var])
+        {
+            const int F_scratch_idx = var_db->mapVariableAndContextToIndex(F_var, getScratchContext());
+            const int F_new_idx = var_db->mapVariableAndContextToIndex(F_var, getNewContext());
+            axpy_cc_data_depths(G_rhs_scratch_idx, offset, -1.0, F_scratch_idx, 0, Q_depth, d_hierarchy);
+            d_hier_cc_data_ops->copyData(F_new_idx, F_scratch_idx);
+        }
+        offset += Q_depth;
+    }
+    return;
+} // integrateGroup
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBAMR
@@ -34,6 +34,7 @@
 
 #include <math.h>
 #include <stddef.h>
+#include <algorithm>
 #include <limits>
 #include <ostream>
 #include <string>
@@ -85,14 +86,47 @@ namespace IBAMR
 
 namespace
 {
+// Fill the specified box with normally distributed random values, drawn from
+// the Mersenne Twister generator if rng_key is NULL and otherwise from the
+// counter-based generator, using the specified stream (see RNG::rng_stream()).
 void
-genrandn(ArrayData<NDIM, double>& data, const Box<NDIM>& box)
+genrandn(ArrayData<NDIM, double>& data,
+         const Box<NDIM>& box,
+         const unsigned int* const rng_key = NULL,
+         const unsigned int stream = 0)
 {
-    for (int depth = 0; depth < data.getDepth(); ++depth)
+    const int data_depth = data.getDepth();
+    if (!rng_key)
     {
-        for (Box<NDIM>::Iterator i(box); i; i++)
+        for (int depth = 0; depth < data_depth; ++depth)
         {
-            RNG::genrandn(&data(i(), depth));
+            for (Box<NDIM>::Iterator i(box); i; i++)
+            {
+                RNG::genrandn(&data(i(), depth));
+            }
+        }
+        return;
+    }
+
+    // Each evaluation of the generator yields four values, which are assigned
+    // to consecutive data depths.
+    double vals[4];
+    unsigned int ctr[4];
+    for (int depth = 0; depth < data_depth; depth += 4)
+    {
+        const int n_vals = std::min(4, data_depth - depth);
+        ctr[3] = (stream << 8) | static_cast<unsigned int>(depth / 4);
+        for (Box<NDIM>::Iterator b(box); b; b++)
+        {
+            const Index<NDIM>& i = b();
+            ctr[0] = static_cast<unsigned int>(i(0));
+            ctr[1] = static_cast<unsigned int>(i(1));
+            ctr[2] = (NDIM > 2 ? static_cast<unsigned int>(i(NDIM - 1)) : 0U);
+            RNG::genrandn(vals, ctr, rng_key);
+            for (int k = 0; k < n_vals; ++k)
+            {
+                data(i, depth + k) = vals[k];
+            }
         }
     }
     return;
@@ -114,6 +148,8 @@ AdvDiffStochasticForcing::AdvDiffStochasticForcing(const std::string& object_nam
       d_weights(),
       d_dirichlet_bc_scaling(sqrt(2.0)),
       d_neumann_bc_scaling(0.0),
+      d_use_counter_based_rng(false),
+      d_rng_key(RNG::hash_object_name(object_name)),
       d_context(NULL),
       d_C_cc_var(NULL),
       d_C_current_cc_idx(-1),
@@ -144,6 +180,8 @@ AdvDiffStochasticForcing::AdvDiffStochasticForcing(const std::string& object_nam
         if (input_db->keyExists("dirichlet_bc_scaling"))
             d_dirichlet_bc_scaling = input_db->getDouble("dirichlet_bc_scaling");
         if (input_db->keyExists("neumann_bc_scaling")) d_neumann_bc_scaling = input_db->getDouble("neumann_bc_scaling");
+        if (input_db->keyExists("use_counter_based_rng"))
+            d_use_counter_based_rng = input_db->getBool("use_counter_based_rng");
         if (input_db->keyExists("f_expression")) f_expression = input_db->getString("f_expression");
     }
     d_f_parser.SetExpr(f_expression);
@@ -274,6 +312,10 @@ AdvDiffStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
         // Generate random components.
         if (cycle_num == 0)
         {
+            unsigned int rng_key[2];
+            rng_key[0] = RNG::getGlobalSeed() ^ d_rng_key;
+            rng_key[1] = static_cast<unsigned int>(d_adv_diff_solver->getIntegratorStep());
+            const unsigned int* const key = d_use_counter_based_rng ? rng_key : NULL;
             for (int k = 0; k < d_num_rand_vals; ++k)
             {
                 for (int level_num = coarsest_ln; level_num <= finest_ln; ++level_num)
@@ -285,7 +327,10 @@ AdvDiffStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
                         Pointer<SideData<NDIM, double> > F_sc_data = patch->getPatchData(d_F_sc_idxs[k]);
                         for (int d = 0; d < NDIM; ++d)
                         {
-                            genrandn(F_sc_data->getArrayData(d), SideGeometry<NDIM>::toSideBox(F_sc_data->getBox(), d));
+                            genrandn(F_sc_data->getArrayData(d),
+                                     SideGeometry<NDIM>::toSideBox(F_sc_data->getBox(), d),
+                                     key,
+                                     RNG::rng_stream(k, level_num, d));
                         }
                     }
                 }
@@ -32,6 +32,9 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
+#include <cmath>
+
 #include "ibamr/FastSweepingLSMethod.h"
 #include "CellVariable.h"
 #include "HierarchyCellDataOpsReal.h"
@@ -83,6 +86,20 @@ namespace IBAMR
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Raw data needed to sweep a single patch.
+struct PatchSweepData
+{
+    double* D;
+    int D_ghosts;
+    Box<NDIM> patch_box, ghost_box, domain_box;
+    const double* dx;
+    int patch_touches_bdry;
+    int touches_wall_loc_idx[2 * NDIM];
+};
+}
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 FastSweepingLSMethod::FastSweepingLSMethod(const std::string& object_name,
@@ -96,6 +113,7 @@ FastSweepingLSMethod::FastSweepingLSMethod(const std::string& object_name,
     d_abs_tol = 1e-5;
     d_enable_logging = false;
     d_consider_phys_bdry_wall = false;
+    d_narrow_band_width = 0.0;
     for (int k = 0; k < 2 * NDIM; ++k) d_wall_location_idx[k] = 0;
 
     if (d_registered_for_restart) getFromRestart();
@@ -237,58 +255,112 @@ FastSweepingLSMethod::fastSweep(Pointer<HierarchyMathOps> hier_math_ops, int dis
     const int coarsest_ln = 0;
     const int finest_ln = hierarchy->getFinestLevelNumber();
 
+    // Collect the raw patch data of the local patches first, since the
+    // reference counted SAMRAI pointers cannot be accessed concurrently.
+    std::vector<PatchSweepData> patch_data;
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
         const BoxArray<NDIM>& domain_boxes = level->getPhysicalDomain();
-#if !defined(NDEBUG)
-        TBOX_ASSERT(domain_boxes.size() == 1);
-#endif
+        Box<NDIM> domain_bounding_box = domain_boxes[0];
+        for (int k = 1; k < domain_boxes.size(); ++k)
+        {
+            domain_bounding_box = domain_bounding_box + domain_boxes[k];
+        }
 
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<CellData<NDIM, double> > dist_data = patch->getPatchData(dist_idx);
-            fastSweep(dist_data, patch, domain_boxes[0]);
+#if !defined(NDEBUG)
+            TBOX_ASSERT(dist_data->getDepth() == 1);
+#endif
+            PatchSweepData data;
+            data.D = dist_data->getPointer(0);
+            data.D_ghosts = (dist_data->getGhostCellWidth()).max();
+            data.patch_box = patch->getBox();
+            data.ghost_box = dist_data->getGhostBox();
+            Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            data.dx = pgeom->getDx();
+
+            // Check if the patch touches physical domain.
+            for (int k = 0; k < 2 * NDIM; ++k) data.touches_wall_loc_idx[k] = 0;
+            data.patch_touches_bdry = pgeom->getTouchesRegularBoundary() || pgeom->getTouchesPeriodicBoundary();
+            data.domain_box = domain_bounding_box;
+            if (data.patch_touches_bdry)
+            {
+                int loc_idx = 0;
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    for (int upperlower = 0; upperlower < 2; ++upperlower, ++loc_idx)
+                    {
+                        const bool touches_regular_bdry = pgeom->getTouchesRegularBoundary(axis, upperlower);
+                        data.touches_wall_loc_idx[loc_idx] =
+                            d_consider_phys_bdry_wall && touches_regular_bdry && d_wall_location_idx[loc_idx];
+
+                        // For multi-box domains the wall is not necessarily
+                        // located at the face of the bounding box, but it is
+                        // always located at the face of the patch it touches.
+                        if (touches_regular_bdry)
+                        {
+                            if (upperlower == 0) data.domain_box.lower(axis) = data.patch_box.lower(axis);
+                            if (upperlower == 1) data.domain_box.upper(axis) = data.patch_box.upper(axis);
+                        }
+                    }
+                }
+            }
+            patch_data.push_back(data);
         }
     }
-    return;
 
-} // fastSweep
-
-void
-FastSweepingLSMethod::fastSweep(Pointer<CellData<NDIM, double> > dist_data,
-                                const Pointer<Patch<NDIM> > patch,
-                                const Box<NDIM>& domain_box) const
-{
-    double* const D = dist_data->getPointer(0);
-    const int D_ghosts = (dist_data->getGhostCellWidth()).max();
-
-    // Check if the patch touches physical domain.
-    int touches_wall_loc_idx[NDIM * 2] = { 0 };
-    Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-    const bool patch_touches_bdry = pgeom->getTouchesRegularBoundary() || pgeom->getTouchesPeriodicBoundary();
-    if (patch_touches_bdry)
+    const int num_patches = static_cast<int>(patch_data.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int k = 0; k < num_patches; ++k)
     {
-        int loc_idx = 0;
-        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        const PatchSweepData& data = patch_data[k];
+
+        // Skip patches that lie outside the narrow band around the interface.
+        if (d_narrow_band_width > 0.0)
         {
-            for (int upperlower = 0; upperlower < 2; ++upperlower, ++loc_idx)
+            double dx_min = data.dx[0];
+            for (int d = 1; d < NDIM; ++d) dx_min = std::min(dx_min, data.dx[d]);
+            const double band_width = d_narrow_band_width * dx_min;
+            const int ghost_box_size = data.ghost_box.size();
+            bool in_band = false;
+            for (int i = 0; i < ghost_box_size && !in_band; ++i)
             {
-                touches_wall_loc_idx[loc_idx] = d_consider_phys_bdry_wall &&
-                                                pgeom->getTouchesRegularBoundary(axis, upperlower) &&
-                                                d_wall_location_idx[loc_idx];
+                in_band = std::abs(data.D[i]) <= band_width;
             }
+            if (!in_band) continue;
         }
+
+        fastSweep(data.D,
+                  data.D_ghosts,
+                  data.patch_box,
+                  data.domain_box,
+                  data.dx,
+                  data.patch_touches_bdry,
+                  data.touches_wall_loc_idx);
     }
+    return;
+
+} // fastSweep
 
+void
+FastSweepingLSMethod::fastSweep(double* D,
+                                int D_ghosts,
+                                const Box<NDIM>& patch_box,
+                                const Box<NDIM>& domain_box,
+                                const double* dx,
+                                int patch_touches_bdry,
+                                const int* touches_wall_loc_idx) const
+{
 #if !defined(NDEBUG)
-    TBOX_ASSERT(dist_data->getDepth() == 1);
     if (d_ls_order == FIRST_ORDER_LS) TBOX_ASSERT(D_ghosts >= 1);
 #endif
 
-    const Box<NDIM>& patch_box = patch->getBox();
-    const double* const dx = pgeom->getDx();
     if (d_ls_order == FIRST_ORDER_LS)
     {
         FAST_SWEEP_1ST_ORDER_FC(D,
@@ -337,6 +409,8 @@ FastSweepingLSMethod::getFromInput(Pointer<Database> input_db)
 
     d_reinit_interval = input_db->getIntegerWithDefault("reinit_interval", d_reinit_interval);
 
+    d_narrow_band_width = input_db->getDoubleWithDefault("narrow_band_width", d_narrow_band_width);
+
     d_consider_phys_bdry_wall = input_db->getBoolWithDefault("physical_bdry_wall", d_consider_phys_bdry_wall);
     Array<int> wall_loc_idices;
     if (input_db->keyExists("physical_bdry_wall_loc_idx"))
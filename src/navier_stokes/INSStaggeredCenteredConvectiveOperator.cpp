@@ -217,6 +217,15 @@ namespace
 // Number of ghosts cells used for each variable quantity.
 static const int GADVECTG = 1;
 
+// Raw data needed to compute the convective derivative on a single patch.
+struct ConvectivePatchData
+{
+    CartesianPatchGeometry<NDIM>* patch_geom;
+    Box<NDIM> patch_box;
+    SideData<NDIM, double>* N_data;
+    SideData<NDIM, double>* U_data;
+};
+
 // Timers.
 static Timer* t_apply_convective_operator;
 static Timer* t_apply;
@@ -334,150 +343,171 @@ INSStaggeredCenteredConvectiveOperator::applyConvectiveOperator(const int U_idx,
     StaggeredStokesPhysicalBoundaryHelper::resetBcCoefObjects(d_bc_coefs, NULL);
     d_hier_bdry_fill->resetTransactionComponents(d_transaction_comps);
 
-    // Compute the convective derivative.
+    // Collect the data needed to compute the convective derivative on each
+    // patch.  SAMRAI smart pointers are not thread safe, so only raw pointers
+    // are handed to the threaded loop over patches below.
+    std::vector<ConvectivePatchData> patch_data;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+            Pointer<SideData<NDIM, double> > N_data = patch->getPatchData(N_idx);
+            Pointer<SideData<NDIM, double> > U_data = patch->getPatchData(d_U_scratch_idx);
+            ConvectivePatchData data;
+            data.patch_geom = patch_geom.getPointer();
+            data.patch_box = patch->getBox();
+            data.N_data = N_data.getPointer();
+            data.U_data = U_data.getPointer();
+            patch_data.push_back(data);
+        }
+    }
 
-            const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
-            const double* const dx = patch_geom->getDx();
+    // Compute the convective derivative.  The patches are independent, so they
+    // may be processed concurrently.
+    const int num_patches = static_cast<int>(patch_data.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int k = 0; k < num_patches; ++k)
+    {
+        CartesianPatchGeometry<NDIM>* const patch_geom = patch_data[k].patch_geom;
+        const double* const dx = patch_geom->getDx();
 
-            const Box<NDIM>& patch_box = patch->getBox();
-            const IntVector<NDIM>& patch_lower = patch_box.lower();
-            const IntVector<NDIM>& patch_upper = patch_box.upper();
+        const Box<NDIM>& patch_box = patch_data[k].patch_box;
+        const IntVector<NDIM>& patch_lower = patch_box.lower();
+        const IntVector<NDIM>& patch_upper = patch_box.upper();
 
-            Pointer<SideData<NDIM, double> > N_data = patch->getPatchData(N_idx);
-            Pointer<SideData<NDIM, double> > U_data = patch->getPatchData(d_U_scratch_idx);
+        SideData<NDIM, double>* const N_data = patch_data[k].N_data;
+        SideData<NDIM, double>* const U_data = patch_data[k].U_data;
 
-            const IntVector<NDIM>& N_data_gcw = N_data->getGhostCellWidth();
-            const IntVector<NDIM>& U_data_gcw = U_data->getGhostCellWidth();
+        const IntVector<NDIM>& N_data_gcw = N_data->getGhostCellWidth();
+        const IntVector<NDIM>& U_data_gcw = U_data->getGhostCellWidth();
 
-            switch (d_difference_form)
-            {
-            case CONSERVATIVE:
-                NAVIER_STOKES_STAGGERED_DIV_DERIVATIVE_FC(dx,
+        switch (d_difference_form)
+        {
+        case CONSERVATIVE:
+            NAVIER_STOKES_STAGGERED_DIV_DERIVATIVE_FC(dx,
 #if (NDIM == 2)
-                                                          patch_lower(0),
-                                                          patch_upper(0),
-                                                          patch_lower(1),
-                                                          patch_upper(1),
-                                                          U_data_gcw(0),
-                                                          U_data_gcw(1),
-                                                          U_data->getPointer(0),
-                                                          U_data->getPointer(1),
-                                                          N_data_gcw(0),
-                                                          N_data_gcw(1),
-                                                          N_data->getPointer(0),
-                                                          N_data->getPointer(1)
+                                                      patch_lower(0),
+                                                      patch_upper(0),
+                                                      patch_lower(1),
+                                                      patch_upper(1),
+                                                      U_data_gcw(0),
+                                                      U_data_gcw(1),
+                                                      U_data->getPointer(0),
+                                                      U_data->getPointer(1),
+                                                      N_data_gcw(0),
+                                                      N_data_gcw(1),
+                                                      N_data->getPointer(0),
+                                                      N_data->getPointer(1)
 #endif
 #if (NDIM == 3)
-                                                              patch_lower(0),
-                                                          patch_upper(0),
-                                                          patch_lower(1),
-                                                          patch_upper(1),
-                                                          patch_lower(2),
-                                                          patch_upper(2),
-                                                          U_data_gcw(0),
-                                                          U_data_gcw(1),
-                                                          U_data_gcw(2),
-                                                          U_data->getPointer(0),
-                                                          U_data->getPointer(1),
-                                                          U_data->getPointer(2),
-                                                          N_data_gcw(0),
-                                                          N_data_gcw(1),
-                                                          N_data_gcw(2),
-                                                          N_data->getPointer(0),
-                                                          N_data->getPointer(1),
-                                                          N_data->getPointer(2)
+                                                          patch_lower(0),
+                                                      patch_upper(0),
+                                                      patch_lower(1),
+                                                      patch_upper(1),
+                                                      patch_lower(2),
+                                                      patch_upper(2),
+                                                      U_data_gcw(0),
+                                                      U_data_gcw(1),
+                                                      U_data_gcw(2),
+                                                      U_data->getPointer(0),
+                                                      U_data->getPointer(1),
+                                                      U_data->getPointer(2),
+                                                      N_data_gcw(0),
+                                                      N_data_gcw(1),
+                                                      N_data_gcw(2),
+                                                      N_data->getPointer(0),
+                                                      N_data->getPointer(1),
+                                                      N_data->getPointer(2)
 #endif
-                                                              );
-                break;
-            case ADVECTIVE:
-                NAVIER_STOKES_STAGGERED_ADV_DERIVATIVE_FC(dx,
+                                                          );
+            break;
+        case ADVECTIVE:
+            NAVIER_STOKES_STAGGERED_ADV_DERIVATIVE_FC(dx,
 #if (NDIM == 2)
-                                                          patch_lower(0),
-                                                          patch_upper(0),
-                                                          patch_lower(1),
-                                                          patch_upper(1),
-                                                          U_data_gcw(0),
-                                                          U_data_gcw(1),
-                                                          U_data->getPointer(0),
-                                                          U_data->getPointer(1),
-                                                          N_data_gcw(0),
-                                                          N_data_gcw(1),
-                                                          N_data->getPointer(0),
-                                                          N_data->getPointer(1)
+                                                      patch_lower(0),
+                                                      patch_upper(0),
+                                                      patch_lower(1),
+                                                      patch_upper(1),
+                                                      U_data_gcw(0),
+                                                      U_data_gcw(1),
+                                                      U_data->getPointer(0),
+                                                      U_data->getPointer(1),
+                                                      N_data_gcw(0),
+                                                      N_data_gcw(1),
+                                                      N_data->getPointer(0),
+                                                      N_data->getPointer(1)
 #endif
 #if (NDIM == 3)
-                                                              patch_lower(0),
-                                                          patch_upper(0),
-                                                          patch_lower(1),
-                                                          patch_upper(1),
-                                                          patch_lower(2),
-                                                          patch_upper(2),
-                                                          U_data_gcw(0),
-                                                          U_data_gcw(1),
-                                                          U_data_gcw(2),
-                                                          U_data->getPointer(0),
-                                                          U_data->getPointer(1),
-                                                          U_data->getPointer(2),
-                                                          N_data_gcw(0),
-                                                          N_data_gcw(1),
-                                                          N_data_gcw(2),
-                                                          N_data->getPointer(0),
-                                                          N_data->getPointer(1),
-                                                          N_data->getPointer(2)
+                                                          patch_lower(0),
+                                                      patch_upper(0),
+                                                      patch_lower(1),
+                                                      patch_upper(1),
+                                                      patch_lower(2),
+                                                      patch_upper(2),
+                                                      U_data_gcw(0),
+                                                      U_data_gcw(1),
+                                                      U_data_gcw(2),
+                                                      U_data->getPointer(0),
+                                                      U_data->getPointer(1),
+                                                      U_data->getPointer(2),
+                                                      N_data_gcw(0),
+                                                      N_data_gcw(1),
+                                                      N_data_gcw(2),
+                                                      N_data->getPointer(0),
+                                                      N_data->getPointer(1),
+                                                      N_data->getPointer(2)
 #endif
-                                                              );
-                break;
-            case SKEW_SYMMETRIC:
-                NAVIER_STOKES_STAGGERED_SKEW_SYM_DERIVATIVE_FC(dx,
+                                                          );
+            break;
+        case SKEW_SYMMETRIC:
+            NAVIER_STOKES_STAGGERED_SKEW_SYM_DERIVATIVE_FC(dx,
 #if (NDIM == 2)
-                                                               patch_lower(0),
-                                                               patch_upper(0),
-                                                               patch_lower(1),
-                                                               patch_upper(1),
-                                                               U_data_gcw(0),
-                                                               U_data_gcw(1),
-                                                               U_data->getPointer(0),
-                                                               U_data->getPointer(1),
-                                                               N_data_gcw(0),
-                                                               N_data_gcw(1),
-                                                               N_data->getPointer(0),
-                                                               N_data->getPointer(1)
+                                                           patch_lower(0),
+                                                           patch_upper(0),
+                                                           patch_lower(1),
+                                                           patch_upper(1),
+                                                           U_data_gcw(0),
+                                                           U_data_gcw(1),
+                                                           U_data->getPointer(0),
+                                                           U_data->getPointer(1),
+                                                           N_data_gcw(0),
+                                                           N_data_gcw(1),
+                                                           N_data->getPointer(0),
+                                                           N_data->getPointer(1)
 #endif
 #if (NDIM == 3)
-                                                                   patch_lower(0),
-                                                               patch_upper(0),
-                                                               patch_lower(1),
-                                                               patch_upper(1),
-                                                               patch_lower(2),
-                                                               patch_upper(2),
-                                                               U_data_gcw(0),
-                                                               U_data_gcw(1),
-                                                               U_data_gcw(2),
-                                                               U_data->getPointer(0),
-                                                               U_data->getPointer(1),
-                                                               U_data->getPointer(2),
-                                                               N_data_gcw(0),
-                                                               N_data_gcw(1),
-                                                               N_data_gcw(2),
-                                                               N_data->getPointer(0),
-                                                               N_data->getPointer(1),
-                                                               N_data->getPointer(2)
+                                                               patch_lower(0),
+                                                           patch_upper(0),
+                                                           patch_lower(1),
+                                                           patch_upper(1),
+                                                           patch_lower(2),
+                                                           patch_upper(2),
+                                                           U_data_gcw(0),
+                                                           U_data_gcw(1),
+                                                           U_data_gcw(2),
+                                                           U_data->getPointer(0),
+                                                           U_data->getPointer(1),
+                                                           U_data->getPointer(2),
+                                                           N_data_gcw(0),
+                                                           N_data_gcw(1),
+                                                           N_data_gcw(2),
+                                                           N_data->getPointer(0),
+                                                           N_data->getPointer(1),
+                                                           N_data->getPointer(2)
 #endif
-                                                                   );
-                break;
-            default:
-                TBOX_ERROR("INSStaggeredCenteredConvectiveOperator::applyConvectiveOperator():\n"
-                           << "  unsupported differencing form: "
-                           << enum_to_string<ConvectiveDifferencingType>(d_difference_form)
-                           << " \n"
-                           << "  valid choices are: ADVECTIVE, CONSERVATIVE, SKEW_SYMMETRIC\n");
-            }
+                                                               );
+            break;
+        default:
+            TBOX_ERROR("INSStaggeredCenteredConvectiveOperator::applyConvectiveOperator():\n"
+                       << "  unsupported differencing form: "
+                       << enum_to_string<ConvectiveDifferencingType>(d_difference_form)
+                       << " \n"
+                       << "  valid choices are: ADVECTIVE, CONSERVATIVE, SKEW_SYMMETRIC\n");
         }
     }
 
@@ -550,6 +550,20 @@ INSStaggeredHierarchyIntegrator::INSStaggeredHierarchyIntegrator(const std::stri
     if (input_db->keyExists("explicitly_remove_nullspace"))
         d_explicitly_remove_nullspace = input_db->getBool("explicitly_remove_nullspace");
 
+    // Flag to determine whether the structural data maintained by the solvers
+    // (e.g., DOF index maps, matrix sparsity patterns, subdomains, and transfer
+    // schedules) are reused when only the time step size or the fluid
+    // coefficients change.
+    d_reuse_solver_structure = false;
+    if (input_db->keyExists("reuse_solver_structure"))
+        d_reuse_solver_structure = input_db->getBool("reuse_solver_structure");
+    d_velocity_solver_needs_reinit = false;
+    d_pressure_solver_needs_reinit = false;
+    d_stokes_solver_needs_reinit = false;
+    d_solver_rho = std::numeric_limits<double>::quiet_NaN();
+    d_solver_mu = std::numeric_limits<double>::quiet_NaN();
+    d_solver_lambda = std::numeric_limits<double>::quiet_NaN();
+
     // Setup physical boundary conditions objects.
     d_bc_helper = new StaggeredStokesPhysicalBoundaryHelper();
     d_U_bc_coefs.resize(NDIM);
@@ -2310,13 +2324,30 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
     P_problem_coefs.setDConstant(rho == 0.0 ? -1.0 : -1.0 / rho);
 
     // Ensure that solver components are appropriately reinitialized when the
-    // time step size changes.
+    // time step size changes.  When solver structure reuse is enabled, changes
+    // in the time step size or in the fluid coefficients only require the
+    // numerical values used by the solvers to be refreshed.
     const bool dt_change = initial_time || !MathUtilities<double>::equalEps(dt, d_dt_previous[0]);
-    if (dt_change)
+    if (d_reuse_solver_structure && !initial_time)
+    {
+        const bool rho_change = !MathUtilities<double>::equalEps(rho, d_solver_rho);
+        const bool coefs_change = rho_change || !MathUtilities<double>::equalEps(mu, d_solver_mu) ||
+                                  !MathUtilities<double>::equalEps(lambda, d_solver_lambda);
+        if (dt_change || coefs_change)
+        {
+            d_velocity_solver_needs_reinit = true;
+            d_stokes_solver_needs_reinit = true;
+        }
+        if (rho_change) d_pressure_solver_needs_reinit = true;
+    }
+    else if (dt_change)
     {
         d_velocity_solver_needs_init = true;
         d_stokes_solver_needs_init = true;
     }
+    d_solver_rho = rho;
+    d_solver_mu = mu;
+    d_solver_lambda = lambda;
 
     // Setup solver vectors.
     const bool has_velocity_nullspace = d_normalize_velocity && MathUtilities<double>::equalEps(rho, 0.0);
@@ -2466,6 +2497,16 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
             }
             d_velocity_solver->initializeSolverState(*d_U_scratch_vec, *d_U_rhs_vec);
             d_velocity_solver_needs_init = false;
+            d_velocity_solver_needs_reinit = false;
+        }
+        else if (d_velocity_solver_needs_reinit)
+        {
+            if (d_enable_logging)
+                plog << d_object_name << "::preprocessIntegrateHierarchy(): refreshing "
+                                         "velocity subdomain solver"
+                     << std::endl;
+            d_velocity_solver->reinitializeSolverState(*d_U_scratch_vec, *d_U_rhs_vec);
+            d_velocity_solver_needs_reinit = false;
         }
     }
 
@@ -2489,6 +2530,16 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
             }
             d_pressure_solver->initializeSolverState(*d_P_scratch_vec, *d_P_rhs_vec);
             d_pressure_solver_needs_init = false;
+            d_pressure_solver_needs_reinit = false;
+        }
+        else if (d_pressure_solver_needs_reinit)
+        {
+            if (d_enable_logging)
+                plog << d_object_name << "::preprocessIntegrateHierarchy(): refreshing "
+                                         "pressure subdomain solver"
+                     << std::endl;
+            d_pressure_solver->reinitializeSolverState(*d_P_scratch_vec, *d_P_rhs_vec);
+            d_pressure_solver_needs_reinit = false;
         }
     }
 
@@ -2564,6 +2615,16 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
         }
         d_stokes_solver->initializeSolverState(*d_sol_vec, *d_rhs_vec);
         d_stokes_solver_needs_init = false;
+        d_stokes_solver_needs_reinit = false;
+    }
+    else if (d_stokes_solver_needs_reinit)
+    {
+        if (d_enable_logging)
+            plog << d_object_name << "::preprocessIntegrateHierarchy(): refreshing "
+                                     "incompressible Stokes solver"
+                 << std::endl;
+        d_stokes_solver->reinitializeSolverState(*d_sol_vec, *d_rhs_vec);
+        d_stokes_solver_needs_reinit = false;
     }
     return;
 } // reinitializeOperatorsAndSolvers
@@ -33,13 +33,14 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <stddef.h>
+#include <algorithm>
 #include <ostream>
 #include <string>
 #include <vector>
 
 #include "Box.h"
 #include "CartesianPatchGeometry.h"
-#include "FaceData.h"
+#include "FaceGeometry.h"
 #include "IBAMR_config.h"
 #include "Index.h"
 #include "IntVector.h"
@@ -457,6 +458,18 @@ namespace
 // Kamm).
 static const int GADVECTG = 4;
 
+// Number of side-centered work arrays used by the Godunov extrapolation.
+static const int NUM_WORK_ARRAYS = (NDIM == 2 ? 4 : 5);
+
+// Raw data needed to compute the convective derivative on a single patch.
+struct ConvectivePatchData
+{
+    CartesianPatchGeometry<NDIM>* patch_geom;
+    Box<NDIM> patch_box;
+    SideData<NDIM, double>* N_data;
+    SideData<NDIM, double>* U_data;
+};
+
 // Timers.
 static Timer* t_apply_convective_operator;
 static Timer* t_apply;
@@ -568,403 +581,442 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
     StaggeredStokesPhysicalBoundaryHelper::resetBcCoefObjects(d_bc_coefs, NULL);
     d_hier_bdry_fill->resetTransactionComponents(d_transaction_comps);
 
-    // Compute the convective derivative.
+    // Collect the data needed to compute the convective derivative on each
+    // patch.  SAMRAI smart pointers are not thread safe, so only raw pointers
+    // are handed to the threaded loop over patches below.
+    std::vector<ConvectivePatchData> patch_data;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+            Pointer<SideData<NDIM, double> > N_data = patch->getPatchData(N_idx);
+            Pointer<SideData<NDIM, double> > U_data = patch->getPatchData(d_U_scratch_idx);
+            ConvectivePatchData data;
+            data.patch_geom = patch_geom.getPointer();
+            data.patch_box = patch->getBox();
+            data.N_data = N_data.getPointer();
+            data.U_data = U_data.getPointer();
+            patch_data.push_back(data);
+        }
+    }
 
-            const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
-            const double* const dx = patch_geom->getDx();
+    // Compute the convective derivative.  The patches are independent, and the
+    // temporary face-centered velocities and extrapolation work arrays are
+    // carved out of scratch buffers owned by each thread, so the patches may be
+    // processed concurrently.
+    prepareThreadScratchBuffers();
+    const int num_patches = static_cast<int>(patch_data.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int k = 0; k < num_patches; ++k)
+    {
+        CartesianPatchGeometry<NDIM>* const patch_geom = patch_data[k].patch_geom;
+        const double* const dx = patch_geom->getDx();
 
-            const Box<NDIM>& patch_box = patch->getBox();
-            const IntVector<NDIM>& patch_lower = patch_box.lower();
-            const IntVector<NDIM>& patch_upper = patch_box.upper();
+        const Box<NDIM>& patch_box = patch_data[k].patch_box;
+        const IntVector<NDIM>& patch_lower = patch_box.lower();
+        const IntVector<NDIM>& patch_upper = patch_box.upper();
 
-            Pointer<SideData<NDIM, double> > N_data = patch->getPatchData(N_idx);
-            Pointer<SideData<NDIM, double> > U_data = patch->getPatchData(d_U_scratch_idx);
+        SideData<NDIM, double>* const N_data = patch_data[k].N_data;
+        SideData<NDIM, double>* const U_data = patch_data[k].U_data;
 
-            const IntVector<NDIM> ghosts = IntVector<NDIM>(1);
-            boost::array<Box<NDIM>, NDIM> side_boxes;
-            boost::array<Pointer<FaceData<NDIM, double> >, NDIM> U_adv_data;
-            boost::array<Pointer<FaceData<NDIM, double> >, NDIM> U_half_data;
-            for (unsigned int axis = 0; axis < NDIM; ++axis)
+        // Lay out the temporary data in the scratch buffer of this thread.
+        const IntVector<NDIM> ghosts = IntVector<NDIM>(1);
+        const Box<NDIM> U_ghost_box = Box<NDIM>::grow(patch_box, U_data->getGhostCellWidth());
+        boost::array<Box<NDIM>, NDIM> side_boxes;
+        boost::array<boost::array<Box<NDIM>, NDIM>, NDIM> face_boxes;
+        size_t face_size = 0;
+        size_t work_size = 0;
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            side_boxes[axis] = SideGeometry<NDIM>::toSideBox(patch_box, axis);
+            for (unsigned int d = 0; d < NDIM; ++d)
             {
-                side_boxes[axis] = SideGeometry<NDIM>::toSideBox(patch_box, axis);
-                U_adv_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
-                U_half_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
+                face_boxes[axis][d] = FaceGeometry<NDIM>::toFaceBox(Box<NDIM>::grow(side_boxes[axis], ghosts), d);
+                face_size += face_boxes[axis][d].size();
             }
-#if (NDIM == 2)
-            NAVIER_STOKES_INTERP_COMPS_FC(patch_lower(0),
-                                          patch_upper(0),
-                                          patch_lower(1),
-                                          patch_upper(1),
-                                          U_data->getGhostCellWidth()(0),
-                                          U_data->getGhostCellWidth()(1),
-                                          U_data->getPointer(0),
-                                          U_data->getPointer(1),
-                                          side_boxes[0].lower(0),
-                                          side_boxes[0].upper(0),
-                                          side_boxes[0].lower(1),
-                                          side_boxes[0].upper(1),
-                                          U_adv_data[0]->getGhostCellWidth()(0),
-                                          U_adv_data[0]->getGhostCellWidth()(1),
-                                          U_adv_data[0]->getPointer(0),
-                                          U_adv_data[0]->getPointer(1),
-                                          side_boxes[1].lower(0),
-                                          side_boxes[1].upper(0),
-                                          side_boxes[1].lower(1),
-                                          side_boxes[1].upper(1),
-                                          U_adv_data[1]->getGhostCellWidth()(0),
-                                          U_adv_data[1]->getGhostCellWidth()(1),
-                                          U_adv_data[1]->getPointer(0),
-                                          U_adv_data[1]->getPointer(1));
-#endif
+            const size_t U_size = SideGeometry<NDIM>::toSideBox(U_ghost_box, axis).size();
+            work_size = std::max(work_size, U_size);
+        }
+        double* scratch = getThreadScratchBuffer(2 * face_size + NUM_WORK_ARRAYS * work_size);
+        boost::array<boost::array<double*, NDIM>, NDIM> U_adv, U_half;
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                U_adv[axis][d] = scratch;
+                scratch += face_boxes[axis][d].size();
+                U_half[axis][d] = scratch;
+                scratch += face_boxes[axis][d].size();
+            }
+        }
+        double* const dU = scratch;
+        double* const U_L = dU + work_size;
+        double* const U_R = U_L + work_size;
+        double* const U_scratch1 = U_R + work_size;
 #if (NDIM == 3)
-            NAVIER_STOKES_INTERP_COMPS_FC(patch_lower(0),
-                                          patch_upper(0),
-                                          patch_lower(1),
-                                          patch_upper(1),
-                                          patch_lower(2),
-                                          patch_upper(2),
-                                          U_data->getGhostCellWidth()(0),
-                                          U_data->getGhostCellWidth()(1),
-                                          U_data->getGhostCellWidth()(2),
-                                          U_data->getPointer(0),
-                                          U_data->getPointer(1),
-                                          U_data->getPointer(2),
-                                          side_boxes[0].lower(0),
-                                          side_boxes[0].upper(0),
-                                          side_boxes[0].lower(1),
-                                          side_boxes[0].upper(1),
-                                          side_boxes[0].lower(2),
-                                          side_boxes[0].upper(2),
-                                          U_adv_data[0]->getGhostCellWidth()(0),
-                                          U_adv_data[0]->getGhostCellWidth()(1),
-                                          U_adv_data[0]->getGhostCellWidth()(2),
-                                          U_adv_data[0]->getPointer(0),
-                                          U_adv_data[0]->getPointer(1),
-                                          U_adv_data[0]->getPointer(2),
-                                          side_boxes[1].lower(0),
-                                          side_boxes[1].upper(0),
-                                          side_boxes[1].lower(1),
-                                          side_boxes[1].upper(1),
-                                          side_boxes[1].lower(2),
-                                          side_boxes[1].upper(2),
-                                          U_adv_data[1]->getGhostCellWidth()(0),
-                                          U_adv_data[1]->getGhostCellWidth()(1),
-                                          U_adv_data[1]->getGhostCellWidth()(2),
-                                          U_adv_data[1]->getPointer(0),
-                                          U_adv_data[1]->getPointer(1),
-                                          U_adv_data[1]->getPointer(2),
-                                          side_boxes[2].lower(0),
-                                          side_boxes[2].upper(0),
-                                          side_boxes[2].lower(1),
-                                          side_boxes[2].upper(1),
-                                          side_boxes[2].lower(2),
-                                          side_boxes[2].upper(2),
-                                          U_adv_data[2]->getGhostCellWidth()(0),
-                                          U_adv_data[2]->getGhostCellWidth()(1),
-                                          U_adv_data[2]->getGhostCellWidth()(2),
-                                          U_adv_data[2]->getPointer(0),
-                                          U_adv_data[2]->getPointer(1),
-                                          U_adv_data[2]->getPointer(2));
+        double* const U_scratch2 = U_scratch1 + work_size;
+#endif
+#if (NDIM == 2)
+        NAVIER_STOKES_INTERP_COMPS_FC(patch_lower(0),
+                                      patch_upper(0),
+                                      patch_lower(1),
+                                      patch_upper(1),
+                                      U_data->getGhostCellWidth()(0),
+                                      U_data->getGhostCellWidth()(1),
+                                      U_data->getPointer(0),
+                                      U_data->getPointer(1),
+                                      side_boxes[0].lower(0),
+                                      side_boxes[0].upper(0),
+                                      side_boxes[0].lower(1),
+                                      side_boxes[0].upper(1),
+                                      ghosts(0),
+                                      ghosts(1),
+                                      U_adv[0][0],
+                                      U_adv[0][1],
+                                      side_boxes[1].lower(0),
+                                      side_boxes[1].upper(0),
+                                      side_boxes[1].lower(1),
+                                      side_boxes[1].upper(1),
+                                      ghosts(0),
+                                      ghosts(1),
+                                      U_adv[1][0],
+                                      U_adv[1][1]);
 #endif
-            for (unsigned int axis = 0; axis < NDIM; ++axis)
-            {
-                Pointer<SideData<NDIM, double> > dU_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_L_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_R_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_scratch1_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
 #if (NDIM == 3)
-                Pointer<SideData<NDIM, double> > U_scratch2_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
+        NAVIER_STOKES_INTERP_COMPS_FC(patch_lower(0),
+                                      patch_upper(0),
+                                      patch_lower(1),
+                                      patch_upper(1),
+                                      patch_lower(2),
+                                      patch_upper(2),
+                                      U_data->getGhostCellWidth()(0),
+                                      U_data->getGhostCellWidth()(1),
+                                      U_data->getGhostCellWidth()(2),
+                                      U_data->getPointer(0),
+                                      U_data->getPointer(1),
+                                      U_data->getPointer(2),
+                                      side_boxes[0].lower(0),
+                                      side_boxes[0].upper(0),
+                                      side_boxes[0].lower(1),
+                                      side_boxes[0].upper(1),
+                                      side_boxes[0].lower(2),
+                                      side_boxes[0].upper(2),
+                                      ghosts(0),
+                                      ghosts(1),
+                                      ghosts(2),
+                                      U_adv[0][0],
+                                      U_adv[0][1],
+                                      U_adv[0][2],
+                                      side_boxes[1].lower(0),
+                                      side_boxes[1].upper(0),
+                                      side_boxes[1].lower(1),
+                                      side_boxes[1].upper(1),
+                                      side_boxes[1].lower(2),
+                                      side_boxes[1].upper(2),
+                                      ghosts(0),
+                                      ghosts(1),
+                                      ghosts(2),
+                                      U_adv[1][0],
+                                      U_adv[1][1],
+                                      U_adv[1][2],
+                                      side_boxes[2].lower(0),
+                                      side_boxes[2].upper(0),
+                                      side_boxes[2].lower(1),
+                                      side_boxes[2].upper(1),
+                                      side_boxes[2].lower(2),
+                                      side_boxes[2].upper(2),
+                                      ghosts(0),
+                                      ghosts(1),
+                                      ghosts(2),
+                                      U_adv[2][0],
+                                      U_adv[2][1],
+                                      U_adv[2][2]);
 #endif
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
 #if (NDIM == 2)
-                GODUNOV_EXTRAPOLATE_FC(side_boxes[axis].lower(0),
-                                       side_boxes[axis].upper(0),
-                                       side_boxes[axis].lower(1),
-                                       side_boxes[axis].upper(1),
-                                       U_data->getGhostCellWidth()(0),
-                                       U_data->getGhostCellWidth()(1),
-                                       U_data->getPointer(axis),
-                                       U_scratch1_data->getPointer(axis),
-                                       dU_data->getPointer(axis),
-                                       U_L_data->getPointer(axis),
-                                       U_R_data->getPointer(axis),
-                                       U_adv_data[axis]->getGhostCellWidth()(0),
-                                       U_adv_data[axis]->getGhostCellWidth()(1),
-                                       U_half_data[axis]->getGhostCellWidth()(0),
-                                       U_half_data[axis]->getGhostCellWidth()(1),
-                                       U_adv_data[axis]->getPointer(0),
-                                       U_adv_data[axis]->getPointer(1),
-                                       U_half_data[axis]->getPointer(0),
-                                       U_half_data[axis]->getPointer(1));
+            GODUNOV_EXTRAPOLATE_FC(side_boxes[axis].lower(0),
+                                   side_boxes[axis].upper(0),
+                                   side_boxes[axis].lower(1),
+                                   side_boxes[axis].upper(1),
+                                   U_data->getGhostCellWidth()(0),
+                                   U_data->getGhostCellWidth()(1),
+                                   U_data->getPointer(axis),
+                                   U_scratch1,
+                                   dU,
+                                   U_L,
+                                   U_R,
+                                   ghosts(0),
+                                   ghosts(1),
+                                   ghosts(0),
+                                   ghosts(1),
+                                   U_adv[axis][0],
+                                   U_adv[axis][1],
+                                   U_half[axis][0],
+                                   U_half[axis][1]);
 #endif
 #if (NDIM == 3)
-                GODUNOV_EXTRAPOLATE_FC(side_boxes[axis].lower(0),
-                                       side_boxes[axis].upper(0),
-                                       side_boxes[axis].lower(1),
-                                       side_boxes[axis].upper(1),
-                                       side_boxes[axis].lower(2),
-                                       side_boxes[axis].upper(2),
-                                       U_data->getGhostCellWidth()(0),
-                                       U_data->getGhostCellWidth()(1),
-                                       U_data->getGhostCellWidth()(2),
-                                       U_data->getPointer(axis),
-                                       U_scratch1_data->getPointer(axis),
-                                       U_scratch2_data->getPointer(axis),
-                                       dU_data->getPointer(axis),
-                                       U_L_data->getPointer(axis),
-                                       U_R_data->getPointer(axis),
-                                       U_adv_data[axis]->getGhostCellWidth()(0),
-                                       U_adv_data[axis]->getGhostCellWidth()(1),
-                                       U_adv_data[axis]->getGhostCellWidth()(2),
-                                       U_half_data[axis]->getGhostCellWidth()(0),
-                                       U_half_data[axis]->getGhostCellWidth()(1),
-                                       U_half_data[axis]->getGhostCellWidth()(2),
-                                       U_adv_data[axis]->getPointer(0),
-                                       U_adv_data[axis]->getPointer(1),
-                                       U_adv_data[axis]->getPointer(2),
-                                       U_half_data[axis]->getPointer(0),
-                                       U_half_data[axis]->getPointer(1),
-                                       U_half_data[axis]->getPointer(2));
+            GODUNOV_EXTRAPOLATE_FC(side_boxes[axis].lower(0),
+                                   side_boxes[axis].upper(0),
+                                   side_boxes[axis].lower(1),
+                                   side_boxes[axis].upper(1),
+                                   side_boxes[axis].lower(2),
+                                   side_boxes[axis].upper(2),
+                                   U_data->getGhostCellWidth()(0),
+                                   U_data->getGhostCellWidth()(1),
+                                   U_data->getGhostCellWidth()(2),
+                                   U_data->getPointer(axis),
+                                   U_scratch1,
+                                   U_scratch2,
+                                   dU,
+                                   U_L,
+                                   U_R,
+                                   ghosts(0),
+                                   ghosts(1),
+                                   ghosts(2),
+                                   ghosts(0),
+                                   ghosts(1),
+                                   ghosts(2),
+                                   U_adv[axis][0],
+                                   U_adv[axis][1],
+                                   U_adv[axis][2],
+                                   U_half[axis][0],
+                                   U_half[axis][1],
+                                   U_half[axis][2]);
 #endif
-            }
+        }
 #if (NDIM == 2)
-            NAVIER_STOKES_RESET_ADV_VELOCITY_FC(side_boxes[0].lower(0),
-                                                side_boxes[0].upper(0),
-                                                side_boxes[0].lower(1),
-                                                side_boxes[0].upper(1),
-                                                U_adv_data[0]->getGhostCellWidth()(0),
-                                                U_adv_data[0]->getGhostCellWidth()(1),
-                                                U_adv_data[0]->getPointer(0),
-                                                U_adv_data[0]->getPointer(1),
-                                                U_half_data[0]->getGhostCellWidth()(0),
-                                                U_half_data[0]->getGhostCellWidth()(1),
-                                                U_half_data[0]->getPointer(0),
-                                                U_half_data[0]->getPointer(1),
-                                                side_boxes[1].lower(0),
-                                                side_boxes[1].upper(0),
-                                                side_boxes[1].lower(1),
-                                                side_boxes[1].upper(1),
-                                                U_adv_data[1]->getGhostCellWidth()(0),
-                                                U_adv_data[1]->getGhostCellWidth()(1),
-                                                U_adv_data[1]->getPointer(0),
-                                                U_adv_data[1]->getPointer(1),
-                                                U_half_data[1]->getGhostCellWidth()(0),
-                                                U_half_data[1]->getGhostCellWidth()(1),
-                                                U_half_data[1]->getPointer(0),
-                                                U_half_data[1]->getPointer(1));
+        NAVIER_STOKES_RESET_ADV_VELOCITY_FC(side_boxes[0].lower(0),
+                                            side_boxes[0].upper(0),
+                                            side_boxes[0].lower(1),
+                                            side_boxes[0].upper(1),
+                                            ghosts(0),
+                                            ghosts(1),
+                                            U_adv[0][0],
+                                            U_adv[0][1],
+                                            ghosts(0),
+                                            ghosts(1),
+                                            U_half[0][0],
+                                            U_half[0][1],
+                                            side_boxes[1].lower(0),
+                                            side_boxes[1].upper(0),
+                                            side_boxes[1].lower(1),
+                                            side_boxes[1].upper(1),
+                                            ghosts(0),
+                                            ghosts(1),
+                                            U_adv[1][0],
+                                            U_adv[1][1],
+                                            ghosts(0),
+                                            ghosts(1),
+                                            U_half[1][0],
+                                            U_half[1][1]);
 #endif
 #if (NDIM == 3)
-            NAVIER_STOKES_RESET_ADV_VELOCITY_FC(side_boxes[0].lower(0),
-                                                side_boxes[0].upper(0),
-                                                side_boxes[0].lower(1),
-                                                side_boxes[0].upper(1),
-                                                side_boxes[0].lower(2),
-                                                side_boxes[0].upper(2),
-                                                U_adv_data[0]->getGhostCellWidth()(0),
-                                                U_adv_data[0]->getGhostCellWidth()(1),
-                                                U_adv_data[0]->getGhostCellWidth()(2),
-                                                U_adv_data[0]->getPointer(0),
-                                                U_adv_data[0]->getPointer(1),
-                                                U_adv_data[0]->getPointer(2),
-                                                U_half_data[0]->getGhostCellWidth()(0),
-                                                U_half_data[0]->getGhostCellWidth()(1),
-                                                U_half_data[0]->getGhostCellWidth()(2),
-                                                U_half_data[0]->getPointer(0),
-                                                U_half_data[0]->getPointer(1),
-                                                U_half_data[0]->getPointer(2),
-                                                side_boxes[1].lower(0),
-                                                side_boxes[1].upper(0),
-                                                side_boxes[1].lower(1),
-                                                side_boxes[1].upper(1),
-                                                side_boxes[1].lower(2),
-                                                side_boxes[1].upper(2),
-                                                U_adv_data[1]->getGhostCellWidth()(0),
-                                                U_adv_data[1]->getGhostCellWidth()(1),
-                                                U_adv_data[1]->getGhostCellWidth()(2),
-                                                U_adv_data[1]->getPointer(0),
-                                                U_adv_data[1]->getPointer(1),
-                                                U_adv_data[1]->getPointer(2),
-                                                U_half_data[1]->getGhostCellWidth()(0),
-                                                U_half_data[1]->getGhostCellWidth()(1),
-                                                U_half_data[1]->getGhostCellWidth()(2),
-                                                U_half_data[1]->getPointer(0),
-                                                U_half_data[1]->getPointer(1),
-                                                U_half_data[1]->getPointer(2),
-                                                side_boxes[2].lower(0),
-                                                side_boxes[2].upper(0),
-                                                side_boxes[2].lower(1),
-                                                side_boxes[2].upper(1),
-                                                side_boxes[2].lower(2),
-                                                side_boxes[2].upper(2),
-                                                U_adv_data[2]->getGhostCellWidth()(0),
-                                                U_adv_data[2]->getGhostCellWidth()(1),
-                                                U_adv_data[2]->getGhostCellWidth()(2),
-                                                U_adv_data[2]->getPointer(0),
-                                                U_adv_data[2]->getPointer(1),
-                                                U_adv_data[2]->getPointer(2),
-                                                U_half_data[2]->getGhostCellWidth()(0),
-                                                U_half_data[2]->getGhostCellWidth()(1),
-                                                U_half_data[2]->getGhostCellWidth()(2),
-                                                U_half_data[2]->getPointer(0),
-                                                U_half_data[2]->getPointer(1),
-                                                U_half_data[2]->getPointer(2));
+        NAVIER_STOKES_RESET_ADV_VELOCITY_FC(side_boxes[0].lower(0),
+                                            side_boxes[0].upper(0),
+                                            side_boxes[0].lower(1),
+                                            side_boxes[0].upper(1),
+                                            side_boxes[0].lower(2),
+                                            side_boxes[0].upper(2),
+                                            ghosts(0),
+                                            ghosts(1),
+                                            ghosts(2),
+                                            U_adv[0][0],
+                                            U_adv[0][1],
+                                            U_adv[0][2],
+                                            ghosts(0),
+                                            ghosts(1),
+                                            ghosts(2),
+                                            U_half[0][0],
+                                            U_half[0][1],
+                                            U_half[0][2],
+                                            side_boxes[1].lower(0),
+                                            side_boxes[1].upper(0),
+                                            side_boxes[1].lower(1),
+                                            side_boxes[1].upper(1),
+                                            side_boxes[1].lower(2),
+                                            side_boxes[1].upper(2),
+                                            ghosts(0),
+                                            ghosts(1),
+                                            ghosts(2),
+                                            U_adv[1][0],
+                                            U_adv[1][1],
+                                            U_adv[1][2],
+                                            ghosts(0),
+                                            ghosts(1),
+                                            ghosts(2),
+                                            U_half[1][0],
+                                            U_half[1][1],
+                                            U_half[1][2],
+                                            side_boxes[2].lower(0),
+                                            side_boxes[2].upper(0),
+                                            side_boxes[2].lower(1),
+                                            side_boxes[2].upper(1),
+                                            side_boxes[2].lower(2),
+                                            side_boxes[2].upper(2),
+                                            ghosts(0),
+                                            ghosts(1),
+                                            ghosts(2),
+                                            U_adv[2][0],
+                                            U_adv[2][1],
+                                            U_adv[2][2],
+                                            ghosts(0),
+                                            ghosts(1),
+                                            ghosts(2),
+                                            U_half[2][0],
+                                            U_half[2][1],
+                                            U_half[2][2]);
 #endif
-            for (unsigned int axis = 0; axis < NDIM; ++axis)
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            switch (d_difference_form)
             {
-                switch (d_difference_form)
-                {
-                case CONSERVATIVE:
+            case CONSERVATIVE:
 #if (NDIM == 2)
-                    CONVECT_DERIVATIVE_FC(dx,
-                                          side_boxes[axis].lower(0),
-                                          side_boxes[axis].upper(0),
-                                          side_boxes[axis].lower(1),
-                                          side_boxes[axis].upper(1),
-                                          U_adv_data[axis]->getGhostCellWidth()(0),
-                                          U_adv_data[axis]->getGhostCellWidth()(1),
-                                          U_half_data[axis]->getGhostCellWidth()(0),
-                                          U_half_data[axis]->getGhostCellWidth()(1),
-                                          U_adv_data[axis]->getPointer(0),
-                                          U_adv_data[axis]->getPointer(1),
-                                          U_half_data[axis]->getPointer(0),
-                                          U_half_data[axis]->getPointer(1),
-                                          N_data->getGhostCellWidth()(0),
-                                          N_data->getGhostCellWidth()(1),
-                                          N_data->getPointer(axis));
+                CONVECT_DERIVATIVE_FC(dx,
+                                      side_boxes[axis].lower(0),
+                                      side_boxes[axis].upper(0),
+                                      side_boxes[axis].lower(1),
+                                      side_boxes[axis].upper(1),
+                                      ghosts(0),
+                                      ghosts(1),
+                                      ghosts(0),
+                                      ghosts(1),
+                                      U_adv[axis][0],
+                                      U_adv[axis][1],
+                                      U_half[axis][0],
+                                      U_half[axis][1],
+                                      N_data->getGhostCellWidth()(0),
+                                      N_data->getGhostCellWidth()(1),
+                                      N_data->getPointer(axis));
 #endif
 #if (NDIM == 3)
-                    CONVECT_DERIVATIVE_FC(dx,
-                                          side_boxes[axis].lower(0),
-                                          side_boxes[axis].upper(0),
-                                          side_boxes[axis].lower(1),
-                                          side_boxes[axis].upper(1),
-                                          side_boxes[axis].lower(2),
-                                          side_boxes[axis].upper(2),
-                                          U_adv_data[axis]->getGhostCellWidth()(0),
-                                          U_adv_data[axis]->getGhostCellWidth()(1),
-                                          U_adv_data[axis]->getGhostCellWidth()(2),
-                                          U_half_data[axis]->getGhostCellWidth()(0),
-                                          U_half_data[axis]->getGhostCellWidth()(1),
-                                          U_half_data[axis]->getGhostCellWidth()(2),
-                                          U_adv_data[axis]->getPointer(0),
-                                          U_adv_data[axis]->getPointer(1),
-                                          U_adv_data[axis]->getPointer(2),
-                                          U_half_data[axis]->getPointer(0),
-                                          U_half_data[axis]->getPointer(1),
-                                          U_half_data[axis]->getPointer(2),
-                                          N_data->getGhostCellWidth()(0),
-                                          N_data->getGhostCellWidth()(1),
-                                          N_data->getGhostCellWidth()(2),
-                                          N_data->getPointer(axis));
+                CONVECT_DERIVATIVE_FC(dx,
+                                      side_boxes[axis].lower(0),
+                                      side_boxes[axis].upper(0),
+                                      side_boxes[axis].lower(1),
+                                      side_boxes[axis].upper(1),
+                                      side_boxes[axis].lower(2),
+                                      side_boxes[axis].upper(2),
+                                      ghosts(0),
+                                      ghosts(1),
+                                      ghosts(2),
+                                      ghosts(0),
+                                      ghosts(1),
+                                      ghosts(2),
+                                      U_adv[axis][0],
+                                      U_adv[axis][1],
+                                      U_adv[axis][2],
+                                      U_half[axis][0],
+                                      U_half[axis][1],
+                                      U_half[axis][2],
+                                      N_data->getGhostCellWidth()(0),
+                                      N_data->getGhostCellWidth()(1),
+                                      N_data->getGhostCellWidth()(2),
+                                      N_data->getPointer(axis));
 #endif
-                    break;
-                case ADVECTIVE:
+                break;
+            case ADVECTIVE:
 #if (NDIM == 2)
-                    ADVECT_DERIVATIVE_FC(dx,
-                                         side_boxes[axis].lower(0),
-                                         side_boxes[axis].upper(0),
-                                         side_boxes[axis].lower(1),
-                                         side_boxes[axis].upper(1),
-                                         U_adv_data[axis]->getGhostCellWidth()(0),
-                                         U_adv_data[axis]->getGhostCellWidth()(1),
-                                         U_half_data[axis]->getGhostCellWidth()(0),
-                                         U_half_data[axis]->getGhostCellWidth()(1),
-                                         U_adv_data[axis]->getPointer(0),
-                                         U_adv_data[axis]->getPointer(1),
-                                         U_half_data[axis]->getPointer(0),
-                                         U_half_data[axis]->getPointer(1),
-                                         N_data->getGhostCellWidth()(0),
-                                         N_data->getGhostCellWidth()(1),
-                                         N_data->getPointer(axis));
+                ADVECT_DERIVATIVE_FC(dx,
+                                     side_boxes[axis].lower(0),
+                                     side_boxes[axis].upper(0),
+                                     side_boxes[axis].lower(1),
+                                     side_boxes[axis].upper(1),
+                                     ghosts(0),
+                                     ghosts(1),
+                                     ghosts(0),
+                                     ghosts(1),
+                                     U_adv[axis][0],
+                                     U_adv[axis][1],
+                                     U_half[axis][0],
+                                     U_half[axis][1],
+                                     N_data->getGhostCellWidth()(0),
+                                     N_data->getGhostCellWidth()(1),
+                                     N_data->getPointer(axis));
 #endif
 #if (NDIM == 3)
-                    ADVECT_DERIVATIVE_FC(dx,
-                                         side_boxes[axis].lower(0),
-                                         side_boxes[axis].upper(0),
-                                         side_boxes[axis].lower(1),
-                                         side_boxes[axis].upper(1),
-                                         side_boxes[axis].lower(2),
-                                         side_boxes[axis].upper(2),
-                                         U_adv_data[axis]->getGhostCellWidth()(0),
-                                         U_adv_data[axis]->getGhostCellWidth()(1),
-                                         U_adv_data[axis]->getGhostCellWidth()(2),
-                                         U_half_data[axis]->getGhostCellWidth()(0),
-                                         U_half_data[axis]->getGhostCellWidth()(1),
-                                         U_half_data[axis]->getGhostCellWidth()(2),
-                                         U_adv_data[axis]->getPointer(0),
-                                         U_adv_data[axis]->getPointer(1),
-                                         U_adv_data[axis]->getPointer(2),
-                                         U_half_data[axis]->getPointer(0),
-                                         U_half_data[axis]->getPointer(1),
-                                         U_half_data[axis]->getPointer(2),
-                                         N_data->getGhostCellWidth()(0),
-                                         N_data->getGhostCellWidth()(1),
-                                         N_data->getGhostCellWidth()(2),
-                                         N_data->getPointer(axis));
+                ADVECT_DERIVATIVE_FC(dx,
+                                     side_boxes[axis].lower(0),
+                                     side_boxes[axis].upper(0),
+                                     side_boxes[axis].lower(1),
+                                     side_boxes[axis].upper(1),
+                                     side_boxes[axis].lower(2),
+                                     side_boxes[axis].upper(2),
+                                     ghosts(0),
+                                     ghosts(1),
+                                     ghosts(2),
+                                     ghosts(0),
+                                     ghosts(1),
+                                     ghosts(2),
+                                     U_adv[axis][0],
+                                     U_adv[axis][1],
+                                     U_adv[axis][2],
+                                     U_half[axis][0],
+                                     U_half[axis][1],
+                                     U_half[axis][2],
+                                     N_data->getGhostCellWidth()(0),
+                                     N_data->getGhostCellWidth()(1),
+                                     N_data->getGhostCellWidth()(2),
+                                     N_data->getPointer(axis));
 #endif
-                    break;
-                case SKEW_SYMMETRIC:
+                break;
+            case SKEW_SYMMETRIC:
 #if (NDIM == 2)
-                    SKEW_SYM_DERIVATIVE_FC(dx,
-                                           side_boxes[axis].lower(0),
-                                           side_boxes[axis].upper(0),
-                                           side_boxes[axis].lower(1),
-                                           side_boxes[axis].upper(1),
-                                           U_adv_data[axis]->getGhostCellWidth()(0),
-                                           U_adv_data[axis]->getGhostCellWidth()(1),
-                                           U_half_data[axis]->getGhostCellWidth()(0),
-                                           U_half_data[axis]->getGhostCellWidth()(1),
-                                           U_adv_data[axis]->getPointer(0),
-                                           U_adv_data[axis]->getPointer(1),
-                                           U_half_data[axis]->getPointer(0),
-                                           U_half_data[axis]->getPointer(1),
-                                           N_data->getGhostCellWidth()(0),
-                                           N_data->getGhostCellWidth()(1),
-                                           N_data->getPointer(axis));
+                SKEW_SYM_DERIVATIVE_FC(dx,
+                                       side_boxes[axis].lower(0),
+                                       side_boxes[axis].upper(0),
+                                       side_boxes[axis].lower(1),
+                                       side_boxes[axis].upper(1),
+                                       ghosts(0),
+                                       ghosts(1),
+                                       ghosts(0),
+                                       ghosts(1),
+                                       U_adv[axis][0],
+                                       U_adv[axis][1],
+                                       U_half[axis][0],
+                                       U_half[axis][1],
+                                       N_data->getGhostCellWidth()(0),
+                                       N_data->getGhostCellWidth()(1),
+                                       N_data->getPointer(axis));
 #endif
 #if (NDIM == 3)
-                    SKEW_SYM_DERIVATIVE_FC(dx,
-                                           side_boxes[axis].lower(0),
-                                           side_boxes[axis].upper(0),
-                                           side_boxes[axis].lower(1),
-                                           side_boxes[axis].upper(1),
-                                           side_boxes[axis].lower(2),
-                                           side_boxes[axis].upper(2),
-                                           U_adv_data[axis]->getGhostCellWidth()(0),
-                                           U_adv_data[axis]->getGhostCellWidth()(1),
-                                           U_adv_data[axis]->getGhostCellWidth()(2),
-                                           U_half_data[axis]->getGhostCellWidth()(0),
-                                           U_half_data[axis]->getGhostCellWidth()(1),
-                                           U_half_data[axis]->getGhostCellWidth()(2),
-                                           U_adv_data[axis]->getPointer(0),
-                                           U_adv_data[axis]->getPointer(1),
-                                           U_adv_data[axis]->getPointer(2),
-                                           U_half_data[axis]->getPointer(0),
-                                           U_half_data[axis]->getPointer(1),
-                                           U_half_data[axis]->getPointer(2),
-                                           N_data->getGhostCellWidth()(0),
-                                           N_data->getGhostCellWidth()(1),
-                                           N_data->getGhostCellWidth()(2),
-                                           N_data->getPointer(axis));
+                SKEW_SYM_DERIVATIVE_FC(dx,
+                                       side_boxes[axis].lower(0),
+                                       side_boxes[axis].upper(0),
+                                       side_boxes[axis].lower(1),
+                                       side_boxes[axis].upper(1),
+                                       side_boxes[axis].lower(2),
+                                       side_boxes[axis].upper(2),
+                                       ghosts(0),
+                                       ghosts(1),
+                                       ghosts(2),
+                                       ghosts(0),
+                                       ghosts(1),
+                                       ghosts(2),
+                                       U_adv[axis][0],
+                                       U_adv[axis][1],
+                                       U_adv[axis][2],
+                                       U_half[axis][0],
+                                       U_half[axis][1],
+                                       U_half[axis][2],
+                                       N_data->getGhostCellWidth()(0),
+                                       N_data->getGhostCellWidth()(1),
+                                       N_data->getGhostCellWidth()(2),
+                                       N_data->getPointer(axis));
 #endif
-                    break;
-                default:
-                    TBOX_ERROR("INSStaggeredPPMConvectiveOperator::applyConvectiveOperator():\n"
-                               << "  unsupported differencing form: "
-                               << enum_to_string<ConvectiveDifferencingType>(d_difference_form)
-                               << " \n"
-                               << "  valid choices are: ADVECTIVE, CONSERVATIVE, SKEW_SYMMETRIC\n");
-                }
+                break;
+            default:
+                TBOX_ERROR("INSStaggeredPPMConvectiveOperator::applyConvectiveOperator():\n"
+                           << "  unsupported differencing form: "
+                           << enum_to_string<ConvectiveDifferencingType>(d_difference_form)
+                           << " \n"
+                           << "  valid choices are: ADVECTIVE, CONSERVATIVE, SKEW_SYMMETRIC\n");
             }
         }
     }
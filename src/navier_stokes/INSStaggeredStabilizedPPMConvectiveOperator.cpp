@@ -33,6 +33,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <stddef.h>
+#include <algorithm>
 #include <cmath>
 #include <ostream>
 #include <string>
@@ -42,7 +43,7 @@
 #include "Box.h"
 #include "BoxArray.h"
 #include "CartesianPatchGeometry.h"
-#include "FaceData.h"
+#include "FaceGeometry.h"
 #include "FaceIndex.h"
 #include "FaceIterator.h"
 #include "GridGeometry.h"
@@ -471,6 +472,19 @@ smooth_kernel(const double r)
     return std::abs(r) < 1.0 ? 0.5 * (cos(M_PI * r) + 1.0) : 0.0;
 } // smooth_kernel
 
+// Number of side-centered work arrays used by the Godunov extrapolation.
+static const int NUM_WORK_ARRAYS = (NDIM == 2 ? 4 : 5);
+
+// Raw data needed to compute the convective derivative on a single patch.
+struct ConvectivePatchData
+{
+    CartesianPatchGeometry<NDIM>* patch_geom;
+    Box<NDIM> patch_box;
+    Box<NDIM> domain_box;
+    SideData<NDIM, double>* N_data;
+    SideData<NDIM, double>* U_data;
+};
+
 // Timers.
 static Timer* t_apply_convective_operator;
 static Timer* t_apply;
@@ -607,8 +621,30 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
     StaggeredStokesPhysicalBoundaryHelper::resetBcCoefObjects(d_bc_coefs, NULL);
     d_hier_bdry_fill->resetTransactionComponents(d_transaction_comps);
 
-    // Compute the convective derivative.
+    // Determine how the low-order and high-order discretizations are blended
+    // together at physical boundaries.
+    bool use_upwind_differencing_at_bdry = false;
+    if (d_stabilization_type == "UPWIND")
+    {
+        use_upwind_differencing_at_bdry = true;
+    }
+    else if (d_stabilization_type == "VISCOUS_ONLY")
+    {
+        use_upwind_differencing_at_bdry = false;
+    }
+    else
+    {
+        TBOX_ERROR("INSStaggeredStabilizedPPMConvectiveOperator: unrecognized value for stabilization_type, "
+                   << d_stabilization_type
+                   << "\n"
+                   << "  recognized choices are UPWIND, VISCOUS_ONLY\n");
+    }
+
+    // Collect the data needed to compute the convective derivative on each
+    // patch.  SAMRAI smart pointers are not thread safe, so only raw pointers
+    // are handed to the threaded loop over patches below.
     Pointer<GridGeometry<NDIM> > grid_geometry = d_hierarchy->getGridGeometry();
+    std::vector<ConvectivePatchData> patch_data;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
@@ -617,432 +653,206 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+            Pointer<SideData<NDIM, double> > N_data = patch->getPatchData(N_idx);
+            Pointer<SideData<NDIM, double> > U_data = patch->getPatchData(d_U_scratch_idx);
+#if !defined(NDEBUG)
+            TBOX_ASSERT(N_data->getDepth() == 1);
+#endif
+            ConvectivePatchData data;
+            data.patch_geom = patch_geom.getPointer();
+            data.patch_box = patch->getBox();
+            data.domain_box = domain_box;
+            data.N_data = N_data.getPointer();
+            data.U_data = U_data.getPointer();
+            patch_data.push_back(data);
+        }
+    }
 
-            const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
-            const double* const dx = patch_geom->getDx();
-            const double* const x_lower = patch_geom->getXLower();
-            const double* const x_upper = patch_geom->getXUpper();
+    // Compute the convective derivative.  The patches are independent, and the
+    // temporary face-centered velocities, extrapolation work arrays, and
+    // boundary blending arrays are carved out of scratch buffers owned by each
+    // thread, so the patches may be processed concurrently.
+    prepareThreadScratchBuffers();
+    const int num_patches = static_cast<int>(patch_data.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int k = 0; k < num_patches; ++k)
+    {
+        CartesianPatchGeometry<NDIM>* const patch_geom = patch_data[k].patch_geom;
+        const double* const dx = patch_geom->getDx();
+        const double* const x_lower = patch_geom->getXLower();
+        const double* const x_upper = patch_geom->getXUpper();
+        const Box<NDIM>& domain_box = patch_data[k].domain_box;
 
-            const Box<NDIM>& patch_box = patch->getBox();
-            const IntVector<NDIM>& patch_lower = patch_box.lower();
-            const IntVector<NDIM>& patch_upper = patch_box.upper();
+        const Box<NDIM>& patch_box = patch_data[k].patch_box;
+        const IntVector<NDIM>& patch_lower = patch_box.lower();
+        const IntVector<NDIM>& patch_upper = patch_box.upper();
 
-            Pointer<SideData<NDIM, double> > N_data = patch->getPatchData(N_idx);
-            Pointer<SideData<NDIM, double> > N_upwind_data =
-                new SideData<NDIM, double>(N_data->getBox(), N_data->getDepth(), N_data->getGhostCellWidth());
-            Pointer<SideData<NDIM, double> > U_data = patch->getPatchData(d_U_scratch_idx);
+        SideData<NDIM, double>* const N_data = patch_data[k].N_data;
+        SideData<NDIM, double>* const U_data = patch_data[k].U_data;
 
-            const IntVector<NDIM> ghosts = IntVector<NDIM>(1);
-            boost::array<Box<NDIM>, NDIM> side_boxes;
-            boost::array<Pointer<FaceData<NDIM, double> >, NDIM> U_adv_data;
-            boost::array<Pointer<FaceData<NDIM, double> >, NDIM> U_half_data;
-            boost::array<Pointer<FaceData<NDIM, double> >, NDIM> U_half_upwind_data;
-            for (unsigned int axis = 0; axis < NDIM; ++axis)
+        // Lay out the temporary data in the scratch buffer of this thread.
+        const IntVector<NDIM> ghosts = IntVector<NDIM>(1);
+        const Box<NDIM> U_ghost_box = Box<NDIM>::grow(patch_box, U_data->getGhostCellWidth());
+        boost::array<Box<NDIM>, NDIM> side_boxes;
+        boost::array<boost::array<Box<NDIM>, NDIM>, NDIM> face_boxes;
+        size_t face_size = 0;
+        size_t work_size = 0;
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            side_boxes[axis] = SideGeometry<NDIM>::toSideBox(patch_box, axis);
+            for (unsigned int d = 0; d < NDIM; ++d)
             {
-                side_boxes[axis] = SideGeometry<NDIM>::toSideBox(patch_box, axis);
-                U_adv_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
-                U_half_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
-                U_half_upwind_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
+                face_boxes[axis][d] = FaceGeometry<NDIM>::toFaceBox(Box<NDIM>::grow(side_boxes[axis], ghosts), d);
+                face_size += face_boxes[axis][d].size();
             }
+            const size_t U_size = SideGeometry<NDIM>::toSideBox(U_ghost_box, axis).size();
+            work_size = std::max(work_size, U_size);
+        }
+        const Box<NDIM> N_ghost_box = Box<NDIM>::grow(patch_box, N_data->getGhostCellWidth());
+        boost::array<Box<NDIM>, NDIM> N_boxes;
+        size_t N_size = 0;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            N_boxes[d] = SideGeometry<NDIM>::toSideBox(N_ghost_box, d);
+            N_size += N_boxes[d].size();
+        }
+        const size_t bdry_size = patch_geom->getTouchesRegularBoundary() ? 2 * N_size : 0;
+        double* scratch = getThreadScratchBuffer(3 * face_size + NUM_WORK_ARRAYS * work_size + bdry_size);
+        boost::array<boost::array<double*, NDIM>, NDIM> U_adv, U_half, U_half_upwind;
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                U_adv[axis][d] = scratch;
+                scratch += face_boxes[axis][d].size();
+                U_half[axis][d] = scratch;
+                scratch += face_boxes[axis][d].size();
+                U_half_upwind[axis][d] = scratch;
+                scratch += face_boxes[axis][d].size();
+            }
+        }
+        double* const dU = scratch;
+        double* const U_L = dU + work_size;
+        double* const U_R = U_L + work_size;
+        double* const U_scratch1 = U_R + work_size;
+#if (NDIM == 3)
+        double* const U_scratch2 = U_scratch1 + work_size;
+#endif
+        scratch += NUM_WORK_ARRAYS * work_size;
+        boost::array<double*, NDIM> N_upwind, N_PPM;
+        if (bdry_size > 0)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                N_upwind[d] = scratch;
+                scratch += N_boxes[d].size();
+                N_PPM[d] = scratch;
+                scratch += N_boxes[d].size();
+            }
+        }
 
 // Interpolate the staggered-grid velocity field onto the faces of
 // the control volumes.
 #if (NDIM == 2)
-            NAVIER_STOKES_INTERP_COMPS_FC(patch_lower(0),
-                                          patch_upper(0),
-                                          patch_lower(1),
-                                          patch_upper(1),
-                                          U_data->getGhostCellWidth()(0),
-                                          U_data->getGhostCellWidth()(1),
-                                          U_data->getPointer(0),
-                                          U_data->getPointer(1),
-                                          side_boxes[0].lower(0),
-                                          side_boxes[0].upper(0),
-                                          side_boxes[0].lower(1),
-                                          side_boxes[0].upper(1),
-                                          U_adv_data[0]->getGhostCellWidth()(0),
-                                          U_adv_data[0]->getGhostCellWidth()(1),
-                                          U_adv_data[0]->getPointer(0),
-                                          U_adv_data[0]->getPointer(1),
-                                          side_boxes[1].lower(0),
-                                          side_boxes[1].upper(0),
-                                          side_boxes[1].lower(1),
-                                          side_boxes[1].upper(1),
-                                          U_adv_data[1]->getGhostCellWidth()(0),
-                                          U_adv_data[1]->getGhostCellWidth()(1),
-                                          U_adv_data[1]->getPointer(0),
-                                          U_adv_data[1]->getPointer(1));
+        NAVIER_STOKES_INTERP_COMPS_FC(patch_lower(0),
+                                      patch_upper(0),
+                                      patch_lower(1),
+                                      patch_upper(1),
+                                      U_data->getGhostCellWidth()(0),
+                                      U_data->getGhostCellWidth()(1),
+                                      U_data->getPointer(0),
+                                      U_data->getPointer(1),
+                                      side_boxes[0].lower(0),
+                                      side_boxes[0].upper(0),
+                                      side_boxes[0].lower(1),
+                                      side_boxes[0].upper(1),
+                                      ghosts(0),
+                                      ghosts(1),
+                                      U_adv[0][0],
+                                      U_adv[0][1],
+                                      side_boxes[1].lower(0),
+                                      side_boxes[1].upper(0),
+                                      side_boxes[1].lower(1),
+                                      side_boxes[1].upper(1),
+                                      ghosts(0),
+                                      ghosts(1),
+                                      U_adv[1][0],
+                                      U_adv[1][1]);
 #endif
 #if (NDIM == 3)
-            NAVIER_STOKES_INTERP_COMPS_FC(patch_lower(0),
-                                          patch_upper(0),
-                                          patch_lower(1),
-                                          patch_upper(1),
-                                          patch_lower(2),
-                                          patch_upper(2),
-                                          U_data->getGhostCellWidth()(0),
-                                          U_data->getGhostCellWidth()(1),
-                                          U_data->getGhostCellWidth()(2),
-                                          U_data->getPointer(0),
-                                          U_data->getPointer(1),
-                                          U_data->getPointer(2),
-                                          side_boxes[0].lower(0),
-                                          side_boxes[0].upper(0),
-                                          side_boxes[0].lower(1),
-                                          side_boxes[0].upper(1),
-                                          side_boxes[0].lower(2),
-                                          side_boxes[0].upper(2),
-                                          U_adv_data[0]->getGhostCellWidth()(0),
-                                          U_adv_data[0]->getGhostCellWidth()(1),
-                                          U_adv_data[0]->getGhostCellWidth()(2),
-                                          U_adv_data[0]->getPointer(0),
-                                          U_adv_data[0]->getPointer(1),
-                                          U_adv_data[0]->getPointer(2),
-                                          side_boxes[1].lower(0),
-                                          side_boxes[1].upper(0),
-                                          side_boxes[1].lower(1),
-                                          side_boxes[1].upper(1),
-                                          side_boxes[1].lower(2),
-                                          side_boxes[1].upper(2),
-                                          U_adv_data[1]->getGhostCellWidth()(0),
-                                          U_adv_data[1]->getGhostCellWidth()(1),
-                                          U_adv_data[1]->getGhostCellWidth()(2),
-                                          U_adv_data[1]->getPointer(0),
-                                          U_adv_data[1]->getPointer(1),
-                                          U_adv_data[1]->getPointer(2),
-                                          side_boxes[2].lower(0),
-                                          side_boxes[2].upper(0),
-                                          side_boxes[2].lower(1),
-                                          side_boxes[2].upper(1),
-                                          side_boxes[2].lower(2),
-                                          side_boxes[2].upper(2),
-                                          U_adv_data[2]->getGhostCellWidth()(0),
-                                          U_adv_data[2]->getGhostCellWidth()(1),
-                                          U_adv_data[2]->getGhostCellWidth()(2),
-                                          U_adv_data[2]->getPointer(0),
-                                          U_adv_data[2]->getPointer(1),
-                                          U_adv_data[2]->getPointer(2));
+        NAVIER_STOKES_INTERP_COMPS_FC(patch_lower(0),
+                                      patch_upper(0),
+                                      patch_lower(1),
+                                      patch_upper(1),
+                                      patch_lower(2),
+                                      patch_upper(2),
+                                      U_data->getGhostCellWidth()(0),
+                                      U_data->getGhostCellWidth()(1),
+                                      U_data->getGhostCellWidth()(2),
+                                      U_data->getPointer(0),
+                                      U_data->getPointer(1),
+                                      U_data->getPointer(2),
+                                      side_boxes[0].lower(0),
+                                      side_boxes[0].upper(0),
+                                      side_boxes[0].lower(1),
+                                      side_boxes[0].upper(1),
+                                      side_boxes[0].lower(2),
+                                      side_boxes[0].upper(2),
+                                      ghosts(0),
+                                      ghosts(1),
+                                      ghosts(2),
+                                      U_adv[0][0],
+                                      U_adv[0][1],
+                                      U_adv[0][2],
+                                      side_boxes[1].lower(0),
+                                      side_boxes[1].upper(0),
+                                      side_boxes[1].lower(1),
+                                      side_boxes[1].upper(1),
+                                      side_boxes[1].lower(2),
+                                      side_boxes[1].upper(2),
+                                      ghosts(0),
+                                      ghosts(1),
+                                      ghosts(2),
+                                      U_adv[1][0],
+                                      U_adv[1][1],
+                                      U_adv[1][2],
+                                      side_boxes[2].lower(0),
+                                      side_boxes[2].upper(0),
+                                      side_boxes[2].lower(1),
+                                      side_boxes[2].upper(1),
+                                      side_boxes[2].lower(2),
+                                      side_boxes[2].upper(2),
+                                      ghosts(0),
+                                      ghosts(1),
+                                      ghosts(2),
+                                      U_adv[2][0],
+                                      U_adv[2][1],
+                                      U_adv[2][2]);
 #endif
 
-            // Compute the first-order upwind discretization.
-            if (patch_geom->getTouchesRegularBoundary())
+        // Compute the first-order upwind discretization.
+        if (patch_geom->getTouchesRegularBoundary())
+        {
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
-                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                const ArrayData<NDIM, double>& U_array_data = U_data->getArrayData(axis);
+                for (unsigned int d = 0; d < NDIM; ++d)
                 {
-                    const ArrayData<NDIM, double>& U_array_data = U_data->getArrayData(axis);
-                    for (unsigned int d = 0; d < NDIM; ++d)
+                    for (FaceIterator<NDIM> ic(side_boxes[axis], d); ic; ic++)
                     {
-                        for (FaceIterator<NDIM> ic(side_boxes[axis], d); ic; ic++)
-                        {
-                            const FaceIndex<NDIM>& i = ic();
-                            const double u_ADV = (*U_adv_data[axis])(i);
-                            const double U_lower = U_array_data(i.toCell(0), 0);
-                            const double U_upper = U_array_data(i.toCell(1), 0);
-                            (*U_half_upwind_data[axis])(i) =
-                                (u_ADV > 1.0e-8) ? U_lower : (u_ADV < 1.0e-8) ? U_upper : 0.5 * (U_lower + U_upper);
-                        }
-                    }
-                }
-                for (unsigned int axis = 0; axis < NDIM; ++axis)
-                {
-                    switch (d_difference_form)
-                    {
-                    case CONSERVATIVE:
-#if (NDIM == 2)
-                        CONVECT_DERIVATIVE_FC(dx,
-                                              side_boxes[axis].lower(0),
-                                              side_boxes[axis].upper(0),
-                                              side_boxes[axis].lower(1),
-                                              side_boxes[axis].upper(1),
-                                              U_adv_data[axis]->getGhostCellWidth()(0),
-                                              U_adv_data[axis]->getGhostCellWidth()(1),
-                                              U_half_upwind_data[axis]->getGhostCellWidth()(0),
-                                              U_half_upwind_data[axis]->getGhostCellWidth()(1),
-                                              U_adv_data[axis]->getPointer(0),
-                                              U_adv_data[axis]->getPointer(1),
-                                              U_half_upwind_data[axis]->getPointer(0),
-                                              U_half_upwind_data[axis]->getPointer(1),
-                                              N_upwind_data->getGhostCellWidth()(0),
-                                              N_upwind_data->getGhostCellWidth()(1),
-                                              N_upwind_data->getPointer(axis));
-#endif
-#if (NDIM == 3)
-                        CONVECT_DERIVATIVE_FC(dx,
-                                              side_boxes[axis].lower(0),
-                                              side_boxes[axis].upper(0),
-                                              side_boxes[axis].lower(1),
-                                              side_boxes[axis].upper(1),
-                                              side_boxes[axis].lower(2),
-                                              side_boxes[axis].upper(2),
-                                              U_adv_data[axis]->getGhostCellWidth()(0),
-                                              U_adv_data[axis]->getGhostCellWidth()(1),
-                                              U_adv_data[axis]->getGhostCellWidth()(2),
-                                              U_half_upwind_data[axis]->getGhostCellWidth()(0),
-                                              U_half_upwind_data[axis]->getGhostCellWidth()(1),
-                                              U_half_upwind_data[axis]->getGhostCellWidth()(2),
-                                              U_adv_data[axis]->getPointer(0),
-                                              U_adv_data[axis]->getPointer(1),
-                                              U_adv_data[axis]->getPointer(2),
-                                              U_half_upwind_data[axis]->getPointer(0),
-                                              U_half_upwind_data[axis]->getPointer(1),
-                                              U_half_upwind_data[axis]->getPointer(2),
-                                              N_upwind_data->getGhostCellWidth()(0),
-                                              N_upwind_data->getGhostCellWidth()(1),
-                                              N_upwind_data->getGhostCellWidth()(2),
-                                              N_upwind_data->getPointer(axis));
-#endif
-                        break;
-                    case ADVECTIVE:
-#if (NDIM == 2)
-                        ADVECT_DERIVATIVE_FC(dx,
-                                             side_boxes[axis].lower(0),
-                                             side_boxes[axis].upper(0),
-                                             side_boxes[axis].lower(1),
-                                             side_boxes[axis].upper(1),
-                                             U_adv_data[axis]->getGhostCellWidth()(0),
-                                             U_adv_data[axis]->getGhostCellWidth()(1),
-                                             U_half_upwind_data[axis]->getGhostCellWidth()(0),
-                                             U_half_upwind_data[axis]->getGhostCellWidth()(1),
-                                             U_adv_data[axis]->getPointer(0),
-                                             U_adv_data[axis]->getPointer(1),
-                                             U_half_upwind_data[axis]->getPointer(0),
-                                             U_half_upwind_data[axis]->getPointer(1),
-                                             N_upwind_data->getGhostCellWidth()(0),
-                                             N_upwind_data->getGhostCellWidth()(1),
-                                             N_upwind_data->getPointer(axis));
-#endif
-#if (NDIM == 3)
-                        ADVECT_DERIVATIVE_FC(dx,
-                                             side_boxes[axis].lower(0),
-                                             side_boxes[axis].upper(0),
-                                             side_boxes[axis].lower(1),
-                                             side_boxes[axis].upper(1),
-                                             side_boxes[axis].lower(2),
-                                             side_boxes[axis].upper(2),
-                                             U_adv_data[axis]->getGhostCellWidth()(0),
-                                             U_adv_data[axis]->getGhostCellWidth()(1),
-                                             U_adv_data[axis]->getGhostCellWidth()(2),
-                                             U_half_upwind_data[axis]->getGhostCellWidth()(0),
-                                             U_half_upwind_data[axis]->getGhostCellWidth()(1),
-                                             U_half_upwind_data[axis]->getGhostCellWidth()(2),
-                                             U_adv_data[axis]->getPointer(0),
-                                             U_adv_data[axis]->getPointer(1),
-                                             U_adv_data[axis]->getPointer(2),
-                                             U_half_upwind_data[axis]->getPointer(0),
-                                             U_half_upwind_data[axis]->getPointer(1),
-                                             U_half_upwind_data[axis]->getPointer(2),
-                                             N_upwind_data->getGhostCellWidth()(0),
-                                             N_upwind_data->getGhostCellWidth()(1),
-                                             N_upwind_data->getGhostCellWidth()(2),
-                                             N_upwind_data->getPointer(axis));
-#endif
-                        break;
-                    case SKEW_SYMMETRIC:
-#if (NDIM == 2)
-                        SKEW_SYM_DERIVATIVE_FC(dx,
-                                               side_boxes[axis].lower(0),
-                                               side_boxes[axis].upper(0),
-                                               side_boxes[axis].lower(1),
-                                               side_boxes[axis].upper(1),
-                                               U_adv_data[axis]->getGhostCellWidth()(0),
-                                               U_adv_data[axis]->getGhostCellWidth()(1),
-                                               U_half_upwind_data[axis]->getGhostCellWidth()(0),
-                                               U_half_upwind_data[axis]->getGhostCellWidth()(1),
-                                               U_adv_data[axis]->getPointer(0),
-                                               U_adv_data[axis]->getPointer(1),
-                                               U_half_upwind_data[axis]->getPointer(0),
-                                               U_half_upwind_data[axis]->getPointer(1),
-                                               N_upwind_data->getGhostCellWidth()(0),
-                                               N_upwind_data->getGhostCellWidth()(1),
-                                               N_upwind_data->getPointer(axis));
-#endif
-#if (NDIM == 3)
-                        SKEW_SYM_DERIVATIVE_FC(dx,
-                                               side_boxes[axis].lower(0),
-                                               side_boxes[axis].upper(0),
-                                               side_boxes[axis].lower(1),
-                                               side_boxes[axis].upper(1),
-                                               side_boxes[axis].lower(2),
-                                               side_boxes[axis].upper(2),
-                                               U_adv_data[axis]->getGhostCellWidth()(0),
-                                               U_adv_data[axis]->getGhostCellWidth()(1),
-                                               U_adv_data[axis]->getGhostCellWidth()(2),
-                                               U_half_upwind_data[axis]->getGhostCellWidth()(0),
-                                               U_half_upwind_data[axis]->getGhostCellWidth()(1),
-                                               U_half_upwind_data[axis]->getGhostCellWidth()(2),
-                                               U_adv_data[axis]->getPointer(0),
-                                               U_adv_data[axis]->getPointer(1),
-                                               U_adv_data[axis]->getPointer(2),
-                                               U_half_upwind_data[axis]->getPointer(0),
-                                               U_half_upwind_data[axis]->getPointer(1),
-                                               U_half_upwind_data[axis]->getPointer(2),
-                                               N_upwind_data->getGhostCellWidth()(0),
-                                               N_upwind_data->getGhostCellWidth()(1),
-                                               N_upwind_data->getGhostCellWidth()(2),
-                                               N_upwind_data->getPointer(axis));
-#endif
-                        break;
-                    default:
-                        TBOX_ERROR(
-                            "INSStaggeredStabilizedConvectiveOperator::"
-                            "applyConvectiveOperator():\n"
-                            << "  unsupported differencing form: "
-                            << enum_to_string<ConvectiveDifferencingType>(d_difference_form)
-                            << " \n"
-                            << "  valid choices are: ADVECTIVE, CONSERVATIVE, "
-                               "SKEW_SYMMETRIC\n");
+                        const FaceIndex<NDIM>& i = ic();
+                        const int idx = face_boxes[axis][d].offset(i);
+                        const double u_ADV = U_adv[axis][d][idx];
+                        const double U_lower = U_array_data(i.toCell(0), 0);
+                        const double U_upper = U_array_data(i.toCell(1), 0);
+                        U_half_upwind[axis][d][idx] =
+                            (u_ADV > 1.0e-8) ? U_lower : (u_ADV < 1.0e-8) ? U_upper : 0.5 * (U_lower + U_upper);
                     }
                 }
             }
-
-            // Compute the xsPPM7 discretization.
-            for (unsigned int axis = 0; axis < NDIM; ++axis)
-            {
-                Pointer<SideData<NDIM, double> > dU_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_L_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_R_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_scratch1_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-#if (NDIM == 3)
-                Pointer<SideData<NDIM, double> > U_scratch2_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-#endif
-#if (NDIM == 2)
-                GODUNOV_EXTRAPOLATE_FC(side_boxes[axis].lower(0),
-                                       side_boxes[axis].upper(0),
-                                       side_boxes[axis].lower(1),
-                                       side_boxes[axis].upper(1),
-                                       U_data->getGhostCellWidth()(0),
-                                       U_data->getGhostCellWidth()(1),
-                                       U_data->getPointer(axis),
-                                       U_scratch1_data->getPointer(axis),
-                                       dU_data->getPointer(axis),
-                                       U_L_data->getPointer(axis),
-                                       U_R_data->getPointer(axis),
-                                       U_adv_data[axis]->getGhostCellWidth()(0),
-                                       U_adv_data[axis]->getGhostCellWidth()(1),
-                                       U_half_data[axis]->getGhostCellWidth()(0),
-                                       U_half_data[axis]->getGhostCellWidth()(1),
-                                       U_adv_data[axis]->getPointer(0),
-                                       U_adv_data[axis]->getPointer(1),
-                                       U_half_data[axis]->getPointer(0),
-                                       U_half_data[axis]->getPointer(1));
-#endif
-#if (NDIM == 3)
-                GODUNOV_EXTRAPOLATE_FC(side_boxes[axis].lower(0),
-                                       side_boxes[axis].upper(0),
-                                       side_boxes[axis].lower(1),
-                                       side_boxes[axis].upper(1),
-                                       side_boxes[axis].lower(2),
-                                       side_boxes[axis].upper(2),
-                                       U_data->getGhostCellWidth()(0),
-                                       U_data->getGhostCellWidth()(1),
-                                       U_data->getGhostCellWidth()(2),
-                                       U_data->getPointer(axis),
-                                       U_scratch1_data->getPointer(axis),
-                                       U_scratch2_data->getPointer(axis),
-                                       dU_data->getPointer(axis),
-                                       U_L_data->getPointer(axis),
-                                       U_R_data->getPointer(axis),
-                                       U_adv_data[axis]->getGhostCellWidth()(0),
-                                       U_adv_data[axis]->getGhostCellWidth()(1),
-                                       U_adv_data[axis]->getGhostCellWidth()(2),
-                                       U_half_data[axis]->getGhostCellWidth()(0),
-                                       U_half_data[axis]->getGhostCellWidth()(1),
-                                       U_half_data[axis]->getGhostCellWidth()(2),
-                                       U_adv_data[axis]->getPointer(0),
-                                       U_adv_data[axis]->getPointer(1),
-                                       U_adv_data[axis]->getPointer(2),
-                                       U_half_data[axis]->getPointer(0),
-                                       U_half_data[axis]->getPointer(1),
-                                       U_half_data[axis]->getPointer(2));
-#endif
-            }
-#if (NDIM == 2)
-            NAVIER_STOKES_RESET_ADV_VELOCITY_FC(side_boxes[0].lower(0),
-                                                side_boxes[0].upper(0),
-                                                side_boxes[0].lower(1),
-                                                side_boxes[0].upper(1),
-                                                U_adv_data[0]->getGhostCellWidth()(0),
-                                                U_adv_data[0]->getGhostCellWidth()(1),
-                                                U_adv_data[0]->getPointer(0),
-                                                U_adv_data[0]->getPointer(1),
-                                                U_half_data[0]->getGhostCellWidth()(0),
-                                                U_half_data[0]->getGhostCellWidth()(1),
-                                                U_half_data[0]->getPointer(0),
-                                                U_half_data[0]->getPointer(1),
-                                                side_boxes[1].lower(0),
-                                                side_boxes[1].upper(0),
-                                                side_boxes[1].lower(1),
-                                                side_boxes[1].upper(1),
-                                                U_adv_data[1]->getGhostCellWidth()(0),
-                                                U_adv_data[1]->getGhostCellWidth()(1),
-                                                U_adv_data[1]->getPointer(0),
-                                                U_adv_data[1]->getPointer(1),
-                                                U_half_data[1]->getGhostCellWidth()(0),
-                                                U_half_data[1]->getGhostCellWidth()(1),
-                                                U_half_data[1]->getPointer(0),
-                                                U_half_data[1]->getPointer(1));
-#endif
-#if (NDIM == 3)
-            NAVIER_STOKES_RESET_ADV_VELOCITY_FC(side_boxes[0].lower(0),
-                                                side_boxes[0].upper(0),
-                                                side_boxes[0].lower(1),
-                                                side_boxes[0].upper(1),
-                                                side_boxes[0].lower(2),
-                                                side_boxes[0].upper(2),
-                                                U_adv_data[0]->getGhostCellWidth()(0),
-                                                U_adv_data[0]->getGhostCellWidth()(1),
-                                                U_adv_data[0]->getGhostCellWidth()(2),
-                                                U_adv_data[0]->getPointer(0),
-                                                U_adv_data[0]->getPointer(1),
-                                                U_adv_data[0]->getPointer(2),
-                                                U_half_data[0]->getGhostCellWidth()(0),
-                                                U_half_data[0]->getGhostCellWidth()(1),
-                                                U_half_data[0]->getGhostCellWidth()(2),
-                                                U_half_data[0]->getPointer(0),
-                                                U_half_data[0]->getPointer(1),
-                                                U_half_data[0]->getPointer(2),
-                                                side_boxes[1].lower(0),
-                                                side_boxes[1].upper(0),
-                                                side_boxes[1].lower(1),
-                                                side_boxes[1].upper(1),
-                                                side_boxes[1].lower(2),
-                                                side_boxes[1].upper(2),
-                                                U_adv_data[1]->getGhostCellWidth()(0),
-                                                U_adv_data[1]->getGhostCellWidth()(1),
-                                                U_adv_data[1]->getGhostCellWidth()(2),
-                                                U_adv_data[1]->getPointer(0),
-                                                U_adv_data[1]->getPointer(1),
-                                                U_adv_data[1]->getPointer(2),
-                                                U_half_data[1]->getGhostCellWidth()(0),
-                                                U_half_data[1]->getGhostCellWidth()(1),
-                                                U_half_data[1]->getGhostCellWidth()(2),
-                                                U_half_data[1]->getPointer(0),
-                                                U_half_data[1]->getPointer(1),
-                                                U_half_data[1]->getPointer(2),
-                                                side_boxes[2].lower(0),
-                                                side_boxes[2].upper(0),
-                                                side_boxes[2].lower(1),
-                                                side_boxes[2].upper(1),
-                                                side_boxes[2].lower(2),
-                                                side_boxes[2].upper(2),
-                                                U_adv_data[2]->getGhostCellWidth()(0),
-                                                U_adv_data[2]->getGhostCellWidth()(1),
-                                                U_adv_data[2]->getGhostCellWidth()(2),
-                                                U_adv_data[2]->getPointer(0),
-                                                U_adv_data[2]->getPointer(1),
-                                                U_adv_data[2]->getPointer(2),
-                                                U_half_data[2]->getGhostCellWidth()(0),
-                                                U_half_data[2]->getGhostCellWidth()(1),
-                                                U_half_data[2]->getGhostCellWidth()(2),
-                                                U_half_data[2]->getPointer(0),
-                                                U_half_data[2]->getPointer(1),
-                                                U_half_data[2]->getPointer(2));
-#endif
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
                 switch (d_difference_form)
@@ -1054,17 +864,17 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
                                           side_boxes[axis].upper(0),
                                           side_boxes[axis].lower(1),
                                           side_boxes[axis].upper(1),
-                                          U_adv_data[axis]->getGhostCellWidth()(0),
-                                          U_adv_data[axis]->getGhostCellWidth()(1),
-                                          U_half_data[axis]->getGhostCellWidth()(0),
-                                          U_half_data[axis]->getGhostCellWidth()(1),
-                                          U_adv_data[axis]->getPointer(0),
-                                          U_adv_data[axis]->getPointer(1),
-                                          U_half_data[axis]->getPointer(0),
-                                          U_half_data[axis]->getPointer(1),
+                                          ghosts(0),
+                                          ghosts(1),
+                                          ghosts(0),
+                                          ghosts(1),
+                                          U_adv[axis][0],
+                                          U_adv[axis][1],
+                                          U_half_upwind[axis][0],
+                                          U_half_upwind[axis][1],
                                           N_data->getGhostCellWidth()(0),
                                           N_data->getGhostCellWidth()(1),
-                                          N_data->getPointer(axis));
+                                          N_upwind[axis]);
 #endif
 #if (NDIM == 3)
                     CONVECT_DERIVATIVE_FC(dx,
@@ -1074,22 +884,22 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
                                           side_boxes[axis].upper(1),
                                           side_boxes[axis].lower(2),
                                           side_boxes[axis].upper(2),
-                                          U_adv_data[axis]->getGhostCellWidth()(0),
-                                          U_adv_data[axis]->getGhostCellWidth()(1),
-                                          U_adv_data[axis]->getGhostCellWidth()(2),
-                                          U_half_data[axis]->getGhostCellWidth()(0),
-                                          U_half_data[axis]->getGhostCellWidth()(1),
-                                          U_half_data[axis]->getGhostCellWidth()(2),
-                                          U_adv_data[axis]->getPointer(0),
-                                          U_adv_data[axis]->getPointer(1),
-                                          U_adv_data[axis]->getPointer(2),
-                                          U_half_data[axis]->getPointer(0),
-                                          U_half_data[axis]->getPointer(1),
-                                          U_half_data[axis]->getPointer(2),
+                                          ghosts(0),
+                                          ghosts(1),
+                                          ghosts(2),
+                                          ghosts(0),
+                                          ghosts(1),
+                                          ghosts(2),
+                                          U_adv[axis][0],
+                                          U_adv[axis][1],
+                                          U_adv[axis][2],
+                                          U_half_upwind[axis][0],
+                                          U_half_upwind[axis][1],
+                                          U_half_upwind[axis][2],
                                           N_data->getGhostCellWidth()(0),
                                           N_data->getGhostCellWidth()(1),
                                           N_data->getGhostCellWidth()(2),
-                                          N_data->getPointer(axis));
+                                          N_upwind[axis]);
 #endif
                     break;
                 case ADVECTIVE:
@@ -1099,17 +909,17 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
                                          side_boxes[axis].upper(0),
                                          side_boxes[axis].lower(1),
                                          side_boxes[axis].upper(1),
-                                         U_adv_data[axis]->getGhostCellWidth()(0),
-                                         U_adv_data[axis]->getGhostCellWidth()(1),
-                                         U_half_data[axis]->getGhostCellWidth()(0),
-                                         U_half_data[axis]->getGhostCellWidth()(1),
-                                         U_adv_data[axis]->getPointer(0),
-                                         U_adv_data[axis]->getPointer(1),
-                                         U_half_data[axis]->getPointer(0),
-                                         U_half_data[axis]->getPointer(1),
+                                         ghosts(0),
+                                         ghosts(1),
+                                         ghosts(0),
+                                         ghosts(1),
+                                         U_adv[axis][0],
+                                         U_adv[axis][1],
+                                         U_half_upwind[axis][0],
+                                         U_half_upwind[axis][1],
                                          N_data->getGhostCellWidth()(0),
                                          N_data->getGhostCellWidth()(1),
-                                         N_data->getPointer(axis));
+                                         N_upwind[axis]);
 #endif
 #if (NDIM == 3)
                     ADVECT_DERIVATIVE_FC(dx,
@@ -1119,22 +929,22 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
                                          side_boxes[axis].upper(1),
                                          side_boxes[axis].lower(2),
                                          side_boxes[axis].upper(2),
-                                         U_adv_data[axis]->getGhostCellWidth()(0),
-                                         U_adv_data[axis]->getGhostCellWidth()(1),
-                                         U_adv_data[axis]->getGhostCellWidth()(2),
-                                         U_half_data[axis]->getGhostCellWidth()(0),
-                                         U_half_data[axis]->getGhostCellWidth()(1),
-                                         U_half_data[axis]->getGhostCellWidth()(2),
-                                         U_adv_data[axis]->getPointer(0),
-                                         U_adv_data[axis]->getPointer(1),
-                                         U_adv_data[axis]->getPointer(2),
-                                         U_half_data[axis]->getPointer(0),
-                                         U_half_data[axis]->getPointer(1),
-                                         U_half_data[axis]->getPointer(2),
+                                         ghosts(0),
+                                         ghosts(1),
+                                         ghosts(2),
+                                         ghosts(0),
+                                         ghosts(1),
+                                         ghosts(2),
+                                         U_adv[axis][0],
+                                         U_adv[axis][1],
+                                         U_adv[axis][2],
+                                         U_half_upwind[axis][0],
+                                         U_half_upwind[axis][1],
+                                         U_half_upwind[axis][2],
                                          N_data->getGhostCellWidth()(0),
                                          N_data->getGhostCellWidth()(1),
                                          N_data->getGhostCellWidth()(2),
-                                         N_data->getPointer(axis));
+                                         N_upwind[axis]);
 #endif
                     break;
                 case SKEW_SYMMETRIC:
@@ -1144,17 +954,17 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
                                            side_boxes[axis].upper(0),
                                            side_boxes[axis].lower(1),
                                            side_boxes[axis].upper(1),
-                                           U_adv_data[axis]->getGhostCellWidth()(0),
-                                           U_adv_data[axis]->getGhostCellWidth()(1),
-                                           U_half_data[axis]->getGhostCellWidth()(0),
-                                           U_half_data[axis]->getGhostCellWidth()(1),
-                                           U_adv_data[axis]->getPointer(0),
-                                           U_adv_data[axis]->getPointer(1),
-                                           U_half_data[axis]->getPointer(0),
-                                           U_half_data[axis]->getPointer(1),
+                                           ghosts(0),
+                                           ghosts(1),
+                                           ghosts(0),
+                                           ghosts(1),
+                                           U_adv[axis][0],
+                                           U_adv[axis][1],
+                                           U_half_upwind[axis][0],
+                                           U_half_upwind[axis][1],
                                            N_data->getGhostCellWidth()(0),
                                            N_data->getGhostCellWidth()(1),
-                                           N_data->getPointer(axis));
+                                           N_upwind[axis]);
 #endif
 #if (NDIM == 3)
                     SKEW_SYM_DERIVATIVE_FC(dx,
@@ -1164,89 +974,362 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
                                            side_boxes[axis].upper(1),
                                            side_boxes[axis].lower(2),
                                            side_boxes[axis].upper(2),
-                                           U_adv_data[axis]->getGhostCellWidth()(0),
-                                           U_adv_data[axis]->getGhostCellWidth()(1),
-                                           U_adv_data[axis]->getGhostCellWidth()(2),
-                                           U_half_data[axis]->getGhostCellWidth()(0),
-                                           U_half_data[axis]->getGhostCellWidth()(1),
-                                           U_half_data[axis]->getGhostCellWidth()(2),
-                                           U_adv_data[axis]->getPointer(0),
-                                           U_adv_data[axis]->getPointer(1),
-                                           U_adv_data[axis]->getPointer(2),
-                                           U_half_data[axis]->getPointer(0),
-                                           U_half_data[axis]->getPointer(1),
-                                           U_half_data[axis]->getPointer(2),
+                                           ghosts(0),
+                                           ghosts(1),
+                                           ghosts(2),
+                                           ghosts(0),
+                                           ghosts(1),
+                                           ghosts(2),
+                                           U_adv[axis][0],
+                                           U_adv[axis][1],
+                                           U_adv[axis][2],
+                                           U_half_upwind[axis][0],
+                                           U_half_upwind[axis][1],
+                                           U_half_upwind[axis][2],
                                            N_data->getGhostCellWidth()(0),
                                            N_data->getGhostCellWidth()(1),
                                            N_data->getGhostCellWidth()(2),
-                                           N_data->getPointer(axis));
+                                           N_upwind[axis]);
 #endif
                     break;
                 default:
                     TBOX_ERROR(
-                        "INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator("
-                        "):\n"
+                        "INSStaggeredStabilizedConvectiveOperator::"
+                        "applyConvectiveOperator():\n"
                         << "  unsupported differencing form: "
                         << enum_to_string<ConvectiveDifferencingType>(d_difference_form)
                         << " \n"
-                        << "  valid choices are: ADVECTIVE, CONSERVATIVE, SKEW_SYMMETRIC\n");
+                        << "  valid choices are: ADVECTIVE, CONSERVATIVE, "
+                           "SKEW_SYMMETRIC\n");
                 }
             }
+        }
 
-            // Blend together the low-order and high-order discretizations at
-            // physical boundaries.
-            bool use_upwind_differencing_at_bdry = false;
-            if (d_stabilization_type == "UPWIND")
-            {
-                use_upwind_differencing_at_bdry = true;
-            }
-            else if (d_stabilization_type == "VISCOUS_ONLY")
+        // Compute the xsPPM7 discretization.
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+#if (NDIM == 2)
+            GODUNOV_EXTRAPOLATE_FC(side_boxes[axis].lower(0),
+                                   side_boxes[axis].upper(0),
+                                   side_boxes[axis].lower(1),
+                                   side_boxes[axis].upper(1),
+                                   U_data->getGhostCellWidth()(0),
+                                   U_data->getGhostCellWidth()(1),
+                                   U_data->getPointer(axis),
+                                   U_scratch1,
+                                   dU,
+                                   U_L,
+                                   U_R,
+                                   ghosts(0),
+                                   ghosts(1),
+                                   ghosts(0),
+                                   ghosts(1),
+                                   U_adv[axis][0],
+                                   U_adv[axis][1],
+                                   U_half[axis][0],
+                                   U_half[axis][1]);
+#endif
+#if (NDIM == 3)
+            GODUNOV_EXTRAPOLATE_FC(side_boxes[axis].lower(0),
+                                   side_boxes[axis].upper(0),
+                                   side_boxes[axis].lower(1),
+                                   side_boxes[axis].upper(1),
+                                   side_boxes[axis].lower(2),
+                                   side_boxes[axis].upper(2),
+                                   U_data->getGhostCellWidth()(0),
+                                   U_data->getGhostCellWidth()(1),
+                                   U_data->getGhostCellWidth()(2),
+                                   U_data->getPointer(axis),
+                                   U_scratch1,
+                                   U_scratch2,
+                                   dU,
+                                   U_L,
+                                   U_R,
+                                   ghosts(0),
+                                   ghosts(1),
+                                   ghosts(2),
+                                   ghosts(0),
+                                   ghosts(1),
+                                   ghosts(2),
+                                   U_adv[axis][0],
+                                   U_adv[axis][1],
+                                   U_adv[axis][2],
+                                   U_half[axis][0],
+                                   U_half[axis][1],
+                                   U_half[axis][2]);
+#endif
+        }
+#if (NDIM == 2)
+        NAVIER_STOKES_RESET_ADV_VELOCITY_FC(side_boxes[0].lower(0),
+                                            side_boxes[0].upper(0),
+                                            side_boxes[0].lower(1),
+                                            side_boxes[0].upper(1),
+                                            ghosts(0),
+                                            ghosts(1),
+                                            U_adv[0][0],
+                                            U_adv[0][1],
+                                            ghosts(0),
+                                            ghosts(1),
+                                            U_half[0][0],
+                                            U_half[0][1],
+                                            side_boxes[1].lower(0),
+                                            side_boxes[1].upper(0),
+                                            side_boxes[1].lower(1),
+                                            side_boxes[1].upper(1),
+                                            ghosts(0),
+                                            ghosts(1),
+                                            U_adv[1][0],
+                                            U_adv[1][1],
+                                            ghosts(0),
+                                            ghosts(1),
+                                            U_half[1][0],
+                                            U_half[1][1]);
+#endif
+#if (NDIM == 3)
+        NAVIER_STOKES_RESET_ADV_VELOCITY_FC(side_boxes[0].lower(0),
+                                            side_boxes[0].upper(0),
+                                            side_boxes[0].lower(1),
+                                            side_boxes[0].upper(1),
+                                            side_boxes[0].lower(2),
+                                            side_boxes[0].upper(2),
+                                            ghosts(0),
+                                            ghosts(1),
+                                            ghosts(2),
+                                            U_adv[0][0],
+                                            U_adv[0][1],
+                                            U_adv[0][2],
+                                            ghosts(0),
+                                            ghosts(1),
+                                            ghosts(2),
+                                            U_half[0][0],
+                                            U_half[0][1],
+                                            U_half[0][2],
+                                            side_boxes[1].lower(0),
+                                            side_boxes[1].upper(0),
+                                            side_boxes[1].lower(1),
+                                            side_boxes[1].upper(1),
+                                            side_boxes[1].lower(2),
+                                            side_boxes[1].upper(2),
+                                            ghosts(0),
+                                            ghosts(1),
+                                            ghosts(2),
+                                            U_adv[1][0],
+                                            U_adv[1][1],
+                                            U_adv[1][2],
+                                            ghosts(0),
+                                            ghosts(1),
+                                            ghosts(2),
+                                            U_half[1][0],
+                                            U_half[1][1],
+                                            U_half[1][2],
+                                            side_boxes[2].lower(0),
+                                            side_boxes[2].upper(0),
+                                            side_boxes[2].lower(1),
+                                            side_boxes[2].upper(1),
+                                            side_boxes[2].lower(2),
+                                            side_boxes[2].upper(2),
+                                            ghosts(0),
+                                            ghosts(1),
+                                            ghosts(2),
+                                            U_adv[2][0],
+                                            U_adv[2][1],
+                                            U_adv[2][2],
+                                            ghosts(0),
+                                            ghosts(1),
+                                            ghosts(2),
+                                            U_half[2][0],
+                                            U_half[2][1],
+                                            U_half[2][2]);
+#endif
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            switch (d_difference_form)
             {
-                use_upwind_differencing_at_bdry = false;
+            case CONSERVATIVE:
+#if (NDIM == 2)
+                CONVECT_DERIVATIVE_FC(dx,
+                                      side_boxes[axis].lower(0),
+                                      side_boxes[axis].upper(0),
+                                      side_boxes[axis].lower(1),
+                                      side_boxes[axis].upper(1),
+                                      ghosts(0),
+                                      ghosts(1),
+                                      ghosts(0),
+                                      ghosts(1),
+                                      U_adv[axis][0],
+                                      U_adv[axis][1],
+                                      U_half[axis][0],
+                                      U_half[axis][1],
+                                      N_data->getGhostCellWidth()(0),
+                                      N_data->getGhostCellWidth()(1),
+                                      N_data->getPointer(axis));
+#endif
+#if (NDIM == 3)
+                CONVECT_DERIVATIVE_FC(dx,
+                                      side_boxes[axis].lower(0),
+                                      side_boxes[axis].upper(0),
+                                      side_boxes[axis].lower(1),
+                                      side_boxes[axis].upper(1),
+                                      side_boxes[axis].lower(2),
+                                      side_boxes[axis].upper(2),
+                                      ghosts(0),
+                                      ghosts(1),
+                                      ghosts(2),
+                                      ghosts(0),
+                                      ghosts(1),
+                                      ghosts(2),
+                                      U_adv[axis][0],
+                                      U_adv[axis][1],
+                                      U_adv[axis][2],
+                                      U_half[axis][0],
+                                      U_half[axis][1],
+                                      U_half[axis][2],
+                                      N_data->getGhostCellWidth()(0),
+                                      N_data->getGhostCellWidth()(1),
+                                      N_data->getGhostCellWidth()(2),
+                                      N_data->getPointer(axis));
+#endif
+                break;
+            case ADVECTIVE:
+#if (NDIM == 2)
+                ADVECT_DERIVATIVE_FC(dx,
+                                     side_boxes[axis].lower(0),
+                                     side_boxes[axis].upper(0),
+                                     side_boxes[axis].lower(1),
+                                     side_boxes[axis].upper(1),
+                                     ghosts(0),
+                                     ghosts(1),
+                                     ghosts(0),
+                                     ghosts(1),
+                                     U_adv[axis][0],
+                                     U_adv[axis][1],
+                                     U_half[axis][0],
+                                     U_half[axis][1],
+                                     N_data->getGhostCellWidth()(0),
+                                     N_data->getGhostCellWidth()(1),
+                                     N_data->getPointer(axis));
+#endif
+#if (NDIM == 3)
+                ADVECT_DERIVATIVE_FC(dx,
+                                     side_boxes[axis].lower(0),
+                                     side_boxes[axis].upper(0),
+                                     side_boxes[axis].lower(1),
+                                     side_boxes[axis].upper(1),
+                                     side_boxes[axis].lower(2),
+                                     side_boxes[axis].upper(2),
+                                     ghosts(0),
+                                     ghosts(1),
+                                     ghosts(2),
+                                     ghosts(0),
+                                     ghosts(1),
+                                     ghosts(2),
+                                     U_adv[axis][0],
+                                     U_adv[axis][1],
+                                     U_adv[axis][2],
+                                     U_half[axis][0],
+                                     U_half[axis][1],
+                                     U_half[axis][2],
+                                     N_data->getGhostCellWidth()(0),
+                                     N_data->getGhostCellWidth()(1),
+                                     N_data->getGhostCellWidth()(2),
+                                     N_data->getPointer(axis));
+#endif
+                break;
+            case SKEW_SYMMETRIC:
+#if (NDIM == 2)
+                SKEW_SYM_DERIVATIVE_FC(dx,
+                                       side_boxes[axis].lower(0),
+                                       side_boxes[axis].upper(0),
+                                       side_boxes[axis].lower(1),
+                                       side_boxes[axis].upper(1),
+                                       ghosts(0),
+                                       ghosts(1),
+                                       ghosts(0),
+                                       ghosts(1),
+                                       U_adv[axis][0],
+                                       U_adv[axis][1],
+                                       U_half[axis][0],
+                                       U_half[axis][1],
+                                       N_data->getGhostCellWidth()(0),
+                                       N_data->getGhostCellWidth()(1),
+                                       N_data->getPointer(axis));
+#endif
+#if (NDIM == 3)
+                SKEW_SYM_DERIVATIVE_FC(dx,
+                                       side_boxes[axis].lower(0),
+                                       side_boxes[axis].upper(0),
+                                       side_boxes[axis].lower(1),
+                                       side_boxes[axis].upper(1),
+                                       side_boxes[axis].lower(2),
+                                       side_boxes[axis].upper(2),
+                                       ghosts(0),
+                                       ghosts(1),
+                                       ghosts(2),
+                                       ghosts(0),
+                                       ghosts(1),
+                                       ghosts(2),
+                                       U_adv[axis][0],
+                                       U_adv[axis][1],
+                                       U_adv[axis][2],
+                                       U_half[axis][0],
+                                       U_half[axis][1],
+                                       U_half[axis][2],
+                                       N_data->getGhostCellWidth()(0),
+                                       N_data->getGhostCellWidth()(1),
+                                       N_data->getGhostCellWidth()(2),
+                                       N_data->getPointer(axis));
+#endif
+                break;
+            default:
+                TBOX_ERROR(
+                    "INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator("
+                    "):\n"
+                    << "  unsupported differencing form: "
+                    << enum_to_string<ConvectiveDifferencingType>(d_difference_form)
+                    << " \n"
+                    << "  valid choices are: ADVECTIVE, CONSERVATIVE, SKEW_SYMMETRIC\n");
             }
-            else
+        }
+
+        // Blend together the low-order and high-order discretizations at
+        // physical boundaries.
+        if (patch_geom->getTouchesRegularBoundary())
+        {
+            for (unsigned int d = 0; d < NDIM; ++d)
             {
-                TBOX_ERROR("INSStaggeredStabilizedPPMConvectiveOperator: unrecognized value for stabilization_type, "
-                           << d_stabilization_type
-                           << "\n"
-                           << "  recognized choices are UPWIND, VISCOUS_ONLY\n");
+                std::copy(N_data->getPointer(d), N_data->getPointer(d) + N_boxes[d].size(), N_PPM[d]);
             }
-            if (patch_geom->getTouchesRegularBoundary())
+            for (unsigned int location_index = 0; location_index < 2 * NDIM; ++location_index)
             {
-                Pointer<SideData<NDIM, double> > N_PPM_data =
-                    new SideData<NDIM, double>(N_data->getBox(), N_data->getDepth(), N_data->getGhostCellWidth());
-                N_PPM_data->copy(*N_data);
-                for (unsigned int location_index = 0; location_index < 2 * NDIM; ++location_index)
+                const unsigned int axis = location_index / 2;
+                const unsigned int side = location_index % 2;
+                const bool is_lower = side == 0;
+                if (d_open_bdry[location_index] && patch_geom->getTouchesRegularBoundary(axis, side))
                 {
-                    const unsigned int axis = location_index / 2;
-                    const unsigned int side = location_index % 2;
-                    const bool is_lower = side == 0;
-                    if (d_open_bdry[location_index] && patch_geom->getTouchesRegularBoundary(axis, side))
+                    for (unsigned int d = 0; d < NDIM; ++d)
                     {
-                        for (unsigned int d = 0; d < NDIM; ++d)
+                        Box<NDIM> bdry_box = domain_box;
+                        const double width = d_width[location_index];
+                        const int offset = static_cast<int>(width / dx[axis]);
+                        if (is_lower)
+                        {
+                            bdry_box.upper(axis) = domain_box.lower(axis) + offset;
+                        }
+                        else
+                        {
+                            bdry_box.lower(axis) = domain_box.upper(axis) - offset;
+                        }
+                        for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(bdry_box * patch_box, d)); b; b++)
                         {
-                            Box<NDIM> bdry_box = domain_box;
-                            const double width = d_width[location_index];
-                            const int offset = static_cast<int>(width / dx[axis]);
-                            if (is_lower)
-                            {
-                                bdry_box.upper(axis) = domain_box.lower(axis) + offset;
-                            }
-                            else
-                            {
-                                bdry_box.lower(axis) = domain_box.upper(axis) - offset;
-                            }
-                            for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(bdry_box * patch_box, d)); b; b++)
-                            {
-                                const Index<NDIM>& i = b();
-                                const SideIndex<NDIM> i_s(i, d, SideIndex<NDIM>::Lower);
-                                const double x =
-                                    x_lower[axis] + dx[axis] * static_cast<double>(i(axis) - patch_box.lower(axis));
-                                const double x_bdry = (is_lower ? x_lower[axis] : x_upper[axis]);
-                                const double fac = smooth_kernel((x - x_bdry) / width);
-                                (*N_data)(i_s) = fac * (use_upwind_differencing_at_bdry ? (*N_upwind_data)(i_s) : 0.0) +
-                                                 (1.0 - fac) * (*N_PPM_data)(i_s);
-                            }
+                            const Index<NDIM>& i = b();
+                            const SideIndex<NDIM> i_s(i, d, SideIndex<NDIM>::Lower);
+                            const double x =
+                                x_lower[axis] + dx[axis] * static_cast<double>(i(axis) - patch_box.lower(axis));
+                            const double x_bdry = (is_lower ? x_lower[axis] : x_upper[axis]);
+                            const double fac = smooth_kernel((x - x_bdry) / width);
+                            const int idx = N_boxes[d].offset(i);
+                            (*N_data)(i_s) = fac * (use_upwind_differencing_at_bdry ? N_upwind[d][idx] : 0.0) +
+                                             (1.0 - fac) * N_PPM[d][idx];
                         }
                     }
                 }
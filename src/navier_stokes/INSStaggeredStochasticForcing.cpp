@@ -34,6 +34,7 @@
 
 #include <math.h>
 #include <stddef.h>
+#include <algorithm>
 #include <limits>
 #include <ostream>
 #include <string>
@@ -164,14 +165,47 @@ compute_tangential_extension(const Box<NDIM>& box, const int data_axis)
     return extended_box;
 } // compute_tangential_extension
 
+// Fill the specified box with normally distributed random values, drawn from
+// the Mersenne Twister generator if rng_key is NULL and otherwise from the
+// counter-based generator, using the specified stream (see RNG::rng_stream()).
 void
-genrandn(ArrayData<NDIM, double>& data, const Box<NDIM>& box)
+genrandn(ArrayData<NDIM, double>& data,
+         const Box<NDIM>& box,
+         const unsigned int* const rng_key = NULL,
+         const unsigned int stream = 0)
 {
-    for (int depth = 0; depth < data.getDepth(); ++depth)
+    const int data_depth = data.getDepth();
+    if (!rng_key)
     {
-        for (Box<NDIM>::Iterator i(box); i; i++)
+        for (int depth = 0; depth < data_depth; ++depth)
         {
-            RNG::genrandn(&data(i(), depth));
+            for (Box<NDIM>::Iterator i(box); i; i++)
+            {
+                RNG::genrandn(&data(i(), depth));
+            }
+        }
+        return;
+    }
+
+    // Each evaluation of the generator yields four values, which are assigned
+    // to consecutive data depths.
+    double vals[4];
+    unsigned int ctr[4];
+    for (int depth = 0; depth < data_depth; depth += 4)
+    {
+        const int n_vals = std::min(4, data_depth - depth);
+        ctr[3] = (stream << 8) | static_cast<unsigned int>(depth / 4);
+        for (Box<NDIM>::Iterator b(box); b; b++)
+        {
+            const Index<NDIM>& i = b();
+            ctr[0] = static_cast<unsigned int>(i(0));
+            ctr[1] = static_cast<unsigned int>(i(1));
+            ctr[2] = (NDIM > 2 ? static_cast<unsigned int>(i(NDIM - 1)) : 0U);
+            RNG::genrandn(vals, ctr, rng_key);
+            for (int k = 0; k < n_vals; ++k)
+            {
+                data(i, depth + k) = vals[k];
+            }
         }
     }
     return;
@@ -191,6 +225,8 @@ INSStaggeredStochasticForcing::INSStaggeredStochasticForcing(const std::string&
       d_weights(),
       d_velocity_bc_scaling(NDIM == 2 ? 2.0 : 5.0 / 3.0),
       d_traction_bc_scaling(0.0),
+      d_use_counter_based_rng(false),
+      d_rng_key(RNG::hash_object_name(object_name)),
       d_context(NULL),
       d_W_cc_var(NULL),
       d_W_cc_idx(-1),
@@ -230,6 +266,8 @@ INSStaggeredStochasticForcing::INSStaggeredStochasticForcing(const std::string&
             d_velocity_bc_scaling = input_db->getDouble("velocity_bc_scaling");
         if (input_db->keyExists("traction_bc_scaling"))
             d_traction_bc_scaling = input_db->getDouble("traction_bc_scaling");
+        if (input_db->keyExists("use_counter_based_rng"))
+            d_use_counter_based_rng = input_db->getBool("use_counter_based_rng");
     }
 
     // Setup variables and variable context objects.
@@ -308,6 +346,10 @@ INSStaggeredStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
         // Generate random components.
         if (cycle_num == 0)
         {
+            unsigned int rng_key[2];
+            rng_key[0] = RNG::getGlobalSeed() ^ d_rng_key;
+            rng_key[1] = static_cast<unsigned int>(d_fluid_solver->getIntegratorStep());
+            const unsigned int* const key = d_use_counter_based_rng ? rng_key : NULL;
             for (int k = 0; k < d_num_rand_vals; ++k)
             {
                 for (int level_num = coarsest_ln; level_num <= finest_ln; ++level_num)
@@ -317,16 +359,23 @@ INSStaggeredStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
                     {
                         Pointer<Patch<NDIM> > patch = level->getPatch(p());
                         Pointer<CellData<NDIM, double> > W_cc_data = patch->getPatchData(d_W_cc_idxs[k]);
-                        genrandn(W_cc_data->getArrayData(), W_cc_data->getBox());
+                        genrandn(
+                            W_cc_data->getArrayData(), W_cc_data->getBox(), key, RNG::rng_stream(k, level_num, 0));
 #if (NDIM == 2)
                         Pointer<NodeData<NDIM, double> > W_nc_data = patch->getPatchData(d_W_nc_idxs[k]);
-                        genrandn(W_nc_data->getArrayData(), NodeGeometry<NDIM>::toNodeBox(W_nc_data->getBox()));
+                        genrandn(W_nc_data->getArrayData(),
+                                 NodeGeometry<NDIM>::toNodeBox(W_nc_data->getBox()),
+                                 key,
+                                 RNG::rng_stream(k, level_num, 1));
 #endif
 #if (NDIM == 3)
                         Pointer<EdgeData<NDIM, double> > W_ec_data = patch->getPatchData(d_W_ec_idxs[k]);
                         for (int d = 0; d < NDIM; ++d)
                         {
-                            genrandn(W_ec_data->getArrayData(d), EdgeGeometry<NDIM>::toEdgeBox(W_ec_data->getBox(), d));
+                            genrandn(W_ec_data->getArrayData(d),
+                                     EdgeGeometry<NDIM>::toEdgeBox(W_ec_data->getBox(), d),
+                                     key,
+                                     RNG::rng_stream(k, level_num, 1 + d));
                         }
 #endif
                     }
@@ -197,6 +197,19 @@ StaggeredStokesBlockPreconditioner::initializeSolverState(const SAMRAIVectorReal
     return;
 } // initializeSolverState
 
+void
+StaggeredStokesBlockPreconditioner::reinitializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
+                                                            const SAMRAIVectorReal<NDIM, double>& b)
+{
+    if (d_is_initialized && d_hierarchy == x.getPatchHierarchy() && d_coarsest_ln == x.getCoarsestLevelNumber() &&
+        d_finest_ln == x.getFinestLevelNumber())
+    {
+        return;
+    }
+    initializeSolverState(x, b);
+    return;
+} // reinitializeSolverState
+
 void
 StaggeredStokesBlockPreconditioner::deallocateSolverState()
 {
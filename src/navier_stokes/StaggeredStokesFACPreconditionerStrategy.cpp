@@ -120,6 +120,7 @@ static Timer* t_restrict_residual;
 static Timer* t_prolong_error;
 static Timer* t_prolong_error_and_correct;
 static Timer* t_initialize_operator_state;
+static Timer* t_reinitialize_operator_state;
 static Timer* t_deallocate_operator_state;
 }
 
@@ -248,6 +249,8 @@ StaggeredStokesFACPreconditionerStrategy::StaggeredStokesFACPreconditionerStrate
             TimerManager::getManager()->getTimer("StaggeredStokesFACPreconditionerStrategy::prolongErrorAndCorrect()");
         t_initialize_operator_state =
             TimerManager::getManager()->getTimer("StaggeredStokesFACPreconditionerStrategy::initializeOperatorState()");
+        t_reinitialize_operator_state = TimerManager::getManager()->getTimer(
+            "StaggeredStokesFACPreconditionerStrategy::reinitializeOperatorState()");
         t_deallocate_operator_state = TimerManager::getManager()->getTimer(
             "StaggeredStokesFACPreconditionerStrategy::deallocateOperatorState()"););
     return;
@@ -910,6 +913,46 @@ StaggeredStokesFACPreconditionerStrategy::initializeOperatorState(const SAMRAIVe
     return;
 } // initializeOperatorState
 
+void
+StaggeredStokesFACPreconditionerStrategy::reinitializeOperatorState(const SAMRAIVectorReal<NDIM, double>& solution,
+                                                                    const SAMRAIVectorReal<NDIM, double>& rhs)
+{
+    // Fall back on a full initialization when the hierarchy configuration has
+    // changed or when only a subset of levels is to be reset.
+    if (!d_is_initialized || d_hierarchy != solution.getPatchHierarchy() ||
+        d_coarsest_ln != solution.getCoarsestLevelNumber() || d_finest_ln != solution.getFinestLevelNumber() ||
+        d_coarsest_reset_ln != -1 || d_finest_reset_ln != -1)
+    {
+        initializeOperatorState(solution, rhs);
+        return;
+    }
+
+    IBAMR_TIMER_START(t_reinitialize_operator_state);
+
+    // Refresh the coarse level solver.  The cloned solution and rhs vectors,
+    // the scratch data, and the transfer operators and schedules only depend on
+    // the hierarchy configuration and are reused.
+    if (!d_coarse_solver_init_subclass && d_coarse_solver_type != "LEVEL_SMOOTHER")
+    {
+#if !defined(NDEBUG)
+        TBOX_ASSERT(d_coarse_solver);
+#endif
+        d_coarse_solver->setSolutionTime(d_solution_time);
+        d_coarse_solver->setTimeInterval(d_current_time, d_new_time);
+        d_coarse_solver->setVelocityPoissonSpecifications(d_U_problem_coefs);
+        d_coarse_solver->setPhysicalBcCoefs(d_U_bc_coefs, d_P_bc_coef);
+        d_coarse_solver->setPhysicalBoundaryHelper(d_bc_helper);
+        d_coarse_solver->reinitializeSolverState(*getLevelSAMRAIVectorReal(*d_solution, d_coarsest_ln),
+                                                 *getLevelSAMRAIVectorReal(*d_rhs, d_coarsest_ln));
+    }
+
+    // Perform implementation-specific reinitialization.
+    reinitializeOperatorStateSpecialized(solution, rhs);
+
+    IBAMR_TIMER_STOP(t_reinitialize_operator_state);
+    return;
+} // reinitializeOperatorState
+
 void
 StaggeredStokesFACPreconditionerStrategy::deallocateOperatorState()
 {
@@ -992,6 +1035,16 @@ StaggeredStokesFACPreconditionerStrategy::deallocateOperatorState()
 
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
+void
+StaggeredStokesFACPreconditionerStrategy::reinitializeOperatorStateSpecialized(
+    const SAMRAIVectorReal<NDIM, double>& solution,
+    const SAMRAIVectorReal<NDIM, double>& rhs)
+{
+    deallocateOperatorStateSpecialized(d_coarsest_ln, d_finest_ln);
+    initializeOperatorStateSpecialized(solution, rhs, d_coarsest_ln, d_finest_ln);
+    return;
+} // reinitializeOperatorStateSpecialized
+
 void
 StaggeredStokesFACPreconditionerStrategy::xeqScheduleProlongation(const std::pair<int, int>& dst_idxs,
                                                                   const std::pair<int, int>& src_idxs,
@@ -372,6 +372,28 @@ StaggeredStokesLevelRelaxationFACOperator::initializeOperatorStateSpecialized(
     return;
 } // initializeOperatorStateSpecialized
 
+void
+StaggeredStokesLevelRelaxationFACOperator::reinitializeOperatorStateSpecialized(
+    const SAMRAIVectorReal<NDIM, double>& /*solution*/,
+    const SAMRAIVectorReal<NDIM, double>& /*rhs*/)
+{
+    for (int ln = std::max(0, d_coarsest_ln); ln <= d_finest_ln; ++ln)
+    {
+        Pointer<StaggeredStokesSolver>& level_solver = d_level_solvers[ln];
+#if !defined(NDEBUG)
+        TBOX_ASSERT(level_solver);
+#endif
+        level_solver->setSolutionTime(d_solution_time);
+        level_solver->setTimeInterval(d_current_time, d_new_time);
+        level_solver->setVelocityPoissonSpecifications(d_U_problem_coefs);
+        level_solver->setPhysicalBcCoefs(d_U_bc_coefs, d_P_bc_coef);
+        level_solver->setPhysicalBoundaryHelper(d_bc_helper);
+        level_solver->reinitializeSolverState(*getLevelSAMRAIVectorReal(*d_solution, ln),
+                                              *getLevelSAMRAIVectorReal(*d_rhs, ln));
+    }
+    return;
+} // reinitializeOperatorStateSpecialized
+
 void
 StaggeredStokesLevelRelaxationFACOperator::deallocateOperatorStateSpecialized(const int coarsest_reset_ln,
                                                                               const int finest_reset_ln)
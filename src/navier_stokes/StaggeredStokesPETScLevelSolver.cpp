@@ -255,6 +255,26 @@ StaggeredStokesPETScLevelSolver::initializeSolverStateSpecialized(const SAMRAIVe
     return;
 } // initializeSolverStateSpecialized
 
+bool
+StaggeredStokesPETScLevelSolver::reinitializeSolverStateSpecialized(const SAMRAIVectorReal<NDIM, double>& /*x*/,
+                                                                    const SAMRAIVectorReal<NDIM, double>& /*b*/)
+{
+    // The DOF indices, and hence the nonzero structure of the matrix, only
+    // depend on the patch level, so only the matrix entries need to be reset.
+    if (!d_petsc_mat) return false;
+    StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp(d_petsc_mat,
+                                                                     d_U_problem_coefs,
+                                                                     d_U_bc_coefs,
+                                                                     d_new_time,
+                                                                     d_num_dofs_per_proc,
+                                                                     d_u_dof_index_idx,
+                                                                     d_p_dof_index_idx,
+                                                                     d_level,
+                                                                     /*reuse_nonzero_structure*/ true);
+    d_petsc_pc = d_petsc_mat;
+    return true;
+} // reinitializeSolverStateSpecialized
+
 void
 StaggeredStokesPETScLevelSolver::deallocateSolverStateSpecialized()
 {
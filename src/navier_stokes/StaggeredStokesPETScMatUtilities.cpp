@@ -106,10 +106,14 @@ StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp(
     const std::vector<int>& num_dofs_per_proc,
     int u_dof_index_idx,
     int p_dof_index_idx,
-    Pointer<PatchLevel<NDIM> > patch_level)
+    Pointer<PatchLevel<NDIM> > patch_level,
+    const bool reuse_nonzero_structure)
 {
     int ierr;
-    if (mat)
+#if !defined(NDEBUG)
+    if (reuse_nonzero_structure) TBOX_ASSERT(mat);
+#endif
+    if (mat && !reuse_nonzero_structure)
     {
         ierr = MatDestroy(&mat);
         IBTK_CHKERRQ(ierr);
@@ -153,30 +157,48 @@ StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp(
     const int iupper = ilower + nlocal;
     const int ntotal = std::accumulate(num_dofs_per_proc.begin(), num_dofs_per_proc.end(), 0);
 
-    // Determine the non-zero structure of the matrix.
-    std::vector<int> d_nnz(nlocal, 0), o_nnz(nlocal, 0);
-    for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
+    // Determine the non-zero structure of the matrix and create an empty
+    // matrix, unless the existing matrix is to be refilled in place.  All
+    // stencil entries are always inserted, so that the nonzero structure only
+    // depends on the DOF indices and not on the problem coefficients.
+    if (!reuse_nonzero_structure)
     {
-        Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
-        const Box<NDIM>& patch_box = patch->getBox();
-        Pointer<SideData<NDIM, int> > u_dof_index_data = patch->getPatchData(u_dof_index_idx);
-        Pointer<CellData<NDIM, int> > p_dof_index_data = patch->getPatchData(p_dof_index_idx);
-        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        std::vector<int> d_nnz(nlocal, 0), o_nnz(nlocal, 0);
+        for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
         {
-            for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch_box, axis)); b; b++)
+            Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<SideData<NDIM, int> > u_dof_index_data = patch->getPatchData(u_dof_index_idx);
+            Pointer<CellData<NDIM, int> > p_dof_index_data = patch->getPatchData(p_dof_index_idx);
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
-                const CellIndex<NDIM>& ic = b();
-                const SideIndex<NDIM> is(ic, axis, SideIndex<NDIM>::Lower);
-                const int u_dof_index = (*u_dof_index_data)(is);
-                if (UNLIKELY(ilower > u_dof_index || u_dof_index >= iupper)) continue;
-                const int u_local_idx = u_dof_index - ilower;
-                d_nnz[u_local_idx] += 1;
-                for (unsigned int d = 0, uu_stencil_index = 1; d < NDIM; ++d)
+                for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch_box, axis)); b; b++)
                 {
-                    for (int side = 0; side <= 1; ++side, ++uu_stencil_index)
+                    const CellIndex<NDIM>& ic = b();
+                    const SideIndex<NDIM> is(ic, axis, SideIndex<NDIM>::Lower);
+                    const int u_dof_index = (*u_dof_index_data)(is);
+                    if (UNLIKELY(ilower > u_dof_index || u_dof_index >= iupper)) continue;
+                    const int u_local_idx = u_dof_index - ilower;
+                    d_nnz[u_local_idx] += 1;
+                    for (unsigned int d = 0, uu_stencil_index = 1; d < NDIM; ++d)
                     {
-                        const int uu_dof_index = (*u_dof_index_data)(is + uu_stencil[uu_stencil_index]);
-                        if (LIKELY(uu_dof_index >= ilower && uu_dof_index < iupper))
+                        for (int side = 0; side <= 1; ++side, ++uu_stencil_index)
+                        {
+                            const int uu_dof_index = (*u_dof_index_data)(is + uu_stencil[uu_stencil_index]);
+                            if (LIKELY(uu_dof_index >= ilower && uu_dof_index < iupper))
+                            {
+                                d_nnz[u_local_idx] += 1;
+                            }
+                            else
+                            {
+                                o_nnz[u_local_idx] += 1;
+                            }
+                        }
+                    }
+                    for (int side = 0, up_stencil_index = 0; side <= 1; ++side, ++up_stencil_index)
+                    {
+                        const int up_dof_index = (*p_dof_index_data)(ic + up_stencil[axis][up_stencil_index]);
+                        if (LIKELY(up_dof_index >= ilower && up_dof_index < iupper))
                         {
                             d_nnz[u_local_idx] += 1;
                         }
@@ -185,71 +207,59 @@ StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp(
                             o_nnz[u_local_idx] += 1;
                         }
                     }
+                    d_nnz[u_local_idx] = std::min(nlocal, d_nnz[u_local_idx]);
+                    o_nnz[u_local_idx] = std::min(ntotal - nlocal, o_nnz[u_local_idx]);
                 }
-                for (int side = 0, up_stencil_index = 0; side <= 1; ++side, ++up_stencil_index)
-                {
-                    const int up_dof_index = (*p_dof_index_data)(ic + up_stencil[axis][up_stencil_index]);
-                    if (LIKELY(up_dof_index >= ilower && up_dof_index < iupper))
-                    {
-                        d_nnz[u_local_idx] += 1;
-                    }
-                    else
-                    {
-                        o_nnz[u_local_idx] += 1;
-                    }
-                }
-                d_nnz[u_local_idx] = std::min(nlocal, d_nnz[u_local_idx]);
-                o_nnz[u_local_idx] = std::min(ntotal - nlocal, o_nnz[u_local_idx]);
             }
-        }
-        for (Box<NDIM>::Iterator b(CellGeometry<NDIM>::toCellBox(patch_box)); b; b++)
-        {
-            const CellIndex<NDIM>& ic = b();
-            const int p_dof_index = (*p_dof_index_data)(ic);
-            if (UNLIKELY(ilower > p_dof_index || p_dof_index >= iupper)) continue;
-            const int p_local_idx = p_dof_index - ilower;
-            d_nnz[p_local_idx] += 1;
-            for (unsigned int axis = 0, pu_stencil_index = 0; axis < NDIM; ++axis)
+            for (Box<NDIM>::Iterator b(CellGeometry<NDIM>::toCellBox(patch_box)); b; b++)
             {
-                for (int side = 0; side <= 1; ++side, ++pu_stencil_index)
+                const CellIndex<NDIM>& ic = b();
+                const int p_dof_index = (*p_dof_index_data)(ic);
+                if (UNLIKELY(ilower > p_dof_index || p_dof_index >= iupper)) continue;
+                const int p_local_idx = p_dof_index - ilower;
+                d_nnz[p_local_idx] += 1;
+                for (unsigned int axis = 0, pu_stencil_index = 0; axis < NDIM; ++axis)
                 {
-                    const int pu_dof_index = (*u_dof_index_data)(
-                        SideIndex<NDIM>(ic + pu_stencil[pu_stencil_index], axis, SideIndex<NDIM>::Lower));
-                    if (LIKELY(pu_dof_index >= ilower && pu_dof_index < iupper))
-                    {
-                        d_nnz[p_local_idx] += 1;
-                    }
-                    else
+                    for (int side = 0; side <= 1; ++side, ++pu_stencil_index)
                     {
-                        o_nnz[p_local_idx] += 1;
+                        const int pu_dof_index = (*u_dof_index_data)(
+                            SideIndex<NDIM>(ic + pu_stencil[pu_stencil_index], axis, SideIndex<NDIM>::Lower));
+                        if (LIKELY(pu_dof_index >= ilower && pu_dof_index < iupper))
+                        {
+                            d_nnz[p_local_idx] += 1;
+                        }
+                        else
+                        {
+                            o_nnz[p_local_idx] += 1;
+                        }
                     }
                 }
+                d_nnz[p_local_idx] = std::min(nlocal, d_nnz[p_local_idx]);
+                o_nnz[p_local_idx] = std::min(ntotal - nlocal, o_nnz[p_local_idx]);
             }
-            d_nnz[p_local_idx] = std::min(nlocal, d_nnz[p_local_idx]);
-            o_nnz[p_local_idx] = std::min(ntotal - nlocal, o_nnz[p_local_idx]);
         }
-    }
 
-    // Create an empty matrix.
-    ierr = MatCreateAIJ(PETSC_COMM_WORLD,
-                        nlocal,
-                        nlocal,
-                        PETSC_DETERMINE,
-                        PETSC_DETERMINE,
-                        0,
-                        nlocal ? &d_nnz[0] : NULL,
-                        0,
-                        nlocal ? &o_nnz[0] : NULL,
-                        &mat);
-    IBTK_CHKERRQ(ierr);
+        // Create an empty matrix.
+        ierr = MatCreateAIJ(PETSC_COMM_WORLD,
+                            nlocal,
+                            nlocal,
+                            PETSC_DETERMINE,
+                            PETSC_DETERMINE,
+                            0,
+                            nlocal ? &d_nnz[0] : NULL,
+                            0,
+                            nlocal ? &o_nnz[0] : NULL,
+                            &mat);
+        IBTK_CHKERRQ(ierr);
 
 // Set some general matrix options.
 #if !defined(NDEBUG)
-    ierr = MatSetOption(mat, MAT_NEW_NONZERO_LOCATION_ERR, PETSC_TRUE);
-    IBTK_CHKERRQ(ierr);
-    ierr = MatSetOption(mat, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_TRUE);
-    IBTK_CHKERRQ(ierr);
+        ierr = MatSetOption(mat, MAT_NEW_NONZERO_LOCATION_ERR, PETSC_TRUE);
+        IBTK_CHKERRQ(ierr);
+        ierr = MatSetOption(mat, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_TRUE);
+        IBTK_CHKERRQ(ierr);
 #endif
+    }
 
     // Set the matrix coefficients.
     const double C = u_problem_coefs.getCConstant();
@@ -32,9 +32,17 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <stddef.h>
+#include <vector>
+
 #include "ibamr/ConvectiveOperator.h"
 #include "SAMRAIVectorReal.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
+#include "tbox/Utilities.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
@@ -45,7 +53,7 @@ namespace IBAMR
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 ConvectiveOperator::ConvectiveOperator(const std::string& object_name, const ConvectiveDifferencingType difference_form)
-    : GeneralOperator(object_name), d_difference_form(difference_form), d_u_idx(-1)
+    : GeneralOperator(object_name), d_difference_form(difference_form), d_u_idx(-1), d_thread_scratch_buffers()
 {
     // intentionally blank
     return;
@@ -97,6 +105,35 @@ ConvectiveOperator::apply(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorReal<ND
 
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
+void
+ConvectiveOperator::prepareThreadScratchBuffers()
+{
+    int num_threads = 1;
+#ifdef _OPENMP
+    num_threads = omp_get_max_threads();
+#endif
+    if (static_cast<int>(d_thread_scratch_buffers.size()) < num_threads)
+    {
+        d_thread_scratch_buffers.resize(num_threads);
+    }
+    return;
+} // prepareThreadScratchBuffers
+
+double*
+ConvectiveOperator::getThreadScratchBuffer(const size_t size)
+{
+    int thread_num = 0;
+#ifdef _OPENMP
+    thread_num = omp_get_thread_num();
+#endif
+#if !defined(NDEBUG)
+    TBOX_ASSERT(thread_num < static_cast<int>(d_thread_scratch_buffers.size()));
+#endif
+    std::vector<double>& buffer = d_thread_scratch_buffers[thread_num];
+    if (buffer.size() < size) buffer.resize(size);
+    return buffer.empty() ? NULL : &buffer[0];
+} // getThreadScratchBuffer
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 //////////////////////////////////////////////////////////////////////////////
@@ -8,6 +8,7 @@
 #include <map>
 #include <ostream>
 #include <set>
+#include <string>
 #include <vector>
 
 #include "ibamr/RNG.h"
@@ -77,6 +78,9 @@ namespace IBAMR
 static unsigned long mt[N]; /* the array for the state vector  */
 static int mti = N + 1;     /* mti==N+1 means mt[N] is not initialized */
 
+// The global seed, which is the same on all MPI processes.
+static unsigned int global_counter_seed = 4357;
+
 void
 RNG::srandgen(unsigned long seed)
 {
@@ -220,6 +224,23 @@ InvNormDist(double p)
 
     return x;
 }
+
+// Compute the high and low 32 bits of the 64-bit product of two 32-bit
+// unsigned integers using only 32-bit arithmetic.
+inline void
+mulhilo32(const unsigned int a, const unsigned int b, unsigned int* const hi, unsigned int* const lo)
+{
+    const unsigned int a_lo = a & 0xffffU, a_hi = a >> 16;
+    const unsigned int b_lo = b & 0xffffU, b_hi = b >> 16;
+    const unsigned int p0 = a_lo * b_lo;
+    const unsigned int p1 = a_lo * b_hi;
+    const unsigned int p2 = a_hi * b_lo;
+    const unsigned int p3 = a_hi * b_hi;
+    const unsigned int mid = (p0 >> 16) + (p1 & 0xffffU) + (p2 & 0xffffU);
+    *lo = ((p0 & 0xffffU) | (mid << 16)) & 0xffffffffU;
+    *hi = (p3 + (p1 >> 16) + (p2 >> 16) + (mid >> 16)) & 0xffffffffU;
+    return;
+}
 }
 
 void
@@ -262,6 +283,12 @@ RNG::parallel_seed(int global_seed)
         std::cout << "\nGlobal seed = " << seed << "\n\n";
     }
 
+    // Make the global seed available on all processes for use with the
+    // counter-based generator.
+    int counter_seed = seed;
+    MPI_Bcast(&counter_seed, 1, MPI_INT, mpi_root, MPI_COMM_WORLD);
+    global_counter_seed = static_cast<unsigned int>(counter_seed);
+
     if (size > 1)
     {
         // This is based on Mike Lijewski's code in LLNS/main.cpp
@@ -310,6 +337,89 @@ RNG::parallel_seed(int global_seed)
     return;
 } // parallel_seed
 
+unsigned int
+RNG::getGlobalSeed()
+{
+    return global_counter_seed;
+} // getGlobalSeed
+
+void
+RNG::philox4x32(const unsigned int ctr[4], const unsigned int key[2], unsigned int result[4])
+{
+    // Philox4x32-10 from J. K. Salmon, M. A. Moraes, R. O. Dror, and D. E.
+    // Shaw, "Parallel random numbers: as easy as 1, 2, 3", Proceedings of the
+    // International Conference for High Performance Computing, Networking,
+    // Storage and Analysis (SC11), 2011.
+    static const unsigned int PHILOX_M0 = 0xD2511F53U;
+    static const unsigned int PHILOX_M1 = 0xCD9E8D57U;
+    static const unsigned int PHILOX_W0 = 0x9E3779B9U;
+    static const unsigned int PHILOX_W1 = 0xBB67AE85U;
+    static const int PHILOX_ROUNDS = 10;
+    unsigned int c0 = ctr[0] & 0xffffffffU, c1 = ctr[1] & 0xffffffffU, c2 = ctr[2] & 0xffffffffU,
+                 c3 = ctr[3] & 0xffffffffU;
+    unsigned int k0 = key[0] & 0xffffffffU, k1 = key[1] & 0xffffffffU;
+    for (int round = 0; round < PHILOX_ROUNDS; ++round)
+    {
+        if (round > 0)
+        {
+            k0 = (k0 + PHILOX_W0) & 0xffffffffU;
+            k1 = (k1 + PHILOX_W1) & 0xffffffffU;
+        }
+        unsigned int hi0, lo0, hi1, lo1;
+        mulhilo32(PHILOX_M0, c0, &hi0, &lo0);
+        mulhilo32(PHILOX_M1, c2, &hi1, &lo1);
+        c0 = hi1 ^ c1 ^ k0;
+        c1 = lo1;
+        c2 = hi0 ^ c3 ^ k1;
+        c3 = lo0;
+    }
+    result[0] = c0;
+    result[1] = c1;
+    result[2] = c2;
+    result[3] = c3;
+    return;
+} // philox4x32
+
+void
+RNG::genrandn(double result[4], const unsigned int ctr[4], const unsigned int key[2])
+{
+    // Map the random integers to uniform random numbers in (0,1) and use the
+    // Box-Muller transform to obtain normally distributed values.
+    static const double TWO_TO_MINUS_32 = 2.3283064365386963e-10;
+    static const double TWO_PI = 6.283185307179586;
+    unsigned int bits[4];
+    philox4x32(ctr, key, bits);
+    for (int k = 0; k < 4; k += 2)
+    {
+        const double u0 = (static_cast<double>(bits[k]) + 0.5) * TWO_TO_MINUS_32;
+        const double u1 = (static_cast<double>(bits[k + 1]) + 0.5) * TWO_TO_MINUS_32;
+        const double r = sqrt(-2.0 * log(u0));
+        const double theta = TWO_PI * u1;
+        result[k] = r * cos(theta);
+        result[k + 1] = r * sin(theta);
+    }
+    return;
+} // genrandn
+
+unsigned int
+RNG::hash_object_name(const std::string& object_name)
+{
+    unsigned int hash = 2166136261U;
+    for (std::string::const_iterator it = object_name.begin(); it != object_name.end(); ++it)
+    {
+        hash ^= static_cast<unsigned char>(*it);
+        hash = (hash * 16777619U) & 0xffffffffU;
+    }
+    return hash;
+} // hash_object_name
+
+unsigned int
+RNG::rng_stream(const int k, const int level_num, const int component)
+{
+    return (static_cast<unsigned int>(k) << 12) | (static_cast<unsigned int>(level_num) << 4) |
+           static_cast<unsigned int>(component);
+} // rng_stream
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
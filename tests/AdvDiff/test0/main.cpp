@@ -0,0 +1,230 @@
+// Filename: main.cpp
+// Created on 17 Oct 2026
+//
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CellData.h>
+#include <CellVariable.h>
+#include <FaceVariable.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/AdvDiffSemiImplicitHierarchyIntegrator.h>
+#include <ibamr/app_namespaces.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+/*******************************************************************************
+ * Advances two transported quantities that share an advection velocity and a  *
+ * diffusion coefficient with AdvDiffSemiImplicitHierarchyIntegrator, once     *
+ * with group_compatible_quantities = FALSE and once with it set to TRUE, and  *
+ * compares the two solutions after a few time steps.  The command line is:    *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    bool test_passed = true;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "adv_diff.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const double tol = input_db->getDoubleWithDefault("TOL", 1.0e-8);
+        const int num_steps = input_db->getIntegerWithDefault("NUM_STEPS", 5);
+        const double kappa = input_db->getDouble("KAPPA");
+
+        // Create the objects that are shared by both runs.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<CartGridFunction> u_fcn = new muParserCartGridFunction(
+            "u_fcn", app_initializer->getComponentDatabase("AdvectionVelocityFunction"), grid_geometry);
+        static const int NUM_QUANTITIES = 2;
+        Pointer<CartGridFunction> Q_init[NUM_QUANTITIES];
+        for (int q = 0; q < NUM_QUANTITIES; ++q)
+        {
+            std::ostringstream init_name, init_db_name;
+            init_name << "Q" << q << "_init";
+            init_db_name << "QInitialConditions_" << q;
+            Q_init[q] = new muParserCartGridFunction(
+                init_name.str(), app_initializer->getComponentDatabase(init_db_name.str()), grid_geometry);
+        }
+
+        // Create the integrators for the ungrouped and grouped runs.  Each run
+        // has its own patch hierarchy and its own variables.
+        static const int NUM_RUNS = 2;
+        const bool group_quantities[NUM_RUNS] = { false, true };
+        const std::string run_names[NUM_RUNS] = { "ungrouped", "grouped" };
+        Pointer<Database> integrator_db =
+            app_initializer->getComponentDatabase("AdvDiffSemiImplicitHierarchyIntegrator");
+        Pointer<AdvDiffSemiImplicitHierarchyIntegrator> time_integrators[NUM_RUNS];
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchies[NUM_RUNS];
+        Pointer<CellVariable<NDIM, double> > Q_vars[NUM_RUNS][NUM_QUANTITIES];
+        for (int r = 0; r < NUM_RUNS; ++r)
+        {
+            const std::string& run_name = run_names[r];
+            integrator_db->putBool("group_compatible_quantities", group_quantities[r]);
+            time_integrators[r] = new AdvDiffSemiImplicitHierarchyIntegrator(
+                "AdvDiffSemiImplicitHierarchyIntegrator::" + run_name, integrator_db, /*register_for_restart*/ false);
+            patch_hierarchies[r] = new PatchHierarchy<NDIM>("PatchHierarchy::" + run_name, grid_geometry);
+            Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+                new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize::" + run_name,
+                                                   time_integrators[r],
+                                                   app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+            Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+            Pointer<LoadBalancer<NDIM> > load_balancer = new LoadBalancer<NDIM>(
+                "LoadBalancer::" + run_name, app_initializer->getComponentDatabase("LoadBalancer"));
+            Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+                new GriddingAlgorithm<NDIM>("GriddingAlgorithm::" + run_name,
+                                            app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                            error_detector,
+                                            box_generator,
+                                            load_balancer);
+
+            // Set up the advected and diffused quantities.
+            Pointer<FaceVariable<NDIM, double> > u_adv_var = new FaceVariable<NDIM, double>("u_adv::" + run_name);
+            time_integrators[r]->registerAdvectionVelocity(u_adv_var);
+            time_integrators[r]->setAdvectionVelocityFunction(u_adv_var, u_fcn);
+            for (int q = 0; q < NUM_QUANTITIES; ++q)
+            {
+                std::ostringstream Q_name;
+                Q_name << "Q" << q << "::" << run_name;
+                Q_vars[r][q] = new CellVariable<NDIM, double>(Q_name.str());
+                time_integrators[r]->registerTransportedQuantity(Q_vars[r][q]);
+                time_integrators[r]->setAdvectionVelocity(Q_vars[r][q], u_adv_var);
+                time_integrators[r]->setDiffusionCoefficient(Q_vars[r][q], kappa);
+                time_integrators[r]->setInitialConditions(Q_vars[r][q], Q_init[q]);
+            }
+
+            // Initialize hierarchy configuration and data on all patches.
+            time_integrators[r]->initializePatchHierarchy(patch_hierarchies[r], gridding_algorithm);
+        }
+        app_initializer.setNull();
+
+        // Print the input database contents to the log file.
+        plog << "Input database:\n";
+        input_db->printClassData(plog);
+
+        // Advance both runs with the same sequence of time step sizes.
+        for (int n = 0; n < num_steps; ++n)
+        {
+            double dt = std::numeric_limits<double>::max();
+            for (int r = 0; r < NUM_RUNS; ++r)
+            {
+                dt = std::min(dt, time_integrators[r]->getMaximumTimeStepSize());
+            }
+            for (int r = 0; r < NUM_RUNS; ++r)
+            {
+                time_integrators[r]->advanceHierarchy(dt);
+            }
+        }
+
+        // Compare the grouped and ungrouped solutions.  Both hierarchies are
+        // generated from the same input, so they have the same patches.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        const int finest_ln = patch_hierarchies[0]->getFinestLevelNumber();
+        if (patch_hierarchies[1]->getFinestLevelNumber() != finest_ln)
+        {
+            TBOX_ERROR("grouped and ungrouped runs use different patch hierarchies\n");
+        }
+        for (int q = 0; q < NUM_QUANTITIES; ++q)
+        {
+            int Q_idx[NUM_RUNS];
+            for (int r = 0; r < NUM_RUNS; ++r)
+            {
+                Q_idx[r] = var_db->mapVariableAndContextToIndex(Q_vars[r][q], time_integrators[r]->getCurrentContext());
+            }
+            double max_diff = 0.0, max_val = 0.0;
+            for (int ln = 0; ln <= finest_ln; ++ln)
+            {
+                Pointer<PatchLevel<NDIM> > level = patch_hierarchies[0]->getPatchLevel(ln);
+                Pointer<PatchLevel<NDIM> > grouped_level = patch_hierarchies[1]->getPatchLevel(ln);
+                for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+                {
+                    Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                    Pointer<Patch<NDIM> > grouped_patch = grouped_level->getPatch(p());
+                    const Box<NDIM>& patch_box = patch->getBox();
+                    if (!grouped_patch || !(grouped_patch->getBox() == patch_box))
+                    {
+                        TBOX_ERROR("grouped and ungrouped runs use different patch hierarchies\n");
+                    }
+                    Pointer<CellData<NDIM, double> > Q_data = patch->getPatchData(Q_idx[0]);
+                    Pointer<CellData<NDIM, double> > Q_grouped_data = grouped_patch->getPatchData(Q_idx[1]);
+                    for (Box<NDIM>::Iterator b(patch_box); b; b++)
+                    {
+                        const CellIndex<NDIM>& i = b();
+                        max_diff = std::max(max_diff, std::abs((*Q_data)(i) - (*Q_grouped_data)(i)));
+                        max_val = std::max(max_val, std::abs((*Q_data)(i)));
+                    }
+                }
+            }
+            max_diff = SAMRAI_MPI::maxReduction(max_diff);
+            max_val = SAMRAI_MPI::maxReduction(max_val);
+            const double rel_diff = max_val > 0.0 ? max_diff / max_val : max_diff;
+            pout << "Q" << q << ": relative max-norm difference between grouped and ungrouped solutions = "
+                 << rel_diff << "\n";
+            test_passed = test_passed && rel_diff <= tol;
+        }
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    pout << (test_passed ? "PASSED" : "FAILED") << "\n";
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return test_passed ? 0 : 1;
+} // main
@@ -0,0 +1,237 @@
+// Filename: main.cpp
+// Created on 17 Oct 2026
+//
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <PoissonSpecifications.h>
+#include <SAMRAIVectorReal.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CCPoissonSolverManager.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+/*******************************************************************************
+ * Checks that the threaded Chebyshev smoother used by the cell-centered       *
+ * Poisson FAC preconditioner gives results that do not depend on the number   *
+ * of OpenMP threads.  The preconditioner is applied with one thread and then  *
+ * with each of the thread counts in Main::num_threads, and the solutions are  *
+ * required to agree bitwise.                                                  *
+ *                                                                             *
+ * The command line is:                                                        *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    bool test_passed = true;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "cc_poisson.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        Pointer<Database> main_db = app_initializer->getComponentDatabase("Main");
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        Pointer<CellVariable<NDIM, double> > u_cc_var = new CellVariable<NDIM, double>("u_cc");
+        Pointer<CellVariable<NDIM, double> > f_cc_var = new CellVariable<NDIM, double>("f_cc");
+        Pointer<CellVariable<NDIM, double> > e_cc_var = new CellVariable<NDIM, double>("e_cc");
+        Pointer<CellVariable<NDIM, double> > r_cc_var = new CellVariable<NDIM, double>("r_cc");
+
+        const int u_cc_idx = var_db->registerVariableAndContext(u_cc_var, ctx, IntVector<NDIM>(1));
+        const int f_cc_idx = var_db->registerVariableAndContext(f_cc_var, ctx, IntVector<NDIM>(1));
+        const int e_cc_idx = var_db->registerVariableAndContext(e_cc_var, ctx, IntVector<NDIM>(1));
+        const int r_cc_idx = var_db->registerVariableAndContext(r_cc_var, ctx, IntVector<NDIM>(1));
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+
+        // Allocate data on each level of the patch hierarchy.
+        for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(u_cc_idx, 0.0);
+            level->allocatePatchData(f_cc_idx, 0.0);
+            level->allocatePatchData(e_cc_idx, 0.0);
+            level->allocatePatchData(r_cc_idx, 0.0);
+        }
+
+        // Setup vector objects.
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int h_cc_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+
+        SAMRAIVectorReal<NDIM, double> u_vec("u", patch_hierarchy, 0, patch_hierarchy->getFinestLevelNumber());
+        SAMRAIVectorReal<NDIM, double> f_vec("f", patch_hierarchy, 0, patch_hierarchy->getFinestLevelNumber());
+        SAMRAIVectorReal<NDIM, double> e_vec("e", patch_hierarchy, 0, patch_hierarchy->getFinestLevelNumber());
+        SAMRAIVectorReal<NDIM, double> r_vec("r", patch_hierarchy, 0, patch_hierarchy->getFinestLevelNumber());
+
+        u_vec.addComponent(u_cc_var, u_cc_idx, h_cc_idx);
+        f_vec.addComponent(f_cc_var, f_cc_idx, h_cc_idx);
+        e_vec.addComponent(e_cc_var, e_cc_idx, h_cc_idx);
+        r_vec.addComponent(r_cc_var, r_cc_idx, h_cc_idx);
+
+        // Setup the right-hand side, and ensure that it has no components in
+        // the nullspace of the operator.
+        muParserCartGridFunction f_fcn("f", app_initializer->getComponentDatabase("f"), grid_geometry);
+        f_fcn.setDataOnPatchHierarchy(f_cc_idx, f_cc_var, patch_hierarchy, 0.0);
+        r_vec.setToScalar(1.0);
+        f_vec.addScalar(Pointer<SAMRAIVectorReal<NDIM, double> >(&f_vec, false),
+                        -f_vec.dot(Pointer<SAMRAIVectorReal<NDIM, double> >(&r_vec, false)) /
+                            r_vec.dot(Pointer<SAMRAIVectorReal<NDIM, double> >(&r_vec, false)));
+
+        // Setup the FAC preconditioner.
+        PoissonSpecifications poisson_spec("poisson_spec");
+        poisson_spec.setCZero();
+        poisson_spec.setDConstant(-1.0);
+        const string precond_type = input_db->getString("precond_type");
+        Pointer<PoissonSolver> poisson_precond = CCPoissonSolverManager::getManager()->allocateSolver(
+            precond_type, "poisson_precond", input_db->getDatabase("precond_db"), "poisson_precond_");
+        poisson_precond->setPoissonSpecifications(poisson_spec);
+        poisson_precond->setMaxIterations(main_db->getIntegerWithDefault("num_cycles", 2));
+        poisson_precond->initializeSolverState(u_vec, f_vec);
+
+        // Apply the preconditioner with one thread to get the reference
+        // solution, and then with each of the requested thread counts.
+        int max_threads = 1;
+#ifdef _OPENMP
+        max_threads = omp_get_max_threads();
+#endif
+        std::vector<int> num_threads(1, max_threads);
+        if (main_db->keyExists("num_threads"))
+        {
+            num_threads.resize(main_db->getArraySize("num_threads"));
+            main_db->getIntegerArray("num_threads", &num_threads[0], static_cast<int>(num_threads.size()));
+        }
+        num_threads.insert(num_threads.begin(), 1);
+        for (unsigned int k = 0; k < num_threads.size(); ++k)
+        {
+#ifdef _OPENMP
+            omp_set_num_threads(std::max(num_threads[k], 1));
+#else
+            if (num_threads[k] > 1)
+            {
+                pout << "skipping " << num_threads[k] << " threads: OpenMP is not enabled\n";
+                continue;
+            }
+#endif
+            u_vec.setToScalar(0.0);
+            poisson_precond->solveSystem(u_vec, f_vec);
+            if (k == 0)
+            {
+                r_vec.copyVector(Pointer<SAMRAIVectorReal<NDIM, double> >(&u_vec, false));
+                pout << "|u|_oo = " << u_vec.maxNorm() << " with 1 thread\n";
+                continue;
+            }
+            e_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&u_vec, false),
+                           Pointer<SAMRAIVectorReal<NDIM, double> >(&r_vec, false));
+            const double diff = e_vec.maxNorm();
+            pout << "|u - u_1|_oo = " << diff << " with " << num_threads[k] << " threads\n";
+            if (diff != 0.0) test_passed = false;
+        }
+#ifdef _OPENMP
+        omp_set_num_threads(max_threads);
+#endif
+        poisson_precond->deallocateSolverState();
+
+        pout << (test_passed ? "PASSED" : "FAILED") << ": Chebyshev smoother results are "
+             << (test_passed ? "" : "not ") << "independent of the number of threads\n";
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return test_passed ? 0 : 1;
+} // main
@@ -0,0 +1,134 @@
+// Filename: main.cpp
+// Created on 17 Oct 2026
+//
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/RNG.h>
+
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+namespace
+{
+// Known-answer vectors for Philox4x32-10 from the Random123 distribution
+// (kat_vectors): counter, key, and expected result.
+static const int NUM_PHILOX_KATS = 3;
+static const unsigned int PHILOX_KAT_CTR[NUM_PHILOX_KATS][4] = {
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },
+    { 0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU },
+    { 0x243f6a88U, 0x85a308d3U, 0x13198a2eU, 0x03707344U }
+};
+static const unsigned int PHILOX_KAT_KEY[NUM_PHILOX_KATS][2] = {
+    { 0x00000000U, 0x00000000U },
+    { 0xffffffffU, 0xffffffffU },
+    { 0xa4093822U, 0x299f31d0U }
+};
+static const unsigned int PHILOX_KAT_RESULT[NUM_PHILOX_KATS][4] = {
+    { 0x6627e8d5U, 0xe169c58dU, 0xbc57ac4cU, 0x9b00dbd8U },
+    { 0x408f276dU, 0x41c83b0eU, 0xa20bc7c6U, 0x6d5451fdU },
+    { 0xd16cfe09U, 0x94fdccebU, 0x5001e420U, 0x24126ea1U }
+};
+
+// Known-answer vectors for the 32-bit FNV-1a hash.
+static const int NUM_FNV_KATS = 3;
+static const char* const FNV_KAT_INPUT[NUM_FNV_KATS] = { "", "a", "foobar" };
+static const unsigned int FNV_KAT_RESULT[NUM_FNV_KATS] = { 0x811c9dc5U, 0xe40c292cU, 0xbf9cf968U };
+}
+
+/*******************************************************************************
+ * Checks the counter-based random number generator in class RNG against       *
+ * published known-answer vectors.  The command line is:                       *
+ *                                                                             *
+ *    executable                                                               *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int /*argc*/, char* /*argv*/ [])
+{
+    bool test_passed = true;
+    std::cout << std::hex << std::setfill('0');
+
+    // Check RNG::philox4x32().
+    for (int n = 0; n < NUM_PHILOX_KATS; ++n)
+    {
+        unsigned int result[4];
+        RNG::philox4x32(PHILOX_KAT_CTR[n], PHILOX_KAT_KEY[n], result);
+        bool kat_passed = true;
+        for (int k = 0; k < 4; ++k)
+        {
+            kat_passed = kat_passed && (result[k] == PHILOX_KAT_RESULT[n][k]);
+        }
+        std::cout << "philox4x32 vector " << n << ":";
+        for (int k = 0; k < 4; ++k) std::cout << " " << std::setw(8) << result[k];
+        std::cout << (kat_passed ? "  ok" : "  MISMATCH") << "\n";
+        test_passed = test_passed && kat_passed;
+    }
+
+    // Check RNG::hash_object_name().
+    for (int n = 0; n < NUM_FNV_KATS; ++n)
+    {
+        const unsigned int hash = RNG::hash_object_name(FNV_KAT_INPUT[n]);
+        const bool kat_passed = (hash == FNV_KAT_RESULT[n]);
+        std::cout << "hash_object_name(\"" << FNV_KAT_INPUT[n] << "\"): " << std::setw(8) << hash
+                  << (kat_passed ? "  ok" : "  MISMATCH") << "\n";
+        test_passed = test_passed && kat_passed;
+    }
+
+    // Check that RNG::genrandn() is a pure function of the counter and key,
+    // and that it yields finite values.
+    {
+        double vals0[4], vals1[4];
+        RNG::genrandn(vals0, PHILOX_KAT_CTR[2], PHILOX_KAT_KEY[2]);
+        RNG::genrandn(vals1, PHILOX_KAT_CTR[2], PHILOX_KAT_KEY[2]);
+        bool check_passed = true;
+        for (int k = 0; k < 4; ++k)
+        {
+            check_passed = check_passed && (vals0[k] == vals1[k]) && (std::abs(vals0[k]) < 10.0);
+        }
+        std::cout << "genrandn is reproducible and finite:" << (check_passed ? "  ok" : "  FAILED") << "\n";
+        test_passed = test_passed && check_passed;
+    }
+
+    std::cout << (test_passed ? "PASSED" : "FAILED") << "\n";
+    return test_passed ? 0 : 1;
+} // main
@@ -0,0 +1,277 @@
+// Filename: main.cpp
+// Created on 17 Oct 2026
+//
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscmat.h>
+#include <petscsys.h>
+#include <petscvec.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBImplicitStaggeredHierarchyIntegrator.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBStandardForceGen.h>
+#include <ibamr/IBStandardInitializer.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+#include <ibamr/app_namespaces.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/muParserRobinBcCoefs.h>
+
+// Function prototypes
+double compare_force_jacobians(Mat A_mat, Mat J_mat, Vec V_vec);
+Mat assemble_force_jacobian(Pointer<IBStandardForceGen> ib_force_fcn,
+                            Pointer<LData> X_data,
+                            Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
+                            LDataManager* l_data_manager,
+                            double data_time);
+
+/*******************************************************************************
+ * Compares the action of the matrix-free force Jacobian provided by IBMethod  *
+ * (MATSHELL, which calls IBMethod::applyForceJacobian()) with that of the     *
+ * assembled force Jacobian computed by IBStandardForceGen, at the initial     *
+ * configuration and at a perturbed configuration.  The command line is:       *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+    SAMRAIManager::setMaxNumberPatchDataEntries(2056);
+
+    bool test_passed = true;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const double tol = input_db->getDoubleWithDefault("TOL", 1.0e-10);
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<INSStaggeredHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBMethod> ib_method_ops = new IBMethod("IBMethod", app_initializer->getComponentDatabase("IBMethod"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBImplicitStaggeredHierarchyIntegrator("IBHierarchyIntegrator",
+                                                       app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                                       ib_method_ops,
+                                                       navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IB solver.
+        Pointer<IBStandardInitializer> ib_initializer = new IBStandardInitializer(
+            "IBStandardInitializer", app_initializer->getComponentDatabase("IBStandardInitializer"));
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+        Pointer<IBStandardForceGen> ib_force_fcn = new IBStandardForceGen();
+        ib_method_ops->registerIBLagrangianForceFunction(ib_force_fcn);
+
+        // Create Eulerian boundary condition specification objects.
+        vector<RobinBcCoefStrategy<NDIM>*> u_bc_coefs(NDIM);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            ostringstream bc_coefs_name_stream;
+            bc_coefs_name_stream << "u_bc_coefs_" << d;
+            const string bc_coefs_name = bc_coefs_name_stream.str();
+
+            ostringstream bc_coefs_db_name_stream;
+            bc_coefs_db_name_stream << "VelocityBcCoefs_" << d;
+            const string bc_coefs_db_name = bc_coefs_db_name_stream.str();
+
+            u_bc_coefs[d] = new muParserRobinBcCoefs(
+                bc_coefs_name, app_initializer->getComponentDatabase(bc_coefs_db_name), grid_geometry);
+        }
+        navier_stokes_integrator->registerPhysicalBoundaryConditions(u_bc_coefs);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Deallocate initialization objects.
+        ib_method_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+        app_initializer.setNull();
+
+        // Set up the Lagrangian data and force function for the first time step.
+        const double loop_time = time_integrator->getIntegratorTime();
+        const double dt = time_integrator->getMaximumTimeStepSize();
+        ib_method_ops->preprocessIntegrateData(loop_time, loop_time + dt, /*num_cycles*/ 1);
+
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        LDataManager* l_data_manager = ib_method_ops->getLDataManager();
+        Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, finest_ln);
+        Vec X_vec = X_data->getVec();
+
+        // Random direction in which to apply the Jacobians.
+        Vec V_vec;
+        VecDuplicate(X_vec, &V_vec);
+        PetscRandom rctx;
+        PetscRandomCreate(PETSC_COMM_WORLD, &rctx);
+        PetscRandomSetFromOptions(rctx);
+        VecSetRandom(V_vec, rctx);
+
+        // Compare the Jacobians at the initial configuration.  The matrix-free
+        // Jacobian is applied twice so that the second product reuses the data
+        // set up by IBMethod::setLinearizedPosition().
+        ib_method_ops->setLinearizedPosition(X_vec, loop_time);
+        Mat A_mat = NULL;
+        ib_method_ops->constructLagrangianForceJacobian(A_mat, MATSHELL, loop_time);
+        Mat J_mat = assemble_force_jacobian(ib_force_fcn, X_data, patch_hierarchy, l_data_manager, loop_time);
+        for (int k = 0; k < 2; ++k)
+        {
+            const double rel_err = compare_force_jacobians(A_mat, J_mat, V_vec);
+            pout << "initial configuration, product " << k << ": relative error = " << rel_err << "\n";
+            test_passed = test_passed && rel_err < tol;
+        }
+        MatDestroy(&J_mat);
+
+        // Compare the Jacobians at a perturbed configuration, which must not
+        // reuse the data set up for the initial configuration.
+        Vec X_perturbed_vec;
+        VecDuplicate(X_vec, &X_perturbed_vec);
+        VecSetRandom(X_perturbed_vec, rctx);
+        VecAYPX(X_perturbed_vec, 1.0e-3, X_vec);
+        Pointer<LData> X_perturbed_data = new LData("X_perturbed", X_perturbed_vec, std::vector<int>(), false);
+        ib_method_ops->setLinearizedPosition(X_perturbed_vec, loop_time);
+        J_mat = assemble_force_jacobian(ib_force_fcn, X_perturbed_data, patch_hierarchy, l_data_manager, loop_time);
+        {
+            const double rel_err = compare_force_jacobians(A_mat, J_mat, V_vec);
+            pout << "perturbed configuration: relative error = " << rel_err << "\n";
+            test_passed = test_passed && rel_err < tol;
+        }
+        MatDestroy(&J_mat);
+        MatDestroy(&A_mat);
+
+        X_perturbed_data.setNull();
+        VecDestroy(&X_perturbed_vec);
+        VecDestroy(&V_vec);
+        PetscRandomDestroy(&rctx);
+
+        // Cleanup Eulerian boundary condition specification objects.
+        for (unsigned int d = 0; d < NDIM; ++d) delete u_bc_coefs[d];
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    pout << (test_passed ? "PASSED" : "FAILED") << "\n";
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return test_passed ? 0 : 1;
+} // main
+
+Mat
+assemble_force_jacobian(Pointer<IBStandardForceGen> ib_force_fcn,
+                        Pointer<LData> X_data,
+                        Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
+                        LDataManager* l_data_manager,
+                        const double data_time)
+{
+    const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+    const int num_local_nodes = l_data_manager->getNumberOfLocalNodes(finest_ln);
+    std::vector<int> d_nnz, o_nnz;
+    ib_force_fcn->computeLagrangianForceJacobianNonzeroStructure(
+        d_nnz, o_nnz, patch_hierarchy, finest_ln, l_data_manager);
+    Mat J_mat;
+    MatCreateBAIJ(PETSC_COMM_WORLD,
+                  NDIM,
+                  NDIM * num_local_nodes,
+                  NDIM * num_local_nodes,
+                  PETSC_DETERMINE,
+                  PETSC_DETERMINE,
+                  0,
+                  num_local_nodes ? &d_nnz[0] : NULL,
+                  0,
+                  num_local_nodes ? &o_nnz[0] : NULL,
+                  &J_mat);
+    ib_force_fcn->computeLagrangianForceJacobian(J_mat,
+                                                 MAT_FINAL_ASSEMBLY,
+                                                 1.0,
+                                                 X_data,
+                                                 0.0,
+                                                 Pointer<LData>(NULL),
+                                                 patch_hierarchy,
+                                                 finest_ln,
+                                                 data_time,
+                                                 l_data_manager);
+    return J_mat;
+} // assemble_force_jacobian
+
+double
+compare_force_jacobians(Mat A_mat, Mat J_mat, Vec V_vec)
+{
+    Vec A_V_vec, J_V_vec;
+    VecDuplicate(V_vec, &A_V_vec);
+    VecDuplicate(V_vec, &J_V_vec);
+    MatMult(A_mat, V_vec, A_V_vec);
+    MatMult(J_mat, V_vec, J_V_vec);
+    double J_V_norm, err_norm;
+    VecNorm(J_V_vec, NORM_2, &J_V_norm);
+    VecAXPY(A_V_vec, -1.0, J_V_vec);
+    VecNorm(A_V_vec, NORM_2, &err_norm);
+    VecDestroy(&A_V_vec);
+    VecDestroy(&J_V_vec);
+    return J_V_norm > 0.0 ? err_norm / J_V_norm : err_norm;
+} // compare_force_jacobians
@@ -0,0 +1,628 @@
+// Filename: main.cpp
+// Created on 17 Oct 2026
+//
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CellVariable.h>
+#include <HierarchySideDataOpsReal.h>
+#include <LoadBalancer.h>
+#include <PoissonSpecifications.h>
+#include <SAMRAIVectorReal.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+
+#ifdef IB_CORE_BENCHMARK_FE
+// Headers for basic libMesh objects
+#include <libmesh/equation_systems.h>
+#include <libmesh/mesh.h>
+#include <libmesh/mesh_generation.h>
+#endif
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBRedundantInitializer.h>
+#include <ibamr/IBStandardForceGen.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CCPoissonSolverManager.h>
+#ifdef IB_CORE_BENCHMARK_FE
+#include <ibtk/FEDataManager.h>
+#endif
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/LEInteractor.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// The synthetic structure is a uniform lattice of markers that fills a box
+// centered in the unit domain.  Neighboring markers along the first coordinate
+// direction are connected by linear springs.
+int finest_ln;
+double marker_spacing;
+boost::array<int, NDIM> num_lattice_markers;
+IBTK::Point lattice_lower;
+
+void
+generate_structure(const unsigned int& /*strct_num*/,
+                   const int& ln,
+                   int& num_vertices,
+                   std::vector<IBTK::Point>& vertex_posn)
+{
+    if (ln != finest_ln)
+    {
+        num_vertices = 0;
+        vertex_posn.resize(num_vertices);
+        return;
+    }
+    num_vertices = 1;
+    for (unsigned int d = 0; d < NDIM; ++d) num_vertices *= num_lattice_markers[d];
+    vertex_posn.resize(num_vertices);
+    for (int k = 0; k < num_vertices; ++k)
+    {
+        int idx = k;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            vertex_posn[k](d) = lattice_lower(d) + marker_spacing * (idx % num_lattice_markers[d]);
+            idx /= num_lattice_markers[d];
+        }
+    }
+    return;
+} // generate_structure
+
+void
+generate_springs(
+    const unsigned int& /*strct_num*/,
+    const int& ln,
+    std::multimap<int, IBRedundantInitializer::Edge>& spring_map,
+    std::map<IBRedundantInitializer::Edge, IBRedundantInitializer::SpringSpec, IBRedundantInitializer::EdgeComp>&
+        spring_spec)
+{
+    if (ln != finest_ln) return;
+    int num_vertices = 1;
+    for (unsigned int d = 0; d < NDIM; ++d) num_vertices *= num_lattice_markers[d];
+    for (int k = 0; k < num_vertices; ++k)
+    {
+        if ((k + 1) % num_lattice_markers[0] == 0) continue;
+        IBRedundantInitializer::Edge e;
+        e.first = k;
+        e.second = k + 1;
+        spring_map.insert(std::make_pair(e.first, e));
+        IBRedundantInitializer::SpringSpec spec_data;
+        spec_data.parameters.resize(2);
+        spec_data.parameters[0] = 1.0 / marker_spacing; // spring constant
+        spec_data.parameters[1] = marker_spacing;       // resting length
+        spec_data.force_fcn_idx = 0;
+        spring_spec.insert(std::make_pair(e, spec_data));
+    }
+    return;
+} // generate_springs
+
+// Time a benchmark phase.  The reported time is the maximum over all
+// processors of the average time per repetition.
+class BenchmarkTimer
+{
+public:
+    void start()
+    {
+        SAMRAI_MPI::barrier();
+        d_start = MPI_Wtime();
+    }
+
+    double stop(const int num_reps)
+    {
+        SAMRAI_MPI::barrier();
+        const double elapsed = MPI_Wtime() - d_start;
+        return SAMRAI_MPI::maxReduction(elapsed) / static_cast<double>(num_reps);
+    }
+
+private:
+    double d_start;
+};
+
+// Report a benchmark result to the screen and, on the root processor, as one
+// JSON record per line to the output stream.
+void
+report_result(std::ofstream& os,
+              const std::string& benchmark_name,
+              const std::string& kernel_fcn,
+              const double num_items,
+              const std::string& item_name,
+              const int num_reps,
+              const double time_per_rep)
+{
+    int num_threads = 1;
+#ifdef _OPENMP
+    num_threads = omp_get_max_threads();
+#endif
+    const int num_ranks = SAMRAI_MPI::getNodes();
+    const double throughput = time_per_rep > 0.0 ? num_items / time_per_rep : 0.0;
+    pout << std::setw(24) << std::left << benchmark_name << std::setw(20) << kernel_fcn << std::right
+         << std::setw(14) << num_items << " " << item_name << "  " << std::scientific << std::setprecision(4)
+         << time_per_rep << " s/rep  " << throughput << " " << item_name << "/s\n"
+         << std::resetiosflags(std::ios::floatfield);
+    if (SAMRAI_MPI::getRank() == 0)
+    {
+        os << "{\"benchmark\": \"" << benchmark_name << "\", \"kernel\": \"" << kernel_fcn << "\", \"dim\": " << NDIM
+           << ", \"mpi_ranks\": " << num_ranks << ", \"threads\": " << num_threads << ", \"items\": " << num_items
+           << ", \"item_type\": \"" << item_name << "\", \"repetitions\": " << num_reps
+           << ", \"time_per_rep\": " << std::scientific << std::setprecision(8) << time_per_rep
+           << ", \"throughput\": " << throughput << "}\n"
+           << std::resetiosflags(std::ios::floatfield);
+    }
+    return;
+} // report_result
+
+/*******************************************************************************
+ * Micro-benchmarks for the core IB operations: force spreading, velocity      *
+ * interpolation, Lagrangian force evaluation, Lagrangian data redistribution, *
+ * and a single FAC V-cycle for the cell-centered Poisson problem.  When built *
+ * with IB_CORE_BENCHMARK_FE defined, FEDataManager force spreading and        *
+ * velocity interpolation for a finite element structure are also timed.       *
+ *                                                                             *
+ * The command line is:                                                        *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+#ifdef IB_CORE_BENCHMARK_FE
+    // Initialize libMesh, PETSc, MPI, and SAMRAI.
+    LibMeshInit init(argc, argv);
+#else
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+#endif
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "benchmark.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        Pointer<Database> bench_db = app_initializer->getComponentDatabase("Benchmark");
+
+        // Read the benchmark parameters.
+        const int num_warmup_reps = bench_db->getIntegerWithDefault("num_warmup_repetitions", 1);
+        const int num_reps = bench_db->getIntegerWithDefault("num_repetitions", 10);
+        const int num_vcycle_reps = bench_db->getIntegerWithDefault("num_vcycle_repetitions", num_reps);
+        const double markers_per_meshwidth = bench_db->getDoubleWithDefault("markers_per_meshwidth", 2.0);
+        const double lattice_width = bench_db->getDoubleWithDefault("lattice_width", 0.5);
+        const double redistribution_shift = bench_db->getDoubleWithDefault("redistribution_shift", 1.0);
+        const string output_file_name = bench_db->getStringWithDefault("output_file_name", "benchmark.json");
+        std::vector<std::string> kernel_fcns;
+        if (bench_db->keyExists("kernel_fcns"))
+        {
+            const Array<std::string> kernel_fcns_arr = bench_db->getStringArray("kernel_fcns");
+            for (int k = 0; k < kernel_fcns_arr.size(); ++k) kernel_fcns.push_back(kernel_fcns_arr[k]);
+        }
+        else
+        {
+            kernel_fcns.push_back("PIECEWISE_LINEAR");
+            kernel_fcns.push_back("IB_3");
+            kernel_fcns.push_back("IB_4");
+            kernel_fcns.push_back("IB_6");
+        }
+
+        // Setup the synthetic structure.
+        const int num_cells = input_db->getInteger("N");
+        finest_ln = input_db->getInteger("MAX_LEVELS") - 1;
+        const double dx_finest = input_db->getDouble("DX_FINEST");
+        marker_spacing = dx_finest / markers_per_meshwidth;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            num_lattice_markers[d] = static_cast<int>(floor(lattice_width / marker_spacing)) + 1;
+            lattice_lower(d) = 0.5 * (1.0 - marker_spacing * (num_lattice_markers[d] - 1));
+        }
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBMethod> ib_method_ops = new IBMethod("IBMethod", app_initializer->getComponentDatabase("IBMethod"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IB solver.
+        Pointer<IBRedundantInitializer> ib_initializer = new IBRedundantInitializer(
+            "IBRedundantInitializer", app_initializer->getComponentDatabase("IBRedundantInitializer"));
+        std::vector<std::string> struct_list_vec(1, "lattice");
+        ib_initializer->setStructureNamesOnLevel(finest_ln, struct_list_vec);
+        ib_initializer->registerInitStructureFunction(generate_structure);
+        ib_initializer->registerInitSpringDataFunction(generate_springs);
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+        Pointer<IBStandardForceGen> ib_force_fcn = new IBStandardForceGen();
+        ib_method_ops->registerIBLagrangianForceFunction(ib_force_fcn);
+
+        // Register the Eulerian data used by the benchmarks.  The ghost cell
+        // width is chosen to accommodate all of the kernel functions.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> bench_ctx = var_db->getContext("Benchmark");
+        int ghost_width = 1;
+        for (unsigned int k = 0; k < kernel_fcns.size(); ++k)
+        {
+            ghost_width = std::max(ghost_width, LEInteractor::getMinimumGhostWidth(kernel_fcns[k]));
+        }
+        Pointer<SideVariable<NDIM, double> > f_sc_var = new SideVariable<NDIM, double>("f_bench");
+        const int f_sc_idx = var_db->registerVariableAndContext(f_sc_var, bench_ctx, IntVector<NDIM>(ghost_width));
+        Pointer<CellVariable<NDIM, double> > u_cc_var = new CellVariable<NDIM, double>("u_bench");
+        Pointer<CellVariable<NDIM, double> > g_cc_var = new CellVariable<NDIM, double>("g_bench");
+        const int u_cc_idx = var_db->registerVariableAndContext(u_cc_var, bench_ctx, IntVector<NDIM>(1));
+        const int g_cc_idx = var_db->registerVariableAndContext(g_cc_var, bench_ctx, IntVector<NDIM>(1));
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Deallocate initialization objects.
+        ib_method_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+        app_initializer.setNull();
+
+        // Print the input database contents to the log file.
+        plog << "Input database:\n";
+        input_db->printClassData(plog);
+
+        const int coarsest_ln = 0;
+        finest_ln = patch_hierarchy->getFinestLevelNumber();
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(f_sc_idx, 0.0);
+            level->allocatePatchData(u_cc_idx, 0.0);
+            level->allocatePatchData(g_cc_idx, 0.0);
+        }
+        HierarchySideDataOpsReal<NDIM, double> hier_sc_data_ops(patch_hierarchy, coarsest_ln, finest_ln);
+        hier_sc_data_ops.setToScalar(f_sc_idx, 0.0, /*interior_only*/ false);
+
+        // Setup the Lagrangian data used by the benchmarks.
+        LDataManager* l_data_manager = ib_method_ops->getLDataManager();
+        Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, finest_ln);
+        Pointer<LData> U_data = l_data_manager->getLData(LDataManager::VEL_DATA_NAME, finest_ln);
+        Pointer<LData> F_data = l_data_manager->createLData("F_bench", finest_ln, NDIM);
+        Pointer<LData> ds_data = l_data_manager->createLData("ds_bench", finest_ln, 1);
+        int ierr = VecSet(F_data->getVec(), 1.0);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecSet(ds_data->getVec(), 1.0);
+        IBTK_CHKERRQ(ierr);
+        const double num_markers = l_data_manager->getNumberOfNodes(finest_ln);
+
+        std::ofstream os;
+        if (SAMRAI_MPI::getRank() == 0) os.open(output_file_name.c_str(), std::ios::app);
+        pout << "\nRunning IB core benchmarks with " << num_markers << " markers on " << SAMRAI_MPI::getNodes()
+             << " processor(s)\n\n";
+        BenchmarkTimer timer;
+
+        // Force spreading and velocity interpolation.
+        for (unsigned int k = 0; k < kernel_fcns.size(); ++k)
+        {
+            const std::string& kernel_fcn = kernel_fcns[k];
+            for (int r = 0; r < num_warmup_reps; ++r)
+            {
+                l_data_manager->spread(f_sc_idx, F_data, X_data, ds_data, kernel_fcn, NULL, finest_ln);
+            }
+            timer.start();
+            for (int r = 0; r < num_reps; ++r)
+            {
+                l_data_manager->spread(f_sc_idx, F_data, X_data, ds_data, kernel_fcn, NULL, finest_ln);
+            }
+            report_result(os, "spread", kernel_fcn, num_markers, "markers", num_reps, timer.stop(num_reps));
+
+            for (int r = 0; r < num_warmup_reps; ++r)
+            {
+                l_data_manager->interp(f_sc_idx, U_data, X_data, kernel_fcn, finest_ln);
+            }
+            timer.start();
+            for (int r = 0; r < num_reps; ++r)
+            {
+                l_data_manager->interp(f_sc_idx, U_data, X_data, kernel_fcn, finest_ln);
+            }
+            report_result(os, "interpolate", kernel_fcn, num_markers, "markers", num_reps, timer.stop(num_reps));
+        }
+
+        // Lagrangian force evaluation.
+        ib_force_fcn->initializeLevelData(patch_hierarchy, finest_ln, 0.0, false, l_data_manager);
+        for (int r = 0; r < num_warmup_reps; ++r)
+        {
+            ib_force_fcn->computeLagrangianForce(
+                F_data, X_data, U_data, patch_hierarchy, finest_ln, 0.0, l_data_manager);
+        }
+        timer.start();
+        for (int r = 0; r < num_reps; ++r)
+        {
+            ib_force_fcn->computeLagrangianForce(
+                F_data, X_data, U_data, patch_hierarchy, finest_ln, 0.0, l_data_manager);
+        }
+        report_result(os, "force", "IBStandardForceGen", num_markers, "markers", num_reps, timer.stop(num_reps));
+
+#ifdef IB_CORE_BENCHMARK_FE
+        // Force spreading and velocity interpolation for a finite element
+        // structure.  The mesh consists of first-order Lagrange elements whose
+        // nodes coincide with the markers of the synthetic lattice.
+        {
+            Mesh mesh(init.comm(), NDIM);
+            boost::array<double, NDIM> lattice_upper;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                lattice_upper[d] = lattice_lower(d) + marker_spacing * (num_lattice_markers[d] - 1);
+            }
+#if (NDIM == 2)
+            MeshTools::Generation::build_square(mesh,
+                                                num_lattice_markers[0] - 1,
+                                                num_lattice_markers[1] - 1,
+                                                lattice_lower(0),
+                                                lattice_upper[0],
+                                                lattice_lower(1),
+                                                lattice_upper[1],
+                                                QUAD4);
+#endif
+#if (NDIM == 3)
+            MeshTools::Generation::build_cube(mesh,
+                                              num_lattice_markers[0] - 1,
+                                              num_lattice_markers[1] - 1,
+                                              num_lattice_markers[2] - 1,
+                                              lattice_lower(0),
+                                              lattice_upper[0],
+                                              lattice_lower(1),
+                                              lattice_upper[1],
+                                              lattice_lower(2),
+                                              lattice_upper[2],
+                                              HEX8);
+#endif
+            const bool use_adaptive_quadrature = true;
+            const double point_density = bench_db->getDoubleWithDefault("fe_point_density", 2.0);
+            const bool use_consistent_mass_matrix =
+                bench_db->getBoolWithDefault("fe_use_consistent_mass_matrix", true);
+            const bool use_nodal_quadrature = false;
+            FEDataManager* fe_data_manager =
+                FEDataManager::getManager("Benchmark FEDataManager",
+                                          FEDataManager::InterpSpec(kernel_fcns[0],
+                                                                    QGAUSS,
+                                                                    INVALID_ORDER,
+                                                                    use_adaptive_quadrature,
+                                                                    point_density,
+                                                                    use_consistent_mass_matrix,
+                                                                    use_nodal_quadrature),
+                                          FEDataManager::SpreadSpec(kernel_fcns[0],
+                                                                    QGAUSS,
+                                                                    INVALID_ORDER,
+                                                                    use_adaptive_quadrature,
+                                                                    point_density,
+                                                                    use_nodal_quadrature),
+                                          IntVector<NDIM>(ghost_width),
+                                          /*register_for_restart*/ false);
+            EquationSystems equation_systems(mesh);
+            fe_data_manager->setPatchHierarchy(patch_hierarchy);
+            fe_data_manager->setPatchLevels(coarsest_ln, finest_ln);
+            fe_data_manager->setEquationSystems(&equation_systems, finest_ln);
+            const std::string X_system_name = fe_data_manager->COORDINATES_SYSTEM_NAME;
+            const std::string F_system_name = "force system";
+            System& X_system = equation_systems.add_system<System>(X_system_name);
+            System& F_system = equation_systems.add_system<System>(F_system_name);
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                std::ostringstream X_os, F_os;
+                X_os << "X_" << d;
+                F_os << "F_" << d;
+                X_system.add_variable(X_os.str(), FIRST, LAGRANGE);
+                F_system.add_variable(F_os.str(), FIRST, LAGRANGE);
+            }
+            equation_systems.init();
+
+            // Initialize the nodal positions and forces.
+            const unsigned int X_sys_num = X_system.number();
+            NumericVector<double>& X_vec = *X_system.solution;
+            for (MeshBase::node_iterator it = mesh.local_nodes_begin(); it != mesh.local_nodes_end(); ++it)
+            {
+                Node* n = *it;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    X_vec.set(n->dof_number(X_sys_num, d, 0), (*n)(d));
+                }
+            }
+            X_vec.close();
+            X_vec.localize(*X_system.current_local_solution);
+            NumericVector<double>& F_vec = *F_system.solution;
+            F_vec = 1.0;
+            F_vec.close();
+            fe_data_manager->reinitElementMappings();
+            NumericVector<double>* X_ghost_vec = fe_data_manager->buildGhostedCoordsVector();
+            NumericVector<double>* F_ghost_vec = fe_data_manager->buildGhostedSolutionVector(F_system_name);
+            const double num_nodes = mesh.n_nodes();
+
+            for (unsigned int k = 0; k < kernel_fcns.size(); ++k)
+            {
+                FEDataManager::SpreadSpec spread_spec = fe_data_manager->getDefaultSpreadSpec();
+                FEDataManager::InterpSpec interp_spec = fe_data_manager->getDefaultInterpSpec();
+                spread_spec.kernel_fcn = kernel_fcns[k];
+                interp_spec.kernel_fcn = kernel_fcns[k];
+                for (int r = 0; r < num_warmup_reps; ++r)
+                {
+                    fe_data_manager->spread(
+                        f_sc_idx, *F_ghost_vec, *X_ghost_vec, F_system_name, spread_spec, NULL, 0.0);
+                }
+                timer.start();
+                for (int r = 0; r < num_reps; ++r)
+                {
+                    fe_data_manager->spread(
+                        f_sc_idx, *F_ghost_vec, *X_ghost_vec, F_system_name, spread_spec, NULL, 0.0);
+                }
+                report_result(os, "fe_spread", kernel_fcns[k], num_nodes, "nodes", num_reps, timer.stop(num_reps));
+
+                for (int r = 0; r < num_warmup_reps; ++r)
+                {
+                    fe_data_manager->interp(f_sc_idx, F_vec, *X_ghost_vec, F_system_name, interp_spec);
+                }
+                timer.start();
+                for (int r = 0; r < num_reps; ++r)
+                {
+                    fe_data_manager->interp(f_sc_idx, F_vec, *X_ghost_vec, F_system_name, interp_spec);
+                }
+                report_result(
+                    os, "fe_interpolate", kernel_fcns[k], num_nodes, "nodes", num_reps, timer.stop(num_reps));
+            }
+        }
+#endif
+
+        // One V-cycle of the cell-centered Poisson FAC preconditioner.
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int h_cc_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+        SAMRAIVectorReal<NDIM, double> u_vec("u", patch_hierarchy, coarsest_ln, finest_ln);
+        SAMRAIVectorReal<NDIM, double> g_vec("g", patch_hierarchy, coarsest_ln, finest_ln);
+        u_vec.addComponent(u_cc_var, u_cc_idx, h_cc_idx);
+        g_vec.addComponent(g_cc_var, g_cc_idx, h_cc_idx);
+        u_vec.setToScalar(0.0);
+        g_vec.setToScalar(1.0);
+        double num_cells_local = 0.0;
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                num_cells_local += level->getPatch(p())->getBox().size();
+            }
+        }
+        const double num_dofs = SAMRAI_MPI::sumReduction(num_cells_local);
+        PoissonSpecifications poisson_spec("poisson_spec");
+        poisson_spec.setCZero();
+        poisson_spec.setDConstant(-1.0);
+        const string fac_precond_type =
+            bench_db->getStringWithDefault("fac_precond_type", CCPoissonSolverManager::DEFAULT_FAC_PRECONDITIONER);
+        Pointer<PoissonSolver> fac_solver = CCPoissonSolverManager::getManager()->allocateSolver(
+            fac_precond_type, "benchmark_fac", bench_db->getDatabase("fac_precond_db"), "benchmark_fac_");
+        fac_solver->setPoissonSpecifications(poisson_spec);
+        fac_solver->setMaxIterations(1);
+        fac_solver->initializeSolverState(u_vec, g_vec);
+        for (int r = 0; r < num_warmup_reps; ++r)
+        {
+            fac_solver->solveSystem(u_vec, g_vec);
+        }
+        timer.start();
+        for (int r = 0; r < num_vcycle_reps; ++r)
+        {
+            fac_solver->solveSystem(u_vec, g_vec);
+        }
+        report_result(os, "fac_vcycle", "CCPoisson", num_dofs, "dofs", num_vcycle_reps, timer.stop(num_vcycle_reps));
+        fac_solver->deallocateSolverState();
+
+        // Lagrangian data redistribution.  The markers are alternately
+        // displaced forward and backward so that they move between patches.
+        //
+        // NOTE: The redistribution invalidates the data used by the other
+        // benchmarks, so it must be run last.
+        double begin_time = 0.0, end_time = 0.0;
+        for (int r = 0; r < num_warmup_reps + num_reps; ++r)
+        {
+            X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, finest_ln);
+            ierr = VecShift(X_data->getVec(), (r % 2 == 0 ? 1.0 : -1.0) * redistribution_shift * dx_finest);
+            IBTK_CHKERRQ(ierr);
+            timer.start();
+            l_data_manager->beginDataRedistribution();
+            const double t_begin = timer.stop(1);
+            timer.start();
+            l_data_manager->endDataRedistribution();
+            const double t_end = timer.stop(1);
+            if (r >= num_warmup_reps)
+            {
+                begin_time += t_begin / static_cast<double>(num_reps);
+                end_time += t_end / static_cast<double>(num_reps);
+            }
+        }
+        report_result(os, "redistribution_begin", "LDataManager", num_markers, "markers", num_reps, begin_time);
+        report_result(os, "redistribution_end", "LDataManager", num_markers, "markers", num_reps, end_time);
+
+        pout << "\nBenchmark results for N = " << num_cells << " appended to " << output_file_name << "\n";
+        if (SAMRAI_MPI::getRank() == 0) os.close();
+
+        // Deallocate the benchmark data.
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->deallocatePatchData(f_sc_idx);
+            level->deallocatePatchData(u_cc_idx);
+            level->deallocatePatchData(g_cc_idx);
+        }
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+#ifndef IB_CORE_BENCHMARK_FE
+    PetscFinalize();
+#endif
+    return 0;
+} // main